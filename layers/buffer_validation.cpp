@@ -3821,15 +3821,99 @@ const GlobalImageLayoutRangeMap *GetLayoutRangeMap(const GlobalImageLayoutMap &m
     return nullptr;
 }
 
+// Compare the initial layouts in subres_map with the current layouts, taken from overlay_map or else from global_map, and
+// append the ranges that don't match to mismatches
+static void FindImageLayoutMismatches(const ImageSubresourceLayoutMap &subres_map, const GlobalImageLayoutRangeMap &overlay_map,
+                                      const GlobalImageLayoutRangeMap &global_map, std::vector<ImageLayoutMismatch> *mismatches) {
+    const auto &initial_layout_map = subres_map.GetInitialLayoutMap();
+    // Note: don't know if it would matter
+    // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
+
+    auto pos = initial_layout_map.begin();
+    const auto end = initial_layout_map.end();
+    sparse_container::parallel_iterator<const ImageSubresourceLayoutMap::LayoutMap> current_layout(overlay_map, global_map,
+                                                                                                   pos->first.begin);
+    while (pos != end) {
+        VkImageLayout initial_layout = pos->second;
+        VkImageLayout image_layout = kInvalidLayout;
+        if (current_layout->range.empty()) break;  // When we are past the end of data in overlay and global... stop looking
+        if (current_layout->pos_A->valid) {        // pos_A denotes the overlay map in the parallel iterator
+            image_layout = current_layout->pos_A->lower_bound->second;
+        } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
+            image_layout = current_layout->pos_B->lower_bound->second;
+        }
+        const auto intersected_range = pos->first & current_layout->range;
+        if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
+            // TODO: Set memory invalid which is in mem_tracker currently
+        } else if (image_layout != initial_layout) {
+            // Need to look up the inital layout *state* to get a bit more information
+            const auto *initial_layout_state = subres_map.GetSubresourceInitialLayoutState(pos->first.begin);
+            assert(initial_layout_state);  // There's no way we should have an initial layout without matching state...
+            bool matches = ImageLayoutMatches(initial_layout_state->aspect_mask, image_layout, initial_layout);
+            if (!matches) {
+                mismatches->push_back({intersected_range, initial_layout, image_layout});
+            }
+        }
+        if (pos->first.includes(intersected_range.end)) {
+            current_layout.seek(intersected_range.end);
+        } else {
+            ++pos;
+            if (pos != end) {
+                current_layout.seek(pos->first.begin);
+            }
+        }
+    }
+}
+
+bool CoreChecks::ReportImageLayoutMismatches(const CMD_BUFFER_STATE *pCB, const IMAGE_STATE &image_state,
+                                             const ImageLayoutMismatch *begin, const ImageLayoutMismatch *end) const {
+    bool skip = false;
+    for (const auto *mismatch = begin; mismatch != end; ++mismatch) {
+        // We can report all the errors for the intersected range directly
+        for (auto index : sparse_container::range_view<decltype(mismatch->range)>(mismatch->range)) {
+            const auto subresource = image_state.subresource_encoder.Decode(index);
+            skip |= LogError(pCB->commandBuffer, kVUID_Core_DrawState_InvalidImageLayout,
+                             "Submitted command buffer expects %s (subresource: aspectMask 0x%X array layer %u, mip level %u) "
+                             "to be in layout %s--instead, current layout is %s.",
+                             report_data->FormatHandle(image_state.image).c_str(), subresource.aspectMask, subresource.arrayLayer,
+                             subresource.mipLevel, string_VkImageLayout(mismatch->initial_layout),
+                             string_VkImageLayout(mismatch->image_layout));
+        }
+    }
+    return skip;
+}
+
+// Compare the initial layouts of pCB with the global layouts alone, as ValidateCmdBufImageLayouts does for images no earlier
+// command buffer of the submit left a layout for. Only reads state, so command buffers can be checked concurrently.
+void CoreChecks::PrecheckCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const GlobalImageLayoutMap &globalImageLayoutMap,
+                                            CmdBufImageLayoutCheck *check) const {
+    GlobalImageLayoutRangeMap empty_map(1);
+    check->image_ends.reserve(pCB->image_layout_map.size());
+    for (const auto &layout_map_entry : pCB->image_layout_map) {
+        const auto *image_state = GetImageState(layout_map_entry.first);
+        const auto &subres_map = layout_map_entry.second;
+        if (image_state && !subres_map->GetInitialLayoutMap().empty()) {
+            const GlobalImageLayoutRangeMap overlay_map(image_state->subresource_encoder.SubresourceCount());
+            const auto *global_map = GetLayoutRangeMap(globalImageLayoutMap, layout_map_entry.first);
+            FindImageLayoutMismatches(*subres_map, overlay_map, global_map ? *global_map : empty_map, &check->mismatches);
+        }
+        check->image_ends.push_back(check->mismatches.size());
+    }
+}
+
 // This validates that the initial layout specified in the command buffer for the IMAGE is the same as the global IMAGE layout
 bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const GlobalImageLayoutMap &globalImageLayoutMap,
-                                            GlobalImageLayoutMap *overlayLayoutMap_arg) const {
+                                            GlobalImageLayoutMap *overlayLayoutMap_arg,
+                                            const CmdBufImageLayoutCheck *precheck) const {
     if (disabled[image_layout_validation]) return false;
     bool skip = false;
     GlobalImageLayoutMap &overlayLayoutMap = *overlayLayoutMap_arg;
     // Iterate over the layout maps for each referenced image
     GlobalImageLayoutRangeMap empty_map(1);
+    std::vector<ImageLayoutMismatch> mismatches;
+    size_t image_index = 0;
     for (const auto &layout_map_entry : pCB->image_layout_map) {
+        const size_t precheck_index = image_index++;
         const auto image = layout_map_entry.first;
         const auto *image_state = GetImageState(image);
         if (!image_state) continue;  // Can't check layouts of a dead image
@@ -3839,56 +3923,20 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const G
         if (initial_layout_map.empty()) continue;
 
         auto *overlay_map = GetLayoutRangeMap(&overlayLayoutMap, *image_state);
-        const auto *global_map = GetLayoutRangeMap(globalImageLayoutMap, image);
-        if (global_map == nullptr) {
-            global_map = &empty_map;
-        }
-
-        // Note: don't know if it would matter
-        // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
-
-        auto pos = initial_layout_map.begin();
-        const auto end = initial_layout_map.end();
-        sparse_container::parallel_iterator<const ImageSubresourceLayoutMap::LayoutMap> current_layout(*overlay_map, *global_map,
-                                                                                                       pos->first.begin);
-        while (pos != end) {
-            VkImageLayout initial_layout = pos->second;
-            VkImageLayout image_layout = kInvalidLayout;
-            if (current_layout->range.empty()) break;  // When we are past the end of data in overlay and global... stop looking
-            if (current_layout->pos_A->valid) {        // pos_A denotes the overlay map in the parallel iterator
-                image_layout = current_layout->pos_A->lower_bound->second;
-            } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
-                image_layout = current_layout->pos_B->lower_bound->second;
-            }
-            const auto intersected_range = pos->first & current_layout->range;
-            if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
-                // TODO: Set memory invalid which is in mem_tracker currently
-            } else if (image_layout != initial_layout) {
-                // Need to look up the inital layout *state* to get a bit more information
-                const auto *initial_layout_state = subres_map->GetSubresourceInitialLayoutState(pos->first.begin);
-                assert(initial_layout_state);  // There's no way we should have an initial layout without matching state...
-                bool matches = ImageLayoutMatches(initial_layout_state->aspect_mask, image_layout, initial_layout);
-                if (!matches) {
-                    // We can report all the errors for the intersected range directly
-                    for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
-                        const auto subresource = image_state->subresource_encoder.Decode(index);
-                        skip |= LogError(
-                            pCB->commandBuffer, kVUID_Core_DrawState_InvalidImageLayout,
-                            "Submitted command buffer expects %s (subresource: aspectMask 0x%X array layer %u, mip level %u) "
-                            "to be in layout %s--instead, current layout is %s.",
-                            report_data->FormatHandle(image).c_str(), subresource.aspectMask, subresource.arrayLayer,
-                            subresource.mipLevel, string_VkImageLayout(initial_layout), string_VkImageLayout(image_layout));
-                    }
-                }
-            }
-            if (pos->first.includes(intersected_range.end)) {
-                current_layout.seek(intersected_range.end);
-            } else {
-                ++pos;
-                if (pos != end) {
-                    current_layout.seek(pos->first.begin);
-                }
+        if (precheck && overlay_map->empty()) {
+            // Nothing earlier in the submit changed this image, so the precheck against the global layouts is the answer
+            const ImageLayoutMismatch *precheck_begin = precheck->mismatches.data();
+            skip |= ReportImageLayoutMismatches(pCB, *image_state,
+                                                precheck_begin + (precheck_index ? precheck->image_ends[precheck_index - 1] : 0),
+                                                precheck_begin + precheck->image_ends[precheck_index]);
+        } else {
+            const auto *global_map = GetLayoutRangeMap(globalImageLayoutMap, image);
+            if (global_map == nullptr) {
+                global_map = &empty_map;
             }
+            mismatches.clear();
+            FindImageLayoutMismatches(*subres_map, *overlay_map, *global_map, &mismatches);
+            skip |= ReportImageLayoutMismatches(pCB, *image_state, mismatches.data(), mismatches.data() + mismatches.size());
         }
 
         // Update all layout set operations (which will be a subset of the initial_layouts)
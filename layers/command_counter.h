@@ -24,6 +24,9 @@ class CommandCounter : public ValidationObject {
     virtual ~CommandCounter() {}
 
     virtual write_lock_guard_t write_lock() { return coreChecks->write_lock(); }
+    virtual cmd_buffer_lock_guard_t cmd_buffer_write_lock(VkCommandBuffer commandBuffer) {
+        return coreChecks->cmd_buffer_write_lock(commandBuffer);
+    }
 
 #include "command_counter_helper.h"
 
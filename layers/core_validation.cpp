@@ -40,6 +40,7 @@
 #include <array>
 #include <assert.h>
 #include <cmath>
+#include <fstream>
 #include <iostream>
 #include <list>
 #include <map>
@@ -152,32 +153,35 @@ GlobalQFOTransferBarrierMap<VkBufferMemoryBarrier> &CoreChecks::GetGlobalQFORele
     return qfo_release_buffer_barrier_map;
 }
 
-static std::unique_ptr<ImageSubresourceLayoutMap> LayoutMapFactory(const IMAGE_STATE &image_state) {
-    std::unique_ptr<ImageSubresourceLayoutMap> map(new ImageSubresourceLayoutMap(image_state));
-    return map;
+ImageSubresourceLayoutMap *CommandBufferImageLayoutMap::GetOrCreate(const IMAGE_STATE &image_state) {
+    auto &entry = maps_[image_state.image];
+    if (!entry.map || (entry.generation != generation_)) {
+        // A map left from a prior recording is rebuilt, as its image may have been destroyed and the handle reused since
+        entry.map.reset(new ImageSubresourceLayoutMap(image_state, &node_pool_));
+        entry.generation = generation_;
+        live_.emplace_back(image_state.image, entry.map.get());
+    }
+    return entry.map.get();
+}
+
+void CommandBufferImageLayoutMap::Reset() {
+    if (maps_.size() > 2 * live_.size() + kMinRetainedMaps) {
+        // Each map is created once per release, so releasing them here costs amortized constant time per map
+        maps_.clear();
+        node_pool_.reset();
+    }
+    live_.clear();
+    generation_++;
 }
 
 // The const variant only need the image as it is the key for the map
 const ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(const CMD_BUFFER_STATE *cb_state, VkImage image) {
-    auto it = cb_state->image_layout_map.find(image);
-    if (it == cb_state->image_layout_map.cend()) {
-        return nullptr;
-    }
-    return it->second.get();
+    return cb_state->image_layout_map.Get(image);
 }
 
 // The non-const variant only needs the image state, as the factory requires it to construct a new entry
 ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(CMD_BUFFER_STATE *cb_state, const IMAGE_STATE &image_state) {
-    auto it = cb_state->image_layout_map.find(image_state.image);
-    if (it == cb_state->image_layout_map.end()) {
-        // Empty slot... fill it in.
-        auto insert_pair = cb_state->image_layout_map.insert(std::make_pair(image_state.image, LayoutMapFactory(image_state)));
-        assert(insert_pair.second);
-        ImageSubresourceLayoutMap *new_map = insert_pair.first->second.get();
-        assert(new_map);
-        return new_map;
-    }
-    return it->second.get();
+    return cb_state->image_layout_map.GetOrCreate(image_state);
 }
 
 void AddInitialLayoutintoImageLayoutMap(const IMAGE_STATE &image_state, GlobalImageLayoutMap &image_layout_map) {
@@ -1118,7 +1122,8 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
             // binding validation. Take the requested binding set and prefilter it to eliminate redundant validation checks.
             // Here, the currently bound pipeline determines whether an image validation check is redundant...
             // for images are the "req" portion of the binding_req is indirectly (but tightly) coupled to the pipeline.
-            cvdescriptorset::PrefilterBindRequestMap reduced_map(*descriptor_set, set_binding_pair.second);
+            cvdescriptorset::PrefilterBindRequestMap reduced_map(*descriptor_set, set_binding_pair.second,
+                                                                 GetManyDescriptorsThreshold());
             const auto &binding_req_map = reduced_map.FilteredMap(*cb_node, *pPipe);
 
             // We can skip validating the descriptor set if "nothing" has changed since the last validation.
@@ -1206,7 +1211,8 @@ bool CoreChecks::ValidatePipelineLocked(std::vector<std::shared_ptr<PIPELINE_STA
 }
 
 // UNLOCKED pipeline validation. DO NOT lookup objects in the CoreChecks->* maps in this function.
-bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint32_t pipelineIndex) const {
+bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint32_t pipelineIndex,
+                                          const ParallelStageResults *parallel_results) const {
     bool skip = false;
 
     // Ensure the subpass index is valid. If not, then ValidateGraphicsPipelineShaderState
@@ -1311,7 +1317,7 @@ bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint3
         }
     }
 
-    if (ValidateGraphicsPipelineShaderState(pPipeline)) {
+    if (ValidateGraphicsPipelineShaderState(pPipeline, parallel_results)) {
         skip = true;
     }
     // Each shader's stage must be unique
@@ -1932,6 +1938,105 @@ bool CoreChecks::ReportInvalidCommandBuffer(const CMD_BUFFER_STATE *cb_state, co
     return skip;
 }
 
+// Resources of sets recorded with lazy descriptor binding are not bound to cb_state until submit, so destroying them has not
+// invalidated it. Report them as ReportInvalidCommandBuffer would have.
+bool CoreChecks::ValidateDeferredDescriptorBindings(const CMD_BUFFER_STATE *cb_state, const char *call_source) const {
+    bool skip = false;
+    std::unordered_set<const BASE_NODE *> reported;
+    auto report_destroyed = [this, cb_state, call_source, &reported](const BASE_NODE *state, const VulkanTypedHandle &obj) {
+        if (!state || !state->destroyed || !reported.insert(state).second) return false;
+        std::ostringstream str;
+        str << kVUID_Core_DrawState_InvalidCommandBuffer << "-" << object_string[obj.type];
+        const string VUID = str.str();
+        LogObjectList objlist(cb_state->commandBuffer);
+        objlist.add(obj);
+        return LogError(objlist, VUID.c_str(), "You are adding %s to %s that is invalid because bound %s was %s.", call_source,
+                        report_data->FormatHandle(cb_state->commandBuffer).c_str(), report_data->FormatHandle(obj).c_str(),
+                        GetCauseStr(obj));
+    };
+    auto report_image_view = [&report_destroyed](const IMAGE_VIEW_STATE *iv_state) {
+        if (!iv_state) return false;
+        bool view_skip = report_destroyed(iv_state, VulkanTypedHandle(iv_state->image_view, kVulkanObjectTypeImageView));
+        const IMAGE_STATE *image_state = iv_state->image_state.get();
+        if (image_state) view_skip |= report_destroyed(image_state, VulkanTypedHandle(image_state->image, kVulkanObjectTypeImage));
+        return view_skip;
+    };
+
+    for (const auto &deferred : cb_state->deferred_descriptor_bindings) {
+        const cvdescriptorset::DescriptorSet *descriptor_set = deferred.descriptor_set.get();
+        // A freed set is reported through broken_bindings. Any other update that would change what cb_state uses invalidated
+        // it, so the set is checked as it is now.
+        if (descriptor_set->destroyed) continue;
+        const auto &layout = descriptor_set->GetLayout();
+        for (const auto &binding_req_pair : deferred.binding_req_map) {
+            const auto index = layout->GetIndexFromBinding(binding_req_pair.first);
+            if (layout->GetDescriptorBindingFlagsFromIndex(index) &
+                (VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT)) {
+                continue;
+            }
+            const auto range = layout->GetGlobalIndexRangeFromIndex(index);
+            for (uint32_t i = range.start; i < range.end; ++i) {
+                const cvdescriptorset::Descriptor *descriptor = descriptor_set->GetDescriptorFromGlobalIndex(i);
+                switch (descriptor->GetClass()) {
+                    case cvdescriptorset::PlainSampler: {
+                        const auto *sampler_descriptor = static_cast<const cvdescriptorset::SamplerDescriptor *>(descriptor);
+                        if (!sampler_descriptor->IsImmutableSampler()) {
+                            skip |= report_destroyed(sampler_descriptor->GetSamplerState(),
+                                                     VulkanTypedHandle(sampler_descriptor->GetSampler(), kVulkanObjectTypeSampler));
+                        }
+                        break;
+                    }
+                    case cvdescriptorset::ImageSampler: {
+                        const auto *image_sampler_descriptor =
+                            static_cast<const cvdescriptorset::ImageSamplerDescriptor *>(descriptor);
+                        if (!image_sampler_descriptor->IsImmutableSampler()) {
+                            skip |= report_destroyed(
+                                image_sampler_descriptor->GetSamplerState(),
+                                VulkanTypedHandle(image_sampler_descriptor->GetSampler(), kVulkanObjectTypeSampler));
+                        }
+                        skip |= report_image_view(image_sampler_descriptor->GetImageViewState());
+                        break;
+                    }
+                    case cvdescriptorset::Image: {
+                        const auto *image_descriptor = static_cast<const cvdescriptorset::ImageDescriptor *>(descriptor);
+                        skip |= report_image_view(image_descriptor->GetImageViewState());
+                        break;
+                    }
+                    case cvdescriptorset::TexelBuffer: {
+                        const BUFFER_VIEW_STATE *bv_state =
+                            static_cast<const cvdescriptorset::TexelDescriptor *>(descriptor)->GetBufferViewState();
+                        if (!bv_state) break;
+                        skip |= report_destroyed(bv_state, VulkanTypedHandle(bv_state->buffer_view, kVulkanObjectTypeBufferView));
+                        const BUFFER_STATE *buffer_state = bv_state->buffer_state.get();
+                        if (buffer_state) {
+                            skip |=
+                                report_destroyed(buffer_state, VulkanTypedHandle(buffer_state->buffer, kVulkanObjectTypeBuffer));
+                        }
+                        break;
+                    }
+                    case cvdescriptorset::GeneralBuffer: {
+                        const auto *buffer_descriptor = static_cast<const cvdescriptorset::BufferDescriptor *>(descriptor);
+                        skip |= report_destroyed(buffer_descriptor->GetBufferState(),
+                                                 VulkanTypedHandle(buffer_descriptor->GetBuffer(), kVulkanObjectTypeBuffer));
+                        break;
+                    }
+                    case cvdescriptorset::AccelerationStructure: {
+                        const auto *acc_descriptor =
+                            static_cast<const cvdescriptorset::AccelerationStructureDescriptor *>(descriptor);
+                        skip |= report_destroyed(acc_descriptor->GetAccelerationStructureState(),
+                                                 VulkanTypedHandle(acc_descriptor->GetAccelerationStructure(),
+                                                                   kVulkanObjectTypeAccelerationStructureNV));
+                        break;
+                    }
+                    default:
+                        break;
+                }
+            }
+        }
+    }
+    return skip;
+}
+
 // 'commandBuffer must be in the recording state' valid usage error code for each command
 // Autogenerated as part of the vk_validation_error_message.h codegen
 static const std::array<const char *, CMD_RANGE_SIZE> must_be_recording_list = {{VUID_MUST_BE_RECORDING_LIST}};
@@ -2237,11 +2342,81 @@ void CoreChecks::PostCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDevice
         [core_checks](CMD_BUFFER_STATE *cb_node, const IMAGE_VIEW_STATE &iv_state, VkImageLayout layout) -> void {
             core_checks->SetImageViewInitialLayout(cb_node, iv_state, layout);
         });
+
+    const char *shader_cache_string = getLayerOption("khronos_validation.shader_validation_cache");
+    if (*shader_cache_string && !strcmp(shader_cache_string, "true") && !core_checks->disabled[shader_validation] &&
+        !core_checks->disabled[shader_validation_caching]) {
+        core_checks->LoadCoreValidationCache();
+    }
+
+    if (core_checks->enabled[parallel_pipeline_validation] || core_checks->enabled[parallel_image_layout_validation]) {
+        // The calling thread works through the items alongside the pool
+        uint32_t worker_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+        core_checks->worker_pool.reset(new WorkerPool(worker_count));
+    }
+}
+
+// Reads a cache file written by StoreCoreValidationCache. A missing, unreadable or stale file gives an empty cache.
+static std::unique_ptr<ValidationCache> ReadValidationCacheFile(const std::string &path) {
+    std::vector<char> data;
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (file) {
+        data.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(data.data(), data.size())) data.clear();
+    }
+
+    VkValidationCacheCreateInfoEXT cache_ci = {};
+    cache_ci.sType = VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT;
+    cache_ci.initialDataSize = data.size();
+    cache_ci.pInitialData = data.empty() ? nullptr : data.data();
+    return std::unique_ptr<ValidationCache>(CastFromHandle<ValidationCache *>(ValidationCache::Create(&cache_ci)));
+}
+
+// The layer's validation cache file is khronos_validation.shader_validation_cache_path if set, and otherwise lives in the
+// user's cache directory. Without such a directory the cache stays off.
+void CoreChecks::LoadCoreValidationCache() {
+    const char *path_string = getLayerOption("khronos_validation.shader_validation_cache_path");
+    core_validation_cache_path = *path_string ? path_string : GetUserCacheFilePath("VkLayer_khronos_validation_shader_cache.bin");
+    if (core_validation_cache_path.empty()) {
+        LogWarning(device, kVUID_Core_Shader_ValidationCacheUnavailable,
+                   "No per-user cache directory is available, so the shader validation cache is disabled.");
+        return;
+    }
+
+    core_validation_cache = ReadValidationCacheFile(core_validation_cache_path);
+    core_validation_cache_dirty = false;
+}
+
+// Writing the cache is best effort; if it fails the next run revalidates its shaders. Entries other processes wrote since
+// the file was read are kept, and the file is replaced in one step so that readers never see it half written.
+void CoreChecks::StoreCoreValidationCache() {
+    if (!core_validation_cache || !core_validation_cache_dirty) return;
+
+    core_validation_cache->Merge(ReadValidationCacheFile(core_validation_cache_path).get());
+    size_t data_size = 0;
+    core_validation_cache->Write(&data_size, nullptr);
+    std::vector<char> data(data_size);
+    core_validation_cache->Write(&data_size, data.data());
+
+    const std::string temp_path = GetProcessTempPath(core_validation_cache_path);
+    bool written = false;
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        written = file && file.write(data.data(), data_size) && file.flush();
+    }
+    if (!written || !RenameReplacingFile(temp_path, core_validation_cache_path)) {
+        remove(temp_path.c_str());
+        return;
+    }
+    core_validation_cache_dirty = false;
 }
 
 void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     if (!device) return;
     imageLayoutMap.clear();
+    StoreCoreValidationCache();
+    core_validation_cache.reset();
 
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator);
 }
@@ -2393,6 +2568,7 @@ bool CoreChecks::ValidateCommandBufferState(const CMD_BUFFER_STATE *cb_state, co
             break;
 
         default: /* recorded */
+            skip |= ValidateDeferredDescriptorBindings(cb_state, call_source);
             break;
     }
     return skip;
@@ -2477,6 +2653,7 @@ bool CoreChecks::ValidatePrimaryCommandBufferState(const CMD_BUFFER_STATE *pCB,
     } else {
         for (auto pSubCB : pCB->linkedCommandBuffers) {
             skip |= ValidateQueuedQFOTransfers(pSubCB, qfo_image_scoreboards, qfo_buffer_scoreboards);
+            skip |= ValidateDeferredDescriptorBindings(pSubCB, "vkQueueSubmit()");
             // TODO: replace with InvalidateCommandBuffers() at recording.
             if ((pSubCB->primaryCommandBuffer != pCB->commandBuffer) &&
                 !(pSubCB->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)) {
@@ -2723,10 +2900,22 @@ bool CoreChecks::ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitIn
     const auto perf_submit = lvl_find_in_chain<VkPerformanceQuerySubmitInfoKHR>(submit->pNext);
     uint32_t perf_pass = perf_submit ? perf_submit->counterPassIndex : 0;
 
+    // Compare the initial layouts of each command buffer with the global layouts on the workers. The ordered pass below builds
+    // the overlay, and only redoes the images an earlier command buffer of the submit left a layout for.
+    std::vector<CmdBufImageLayoutCheck> layout_checks;
+    if (enabled[parallel_image_layout_validation] && !disabled[image_layout_validation] && submit->commandBufferCount > 1) {
+        layout_checks.resize(submit->commandBufferCount);
+        worker_pool->ParallelFor(submit->commandBufferCount, [this, submit, &layout_checks](size_t i) {
+            const auto *cb_node = GetCBState(submit->pCommandBuffers[i]);
+            if (cb_node) PrecheckCmdBufImageLayouts(cb_node, imageLayoutMap, &layout_checks[i]);
+        });
+    }
+
     for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
         const auto *cb_node = GetCBState(submit->pCommandBuffers[i]);
         if (cb_node) {
-            skip |= ValidateCmdBufImageLayouts(cb_node, imageLayoutMap, &overlayLayoutMap);
+            skip |= ValidateCmdBufImageLayouts(cb_node, imageLayoutMap, &overlayLayoutMap,
+                                               layout_checks.empty() ? nullptr : &layout_checks[i]);
             current_cmds.push_back(submit->pCommandBuffers[i]);
             skip |= ValidatePrimaryCommandBufferState(
                 cb_node, (int)std::count(current_cmds.begin(), current_cmds.end(), submit->pCommandBuffers[i]),
@@ -4408,13 +4597,17 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
     bool skip = StateTracker::PreCallValidateCreateGraphicsPipelines(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                      pPipelines, cgpl_state_data);
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
+    ParallelStageResults parallel_results;
+    if (enabled[parallel_pipeline_validation]) {
+        ValidatePipelineStagesInParallel(cgpl_state->pipe_state, &parallel_results);
+    }
 
     for (uint32_t i = 0; i < count; i++) {
         skip |= ValidatePipelineLocked(cgpl_state->pipe_state, i);
     }
 
     for (uint32_t i = 0; i < count; i++) {
-        skip |= ValidatePipelineUnlocked(cgpl_state->pipe_state[i].get(), i);
+        skip |= ValidatePipelineUnlocked(cgpl_state->pipe_state[i].get(), i, &parallel_results);
     }
 
     if (device_extensions.vk_ext_vertex_attribute_divisor) {
@@ -4432,9 +4625,13 @@ bool CoreChecks::PreCallValidateCreateComputePipelines(VkDevice device, VkPipeli
                                                                     pPipelines, ccpl_state_data);
 
     auto *ccpl_state = reinterpret_cast<create_compute_pipeline_api_state *>(ccpl_state_data);
+    ParallelStageResults parallel_results;
+    if (enabled[parallel_pipeline_validation]) {
+        ValidatePipelineStagesInParallel(ccpl_state->pipe_state, &parallel_results);
+    }
     for (uint32_t i = 0; i < count; i++) {
         // TODO: Add Compute Pipeline Verification
-        skip |= ValidateComputePipelineShaderState(ccpl_state->pipe_state[i].get());
+        skip |= ValidateComputePipelineShaderState(ccpl_state->pipe_state[i].get(), &parallel_results);
         skip |= ValidatePipelineCacheControlFlags(pCreateInfos->flags, i, "vkCreateComputePipelines",
                                                   "VUID-VkComputePipelineCreateInfo-pipelineCreationCacheControl-02875");
     }
@@ -4449,6 +4646,10 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesNV(VkDevice device, VkP
                                                                          pPipelines, crtpl_state_data);
 
     auto *crtpl_state = reinterpret_cast<create_ray_tracing_pipeline_api_state *>(crtpl_state_data);
+    ParallelStageResults parallel_results;
+    if (enabled[parallel_pipeline_validation]) {
+        ValidatePipelineStagesInParallel(crtpl_state->pipe_state, &parallel_results);
+    }
     for (uint32_t i = 0; i < count; i++) {
         PIPELINE_STATE *pipeline = crtpl_state->pipe_state[i].get();
         if (pipeline->raytracingPipelineCI.flags & VK_PIPELINE_CREATE_DERIVATIVE_BIT) {
@@ -4466,7 +4667,7 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesNV(VkDevice device, VkP
                     "the base pipeline must have been created with the VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT flag set.");
             }
         }
-        skip |= ValidateRayTracingPipeline(pipeline, /*isKHR*/ false);
+        skip |= ValidateRayTracingPipeline(pipeline, /*isKHR*/ false, &parallel_results);
         skip |= ValidatePipelineCacheControlFlags(pCreateInfos->flags, i, "vkCreateRayTracingPipelinesNV",
                                                   "VUID-VkRayTracingPipelineCreateInfoNV-pipelineCreationCacheControl-02905");
     }
@@ -4481,6 +4682,10 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice device, Vk
                                                                           pPipelines, crtpl_state_data);
 
     auto *crtpl_state = reinterpret_cast<create_ray_tracing_pipeline_khr_api_state *>(crtpl_state_data);
+    ParallelStageResults parallel_results;
+    if (enabled[parallel_pipeline_validation]) {
+        ValidatePipelineStagesInParallel(crtpl_state->pipe_state, &parallel_results);
+    }
     for (uint32_t i = 0; i < count; i++) {
         PIPELINE_STATE *pipeline = crtpl_state->pipe_state[i].get();
         if (pipeline->raytracingPipelineCI.flags & VK_PIPELINE_CREATE_DERIVATIVE_BIT) {
@@ -4498,7 +4703,7 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice device, Vk
                     "the base pipeline must have been created with the VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT flag set.");
             }
         }
-        skip |= ValidateRayTracingPipeline(pipeline, /*isKHR*/ true);
+        skip |= ValidateRayTracingPipeline(pipeline, /*isKHR*/ true, &parallel_results);
         skip |= ValidatePipelineCacheControlFlags(pCreateInfos->flags, i, "vkCreateRayTracingPipelinesKHR",
                                                   "VUID-VkRayTracingPipelineCreateInfoKHR-pipelineCreationCacheControl-02905");
     }
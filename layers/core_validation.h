@@ -76,6 +76,28 @@ typedef struct {
     const char* vuid_protected_cb;
 } ValidateEndQueryVuids;
 
+// A range of an image's subresources whose layout at submit differs from the initial layout a command buffer expects
+struct ImageLayoutMismatch {
+    GlobalImageLayoutRangeMap::key_type range;
+    VkImageLayout initial_layout;
+    VkImageLayout image_layout;
+};
+
+// Mismatches of a command buffer's initial layouts with the global layouts, found ahead of the ordered pass of
+// ValidateCmdBufImageLayouts. image_ends[i] is the end in mismatches of the i-th image of image_layout_map.
+struct CmdBufImageLayoutCheck {
+    std::vector<size_t> image_ends;
+    std::vector<ImageLayoutMismatch> mismatches;
+};
+
+// What ValidatePipelineShaderStage found for a stage on a worker of parallel_pipeline_validation, logged by the calling thread
+// when the sequential checks reach the stage
+struct ParallelStageResult {
+    std::vector<DeferredMessage> messages;
+    bool skip = false;
+};
+typedef std::unordered_map<const PIPELINE_STATE::StageState*, ParallelStageResult> ParallelStageResults;
+
 class CoreChecks : public ValidationStateTracker {
   public:
     using StateTracker = ValidationStateTracker;
@@ -83,12 +105,31 @@ class CoreChecks : public ValidationStateTracker {
     GlobalQFOTransferBarrierMap<VkBufferMemoryBarrier> qfo_release_buffer_barrier_map;
     GlobalImageLayoutMap imageLayoutMap;
 
+    // Hashes of shaders that passed spirv-val, kept on disk between runs for applications without a VkValidationCacheEXT
+    std::unique_ptr<ValidationCache> core_validation_cache;
+    std::string core_validation_cache_path;
+    mutable std::mutex core_validation_cache_mutex;
+    mutable bool core_validation_cache_dirty = false;
+
+    // Workers for the shader stages of pipeline batches and the image layouts of submitted command buffers, present when
+    // parallel_pipeline_validation or parallel_image_layout_validation is enabled
+    std::unique_ptr<WorkerPool> worker_pool;
+
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
+    cmd_buffer_lock_guard_t cmd_buffer_read_lock(VkCommandBuffer commandBuffer) override {
+        return LockCmdBuffer(commandBuffer, false);
+    }
+    cmd_buffer_lock_guard_t cmd_buffer_write_lock(VkCommandBuffer commandBuffer) override {
+        return LockCmdBuffer(commandBuffer, true);
+    }
+
     // Override base class, we have some extra work to do here
     void InitDeviceValidationObject(bool add_obj, ValidationObject* inst_obj, ValidationObject* dev_obj);
 
     void IncrementCommandCount(VkCommandBuffer commandBuffer);
+    void LoadCoreValidationCache();
+    void StoreCoreValidationCache();
 
     bool VerifyQueueStateToSeq(const QUEUE_STATE* initial_queue, uint64_t initial_seq) const;
     bool ValidateSetMemBinding(VkDeviceMemory mem, const VulkanTypedHandle& typed_handle, const char* apiName) const;
@@ -103,7 +144,8 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateIdleDescriptorSet(VkDescriptorSet set, const char* func_str) const;
     bool SemaphoreWasSignaled(VkSemaphore semaphore) const;
     bool ValidatePipelineLocked(std::vector<std::shared_ptr<PIPELINE_STATE>> const& pPipelines, int pipelineIndex) const;
-    bool ValidatePipelineUnlocked(const PIPELINE_STATE* pPipeline, uint32_t pipelineIndex) const;
+    bool ValidatePipelineUnlocked(const PIPELINE_STATE* pPipeline, uint32_t pipelineIndex,
+                                  const ParallelStageResults* parallel_results) const;
     bool ValidImageBufferQueue(const CMD_BUFFER_STATE* cb_node, const VulkanTypedHandle& object, uint32_t queueFamilyIndex,
                                uint32_t count, const uint32_t* indices) const;
     bool ValidateFenceForSubmit(const FENCE_STATE* pFence, const char* inflight_vuid, const char* retired_vuid,
@@ -139,6 +181,7 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateRenderPassCompatibility(const char* type1_string, const RENDER_PASS_STATE* rp1_state, const char* type2_string,
                                          const RENDER_PASS_STATE* rp2_state, const char* caller, const char* error_code) const;
     bool ReportInvalidCommandBuffer(const CMD_BUFFER_STATE* cb_state, const char* call_source) const;
+    bool ValidateDeferredDescriptorBindings(const CMD_BUFFER_STATE* cb_state, const char* call_source) const;
     bool ValidateQueueFamilyIndex(const PHYSICAL_DEVICE_STATE* pd_state, uint32_t requested_queue_family, const char* err_code,
                                   const char* cmd_name, const char* queue_family_var_name) const;
     bool ValidateDeviceQueueCreateInfos(const PHYSICAL_DEVICE_STATE* pd_state, uint32_t info_count,
@@ -377,6 +420,40 @@ class CoreChecks : public ValidationStateTracker {
                                           const std::vector<uint32_t>& dynamic_offsets, uint32_t binding, descriptor_req reqs,
                                           VkFramebuffer framebuffer, const std::vector<VkImageView>& attachment_views,
                                           const char* caller, const DrawDispatchVuid& vuids) const;
+    // What the draw time checks of the descriptors in one binding share
+    struct DescriptorContext {
+        const char* caller;
+        const DrawDispatchVuid* vuids;
+        const CMD_BUFFER_STATE* cb_node;
+        const cvdescriptorset::DescriptorSet* descriptor_set;
+        VkFramebuffer framebuffer;
+        const std::vector<VkImageView>* attachment_views;
+        std::vector<const IMAGE_VIEW_STATE*> attachment_view_states;  // Parallel to attachment_views, for image bindings
+        uint32_t binding;
+        VkDescriptorType descriptor_type;
+        descriptor_req reqs;
+        const uint32_t* dynamic_offsets;  // The binding's first dynamic offset, null if it has none
+    };
+    void ResolveAttachmentViewStates(DescriptorContext* context) const;
+    template <typename TypedDescriptor>
+    bool ValidateDescriptors(const DescriptorContext& context, const cvdescriptorset::IndexRange& index_range) const;
+    // One overload per descriptor class, checking a descriptor already known to be updated
+    bool ValidateDescriptor(const DescriptorContext& context, uint32_t index,
+                            const cvdescriptorset::BufferDescriptor& descriptor) const;
+    bool ValidateDescriptor(const DescriptorContext& context, uint32_t index,
+                            const cvdescriptorset::ImageDescriptor& descriptor) const;
+    bool ValidateDescriptor(const DescriptorContext& context, uint32_t index,
+                            const cvdescriptorset::ImageSamplerDescriptor& descriptor) const;
+    bool ValidateDescriptor(const DescriptorContext& context, uint32_t index,
+                            const cvdescriptorset::SamplerDescriptor& descriptor) const;
+    bool ValidateDescriptor(const DescriptorContext& context, uint32_t index,
+                            const cvdescriptorset::TexelDescriptor& descriptor) const;
+    bool ValidateDescriptor(const DescriptorContext& context, uint32_t index,
+                            const cvdescriptorset::AccelerationStructureDescriptor& descriptor) const;
+    bool ValidateImageDescriptor(const DescriptorContext& context, uint32_t index, VkImageView image_view,
+                                 const IMAGE_VIEW_STATE* image_view_state, VkImageLayout image_layout) const;
+    bool ValidateSamplerDescriptor(const DescriptorContext& context, uint32_t index, VkSampler sampler,
+                                   const SAMPLER_STATE* sampler_state, bool is_immutable) const;
 
     // Validate contents of a CopyUpdate
     using DescriptorSet = cvdescriptorset::DescriptorSet;
@@ -410,14 +487,22 @@ class CoreChecks : public ValidationStateTracker {
                                       const VkCopyDescriptorSet* p_cds, const char* func_name) const;
 
     // Stuff from shader_validation
-    bool ValidateGraphicsPipelineShaderState(const PIPELINE_STATE* pPipeline) const;
-    bool ValidateComputePipelineShaderState(PIPELINE_STATE* pPipeline) const;
-    bool ValidateRayTracingPipeline(PIPELINE_STATE* pipeline, bool isKHR) const;
+    bool ValidateGraphicsPipelineShaderState(const PIPELINE_STATE* pPipeline, const ParallelStageResults* parallel_results) const;
+    bool ValidateComputePipelineShaderState(PIPELINE_STATE* pPipeline, const ParallelStageResults* parallel_results) const;
+    bool ValidateRayTracingPipeline(PIPELINE_STATE* pipeline, bool isKHR, const ParallelStageResults* parallel_results) const;
     bool PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) const;
     bool ValidatePipelineShaderStage(VkPipelineShaderStageCreateInfo const* pStage, const PIPELINE_STATE* pipeline,
                                      const PIPELINE_STATE::StageState& stage_state, const SHADER_MODULE_STATE* module,
                                      const spirv_inst_iter& entrypoint, bool check_point_size) const;
+    void SpecializeShaderStage(VkPipelineShaderStageCreateInfo const* pStage, const SHADER_MODULE_STATE* module,
+                               SPECIALIZED_SHADER_RESULT* result) const;
+    void ValidatePipelineStagesInParallel(const std::vector<std::shared_ptr<PIPELINE_STATE>>& pipe_states,
+                                          ParallelStageResults* parallel_results) const;
+    bool ValidatePipelineShaderStageOnce(VkPipelineShaderStageCreateInfo const* pStage, const PIPELINE_STATE* pipeline,
+                                         const PIPELINE_STATE::StageState& stage_state, const SHADER_MODULE_STATE* module,
+                                         const spirv_inst_iter& entrypoint, bool check_point_size,
+                                         const ParallelStageResults* parallel_results) const;
     bool ValidatePointListShaderState(const PIPELINE_STATE* pipeline, SHADER_MODULE_STATE const* src, spirv_inst_iter entrypoint,
                                       VkShaderStageFlagBits stage) const;
     bool ValidateShaderCapabilities(SHADER_MODULE_STATE const* src, VkShaderStageFlagBits stage) const;
@@ -436,7 +521,7 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateFsOutputsAgainstRenderPass(SHADER_MODULE_STATE const* fs, spirv_inst_iter entrypoint,
                                             PIPELINE_STATE const* pipeline, uint32_t subpass_index) const;
     bool ValidatePushConstantUsage(std::vector<VkPushConstantRange> const* push_constant_ranges, SHADER_MODULE_STATE const* src,
-                                   std::unordered_set<uint32_t> accessible_ids, VkShaderStageFlagBits stage) const;
+                                   std::vector<uint32_t> const& accessible_ids, VkShaderStageFlagBits stage) const;
     bool ValidatePushConstantBlockAgainstPipeline(std::vector<VkPushConstantRange> const* push_constant_ranges,
                                                   SHADER_MODULE_STATE const* src, spirv_inst_iter type,
                                                   VkShaderStageFlagBits stage) const;
@@ -616,8 +701,13 @@ class CoreChecks : public ValidationStateTracker {
                                    VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions,
                                    VkFilter filter);
 
+    bool ReportImageLayoutMismatches(const CMD_BUFFER_STATE* pCB, const IMAGE_STATE& image_state, const ImageLayoutMismatch* begin,
+                                     const ImageLayoutMismatch* end) const;
+    void PrecheckCmdBufImageLayouts(const CMD_BUFFER_STATE* pCB, const GlobalImageLayoutMap& globalImageLayoutMap,
+                                    CmdBufImageLayoutCheck* check) const;
     bool ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE* pCB, const GlobalImageLayoutMap& globalImageLayoutMap,
-                                    GlobalImageLayoutMap* overlayLayoutMap_arg) const;
+                                    GlobalImageLayoutMap* overlayLayoutMap_arg,
+                                    const CmdBufImageLayoutCheck* precheck = nullptr) const;
 
     void UpdateCmdBufImageLayouts(CMD_BUFFER_STATE* pCB);
 
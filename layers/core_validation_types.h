@@ -37,14 +37,17 @@
 #include "convert_to_renderpass2.h"
 #include "layer_chassis_dispatch.h"
 #include "image_layout_map.h"
+#include "descriptor_set_arena.h"
 
 #include <array>
 #include <atomic>
+#include <cstddef>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <set>
+#include <mutex>
 #include <string.h>
 #include <unordered_map>
 #include <unordered_set>
@@ -178,6 +181,9 @@ struct DESCRIPTOR_POOL_STATE : BASE_NODE {
     std::unordered_set<cvdescriptorset::DescriptorSet *> sets;  // Collection of all sets in this pool
     std::map<uint32_t, uint32_t> maxDescriptorTypeCount;        // Max # of descriptors of each type in this pool
     std::map<uint32_t, uint32_t> availableDescriptorTypeCount;  // Available # of descriptors of each type in this pool
+    // Backs the state of the sets allocated from pools whose sets can only be released all at once, null when sets can be
+    // freed individually
+    std::shared_ptr<DescriptorSetArena> set_arena;
 
     DESCRIPTOR_POOL_STATE(const VkDescriptorPool pool, const VkDescriptorPoolCreateInfo *pCreateInfo)
         : pool(pool),
@@ -185,7 +191,11 @@ struct DESCRIPTOR_POOL_STATE : BASE_NODE {
           availableSets(pCreateInfo->maxSets),
           createInfo(pCreateInfo),
           maxDescriptorTypeCount(),
-          availableDescriptorTypeCount() {
+          availableDescriptorTypeCount(),
+          set_arena() {
+        if (!(createInfo.flags & VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT)) {
+            set_arena = std::make_shared<DescriptorSetArena>();
+        }
         // Collect maximums per descriptor type.
         for (uint32_t i = 0; i < createInfo.poolSizeCount; ++i) {
             uint32_t typeIndex = static_cast<uint32_t>(createInfo.pPoolSizes[i].type);
@@ -201,6 +211,10 @@ struct MemRange {
     VkDeviceSize size = 0;
 };
 
+// The objects bound over each part of a memory object. Overlapping bindings share the entries that cover their overlap.
+using MemoryBindingRange = sparse_container::range<VkDeviceSize>;
+using BoundObjectRangeMap = sparse_container::range_map<VkDeviceSize, small_vector<VulkanTypedHandle, 2>>;
+
 // Data struct for tracking memory object
 struct DEVICE_MEMORY_STATE : public BASE_NODE {
     void *object;  // Dispatchable object used to create this memory (device of swapchain)
@@ -217,10 +231,10 @@ struct DEVICE_MEMORY_STATE : public BASE_NODE {
     VkExternalMemoryHandleTypeFlags export_handle_type_flags;
     VkExternalMemoryHandleTypeFlags import_handle_type_flags;
     std::unordered_set<VulkanTypedHandle> obj_bindings;  // objects bound to this memory
-    // Convenience vectors of handles to speed up iterating over objects independently
-    std::unordered_set<VkImage> bound_images;
-    std::unordered_set<VkBuffer> bound_buffers;
-    std::unordered_set<VkAccelerationStructureNV> bound_acceleration_structures;
+    // Non-sparse bindings, indexed by offset so that the objects bound over an offset are found without visiting every
+    // object bound to the memory, and by object so that they can be removed again
+    BoundObjectRangeMap bound_ranges;
+    std::unordered_map<VulkanTypedHandle, small_vector<MemoryBindingRange, 1>> object_ranges;
 
     MemRange mapped_range;
     void *shadow_copy_base;          // Base of layer's allocation for guard band, data, and alignment space
@@ -876,10 +890,17 @@ class safe_VkRayTracingPipelineCreateInfoCommon : public safe_VkRayTracingPipeli
     }
 };
 
+// Outcome of applying the specialization constants of a shader stage to its module and revalidating the result
+struct SPECIALIZED_SHADER_RESULT {
+    bool optimized = false;
+    bool valid = true;
+    std::vector<std::string> optimizer_messages;
+};
+
 class PIPELINE_STATE : public BASE_NODE {
   public:
     struct StageState {
-        std::unordered_set<uint32_t> accessible_ids;
+        std::vector<uint32_t> accessible_ids;
         std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
         bool has_writable_descriptor;
         bool has_atomic_descriptor;
@@ -1169,7 +1190,41 @@ typedef std::map<QueryObject, QueryState> QueryMap;
 typedef std::unordered_map<VkEvent, VkPipelineStageFlags> EventToStageMap;
 typedef ImageSubresourceLayoutMap::LayoutMap GlobalImageLayoutRangeMap;
 typedef std::unordered_map<VkImage, std::unique_ptr<GlobalImageLayoutRangeMap>> GlobalImageLayoutMap;
-typedef std::unordered_map<VkImage, std::unique_ptr<ImageSubresourceLayoutMap>> CommandBufferImageLayoutMap;
+
+// The image layout maps of a command buffer, keyed by image.  Reset() only starts a new generation, leaving the maps of the prior
+// recording in place to be rebuilt when their image is used again, s.t. resetting a command buffer doesn't visit the maps it
+// recorded.  The stale maps are released together once they outnumber the live ones, which bounds the amortized cost per map.
+class CommandBufferImageLayoutMap {
+  public:
+    using value_type = std::pair<VkImage, ImageSubresourceLayoutMap *>;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    // Iterates the maps of the current generation, in the order they were created
+    const_iterator begin() const { return live_.cbegin(); }
+    const_iterator end() const { return live_.cend(); }
+    size_t size() const { return live_.size(); }
+    bool empty() const { return live_.empty(); }
+
+    const ImageSubresourceLayoutMap *Get(VkImage image) const {
+        const auto it = maps_.find(image);
+        return ((it != maps_.cend()) && (it->second.generation == generation_)) ? it->second.map.get() : nullptr;
+    }
+    ImageSubresourceLayoutMap *GetOrCreate(const IMAGE_STATE &image_state);
+    void Reset();
+
+  private:
+    struct Entry {
+        uint64_t generation = 0;
+        std::unique_ptr<ImageSubresourceLayoutMap> map;
+    };
+    static const size_t kMinRetainedMaps = 64;
+
+    // Backs the range map nodes of the layout maps, declared first s.t. it outlives them
+    sparse_container::node_pool node_pool_;
+    std::unordered_map<VkImage, Entry> maps_;
+    std::vector<value_type> live_;
+    uint64_t generation_ = 0;
+};
 
 class FRAMEBUFFER_STATE;
 // Cmd Buffer Wrapper Struct - TODO : This desperately needs its own class
@@ -1214,6 +1269,13 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     };
     std::unordered_map<VkDescriptorSet, std::vector<CmdDrawDispatchInfo>> validate_descriptorsets_in_queuesubmit;
 
+    // Sets with many descriptors whose resources are bound to the command buffer at submit (lazy_descriptor_binding)
+    struct DeferredDescriptorBinding {
+        std::shared_ptr<cvdescriptorset::DescriptorSet> descriptor_set;
+        BindingReqMap binding_req_map;
+    };
+    std::vector<DeferredDescriptorBinding> deferred_descriptor_bindings;
+
     uint32_t viewportMask;
     uint32_t viewportWithCountMask;
     uint32_t scissorMask;
@@ -1278,6 +1340,9 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     std::vector<IMAGE_VIEW_STATE *> imagelessFramebufferAttachments;
 
     bool transform_feedback_active{false};
+
+    // Serializes the vkCmd* hooks recording into this command buffer when command buffer local locking is enabled
+    std::mutex cmd_buffer_lock;
 };
 
 static inline const QFOTransferBarrierSets<VkImageMemoryBarrier> &GetQFOBarrierSets(
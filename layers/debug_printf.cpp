@@ -96,6 +96,7 @@ void DebugPrintf::PostCallRecordCreateDevice(VkPhysicalDevice physicalDevice, co
 }
 
 void DebugPrintf::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    UtilProcessCompletedSubmissions(this, true);
     UtilPreCallRecordDestroyDevice(this);
 }
 
@@ -136,6 +137,7 @@ void DebugPrintf::ResetCommandBuffer(VkCommandBuffer commandBuffer) {
     if (aborted) {
         return;
     }
+    UtilWaitForCommandBuffer(this, commandBuffer);
     auto debug_printf_buffer_list = GetBufferInfo(commandBuffer);
     for (auto buffer_info : debug_printf_buffer_list) {
         vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
@@ -260,8 +262,28 @@ bool DebugPrintf::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
     if (aborted) return false;
     if (pCreateInfo->pCode[0] != spv::MagicNumber) return false;
 
-    // Load original shader SPIR-V
     uint32_t num_words = static_cast<uint32_t>(pCreateInfo->codeSize / 4);
+    using namespace spvtools;
+    spv_target_env target_env = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
+
+    // Reuse the module instrumented by an earlier run if the code and instrumentation settings are the same.
+    // Otherwise instrument with the cache's placeholder shader ID so the result can be cached.
+    uint32_t instrumentation_shader_id = unique_shader_module_id;
+    uint64_t cache_key = 0;
+    bool cache_result = false;
+    if (instrumented_shader_cache.IsEnabled() && !UtilInstrumentedShaderCache::UsesPlaceholder(pCreateInfo->pCode, num_words)) {
+        const uint32_t settings[] = {static_cast<uint32_t>(container_type), desc_set_bind_index,
+                                     static_cast<uint32_t>(target_env)};
+        cache_key = UtilInstrumentedShaderCache::MakeKey(pCreateInfo->pCode, pCreateInfo->codeSize, settings, sizeof(settings));
+        if (instrumented_shader_cache.Get(cache_key, pCreateInfo->pCode, num_words, unique_shader_module_id, new_pgm)) {
+            *unique_shader_id = unique_shader_module_id++;
+            return true;
+        }
+        instrumentation_shader_id = UtilInstrumentedShaderCache::kShaderIdPlaceholder;
+        cache_result = true;
+    }
+
+    // Load original shader SPIR-V
     new_pgm.clear();
     new_pgm.reserve(num_words);
     new_pgm.insert(new_pgm.end(), &pCreateInfo->pCode[0], &pCreateInfo->pCode[num_words]);
@@ -269,8 +291,6 @@ bool DebugPrintf::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
     // Call the optimizer to instrument the shader.
     // Use the unique_shader_module_id as a shader ID so we can look up its handle later in the shader_map.
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
-    using namespace spvtools;
-    spv_target_env target_env = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
     spvtools::ValidatorOptions options;
     AdjustValidatorOptions(device_extensions, enabled_features, options);
     Optimizer optimizer(target_env);
@@ -288,10 +308,12 @@ bool DebugPrintf::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
         }
     };
     optimizer.SetMessageConsumer(DebugPrintfConsoleMessageConsumer);
-    optimizer.RegisterPass(CreateInstDebugPrintfPass(desc_set_bind_index, unique_shader_module_id));
+    optimizer.RegisterPass(CreateInstDebugPrintfPass(desc_set_bind_index, instrumentation_shader_id));
     bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm, options, false);
     if (!pass) {
         ReportSetupProblem(device, "Failure to instrument shader.  Proceeding with non-instrumented shader.");
+    } else if (cache_result) {
+        instrumented_shader_cache.Put(cache_key, pCreateInfo->pCode, num_words, unique_shader_module_id, new_pgm);
     }
     *unique_shader_id = unique_shader_module_id++;
     return pass;
@@ -575,8 +597,23 @@ void DebugPrintf::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
 #pragma GCC diagnostic pop
 #endif
 
+// A simultaneous-use command buffer may still be in flight from an earlier deferred submission.
+// Check its output before the new submission starts writing to the same debug buffers.
+void DebugPrintf::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        const VkSubmitInfo *submit = &pSubmits[submit_idx];
+        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
+            auto cb_node = GetCBState(submit->pCommandBuffers[i]);
+            UtilWaitForCommandBuffer(this, cb_node->commandBuffer);
+            for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
+                UtilWaitForCommandBuffer(this, secondaryCmdBuffer->commandBuffer);
+            }
+        }
+    }
+}
+
 // Issue a memory barrier to make GPU-written data available to host.
-// Wait for the queue to complete execution.
+// Wait for the queue to complete execution, or in deferred mode track the submission with a fence.
 // Check the debug buffers for all the command buffers that were submitted.
 void DebugPrintf::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                             VkResult result) {
@@ -597,20 +634,38 @@ void DebugPrintf::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
     }
     if (!buffers_present) return;
 
-    UtilSubmitBarrier(queue, this);
+    UtilProcessSubmission(queue, submitCount, pSubmits, this);
+}
 
-    DispatchQueueWaitIdle(queue);
+void DebugPrintf::ProcessCommandBufferOutput(VkQueue queue, VkCommandBuffer command_buffer) {
+    UtilProcessInstrumentationBuffer(queue, command_buffer, this);
+}
 
-    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
-        const VkSubmitInfo *submit = &pSubmits[submit_idx];
-        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
-            auto cb_node = GetCBState(submit->pCommandBuffers[i]);
-            UtilProcessInstrumentationBuffer(queue, cb_node, this);
-            for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
-                UtilProcessInstrumentationBuffer(queue, secondaryCmdBuffer, this);
-            }
-        }
-    }
+// In deferred mode, check the output of submissions whose fences the application has seen signaled.
+void DebugPrintf::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    ValidationStateTracker::PostCallRecordQueueWaitIdle(queue, result);
+    UtilProcessCompletedSubmissions(this, false);
+}
+
+void DebugPrintf::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    ValidationStateTracker::PostCallRecordDeviceWaitIdle(device, result);
+    UtilProcessCompletedSubmissions(this, false);
+}
+
+void DebugPrintf::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                              uint64_t timeout, VkResult result) {
+    ValidationStateTracker::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
+    UtilProcessCompletedSubmissions(this, false);
+}
+
+void DebugPrintf::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    ValidationStateTracker::PostCallRecordGetFenceStatus(device, fence, result);
+    UtilProcessCompletedSubmissions(this, false);
+}
+
+void DebugPrintf::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo, VkResult result) {
+    ValidationStateTracker::PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
+    UtilProcessCompletedSubmissions(this, false);
 }
 
 void DebugPrintf::PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
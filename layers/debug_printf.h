@@ -91,6 +91,10 @@ class DebugPrintf : public ValidationStateTracker {
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
     VmaAllocator vmaAllocator = {};
     std::map<VkQueue, UtilQueueBarrierCommandInfo> queue_barrier_command_infos;
+    bool deferred_processing = false;
+    std::deque<UtilInFlightSubmission> in_flight_submissions;
+    std::vector<VkFence> free_fences;
+    UtilInstrumentedShaderCache instrumented_shader_cache;
     std::vector<DPFBufferInfo>& GetBufferInfo(const VkCommandBuffer command_buffer) {
         auto buffer_list = command_buffer_map.find(command_buffer);
         if (buffer_list == command_buffer_map.end()) {
@@ -227,7 +231,15 @@ class DebugPrintf : public ValidationStateTracker {
                                                const VkStridedBufferRegionKHR* pHitShaderBindingTable,
                                                const VkStridedBufferRegionKHR* pCallableShaderBindingTable, VkBuffer buffer,
                                                VkDeviceSize offset);
+    void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence);
     void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
                                    VkResult result);
+    void ProcessCommandBufferOutput(VkQueue queue, VkCommandBuffer command_buffer);
+    void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result);
+    void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result);
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
+                                     uint64_t timeout, VkResult result);
+    void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result);
+    void PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo, VkResult result);
     void AllocateDebugPrintfResources(const VkCommandBuffer cmd_buffer, const VkPipelineBindPoint bind_point);
 };
@@ -0,0 +1,102 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+#ifndef DESCRIPTOR_SET_ARENA_H_
+#define DESCRIPTOR_SET_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Bump allocator for the state of the descriptor sets allocated from one pool. Nothing is freed individually, the memory is
+// reused once the pool is reset with no set state left alive, and released with the last set allocated from the arena.
+class DescriptorSetArena {
+  public:
+    void *Allocate(size_t size) {
+        size = (size + kAlignment - 1) & ~(kAlignment - 1);
+        for (; chunk_ < chunks_.size(); ++chunk_, offset_ = 0) {
+            auto &chunk = chunks_[chunk_];
+            if (offset_ + size <= chunk.size) {
+                void *allocation = chunk.data.get() + offset_;
+                offset_ += size;
+                return allocation;
+            }
+        }
+        size_t chunk_size = kChunkSize;
+        if (size > chunk_size) chunk_size = size;
+        chunks_.emplace_back(chunk_size);
+        chunk_ = chunks_.size() - 1;
+        offset_ = size;
+        return chunks_.back().data.get();
+    }
+    // Make the memory of all previous allocations available to the following ones
+    void Rewind() {
+        chunk_ = 0;
+        offset_ = 0;
+    }
+
+  private:
+    static const size_t kAlignment = alignof(std::max_align_t);
+    static const size_t kChunkSize = 64 * 1024;
+    struct Chunk {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+        explicit Chunk(size_t size_) : data(new uint8_t[size_]), size(size_) {}
+    };
+    std::vector<Chunk> chunks_;
+    size_t chunk_ = 0;
+    size_t offset_ = 0;
+};
+
+// Allocates from a pool's DescriptorSetArena, or from the heap for pools without one. Every allocation holds a reference to
+// the arena, so set state can outlive the reset or destruction of its pool.
+template <typename T>
+class DescriptorSetArenaAllocator {
+  public:
+    using value_type = T;
+    DescriptorSetArenaAllocator() = default;
+    explicit DescriptorSetArenaAllocator(const std::shared_ptr<DescriptorSetArena> &arena) : arena_(arena) {}
+    template <typename U>
+    DescriptorSetArenaAllocator(const DescriptorSetArenaAllocator<U> &other) : arena_(other.arena_) {}
+
+    T *allocate(size_t n) {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "DescriptorSetArena doesn't support over-aligned types");
+        if (arena_) return static_cast<T *>(arena_->Allocate(n * sizeof(T)));
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T *p, size_t) {
+        if (!arena_) ::operator delete(p);
+    }
+
+    template <typename U>
+    bool operator==(const DescriptorSetArenaAllocator<U> &other) const {
+        return arena_ == other.arena_;
+    }
+    template <typename U>
+    bool operator!=(const DescriptorSetArenaAllocator<U> &other) const {
+        return arena_ != other.arena_;
+    }
+
+  private:
+    template <typename U>
+    friend class DescriptorSetArenaAllocator;
+    std::shared_ptr<DescriptorSetArena> arena_;
+};
+
+#endif  // DESCRIPTOR_SET_ARENA_H_
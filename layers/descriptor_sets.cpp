@@ -591,6 +591,8 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
       set_(set),
       pool_state_(pool_state),
       p_layout_(layout),
+      descriptor_store_(DescriptorSetArenaAllocator<DescriptorBackingStore>(pool_state ? pool_state->set_arena : nullptr)),
+      descriptors_(descriptor_store_.get_allocator()),
       state_data_(state_data),
       variable_count_(variable_count),
       change_count_(0) {
@@ -727,464 +729,475 @@ bool CoreChecks::ValidateDrawState(const DescriptorSet *descriptor_set, const st
     return result;
 }
 
+// Look up the state of the attachments the image descriptors of a binding are checked against, once for the whole binding
+void CoreChecks::ResolveAttachmentViewStates(DescriptorContext *context) const {
+    context->attachment_view_states.clear();
+    if (context->descriptor_type == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT) return;
+    context->attachment_view_states.reserve(context->attachment_views->size());
+    for (const auto &view : *context->attachment_views) {
+        context->attachment_view_states.emplace_back(view != VK_NULL_HANDLE ? Get<IMAGE_VIEW_STATE>(view) : nullptr);
+    }
+}
+
+template <typename TypedDescriptor>
+bool CoreChecks::ValidateDescriptors(const DescriptorContext &context, const cvdescriptorset::IndexRange &index_range) const {
+    for (uint32_t i = index_range.start; i < index_range.end; ++i) {
+        const uint32_t index = i - index_range.start;
+        const auto *descriptor = static_cast<const TypedDescriptor *>(context.descriptor_set->GetDescriptorFromGlobalIndex(i));
+        if (!descriptor->updated) {
+            auto set = context.descriptor_set->GetSet();
+            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                            "%s encountered the following validation error at %s time: Descriptor in binding #%" PRIu32
+                            " index %" PRIu32
+                            " is being used in draw but has never been updated via vkUpdateDescriptorSets() or a similar call.",
+                            report_data->FormatHandle(set).c_str(), context.caller, context.binding, index);
+        }
+        if (ValidateDescriptor(context, index, *descriptor)) return true;
+    }
+    return false;
+}
+
 bool CoreChecks::ValidateDescriptorSetBindingData(const CMD_BUFFER_STATE *cb_node, const DescriptorSet *descriptor_set,
                                                   const std::vector<uint32_t> &dynamic_offsets, uint32_t binding,
                                                   descriptor_req reqs, VkFramebuffer framebuffer,
                                                   const std::vector<VkImageView> &attachment_views, const char *caller,
                                                   const DrawDispatchVuid &vuids) const {
     using DescriptorClass = cvdescriptorset::DescriptorClass;
-    using BufferDescriptor = cvdescriptorset::BufferDescriptor;
-    using ImageDescriptor = cvdescriptorset::ImageDescriptor;
-    using ImageSamplerDescriptor = cvdescriptorset::ImageSamplerDescriptor;
-    using SamplerDescriptor = cvdescriptorset::SamplerDescriptor;
-    using TexelDescriptor = cvdescriptorset::TexelDescriptor;
-    using AccelerationStructureDescriptor = cvdescriptorset::AccelerationStructureDescriptor;
     DescriptorSetLayout::ConstBindingIterator binding_it(descriptor_set->GetLayout().get(), binding);
-    {
-        // Copy the range, the end range is subject to update based on variable length descriptor arrays.
-        cvdescriptorset::IndexRange index_range = binding_it.GetGlobalIndexRange();
-        auto array_idx = 0;  // Track array idx if we're dealing with array descriptors
+    // Copy the range, the end range is subject to update based on variable length descriptor arrays.
+    cvdescriptorset::IndexRange index_range = binding_it.GetGlobalIndexRange();
+    if (binding_it.IsVariableDescriptorCount()) {
+        // Only validate the first N descriptors if it uses variable_count
+        index_range.end = index_range.start + descriptor_set->GetVariableDescriptorCount();
+    }
+    if (index_range.start >= index_range.end) return false;
+
+    // All the descriptors of a binding have the same type, so what their checks share is resolved once here and each class of
+    // descriptor is checked by a loop of its own
+    DescriptorContext context;
+    context.caller = caller;
+    context.vuids = &vuids;
+    context.cb_node = cb_node;
+    context.descriptor_set = descriptor_set;
+    context.framebuffer = framebuffer;
+    context.attachment_views = &attachment_views;
+    context.binding = binding;
+    context.descriptor_type = binding_it.GetType();
+    context.reqs = reqs;
+    context.dynamic_offsets = nullptr;
+    if (context.descriptor_type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC ||
+        context.descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC) {
+        context.dynamic_offsets = dynamic_offsets.data() + binding_it.GetDynamicOffsetIndex();
+    }
+
+    switch (descriptor_set->GetDescriptorFromGlobalIndex(index_range.start)->GetClass()) {
+        case DescriptorClass::GeneralBuffer:
+            return ValidateDescriptors<cvdescriptorset::BufferDescriptor>(context, index_range);
+        case DescriptorClass::ImageSampler:
+            ResolveAttachmentViewStates(&context);
+            return ValidateDescriptors<cvdescriptorset::ImageSamplerDescriptor>(context, index_range);
+        case DescriptorClass::Image:
+            ResolveAttachmentViewStates(&context);
+            return ValidateDescriptors<cvdescriptorset::ImageDescriptor>(context, index_range);
+        case DescriptorClass::PlainSampler:
+            return ValidateDescriptors<cvdescriptorset::SamplerDescriptor>(context, index_range);
+        case DescriptorClass::TexelBuffer:
+            return ValidateDescriptors<cvdescriptorset::TexelDescriptor>(context, index_range);
+        case DescriptorClass::AccelerationStructure:
+            return ValidateDescriptors<cvdescriptorset::AccelerationStructureDescriptor>(context, index_range);
+        default:
+            // Can't validate inline uniform blocks because they may not have been updated.
+            return false;
+    }
+}
 
-        if (binding_it.IsVariableDescriptorCount()) {
-            // Only validate the first N descriptors if it uses variable_count
-            index_range.end = index_range.start + descriptor_set->GetVariableDescriptorCount();
+bool CoreChecks::ValidateDescriptor(const DescriptorContext &context, uint32_t index,
+                                    const cvdescriptorset::BufferDescriptor &descriptor) const {
+    // Verify that buffers are valid
+    auto buffer = descriptor.GetBuffer();
+    auto buffer_node = descriptor.GetBufferState();
+    if (!buffer) return false;
+    if (!buffer_node || buffer_node->destroyed) {
+        auto set = context.descriptor_set->GetSet();
+        return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                        "%s encountered the following validation error at %s time: Descriptor in "
+                        "binding #%" PRIu32 " index %" PRIu32 " is using buffer %s that is invalid or has been destroyed.",
+                        report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                        report_data->FormatHandle(buffer).c_str());
+    } else if (!buffer_node->sparse) {
+        for (auto mem_binding : buffer_node->GetBoundMemory()) {
+            if (mem_binding->destroyed) {
+                auto set = context.descriptor_set->GetSet();
+                return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                                "%s encountered the following validation error at %s time: Descriptor in "
+                                "binding #%" PRIu32 " index %" PRIu32 " is uses buffer %s that references invalid memory %s.",
+                                report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                                report_data->FormatHandle(buffer).c_str(), report_data->FormatHandle(mem_binding->mem).c_str());
+            }
         }
-
-        for (uint32_t i = index_range.start; i < index_range.end; ++i, ++array_idx) {
-            uint32_t index = i - index_range.start;
-            const auto *descriptor = descriptor_set->GetDescriptorFromGlobalIndex(i);
-
-            if (descriptor->GetClass() == DescriptorClass::InlineUniform) {
-                // Can't validate the descriptor because it may not have been updated.
-                continue;
-            } else if (!descriptor->updated) {
-                auto set = descriptor_set->GetSet();
+    }
+    if (context.dynamic_offsets) {
+        // Validate that dynamic offsets are within the buffer
+        auto buffer_size = buffer_node->createInfo.size;
+        auto range = descriptor.GetRange();
+        auto desc_offset = descriptor.GetOffset();
+        auto dyn_offset = context.dynamic_offsets[index];
+        if (VK_WHOLE_SIZE == range) {
+            if ((dyn_offset + desc_offset) > buffer_size) {
+                auto set = context.descriptor_set->GetSet();
                 return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                "%s encountered the following validation error at %s time: Descriptor in binding #%" PRIu32
-                                " index %" PRIu32
-                                " is being used in draw but has never been updated via vkUpdateDescriptorSets() or a similar call.",
-                                report_data->FormatHandle(set).c_str(), caller, binding, index);
-            } else {
-                auto descriptor_class = descriptor->GetClass();
-                if (descriptor_class == DescriptorClass::GeneralBuffer) {
-                    // Verify that buffers are valid
-                    auto buffer = static_cast<const BufferDescriptor *>(descriptor)->GetBuffer();
-                    auto buffer_node = static_cast<const BufferDescriptor *>(descriptor)->GetBufferState();
-                    if (buffer) {
-                        if (!buffer_node || buffer_node->destroyed) {
-                            auto set = descriptor_set->GetSet();
-                            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                            "%s encountered the following validation error at %s time: Descriptor in "
-                                            "binding #%" PRIu32 " index %" PRIu32
-                                            " is using buffer %s that is invalid or has been destroyed.",
-                                            report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                            report_data->FormatHandle(buffer).c_str());
-                        } else if (!buffer_node->sparse) {
-                            for (auto mem_binding : buffer_node->GetBoundMemory()) {
-                                if (mem_binding->destroyed) {
-                                    auto set = descriptor_set->GetSet();
-                                    return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                                    "%s encountered the following validation error at %s time: Descriptor in "
-                                                    "binding #%" PRIu32 " index %" PRIu32
-                                                    " is uses buffer %s that references invalid memory %s.",
-                                                    report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                                    report_data->FormatHandle(buffer).c_str(),
-                                                    report_data->FormatHandle(mem_binding->mem).c_str());
-                                }
-                            }
-                        }
-                        if (descriptor->IsDynamic()) {
-                            // Validate that dynamic offsets are within the buffer
-                            auto buffer_size = buffer_node->createInfo.size;
-                            auto range = static_cast<const BufferDescriptor *>(descriptor)->GetRange();
-                            auto desc_offset = static_cast<const BufferDescriptor *>(descriptor)->GetOffset();
-                            auto dyn_offset = dynamic_offsets[binding_it.GetDynamicOffsetIndex() + array_idx];
-                            if (VK_WHOLE_SIZE == range) {
-                                if ((dyn_offset + desc_offset) > buffer_size) {
-                                    auto set = descriptor_set->GetSet();
-                                    return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                                    "%s encountered the following validation error at %s time: Descriptor in "
-                                                    "binding #%" PRIu32 " index %" PRIu32
-                                                    " is using buffer %s with update range of VK_WHOLE_SIZE has dynamic offset "
-                                                    "%" PRIu32 " combined with offset %" PRIu64
-                                                    " that oversteps the buffer size of %" PRIu64 ".",
-                                                    report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                                    report_data->FormatHandle(buffer).c_str(), dyn_offset, desc_offset,
-                                                    buffer_size);
-                                }
-                            } else {
-                                if ((dyn_offset + desc_offset + range) > buffer_size) {
-                                    auto set = descriptor_set->GetSet();
-                                    return LogError(
-                                        set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                        "%s encountered the following validation error at %s time: "
-                                        "Descriptor in binding #%" PRIu32 " index %" PRIu32
-                                        " is uses buffer %s with dynamic offset %" PRIu32 " combined with offset %" PRIu64
-                                        " and range %" PRIu64 " that oversteps the buffer size of %" PRIu64 ".",
-                                        report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                        report_data->FormatHandle(buffer).c_str(), dyn_offset, desc_offset, range, buffer_size);
-                                }
-                            }
-                        }
-                    }
-                } else if (descriptor_class == DescriptorClass::ImageSampler || descriptor_class == DescriptorClass::Image) {
-                    VkImageView image_view;
-                    VkImageLayout image_layout;
-                    const IMAGE_VIEW_STATE *image_view_state;
-                    if (descriptor_class == DescriptorClass::ImageSampler) {
-                        image_view = static_cast<const ImageSamplerDescriptor *>(descriptor)->GetImageView();
-                        image_view_state = static_cast<const ImageSamplerDescriptor *>(descriptor)->GetImageViewState();
-                        image_layout = static_cast<const ImageSamplerDescriptor *>(descriptor)->GetImageLayout();
-                    } else {
-                        image_view = static_cast<const ImageDescriptor *>(descriptor)->GetImageView();
-                        image_view_state = static_cast<const ImageDescriptor *>(descriptor)->GetImageViewState();
-                        image_layout = static_cast<const ImageDescriptor *>(descriptor)->GetImageLayout();
-                    }
-
-                    if (image_view) {
-                        if (!image_view_state || image_view_state->destroyed) {
-                            // Image view must have been destroyed since initial update. Could potentially flag the descriptor
-                            //  as "invalid" (updated = false) at DestroyImageView() time and detect this error at bind time
-
-                            auto set = descriptor_set->GetSet();
-                            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                            "%s encountered the following validation error at %s time: Descriptor in "
-                                            "binding #%" PRIu32 " index %" PRIu32
-                                            " is using imageView %s that is invalid or has been destroyed.",
-                                            report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                            report_data->FormatHandle(image_view).c_str());
-                        }
-                        const auto &image_view_ci = image_view_state->create_info;
-
-                        if (reqs & DESCRIPTOR_REQ_ALL_VIEW_TYPE_BITS) {
-                            if (~reqs & (1 << image_view_ci.viewType)) {
-                                auto set = descriptor_set->GetSet();
-                                return LogError(
-                                    set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                    "%s encountered the following validation error at %s time: Descriptor "
-                                    "in binding #%" PRIu32 " index %" PRIu32 " requires an image view of type %s but got %s.",
-                                    report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                    StringDescriptorReqViewType(reqs).c_str(), string_VkImageViewType(image_view_ci.viewType));
-                            }
-
-                            if (!(reqs & image_view_state->descriptor_format_bits)) {
-                                // bad component type
-                                auto set = descriptor_set->GetSet();
-                                return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                                "%s encountered the following validation error at %s time: Descriptor in binding "
-                                                "#%" PRIu32 " index %" PRIu32
-                                                " requires %s component type, but bound descriptor format is %s.",
-                                                report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                                StringDescriptorReqComponentType(reqs), string_VkFormat(image_view_ci.format));
-                            }
-                        }
-
-                        if (!disabled[image_layout_validation]) {
-                            auto image_node = image_view_state->image_state.get();
-                            assert(image_node);
-                            // Verify Image Layout
-                            // No "invalid layout" VUID required for this call, since the optimal_layout parameter is UNDEFINED.
-                            bool hit_error = false;
-                            VerifyImageLayout(cb_node, image_node, image_view_state->normalized_subresource_range,
-                                              image_view_ci.subresourceRange.aspectMask, image_layout, VK_IMAGE_LAYOUT_UNDEFINED,
-                                              caller, kVUIDUndefined, "VUID-VkDescriptorImageInfo-imageLayout-00344", &hit_error);
-                            if (hit_error) {
-                                auto set = descriptor_set->GetSet();
-                                return LogError(
-                                    set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                    "%s encountered the following validation error at %s time: Image layout specified "
-                                    "at vkUpdateDescriptorSet* or vkCmdPushDescriptorSet* time "
-                                    "doesn't match actual image layout at time descriptor is used. See previous error callback for "
-                                    "specific details.",
-                                    report_data->FormatHandle(set).c_str(), caller);
-                            }
-                        }
+                                "%s encountered the following validation error at %s time: Descriptor in "
+                                "binding #%" PRIu32 " index %" PRIu32
+                                " is using buffer %s with update range of VK_WHOLE_SIZE has dynamic offset "
+                                "%" PRIu32 " combined with offset %" PRIu64 " that oversteps the buffer size of %" PRIu64 ".",
+                                report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                                report_data->FormatHandle(buffer).c_str(), dyn_offset, desc_offset, buffer_size);
+            }
+        } else {
+            if ((dyn_offset + desc_offset + range) > buffer_size) {
+                auto set = context.descriptor_set->GetSet();
+                return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                                "%s encountered the following validation error at %s time: "
+                                "Descriptor in binding #%" PRIu32 " index %" PRIu32
+                                " is uses buffer %s with dynamic offset %" PRIu32 " combined with offset %" PRIu64
+                                " and range %" PRIu64 " that oversteps the buffer size of %" PRIu64 ".",
+                                report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                                report_data->FormatHandle(buffer).c_str(), dyn_offset, desc_offset, range, buffer_size);
+            }
+        }
+    }
+    return false;
+}
 
-                        // Verify Sample counts
-                        if ((reqs & DESCRIPTOR_REQ_SINGLE_SAMPLE) && image_view_state->samples != VK_SAMPLE_COUNT_1_BIT) {
-                            auto set = descriptor_set->GetSet();
-                            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                            "%s encountered the following validation error at %s time: Descriptor in "
-                                            "binding #%" PRIu32 " index %" PRIu32
-                                            " requires bound image to have VK_SAMPLE_COUNT_1_BIT but got %s.",
-                                            report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                            string_VkSampleCountFlagBits(image_view_state->samples));
-                        }
-                        if ((reqs & DESCRIPTOR_REQ_MULTI_SAMPLE) && image_view_state->samples == VK_SAMPLE_COUNT_1_BIT) {
-                            auto set = descriptor_set->GetSet();
-                            return LogError(
-                                set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                "%s encountered the following validation error at %s time: Descriptor in binding #%" PRIu32
-                                " index %" PRIu32 " requires bound image to have multiple samples, but got VK_SAMPLE_COUNT_1_BIT.",
-                                report_data->FormatHandle(set).c_str(), caller, binding, index);
-                        }
+bool CoreChecks::ValidateDescriptor(const DescriptorContext &context, uint32_t index,
+                                    const cvdescriptorset::ImageDescriptor &descriptor) const {
+    return ValidateImageDescriptor(context, index, descriptor.GetImageView(), descriptor.GetImageViewState(),
+                                   descriptor.GetImageLayout());
+}
+
+bool CoreChecks::ValidateImageDescriptor(const DescriptorContext &context, uint32_t index, VkImageView image_view,
+                                         const IMAGE_VIEW_STATE *image_view_state, VkImageLayout image_layout) const {
+    if (!image_view) return false;
+    const auto reqs = context.reqs;
+    if (!image_view_state || image_view_state->destroyed) {
+        // Image view must have been destroyed since initial update. Could potentially flag the descriptor
+        //  as "invalid" (updated = false) at DestroyImageView() time and detect this error at bind time
+
+        auto set = context.descriptor_set->GetSet();
+        return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                        "%s encountered the following validation error at %s time: Descriptor in "
+                        "binding #%" PRIu32 " index %" PRIu32 " is using imageView %s that is invalid or has been destroyed.",
+                        report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                        report_data->FormatHandle(image_view).c_str());
+    }
+    const auto &image_view_ci = image_view_state->create_info;
+
+    if (reqs & DESCRIPTOR_REQ_ALL_VIEW_TYPE_BITS) {
+        if (~reqs & (1 << image_view_ci.viewType)) {
+            auto set = context.descriptor_set->GetSet();
+            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                            "%s encountered the following validation error at %s time: Descriptor "
+                            "in binding #%" PRIu32 " index %" PRIu32 " requires an image view of type %s but got %s.",
+                            report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                            StringDescriptorReqViewType(reqs).c_str(), string_VkImageViewType(image_view_ci.viewType));
+        }
+
+        if (!(reqs & image_view_state->descriptor_format_bits)) {
+            // bad component type
+            auto set = context.descriptor_set->GetSet();
+            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                            "%s encountered the following validation error at %s time: Descriptor in binding "
+                            "#%" PRIu32 " index %" PRIu32 " requires %s component type, but bound descriptor format is %s.",
+                            report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                            StringDescriptorReqComponentType(reqs), string_VkFormat(image_view_ci.format));
+        }
+    }
+
+    if (!disabled[image_layout_validation]) {
+        auto image_node = image_view_state->image_state.get();
+        assert(image_node);
+        // Verify Image Layout
+        // No "invalid layout" VUID required for this call, since the optimal_layout parameter is UNDEFINED.
+        bool hit_error = false;
+        VerifyImageLayout(context.cb_node, image_node, image_view_state->normalized_subresource_range,
+                          image_view_ci.subresourceRange.aspectMask, image_layout, VK_IMAGE_LAYOUT_UNDEFINED, context.caller,
+                          kVUIDUndefined, "VUID-VkDescriptorImageInfo-imageLayout-00344", &hit_error);
+        if (hit_error) {
+            auto set = context.descriptor_set->GetSet();
+            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                            "%s encountered the following validation error at %s time: Image layout specified "
+                            "at vkUpdateDescriptorSet* or vkCmdPushDescriptorSet* time "
+                            "doesn't match actual image layout at time descriptor is used. See previous error callback for "
+                            "specific details.",
+                            report_data->FormatHandle(set).c_str(), context.caller);
+        }
+    }
+
+    // Verify Sample counts
+    if ((reqs & DESCRIPTOR_REQ_SINGLE_SAMPLE) && image_view_state->samples != VK_SAMPLE_COUNT_1_BIT) {
+        auto set = context.descriptor_set->GetSet();
+        return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                        "%s encountered the following validation error at %s time: Descriptor in "
+                        "binding #%" PRIu32 " index %" PRIu32 " requires bound image to have VK_SAMPLE_COUNT_1_BIT but got %s.",
+                        report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                        string_VkSampleCountFlagBits(image_view_state->samples));
+    }
+    if ((reqs & DESCRIPTOR_REQ_MULTI_SAMPLE) && image_view_state->samples == VK_SAMPLE_COUNT_1_BIT) {
+        auto set = context.descriptor_set->GetSet();
+        return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                        "%s encountered the following validation error at %s time: Descriptor in binding #%" PRIu32
+                        " index %" PRIu32 " requires bound image to have multiple samples, but got VK_SAMPLE_COUNT_1_BIT.",
+                        report_data->FormatHandle(set).c_str(), context.caller, context.binding, index);
+    }
+
+    // Verify VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT
+    if ((reqs & DESCRIPTOR_REQ_VIEW_ATOMIC_OPERATION) && (context.descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE) &&
+        !(image_view_state->format_features & VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT)) {
+        auto set = context.descriptor_set->GetSet();
+        LogObjectList objlist(set);
+        objlist.add(image_view);
+        return LogError(objlist, context.vuids->imageview_atomic,
+                        "%s encountered the following validation error at %s time: Descriptor in binding #%" PRIu32
+                        " index %" PRIu32
+                        ", %s, format %s, doesn't "
+                        "contain VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT.",
+                        report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                        report_data->FormatHandle(image_view).c_str(), string_VkFormat(image_view_ci.format));
+    }
+
+    // Verify if attachments are used in DescriptorSet, attachment_view_states is empty for input attachments
+    for (uint32_t view_index = 0; view_index < context.attachment_view_states.size(); ++view_index) {
+        const auto view = (*context.attachment_views)[view_index];
+        if (view == image_view) {
+            auto set = context.descriptor_set->GetSet();
+            LogObjectList objlist(set);
+            objlist.add(image_view);
+            objlist.add(context.framebuffer);
+            return LogError(objlist, context.vuids->image_subresources,
+                            "%s encountered the following validation error at %s time: %s is used in "
+                            "Descriptor in binding #%" PRIu32 " index %" PRIu32 " and %s attachment # %" PRIu32 ".",
+                            report_data->FormatHandle(set).c_str(), context.caller, report_data->FormatHandle(image_view).c_str(),
+                            context.binding, index, report_data->FormatHandle(context.framebuffer).c_str(), view_index);
+        }
+        const auto *view_state = context.attachment_view_states[view_index];
+        if (view_state && image_view_state->OverlapSubresource(*view_state)) {
+            auto set = context.descriptor_set->GetSet();
+            LogObjectList objlist(set);
+            objlist.add(image_view);
+            objlist.add(context.framebuffer);
+            objlist.add(view);
+            return LogError(objlist, context.vuids->image_subresources,
+                            "%s encountered the following validation error at %s time: Image subresources of %s in "
+                            "Descriptor in binding #%" PRIu32 " index %" PRIu32 " and %s in %s attachment # %" PRIu32 " overlap.",
+                            report_data->FormatHandle(set).c_str(), context.caller, report_data->FormatHandle(image_view).c_str(),
+                            context.binding, index, report_data->FormatHandle(view).c_str(),
+                            report_data->FormatHandle(context.framebuffer).c_str(), view_index);
+        }
+    }
+    return false;
+}
 
-                        const VkDescriptorType descriptor_type = descriptor_set->GetTypeFromBinding(binding);
-
-                        // Verify VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT
-                        if ((reqs & DESCRIPTOR_REQ_VIEW_ATOMIC_OPERATION) &&
-                            (descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE) &&
-                            !(image_view_state->format_features & VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT)) {
-                            auto set = descriptor_set->GetSet();
-                            LogObjectList objlist(set);
-                            objlist.add(image_view);
-                            return LogError(
-                                objlist, vuids.imageview_atomic,
-                                "%s encountered the following validation error at %s time: Descriptor in binding #%" PRIu32
-                                " index %" PRIu32
-                                ", %s, format %s, doesn't "
-                                "contain VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT.",
-                                report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                report_data->FormatHandle(image_view).c_str(), string_VkFormat(image_view_ci.format));
-                        }
+bool CoreChecks::ValidateDescriptor(const DescriptorContext &context, uint32_t index,
+                                    const cvdescriptorset::ImageSamplerDescriptor &descriptor) const {
+    const auto *image_view_state = descriptor.GetImageViewState();
+    const auto sampler = descriptor.GetSampler();
+    const auto *sampler_state = descriptor.GetSamplerState();
+    bool skip = ValidateImageDescriptor(context, index, descriptor.GetImageView(), image_view_state, descriptor.GetImageLayout());
+    if (!skip) skip = ValidateSamplerDescriptor(context, index, sampler, sampler_state, descriptor.IsImmutableSampler());
+    // The remaining checks need both the view and the sampler
+    if (skip || !image_view_state || image_view_state->destroyed || !sampler_state || sampler_state->destroyed) return skip;
+
+    if ((sampler_state->createInfo.borderColor == VK_BORDER_COLOR_INT_CUSTOM_EXT ||
+         sampler_state->createInfo.borderColor == VK_BORDER_COLOR_FLOAT_CUSTOM_EXT) &&
+        (sampler_state->customCreateInfo.format == VK_FORMAT_UNDEFINED)) {
+        if (image_view_state->create_info.format == VK_FORMAT_B4G4R4A4_UNORM_PACK16 ||
+            image_view_state->create_info.format == VK_FORMAT_B5G6R5_UNORM_PACK16 ||
+            image_view_state->create_info.format == VK_FORMAT_B5G5R5A1_UNORM_PACK16) {
+            auto set = context.descriptor_set->GetSet();
+            LogObjectList objlist(set);
+            objlist.add(sampler);
+            objlist.add(image_view_state->image_view);
+            return LogError(objlist, "VUID-VkSamplerCustomBorderColorCreateInfoEXT-format-04015",
+                            "%s encountered the following validation error at %s time: Sampler %s in "
+                            "binding #%" PRIu32 " index %" PRIu32
+                            " has a custom border color with format = VK_FORMAT_UNDEFINED and is used to "
+                            "sample an image view %s with format %s",
+                            report_data->FormatHandle(set).c_str(), context.caller, report_data->FormatHandle(sampler).c_str(),
+                            context.binding, index, report_data->FormatHandle(image_view_state->image_view).c_str(),
+                            string_VkFormat(image_view_state->create_info.format));
+        }
+    }
+    VkFilter sampler_mag_filter = sampler_state->createInfo.magFilter;
+    VkFilter sampler_min_filter = sampler_state->createInfo.minFilter;
+    if ((sampler_mag_filter == VK_FILTER_LINEAR || sampler_min_filter == VK_FILTER_LINEAR) &&
+        !(image_view_state->format_features & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT)) {
+        auto set = context.descriptor_set->GetSet();
+        LogObjectList objlist(set);
+        objlist.add(sampler);
+        objlist.add(image_view_state->image_view);
+        return LogError(objlist, context.vuids->linear_sampler,
+                        "sampler (%s) in descriptor set (%s) "
+                        "is set to use VK_FILTER_LINEAR, then image view's (%s"
+                        ") format (%s) MUST "
+                        "contain VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT in its format features.",
+                        report_data->FormatHandle(sampler).c_str(), report_data->FormatHandle(set).c_str(),
+                        report_data->FormatHandle(image_view_state->image_view).c_str(),
+                        string_VkFormat(image_view_state->create_info.format));
+    }
+    if ((sampler_mag_filter == VK_FILTER_CUBIC_EXT || sampler_min_filter == VK_FILTER_CUBIC_EXT) &&
+        !(image_view_state->format_features & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_CUBIC_BIT_EXT)) {
+        auto set = context.descriptor_set->GetSet();
+        LogObjectList objlist(set);
+        objlist.add(sampler);
+        objlist.add(image_view_state->image_view);
+        return LogError(objlist, context.vuids->cubic_sampler,
+                        "sampler (%s) in descriptor set (%s) "
+                        "is set to use VK_FILTER_CUBIC_EXT, then image view's (%s"
+                        ") format (%s) MUST "
+                        "contain VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_CUBIC_BIT_EXT in its format features.",
+                        report_data->FormatHandle(sampler).c_str(), report_data->FormatHandle(set).c_str(),
+                        report_data->FormatHandle(image_view_state->image_view).c_str(),
+                        string_VkFormat(image_view_state->create_info.format));
+    }
+
+    // The view holds on to its image's state, no need to look it up
+    const IMAGE_STATE *image_state = image_view_state->image_state.get();
+    if ((image_state->createInfo.flags & VK_IMAGE_CREATE_CORNER_SAMPLED_BIT_NV) &&
+        (sampler_state->createInfo.addressModeU != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE ||
+         sampler_state->createInfo.addressModeV != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE ||
+         sampler_state->createInfo.addressModeW != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE)) {
+        std::string address_mode_letter =
+            (sampler_state->createInfo.addressModeU != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE)
+                ? "U"
+                : (sampler_state->createInfo.addressModeV != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE) ? "V" : "W";
+        VkSamplerAddressMode address_mode =
+            (sampler_state->createInfo.addressModeU != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE)
+                ? sampler_state->createInfo.addressModeU
+                : (sampler_state->createInfo.addressModeV != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE)
+                      ? sampler_state->createInfo.addressModeV
+                      : sampler_state->createInfo.addressModeW;
+        auto set = context.descriptor_set->GetSet();
+        LogObjectList objlist(set);
+        objlist.add(sampler);
+        objlist.add(image_state->image);
+        objlist.add(image_view_state->image_view);
+        return LogError(objlist, context.vuids->corner_sampled_address_mode,
+                        "image (%s) in image view (%s) in descriptor set (%s) is created with flag "
+                        "VK_IMAGE_CREATE_CORNER_SAMPLED_BIT_NV and can only be sampled using "
+                        "VK_SAMPLER_ADDRESS_MODE_CLAMP_EDGE, but sampler (%s) has createInfo.addressMode%s set to %s.",
+                        report_data->FormatHandle(image_state->image).c_str(),
+                        report_data->FormatHandle(image_view_state->image_view).c_str(), report_data->FormatHandle(set).c_str(),
+                        report_data->FormatHandle(sampler).c_str(), address_mode_letter.c_str(),
+                        string_VkSamplerAddressMode(address_mode));
+    }
+    return false;
+}
 
-                        // Verify if attachments are used in DescriptorSet
-                        if (attachment_views.size() > 0 && (descriptor_type != VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT)) {
-                            uint32_t view_index = 0;
-                            for (const auto &view : attachment_views) {
-                                if (view == image_view) {
-                                    auto set = descriptor_set->GetSet();
-                                    LogObjectList objlist(set);
-                                    objlist.add(image_view);
-                                    objlist.add(framebuffer);
-                                    return LogError(objlist, vuids.image_subresources,
-                                                    "%s encountered the following validation error at %s time: %s is used in "
-                                                    "Descriptor in binding #%" PRIu32 " index %" PRIu32
-                                                    " and %s attachment # %" PRIu32 ".",
-                                                    report_data->FormatHandle(set).c_str(), caller,
-                                                    report_data->FormatHandle(image_view).c_str(), binding, index,
-                                                    report_data->FormatHandle(framebuffer).c_str(), view_index);
-                                } else if (view != VK_NULL_HANDLE) {
-                                    const auto *view_state = Get<IMAGE_VIEW_STATE>(view);
-                                    if (image_view_state->OverlapSubresource(*view_state)) {
-                                        auto set = descriptor_set->GetSet();
-                                        LogObjectList objlist(set);
-                                        objlist.add(image_view);
-                                        objlist.add(framebuffer);
-                                        objlist.add(view);
-                                        return LogError(
-                                            objlist, vuids.image_subresources,
-                                            "%s encountered the following validation error at %s time: Image subresources of %s in "
-                                            "Descriptor in binding #%" PRIu32 " index %" PRIu32
-                                            " and %s in %s attachment # %" PRIu32 " overlap.",
-                                            report_data->FormatHandle(set).c_str(), caller,
-                                            report_data->FormatHandle(image_view).c_str(), binding, index,
-                                            report_data->FormatHandle(view).c_str(), report_data->FormatHandle(framebuffer).c_str(),
-                                            view_index);
-                                    }
-                                }
-                                ++view_index;
-                            }
-                        }
-                    }
-                } else if (descriptor_class == DescriptorClass::TexelBuffer) {
-                    auto texel_buffer = static_cast<const TexelDescriptor *>(descriptor);
-                    auto buffer_view = texel_buffer->GetBufferView();
-                    auto buffer_view_state = texel_buffer->GetBufferViewState();
-
-                    if (buffer_view) {
-                        if (!buffer_view_state || buffer_view_state->destroyed) {
-                            auto set = descriptor_set->GetSet();
-                            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                            "%s encountered the following validation error at %s time: Descriptor in "
-                                            "binding #%" PRIu32 " index %" PRIu32
-                                            " is using bufferView %s that is invalid or has been destroyed.",
-                                            report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                            report_data->FormatHandle(buffer_view).c_str());
-                        }
-                        auto buffer = buffer_view_state->create_info.buffer;
-                        auto buffer_state = buffer_view_state->buffer_state.get();
-                        if (buffer_state->destroyed) {
-                            auto set = descriptor_set->GetSet();
-                            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                            "%s encountered the following validation error at %s time: Descriptor in "
-                                            "binding #%" PRIu32 " index %" PRIu32 " is using buffer %s that has been destroyed.",
-                                            report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                            report_data->FormatHandle(buffer).c_str());
-                        }
-                        auto format_bits = DescriptorRequirementsBitsFromFormat(buffer_view_state->create_info.format);
-
-                        if (!(reqs & format_bits)) {
-                            // bad component type
-                            auto set = descriptor_set->GetSet();
-                            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                            "%s encountered the following validation error at %s time: Descriptor in "
-                                            "binding #%" PRIu32 " index %" PRIu32
-                                            " requires %s component type, but bound descriptor format is %s.",
-                                            report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                            StringDescriptorReqComponentType(reqs),
-                                            string_VkFormat(buffer_view_state->create_info.format));
-                        }
+bool CoreChecks::ValidateDescriptor(const DescriptorContext &context, uint32_t index,
+                                    const cvdescriptorset::SamplerDescriptor &descriptor) const {
+    // TODO: Validate 04015 for DescriptorClass::PlainSampler
+    return ValidateSamplerDescriptor(context, index, descriptor.GetSampler(), descriptor.GetSamplerState(),
+                                     descriptor.IsImmutableSampler());
+}
+
+bool CoreChecks::ValidateSamplerDescriptor(const DescriptorContext &context, uint32_t index, VkSampler sampler,
+                                           const SAMPLER_STATE *sampler_state, bool is_immutable) const {
+    // Verify Sampler still valid
+    if (!sampler_state || sampler_state->destroyed) {
+        auto set = context.descriptor_set->GetSet();
+        return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                        "%s encountered the following validation error at %s time: Descriptor in "
+                        "binding #%" PRIu32 " index %" PRIu32 " is using sampler %s that is invalid or has been destroyed.",
+                        report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                        report_data->FormatHandle(sampler).c_str());
+    } else if (sampler_state->samplerConversion && !is_immutable) {
+        auto set = context.descriptor_set->GetSet();
+        return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                        "%s encountered the following validation error at %s time: sampler (%s) "
+                        "in the descriptor set (%s) caontains a YCBCR conversion (%s), then the sampler MUST "
+                        "also exist as an immutable sampler.",
+                        report_data->FormatHandle(set).c_str(), context.caller, report_data->FormatHandle(sampler).c_str(),
+                        report_data->FormatHandle(set).c_str(),
+                        report_data->FormatHandle(sampler_state->samplerConversion).c_str());
+    }
+    return false;
+}
 
-                        // Verify VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_ATOMIC_BIT
-                        if ((reqs & DESCRIPTOR_REQ_VIEW_ATOMIC_OPERATION) &&
-                            (descriptor_set->GetTypeFromBinding(binding) == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER) &&
-                            !(buffer_view_state->format_features & VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_ATOMIC_BIT)) {
-                            auto set = descriptor_set->GetSet();
-                            LogObjectList objlist(set);
-                            objlist.add(buffer_view);
-                            return LogError(
-                                objlist, "UNASSIGNED-None-MismatchAtomicBufferFeature",
-                                "%s encountered the following validation error at %s time: Descriptor in binding #%" PRIu32
-                                " index %" PRIu32
-                                ", %s, format %s, doesn't "
-                                "contain VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT.",
-                                report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                report_data->FormatHandle(buffer_view).c_str(),
-                                string_VkFormat(buffer_view_state->create_info.format));
-                        }
-                    }
-                } else if (descriptor_class == DescriptorClass::AccelerationStructure) {
-                    // Verify that acceleration structures are valid
-                    auto acc = static_cast<const AccelerationStructureDescriptor *>(descriptor)->GetAccelerationStructure();
-                    auto acc_node =
-                        static_cast<const AccelerationStructureDescriptor *>(descriptor)->GetAccelerationStructureState();
-                    if (!acc_node || acc_node->destroyed) {
-                        auto set = descriptor_set->GetSet();
-                        return LogError(
-                            set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                            "%s encountered the following validation error at %s time: Descriptor in binding #%" PRIu32
-                            " index %" PRIu32 " is using acceleration structure %s that is invalid or has been destroyed.",
-                            report_data->FormatHandle(set).c_str(), caller, binding, index, report_data->FormatHandle(acc).c_str());
-                    } else {
-                        for (auto mem_binding : acc_node->GetBoundMemory()) {
-                            if (mem_binding->destroyed) {
-                                auto set = descriptor_set->GetSet();
-                                return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                                "%s encountered the following validation error at %s time: Descriptor in "
-                                                "binding #%" PRIu32 " index %" PRIu32
-                                                " is using acceleration structure %s that references invalid memory %s.",
-                                                report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                                report_data->FormatHandle(acc).c_str(),
-                                                report_data->FormatHandle(mem_binding->mem).c_str());
-                            }
-                        }
-                    }
-                }
-                if (descriptor_class == DescriptorClass::ImageSampler || descriptor_class == DescriptorClass::PlainSampler) {
-                    // Verify Sampler still valid
-                    VkSampler sampler;
-                    const SAMPLER_STATE *sampler_state;
-                    if (descriptor_class == DescriptorClass::ImageSampler) {
-                        sampler = static_cast<const ImageSamplerDescriptor *>(descriptor)->GetSampler();
-                        sampler_state = static_cast<const ImageSamplerDescriptor *>(descriptor)->GetSamplerState();
-                    } else {
-                        sampler = static_cast<const SamplerDescriptor *>(descriptor)->GetSampler();
-                        sampler_state = static_cast<const SamplerDescriptor *>(descriptor)->GetSamplerState();
-                    }
-                    if (!sampler_state || sampler_state->destroyed) {
-                        auto set = descriptor_set->GetSet();
-                        return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                        "%s encountered the following validation error at %s time: Descriptor in "
-                                        "binding #%" PRIu32 " index %" PRIu32
-                                        " is using sampler %s that is invalid or has been destroyed.",
-                                        report_data->FormatHandle(set).c_str(), caller, binding, index,
-                                        report_data->FormatHandle(sampler).c_str());
-                    } else {
-                        if (sampler_state->samplerConversion && !descriptor->IsImmutableSampler()) {
-                            auto set = descriptor_set->GetSet();
-                            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                            "%s encountered the following validation error at %s time: sampler (%s) "
-                                            "in the descriptor set (%s) caontains a YCBCR conversion (%s), then the sampler MUST "
-                                            "also exist as an immutable sampler.",
-                                            report_data->FormatHandle(set).c_str(), caller,
-                                            report_data->FormatHandle(sampler).c_str(),
-                                            report_data->FormatHandle(descriptor_set->GetSet()).c_str(),
-                                            report_data->FormatHandle(sampler_state->samplerConversion).c_str());
-                        }
-                    }
-                    // TODO: Validate 04015 for DescriptorClass::PlainSampler
-                    if (descriptor_class == DescriptorClass::ImageSampler) {
-                        const IMAGE_VIEW_STATE *image_view_state;
-                        image_view_state = static_cast<const ImageSamplerDescriptor *>(descriptor)->GetImageViewState();
-                        if ((sampler_state->createInfo.borderColor == VK_BORDER_COLOR_INT_CUSTOM_EXT ||
-                             sampler_state->createInfo.borderColor == VK_BORDER_COLOR_FLOAT_CUSTOM_EXT) &&
-                            (sampler_state->customCreateInfo.format == VK_FORMAT_UNDEFINED)) {
-                            if (image_view_state->create_info.format == VK_FORMAT_B4G4R4A4_UNORM_PACK16 ||
-                                image_view_state->create_info.format == VK_FORMAT_B5G6R5_UNORM_PACK16 ||
-                                image_view_state->create_info.format == VK_FORMAT_B5G5R5A1_UNORM_PACK16) {
-                                auto set = descriptor_set->GetSet();
-                                LogObjectList objlist(set);
-                                objlist.add(sampler);
-                                objlist.add(image_view_state->image_view);
-                                return LogError(objlist, "VUID-VkSamplerCustomBorderColorCreateInfoEXT-format-04015",
-                                                "%s encountered the following validation error at %s time: Sampler %s in "
-                                                "binding #%" PRIu32 " index %" PRIu32
-                                                " has a custom border color with format = VK_FORMAT_UNDEFINED and is used to "
-                                                "sample an image view %s with format %s",
-                                                report_data->FormatHandle(set).c_str(), caller,
-                                                report_data->FormatHandle(sampler).c_str(), binding, index,
-                                                report_data->FormatHandle(image_view_state->image_view).c_str(),
-                                                string_VkFormat(image_view_state->create_info.format));
-                            }
-                        }
-                        VkFilter sampler_mag_filter = sampler_state->createInfo.magFilter;
-                        VkFilter sampler_min_filter = sampler_state->createInfo.minFilter;
-                        if ((sampler_mag_filter == VK_FILTER_LINEAR || sampler_min_filter == VK_FILTER_LINEAR) &&
-                            !(image_view_state->format_features & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT)) {
-                            auto set = descriptor_set->GetSet();
-                            LogObjectList objlist(set);
-                            objlist.add(sampler);
-                            objlist.add(image_view_state->image_view);
-                            return LogError(objlist, vuids.linear_sampler,
-                                            "sampler (%s) in descriptor set (%s) "
-                                            "is set to use VK_FILTER_LINEAR, then image view's (%s"
-                                            ") format (%s) MUST "
-                                            "contain VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT in its format features.",
-                                            report_data->FormatHandle(sampler).c_str(), report_data->FormatHandle(set).c_str(),
-                                            report_data->FormatHandle(image_view_state->image_view).c_str(),
-                                            string_VkFormat(image_view_state->create_info.format));
-                        }
-                        if ((sampler_mag_filter == VK_FILTER_CUBIC_EXT || sampler_min_filter == VK_FILTER_CUBIC_EXT) &&
-                            !(image_view_state->format_features & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_CUBIC_BIT_EXT)) {
-                            auto set = descriptor_set->GetSet();
-                            LogObjectList objlist(set);
-                            objlist.add(sampler);
-                            objlist.add(image_view_state->image_view);
-                            return LogError(objlist, vuids.cubic_sampler,
-                                            "sampler (%s) in descriptor set (%s) "
-                                            "is set to use VK_FILTER_CUBIC_EXT, then image view's (%s"
-                                            ") format (%s) MUST "
-                                            "contain VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_CUBIC_BIT_EXT in its format features.",
-                                            report_data->FormatHandle(sampler).c_str(), report_data->FormatHandle(set).c_str(),
-                                            report_data->FormatHandle(image_view_state->image_view).c_str(),
-                                            string_VkFormat(image_view_state->create_info.format));
-                        }
+bool CoreChecks::ValidateDescriptor(const DescriptorContext &context, uint32_t index,
+                                    const cvdescriptorset::TexelDescriptor &descriptor) const {
+    auto buffer_view = descriptor.GetBufferView();
+    auto buffer_view_state = descriptor.GetBufferViewState();
+    if (!buffer_view) return false;
+    const auto reqs = context.reqs;
+    if (!buffer_view_state || buffer_view_state->destroyed) {
+        auto set = context.descriptor_set->GetSet();
+        return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                        "%s encountered the following validation error at %s time: Descriptor in "
+                        "binding #%" PRIu32 " index %" PRIu32 " is using bufferView %s that is invalid or has been destroyed.",
+                        report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                        report_data->FormatHandle(buffer_view).c_str());
+    }
+    auto buffer = buffer_view_state->create_info.buffer;
+    auto buffer_state = buffer_view_state->buffer_state.get();
+    if (buffer_state->destroyed) {
+        auto set = context.descriptor_set->GetSet();
+        return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                        "%s encountered the following validation error at %s time: Descriptor in "
+                        "binding #%" PRIu32 " index %" PRIu32 " is using buffer %s that has been destroyed.",
+                        report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                        report_data->FormatHandle(buffer).c_str());
+    }
+    auto format_bits = DescriptorRequirementsBitsFromFormat(buffer_view_state->create_info.format);
+
+    if (!(reqs & format_bits)) {
+        // bad component type
+        auto set = context.descriptor_set->GetSet();
+        return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                        "%s encountered the following validation error at %s time: Descriptor in "
+                        "binding #%" PRIu32 " index %" PRIu32 " requires %s component type, but bound descriptor format is %s.",
+                        report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                        StringDescriptorReqComponentType(reqs), string_VkFormat(buffer_view_state->create_info.format));
+    }
+
+    // Verify VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_ATOMIC_BIT
+    if ((reqs & DESCRIPTOR_REQ_VIEW_ATOMIC_OPERATION) && (context.descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER) &&
+        !(buffer_view_state->format_features & VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_ATOMIC_BIT)) {
+        auto set = context.descriptor_set->GetSet();
+        LogObjectList objlist(set);
+        objlist.add(buffer_view);
+        return LogError(objlist, "UNASSIGNED-None-MismatchAtomicBufferFeature",
+                        "%s encountered the following validation error at %s time: Descriptor in binding #%" PRIu32
+                        " index %" PRIu32
+                        ", %s, format %s, doesn't "
+                        "contain VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT.",
+                        report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                        report_data->FormatHandle(buffer_view).c_str(), string_VkFormat(buffer_view_state->create_info.format));
+    }
+    return false;
+}
 
-                        const IMAGE_STATE *image_state;
-                        image_state = GetImageState(image_view_state->create_info.image);
-                        if ((image_state->createInfo.flags & VK_IMAGE_CREATE_CORNER_SAMPLED_BIT_NV) &&
-                            (sampler_state->createInfo.addressModeU != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE ||
-                             sampler_state->createInfo.addressModeV != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE ||
-                             sampler_state->createInfo.addressModeW != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE)) {
-                            std::string address_mode_letter =
-                                (sampler_state->createInfo.addressModeU != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE)
-                                    ? "U"
-                                    : (sampler_state->createInfo.addressModeV != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE) ? "V" : "W";
-                            VkSamplerAddressMode address_mode =
-                                (sampler_state->createInfo.addressModeU != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE)
-                                    ? sampler_state->createInfo.addressModeU
-                                    : (sampler_state->createInfo.addressModeV != VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE)
-                                          ? sampler_state->createInfo.addressModeV
-                                          : sampler_state->createInfo.addressModeW;
-                            auto set = descriptor_set->GetSet();
-                            LogObjectList objlist(set);
-                            objlist.add(sampler);
-                            objlist.add(image_state->image);
-                            objlist.add(image_view_state->image_view);
-                            return LogError(
-                                objlist, vuids.corner_sampled_address_mode,
-                                "image (%s) in image view (%s) in descriptor set (%s) is created with flag "
-                                "VK_IMAGE_CREATE_CORNER_SAMPLED_BIT_NV and can only be sampled using "
-                                "VK_SAMPLER_ADDRESS_MODE_CLAMP_EDGE, but sampler (%s) has createInfo.addressMode%s set to %s.",
-                                report_data->FormatHandle(image_state->image).c_str(),
-                                report_data->FormatHandle(image_view_state->image_view).c_str(),
-                                report_data->FormatHandle(set).c_str(), report_data->FormatHandle(sampler).c_str(),
-                                address_mode_letter.c_str(), string_VkSamplerAddressMode(address_mode));
-                        }
-                    }
-                }
-            }
+bool CoreChecks::ValidateDescriptor(const DescriptorContext &context, uint32_t index,
+                                    const cvdescriptorset::AccelerationStructureDescriptor &descriptor) const {
+    // Verify that acceleration structures are valid
+    auto acc = descriptor.GetAccelerationStructure();
+    auto acc_node = descriptor.GetAccelerationStructureState();
+    if (!acc_node || acc_node->destroyed) {
+        auto set = context.descriptor_set->GetSet();
+        return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                        "%s encountered the following validation error at %s time: Descriptor in binding #%" PRIu32
+                        " index %" PRIu32 " is using acceleration structure %s that is invalid or has been destroyed.",
+                        report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                        report_data->FormatHandle(acc).c_str());
+    }
+    for (auto mem_binding : acc_node->GetBoundMemory()) {
+        if (mem_binding->destroyed) {
+            auto set = context.descriptor_set->GetSet();
+            return LogError(set, kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                            "%s encountered the following validation error at %s time: Descriptor in "
+                            "binding #%" PRIu32 " index %" PRIu32
+                            " is using acceleration structure %s that references invalid memory %s.",
+                            report_data->FormatHandle(set).c_str(), context.caller, context.binding, index,
+                            report_data->FormatHandle(acc).c_str(), report_data->FormatHandle(mem_binding->mem).c_str());
         }
     }
     return false;
@@ -1491,10 +1504,36 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
 // TODO: Modify the UpdateDrawState virtural functions to *only* set initial layout and not change layouts
 // Prereq: This should be called for a set that has been confirmed to be active for the given cb_node, meaning it's going
 //   to be used in a draw by the given cb_node
+// Set the initial layout of an image or image sampler descriptor's view in cb_node without binding any resources
+static void SetDescriptorInitialLayout(ValidationStateTracker *device_data, CMD_BUFFER_STATE *cb_node,
+                                       cvdescriptorset::Descriptor *descriptor) {
+    IMAGE_VIEW_STATE *iv_state = nullptr;
+    VkImageLayout image_layout = VK_IMAGE_LAYOUT_UNDEFINED;
+    switch (descriptor->GetClass()) {
+        case cvdescriptorset::ImageSampler: {
+            auto image_sampler_descriptor = static_cast<cvdescriptorset::ImageSamplerDescriptor *>(descriptor);
+            iv_state = image_sampler_descriptor->GetImageViewState();
+            image_layout = image_sampler_descriptor->GetImageLayout();
+            break;
+        }
+        case cvdescriptorset::Image: {
+            auto image_descriptor = static_cast<cvdescriptorset::ImageDescriptor *>(descriptor);
+            iv_state = image_descriptor->GetImageViewState();
+            image_layout = image_descriptor->GetImageLayout();
+            break;
+        }
+        default:
+            break;
+    }
+    if (iv_state) {
+        device_data->CallSetImageViewInitialLayoutCallback(cb_node, *iv_state, image_layout);
+    }
+}
+
 void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, CMD_BUFFER_STATE *cb_node,
                                                      CMD_TYPE cmd_type, const PIPELINE_STATE *pipe,
                                                      const std::map<uint32_t, descriptor_req> &binding_req_map,
-                                                     const char *function) {
+                                                     const char *function, bool defer_resources) {
     if (!device_data->disabled[command_buffer_state] && !IsPushDescriptor()) {
         // bind cb to this descriptor set
         // Add bindings for descriptor set, the set's pool, and individual objects in the set
@@ -1532,8 +1571,15 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
             continue;
         }
         auto range = p_layout_->GetGlobalIndexRangeFromIndex(index);
-        for (uint32_t i = range.start; i < range.end; ++i) {
-            descriptors_[i]->UpdateDrawState(device_data, cb_node);
+        if (!defer_resources) {
+            for (uint32_t i = range.start; i < range.end; ++i) {
+                descriptors_[i]->UpdateDrawState(device_data, cb_node);
+            }
+        } else if (!device_data->disabled[image_layout_validation]) {
+            // Layouts are still set per draw, as later layout transitions in cb_node depend on them
+            for (uint32_t i = range.start; i < range.end; ++i) {
+                SetDescriptorInitialLayout(device_data, cb_node, descriptors_[i].get());
+            }
         }
     }
 
@@ -1549,6 +1595,22 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
     }
 }
 
+void cvdescriptorset::DescriptorSet::BindCommandBufferResources(ValidationStateTracker *device_data, CMD_BUFFER_STATE *cb_node,
+                                                                const BindingReqMap &binding_req_map) {
+    for (const auto &binding_req_pair : binding_req_map) {
+        auto index = p_layout_->GetIndexFromBinding(binding_req_pair.first);
+        // Matches UpdateDrawState, which records no state for PARTIALLY_BOUND or UPDATE_AFTER_BIND descriptors
+        auto flags = p_layout_->GetDescriptorBindingFlagsFromIndex(index);
+        if (flags & (VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT)) {
+            continue;
+        }
+        auto range = p_layout_->GetGlobalIndexRangeFromIndex(index);
+        for (uint32_t i = range.start; i < range.end; ++i) {
+            descriptors_[i]->BindCommandBuffer(device_data, cb_node);
+        }
+    }
+}
+
 void cvdescriptorset::DescriptorSet::FilterOneBindingReq(const BindingReqMap::value_type &binding_req_pair, BindingReqMap *out_req,
                                                          const TrackedBindings &bindings, uint32_t limit) {
     if (bindings.size() < limit) {
@@ -1560,15 +1622,18 @@ void cvdescriptorset::DescriptorSet::FilterOneBindingReq(const BindingReqMap::va
 void cvdescriptorset::DescriptorSet::FilterBindingReqs(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline,
                                                        const BindingReqMap &in_req, BindingReqMap *out_req) const {
     // For const cleanliness we have to find in the maps...
+    std::unique_lock<std::mutex> lock(cached_validation_lock_);
     const auto validated_it = cached_validation_.find(&cb_state);
-    if (validated_it == cached_validation_.cend()) {
+    const CachedValidation *cached = (validated_it != cached_validation_.cend()) ? &validated_it->second : nullptr;
+    lock.unlock();
+    if (!cached) {
         // We have nothing validated, copy in to out
         for (const auto &binding_req_pair : in_req) {
             out_req->emplace(binding_req_pair);
         }
         return;
     }
-    const auto &validated = validated_it->second;
+    const auto &validated = *cached;
 
     const auto image_sample_version_it = validated.image_samplers.find(&pipeline);
     const VersionedBindings *image_sample_version = nullptr;
@@ -1612,7 +1677,9 @@ void cvdescriptorset::DescriptorSet::FilterBindingReqs(const CMD_BUFFER_STATE &c
 void cvdescriptorset::DescriptorSet::UpdateValidationCache(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline,
                                                            const BindingReqMap &updated_bindings) {
     // For const cleanliness we have to find in the maps...
+    std::unique_lock<std::mutex> lock(cached_validation_lock_);
     auto &validated = cached_validation_[&cb_state];
+    lock.unlock();
 
     auto &image_sample_version = validated.image_samplers[&pipeline];
     auto &dynamic_buffers = validated.dynamic_buffers;
@@ -1920,7 +1987,7 @@ void cvdescriptorset::SamplerDescriptor::CopyUpdate(const ValidationStateTracker
     updated = true;
 }
 
-void cvdescriptorset::SamplerDescriptor::UpdateDrawState(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
+void cvdescriptorset::SamplerDescriptor::BindCommandBuffer(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
     if (!immutable_) {
         auto sampler_state = GetSamplerState();
         if (sampler_state) dev_data->AddCommandBufferBindingSampler(cb_node, sampler_state);
@@ -1965,7 +2032,7 @@ void cvdescriptorset::ImageSamplerDescriptor::CopyUpdate(const ValidationStateTr
     image_view_state_ = dev_data->GetConstCastShared<IMAGE_VIEW_STATE>(image_view_);
 }
 
-void cvdescriptorset::ImageSamplerDescriptor::UpdateDrawState(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
+void cvdescriptorset::ImageSamplerDescriptor::BindCommandBuffer(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
     // First add binding for any non-immutable sampler
     if (!immutable_) {
         auto sampler_state = GetSamplerState();
@@ -1975,6 +2042,13 @@ void cvdescriptorset::ImageSamplerDescriptor::UpdateDrawState(ValidationStateTra
     auto iv_state = GetImageViewState();
     if (iv_state) {
         dev_data->AddCommandBufferBindingImageView(cb_node, iv_state);
+    }
+}
+
+void cvdescriptorset::ImageSamplerDescriptor::UpdateDrawState(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
+    BindCommandBuffer(dev_data, cb_node);
+    auto iv_state = GetImageViewState();
+    if (iv_state) {
         dev_data->CallSetImageViewInitialLayoutCallback(cb_node, *iv_state, image_layout_);
     }
 }
@@ -2004,11 +2078,18 @@ void cvdescriptorset::ImageDescriptor::CopyUpdate(const ValidationStateTracker *
     image_view_state_ = dev_data->GetConstCastShared<IMAGE_VIEW_STATE>(image_view_);
 }
 
-void cvdescriptorset::ImageDescriptor::UpdateDrawState(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
+void cvdescriptorset::ImageDescriptor::BindCommandBuffer(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
     // Add binding for image
     auto iv_state = GetImageViewState();
     if (iv_state) {
         dev_data->AddCommandBufferBindingImageView(cb_node, iv_state);
+    }
+}
+
+void cvdescriptorset::ImageDescriptor::UpdateDrawState(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
+    BindCommandBuffer(dev_data, cb_node);
+    auto iv_state = GetImageViewState();
+    if (iv_state) {
         dev_data->CallSetImageViewInitialLayoutCallback(cb_node, *iv_state, image_layout_);
     }
 }
@@ -2045,7 +2126,7 @@ void cvdescriptorset::BufferDescriptor::CopyUpdate(const ValidationStateTracker
     buffer_state_ = dev_data->GetConstCastShared<BUFFER_STATE>(buffer_);
 }
 
-void cvdescriptorset::BufferDescriptor::UpdateDrawState(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
+void cvdescriptorset::BufferDescriptor::BindCommandBuffer(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
     auto buffer_node = GetBufferState();
     if (buffer_node) dev_data->AddCommandBufferBindingBuffer(cb_node, buffer_node);
 }
@@ -2069,7 +2150,7 @@ void cvdescriptorset::TexelDescriptor::CopyUpdate(const ValidationStateTracker *
     buffer_view_state_ = dev_data->GetConstCastShared<BUFFER_VIEW_STATE>(buffer_view_);
 }
 
-void cvdescriptorset::TexelDescriptor::UpdateDrawState(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
+void cvdescriptorset::TexelDescriptor::BindCommandBuffer(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
     auto bv_state = GetBufferViewState();
     if (bv_state) {
         dev_data->AddCommandBufferBindingBufferView(cb_node, bv_state);
@@ -2097,8 +2178,8 @@ void cvdescriptorset::AccelerationStructureDescriptor::CopyUpdate(const Validati
     acc_state_ = dev_data->GetConstCastShared<ACCELERATION_STRUCTURE_STATE>(acc_);
 }
 
-void cvdescriptorset::AccelerationStructureDescriptor::UpdateDrawState(ValidationStateTracker *dev_data,
-                                                                       CMD_BUFFER_STATE *cb_node) {
+void cvdescriptorset::AccelerationStructureDescriptor::BindCommandBuffer(ValidationStateTracker *dev_data,
+                                                                         CMD_BUFFER_STATE *cb_node) {
     auto acc_node = GetAccelerationStructureState();
     if (acc_node) dev_data->AddCommandBufferBindingAccelerationStructure(cb_node, acc_node);
 }
@@ -29,6 +29,7 @@
 #include "vk_object_types.h"
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -360,7 +361,11 @@ class Descriptor {
     virtual void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) = 0;
     virtual void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) = 0;
     // Create binding between resources of this descriptor and given cb_node
-    virtual void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) = 0;
+    virtual void BindCommandBuffer(ValidationStateTracker *, CMD_BUFFER_STATE *) = 0;
+    // Bind resources and set the initial layouts of the descriptor's images in cb_node
+    virtual void UpdateDrawState(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
+        BindCommandBuffer(dev_data, cb_node);
+    }
     virtual DescriptorClass GetClass() const { return descriptor_class; };
     // Special fast-path check for SamplerDescriptors that are immutable
     virtual bool IsImmutableSampler() const { return false; };
@@ -389,7 +394,7 @@ class SamplerDescriptor : public Descriptor {
     SamplerDescriptor(const ValidationStateTracker *dev_data, const VkSampler *);
     void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
     void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
+    void BindCommandBuffer(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
     virtual bool IsImmutableSampler() const override { return immutable_; };
     VkSampler GetSampler() const { return sampler_; }
     const SAMPLER_STATE *GetSamplerState() const { return sampler_state_.get(); }
@@ -406,6 +411,7 @@ class ImageSamplerDescriptor : public Descriptor {
     ImageSamplerDescriptor(const ValidationStateTracker *dev_data, const VkSampler *);
     void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
     void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
+    void BindCommandBuffer(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
     void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
     virtual bool IsImmutableSampler() const override { return immutable_; };
     VkSampler GetSampler() const { return sampler_; }
@@ -430,6 +436,7 @@ class ImageDescriptor : public Descriptor {
     ImageDescriptor(const VkDescriptorType);
     void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
     void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
+    void BindCommandBuffer(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
     void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
     virtual bool IsStorage() const override { return storage_; }
     VkImageView GetImageView() const { return image_view_; }
@@ -449,7 +456,7 @@ class TexelDescriptor : public Descriptor {
     TexelDescriptor(const VkDescriptorType);
     void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
     void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
+    void BindCommandBuffer(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
     virtual bool IsStorage() const override { return storage_; }
     VkBufferView GetBufferView() const { return buffer_view_; }
     const BUFFER_VIEW_STATE *GetBufferViewState() const { return buffer_view_state_.get(); }
@@ -466,7 +473,7 @@ class BufferDescriptor : public Descriptor {
     BufferDescriptor(const VkDescriptorType);
     void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
     void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
+    void BindCommandBuffer(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
     virtual bool IsDynamic() const override { return dynamic_; }
     virtual bool IsStorage() const override { return storage_; }
     VkBuffer GetBuffer() const { return buffer_; }
@@ -494,7 +501,7 @@ class InlineUniformDescriptor : public Descriptor {
         updated = true;
     }
     void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override { updated = true; }
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override {}
+    void BindCommandBuffer(ValidationStateTracker *, CMD_BUFFER_STATE *) override {}
 };
 
 class AccelerationStructureDescriptor : public Descriptor {
@@ -505,7 +512,7 @@ class AccelerationStructureDescriptor : public Descriptor {
     const ACCELERATION_STRUCTURE_STATE *GetAccelerationStructureState() const { return acc_state_.get(); }
     ACCELERATION_STRUCTURE_STATE *GetAccelerationStructureState() { return acc_state_.get(); }
     void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
+    void BindCommandBuffer(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
 
   private:
     VkAccelerationStructureKHR acc_;
@@ -628,8 +635,11 @@ class DescriptorSet : public BASE_NODE {
     VkDescriptorSet GetSet() const { return set_; };
     // Bind given cmd_buffer to this descriptor set and
     // update CB image layout map with image/imagesampler descriptor image layouts
+    // When defer_resources is set, the descriptors' resources are left for BindCommandBufferResources
     void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *, CMD_TYPE cmd_type, const PIPELINE_STATE *,
-                         const std::map<uint32_t, descriptor_req> &, const char *function);
+                         const std::map<uint32_t, descriptor_req> &, const char *function, bool defer_resources = false);
+    // Bind the resources of the given bindings' descriptors to cmd_buffer, completing a deferred UpdateDrawState
+    void BindCommandBufferResources(ValidationStateTracker *, CMD_BUFFER_STATE *, const BindingReqMap &);
 
     // Track work that has been bound or validated to avoid duplicate work, important when large descriptor arrays
     // are present
@@ -641,9 +651,13 @@ class DescriptorSet : public BASE_NODE {
     void UpdateValidationCache(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline,
                                const BindingReqMap &updated_bindings);
     void ClearCachedDynamicDescriptorValidation(CMD_BUFFER_STATE *cb_state) {
+        std::lock_guard<std::mutex> lock(cached_validation_lock_);
         cached_validation_[cb_state].dynamic_buffers.clear();
     }
-    void ClearCachedValidation(CMD_BUFFER_STATE *cb_state) { cached_validation_.erase(cb_state); }
+    void ClearCachedValidation(CMD_BUFFER_STATE *cb_state) {
+        std::lock_guard<std::mutex> lock(cached_validation_lock_);
+        cached_validation_.erase(cb_state);
+    }
     VkSampler const *GetImmutableSamplerPtrFromBinding(const uint32_t index) const {
         return p_layout_->GetImmutableSamplerPtrFromBinding(index);
     };
@@ -683,10 +697,12 @@ class DescriptorSet : public BASE_NODE {
     VkDescriptorSet set_;
     DESCRIPTOR_POOL_STATE *pool_state_;
     const std::shared_ptr<DescriptorSetLayout const> p_layout_;
+    using DescriptorPtr = std::unique_ptr<Descriptor, DescriptorDeleter>;
     // NOTE: the the backing store for the descriptors must be declared *before* it so it will be destructed *after* it
     // "Destructors for nonstatic member objects are called in the reverse order in which they appear in the class declaration."
-    std::vector<DescriptorBackingStore> descriptor_store_;
-    std::vector<std::unique_ptr<Descriptor, DescriptorDeleter>> descriptors_;
+    // Both are carved from the pool's arena when it has one, see DESCRIPTOR_POOL_STATE::set_arena
+    std::vector<DescriptorBackingStore, DescriptorSetArenaAllocator<DescriptorBackingStore>> descriptor_store_;
+    std::vector<DescriptorPtr, DescriptorSetArenaAllocator<DescriptorPtr>> descriptors_;
     const StateTracker *state_data_;
     uint32_t variable_count_;
     uint64_t change_count_;
@@ -711,19 +727,26 @@ class DescriptorSet : public BASE_NODE {
     typedef std::unordered_map<const CMD_BUFFER_STATE *, CachedValidation> CachedValidationMap;
     // Image and ImageView bindings are validated per pipeline and not invalidate by repeated binding
     CachedValidationMap cached_validation_;
+    // A set can be bound to command buffers being recorded concurrently (see cmd_buffer_local_locking). Guards the map only,
+    // each entry is touched solely by hooks of the command buffer it is keyed on.
+    mutable std::mutex cached_validation_lock_;
 };
 // For the "bindless" style resource usage with many descriptors, need to optimize binding and validation
 class PrefilterBindRequestMap {
   public:
-    static const uint32_t kManyDescriptors_ = 64;  // TODO base this number on measured data
+    static const uint32_t kManyDescriptors_ = 64;
+    // Used with lazy descriptor binding unless overridden by lazy_descriptor_binding_threshold: the number of descriptors bound
+    // to a command buffer within 2 us at the 11.2 ns per descriptor measured by the DescriptorBinding benchmark
+    static const uint32_t kLazyBindingManyDescriptors_ = 178;
     std::unique_ptr<BindingReqMap> filtered_map_;
     const BindingReqMap &orig_map_;
     const DescriptorSet &descriptor_set_;
+    const uint32_t many_descriptors_;
 
-    PrefilterBindRequestMap(const DescriptorSet &ds, const BindingReqMap &in_map)
-        : filtered_map_(), orig_map_(in_map), descriptor_set_(ds) {}
+    PrefilterBindRequestMap(const DescriptorSet &ds, const BindingReqMap &in_map, uint32_t many_descriptors = kManyDescriptors_)
+        : filtered_map_(), orig_map_(in_map), descriptor_set_(ds), many_descriptors_(many_descriptors) {}
     const BindingReqMap &FilteredMap(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &);
-    bool IsManyDescriptors() const { return descriptor_set_.GetTotalDescriptorCount() > kManyDescriptors_; }
+    bool IsManyDescriptors() const { return descriptor_set_.GetTotalDescriptorCount() > many_descriptors_; }
 };
 }  // namespace cvdescriptorset
 #endif  // CORE_VALIDATION_DESCRIPTOR_SETS_H_
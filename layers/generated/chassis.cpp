@@ -36,9 +36,9 @@ small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 
 // Global unique object identifier.
 std::atomic<uint64_t> global_unique_id(1ULL);
-// Map uniqueID to actual object handle. Accesses to the map itself are
-// internally synchronized.
-vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+// Map uniqueID to actual object handle. Accesses to the table itself are
+// internally synchronized, and lookups don't lock.
+vl_concurrent_handle_table unique_id_mapping;
 
 bool wrap_handles = true;
 
@@ -47,6 +47,7 @@ bool wrap_handles = true;
 
 // Include layer validation object definitions
 #include "best_practices_validation.h"
+#include "command_counter.h"
 #include "core_validation.h"
 #include "gpu_validation.h"
 #include "object_lifetime_validation.h"
@@ -268,9 +269,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     // Set up enable and disable features flags
     CHECK_ENABLED local_enables {};
     CHECK_DISABLED local_disables {};
+    bool async_message_delivery = false;
     ConfigAndEnvSettings config_and_env_settings_data {OBJECT_LAYER_DESCRIPTION, pCreateInfo->pNext, local_enables, local_disables,
-        report_data->filter_message_ids, &report_data->duplicate_message_limit};
+        report_data->filter_message_ids, &report_data->duplicate_message_limit, &async_message_delivery};
     ProcessConfigAndEnvSettings(&config_and_env_settings_data);
+    if (async_message_delivery) {
+        report_data->async_delivery.reset(new AsyncMessageDelivery());
+    }
     layer_debug_messenger_actions(report_data, pAllocator, OBJECT_LAYER_DESCRIPTION);
 
     // Create temporary dispatch vector for pre-calls until instance is created
@@ -503,6 +508,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         }
     }
 
+    device_interceptor->InitObjectDispatchVectors();
+    device_interceptor->hook_profile.reset(HookProfile::Create());
+
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
@@ -534,6 +542,8 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
 
+    if (layer_data->hook_profile) layer_data->hook_profile->Report("vkDestroyDevice");
+
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
     }
@@ -558,11 +568,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     for (auto intercept : layer_data->object_dispatch) {
         cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateGraphicsPipelines, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateGraphicsPipelines, intercept->container_type);
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
     }
 
@@ -573,6 +585,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateGraphicsPipelines, intercept->container_type);
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(cgpl_state[intercept->container_type]));
     }
     return result;
@@ -594,11 +607,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     for (auto intercept : layer_data->object_dispatch) {
         ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateComputePipelines, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateComputePipelines, intercept->container_type);
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
     }
 
@@ -609,6 +624,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateComputePipelines, intercept->container_type);
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(ccpl_state[intercept->container_type]));
     }
     return result;
@@ -629,12 +645,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateRayTracingPipelinesNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateRayTracingPipelinesNV, intercept->container_type);
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -643,6 +661,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateRayTracingPipelinesNV, intercept->container_type);
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -664,12 +683,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateRayTracingPipelinesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesKHR(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateRayTracingPipelinesKHR, intercept->container_type);
         intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -678,6 +699,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateRayTracingPipelinesKHR, intercept->container_type);
         intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -698,16 +720,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreatePipelineLayout, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreatePipelineLayout, intercept->container_type);
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreatePipelineLayout, intercept->container_type);
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
     return result;
@@ -727,16 +752,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateShaderModule, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateShaderModule, intercept->container_type);
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
+    // Post-call hooks only add the new module to the state tracker maps, see shared_lock_post_record_functions
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateShaderModule, intercept->container_type);
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
     return result;
@@ -754,17 +783,20 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
     for (auto intercept : layer_data->object_dispatch) {
         ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateAllocateDescriptorSets, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateDescriptorSets(device,
             pAllocateInfo, pDescriptorSets, &(ads_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordAllocateDescriptorSets, intercept->container_type);
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordAllocateDescriptorSets, intercept->container_type);
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets,
             result, &(ads_state[intercept->container_type]));
     }
@@ -785,16 +817,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateBuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateBuffer, intercept->container_type);
         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, &cb_state);
     }
     VkResult result = DispatchCreateBuffer(device, &cb_state.modified_create_info, pAllocator, pBuffer);
+    // Post-call hooks only add the new buffer to the state tracker maps, see shared_lock_post_record_functions
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateBuffer, intercept->container_type);
         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     }
     return result;
@@ -1084,18 +1120,21 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(
     VkQueue*                                    pQueue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeviceQueue, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceQueue]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeviceQueue, intercept->container_type);
         intercept->PreCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
     DispatchGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceQueue]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeviceQueue, intercept->container_type);
         intercept->PostCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
 }
@@ -1107,18 +1146,21 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(
     VkFence                                     fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateQueueSubmit, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordQueueSubmit, intercept->container_type);
         intercept->PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
     }
     VkResult result = DispatchQueueSubmit(queue, submitCount, pSubmits, fence);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordQueueSubmit, intercept->container_type);
         intercept->PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
     }
     return result;
@@ -1128,18 +1170,21 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(
     VkQueue                                     queue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueWaitIdle]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateQueueWaitIdle, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueWaitIdle(queue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueWaitIdle]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordQueueWaitIdle, intercept->container_type);
         intercept->PreCallRecordQueueWaitIdle(queue);
     }
     VkResult result = DispatchQueueWaitIdle(queue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueWaitIdle]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordQueueWaitIdle, intercept->container_type);
         intercept->PostCallRecordQueueWaitIdle(queue, result);
     }
     return result;
@@ -1149,18 +1194,22 @@ VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(
     VkDevice                                    device) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeviceWaitIdle]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDeviceWaitIdle, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeviceWaitIdle(device);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDeviceWaitIdle]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDeviceWaitIdle, intercept->container_type);
         intercept->PreCallRecordDeviceWaitIdle(device);
     }
     VkResult result = DispatchDeviceWaitIdle(device);
-    for (auto intercept : layer_data->object_dispatch) {
+    FlushMessages(layer_data->report_data);
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDeviceWaitIdle]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDeviceWaitIdle, intercept->container_type);
         intercept->PostCallRecordDeviceWaitIdle(device, result);
     }
     return result;
@@ -1173,18 +1222,21 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(
     VkDeviceMemory*                             pMemory) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateMemory]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateAllocateMemory, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordAllocateMemory, intercept->container_type);
         intercept->PreCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     }
     VkResult result = DispatchAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAllocateMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordAllocateMemory, intercept->container_type);
         intercept->PostCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory, result);
     }
     return result;
@@ -1196,18 +1248,21 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeMemory]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateFreeMemory, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeMemory(device, memory, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordFreeMemory, intercept->container_type);
         intercept->PreCallRecordFreeMemory(device, memory, pAllocator);
     }
     DispatchFreeMemory(device, memory, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordFreeMemory, intercept->container_type);
         intercept->PostCallRecordFreeMemory(device, memory, pAllocator);
     }
 }
@@ -1221,18 +1276,21 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory(
     void**                                      ppData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMapMemory]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateMapMemory, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMapMemory(device, memory, offset, size, flags, ppData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordMapMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordMapMemory, intercept->container_type);
         intercept->PreCallRecordMapMemory(device, memory, offset, size, flags, ppData);
     }
     VkResult result = DispatchMapMemory(device, memory, offset, size, flags, ppData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordMapMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordMapMemory, intercept->container_type);
         intercept->PostCallRecordMapMemory(device, memory, offset, size, flags, ppData, result);
     }
     return result;
@@ -1243,18 +1301,21 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(
     VkDeviceMemory                              memory) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUnmapMemory]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateUnmapMemory, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUnmapMemory(device, memory);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUnmapMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordUnmapMemory, intercept->container_type);
         intercept->PreCallRecordUnmapMemory(device, memory);
     }
     DispatchUnmapMemory(device, memory);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUnmapMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordUnmapMemory, intercept->container_type);
         intercept->PostCallRecordUnmapMemory(device, memory);
     }
 }
@@ -1265,18 +1326,21 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(
     const VkMappedMemoryRange*                  pMemoryRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFlushMappedMemoryRanges]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateFlushMappedMemoryRanges, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFlushMappedMemoryRanges]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordFlushMappedMemoryRanges, intercept->container_type);
         intercept->PreCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFlushMappedMemoryRanges]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordFlushMappedMemoryRanges, intercept->container_type);
         intercept->PostCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
     return result;
@@ -1288,18 +1352,21 @@ VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(
     const VkMappedMemoryRange*                  pMemoryRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateInvalidateMappedMemoryRanges]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateInvalidateMappedMemoryRanges, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordInvalidateMappedMemoryRanges]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordInvalidateMappedMemoryRanges, intercept->container_type);
         intercept->PreCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordInvalidateMappedMemoryRanges]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordInvalidateMappedMemoryRanges, intercept->container_type);
         intercept->PostCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
     return result;
@@ -1311,18 +1378,21 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(
     VkDeviceSize*                               pCommittedMemoryInBytes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryCommitment]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeviceMemoryCommitment, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryCommitment]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeviceMemoryCommitment, intercept->container_type);
         intercept->PreCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
     DispatchGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryCommitment]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeviceMemoryCommitment, intercept->container_type);
         intercept->PostCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
 }
@@ -1334,18 +1404,21 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(
     VkDeviceSize                                memoryOffset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateBindBufferMemory, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory(device, buffer, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordBindBufferMemory, intercept->container_type);
         intercept->PreCallRecordBindBufferMemory(device, buffer, memory, memoryOffset);
     }
     VkResult result = DispatchBindBufferMemory(device, buffer, memory, memoryOffset);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordBindBufferMemory, intercept->container_type);
         intercept->PostCallRecordBindBufferMemory(device, buffer, memory, memoryOffset, result);
     }
     return result;
@@ -1358,18 +1431,21 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(
     VkDeviceSize                                memoryOffset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateBindImageMemory, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory(device, image, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordBindImageMemory, intercept->container_type);
         intercept->PreCallRecordBindImageMemory(device, image, memory, memoryOffset);
     }
     VkResult result = DispatchBindImageMemory(device, image, memory, memoryOffset);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordBindImageMemory, intercept->container_type);
         intercept->PostCallRecordBindImageMemory(device, image, memory, memoryOffset, result);
     }
     return result;
@@ -1381,18 +1457,21 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(
     VkMemoryRequirements*                       pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetBufferMemoryRequirements, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetBufferMemoryRequirements, intercept->container_type);
         intercept->PreCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetBufferMemoryRequirements, intercept->container_type);
         intercept->PostCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
 }
@@ -1403,18 +1482,21 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(
     VkMemoryRequirements*                       pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetImageMemoryRequirements, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements(device, image, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetImageMemoryRequirements, intercept->container_type);
         intercept->PreCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements(device, image, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetImageMemoryRequirements, intercept->container_type);
         intercept->PostCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
 }
@@ -1426,18 +1508,21 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(
     VkSparseImageMemoryRequirements*            pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetImageSparseMemoryRequirements, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetImageSparseMemoryRequirements, intercept->container_type);
         intercept->PreCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetImageSparseMemoryRequirements, intercept->container_type);
         intercept->PostCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -1476,18 +1561,21 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(
     VkFence                                     fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBindSparse]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateQueueBindSparse, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueBindSparse]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordQueueBindSparse, intercept->container_type);
         intercept->PreCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     }
     VkResult result = DispatchQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueBindSparse]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordQueueBindSparse, intercept->container_type);
         intercept->PostCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence, result);
     }
     return result;
@@ -1500,18 +1588,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(
     VkFence*                                    pFence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFence]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateFence, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFence(device, pCreateInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateFence]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateFence, intercept->container_type);
         intercept->PreCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence);
     }
     VkResult result = DispatchCreateFence(device, pCreateInfo, pAllocator, pFence);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateFence]) {
+        auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateFence, intercept->container_type);
         intercept->PostCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence, result);
     }
     return result;
@@ -1523,18 +1614,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFence]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyFence, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFence(device, fence, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyFence]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyFence, intercept->container_type);
         intercept->PreCallRecordDestroyFence(device, fence, pAllocator);
     }
     DispatchDestroyFence(device, fence, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyFence]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyFence, intercept->container_type);
         intercept->PostCallRecordDestroyFence(device, fence, pAllocator);
     }
 }
@@ -1545,18 +1639,21 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetFences(
     const VkFence*                              pFences) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetFences]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateResetFences, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetFences(device, fenceCount, pFences);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetFences]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordResetFences, intercept->container_type);
         intercept->PreCallRecordResetFences(device, fenceCount, pFences);
     }
     VkResult result = DispatchResetFences(device, fenceCount, pFences);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetFences]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordResetFences, intercept->container_type);
         intercept->PostCallRecordResetFences(device, fenceCount, pFences, result);
     }
     return result;
@@ -1567,18 +1664,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(
     VkFence                                     fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceStatus]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetFenceStatus, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceStatus(device, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceStatus]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetFenceStatus, intercept->container_type);
         intercept->PreCallRecordGetFenceStatus(device, fence);
     }
     VkResult result = DispatchGetFenceStatus(device, fence);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceStatus]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetFenceStatus, intercept->container_type);
         intercept->PostCallRecordGetFenceStatus(device, fence, result);
     }
     return result;
@@ -1592,18 +1692,21 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(
     uint64_t                                    timeout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitForFences]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateWaitForFences, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitForFences(device, fenceCount, pFences, waitAll, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitForFences]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordWaitForFences, intercept->container_type);
         intercept->PreCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     }
     VkResult result = DispatchWaitForFences(device, fenceCount, pFences, waitAll, timeout);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitForFences]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordWaitForFences, intercept->container_type);
         intercept->PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
     }
     return result;
@@ -1616,18 +1719,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(
     VkSemaphore*                                pSemaphore) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSemaphore]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateSemaphore, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSemaphore]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateSemaphore, intercept->container_type);
         intercept->PreCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     }
     VkResult result = DispatchCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSemaphore]) {
+        auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateSemaphore, intercept->container_type);
         intercept->PostCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore, result);
     }
     return result;
@@ -1639,18 +1745,21 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySemaphore]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroySemaphore, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySemaphore(device, semaphore, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySemaphore]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroySemaphore, intercept->container_type);
         intercept->PreCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
     DispatchDestroySemaphore(device, semaphore, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySemaphore]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroySemaphore, intercept->container_type);
         intercept->PostCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
 }
@@ -1662,18 +1771,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(
     VkEvent*                                    pEvent) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateEvent]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateEvent, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateEvent(device, pCreateInfo, pAllocator, pEvent);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateEvent]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateEvent, intercept->container_type);
         intercept->PreCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     }
     VkResult result = DispatchCreateEvent(device, pCreateInfo, pAllocator, pEvent);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateEvent]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateEvent, intercept->container_type);
         intercept->PostCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent, result);
     }
     return result;
@@ -1685,18 +1797,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyEvent]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyEvent, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyEvent(device, event, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyEvent]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyEvent, intercept->container_type);
         intercept->PreCallRecordDestroyEvent(device, event, pAllocator);
     }
     DispatchDestroyEvent(device, event, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyEvent]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyEvent, intercept->container_type);
         intercept->PostCallRecordDestroyEvent(device, event, pAllocator);
     }
 }
@@ -1706,18 +1821,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(
     VkEvent                                     event) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetEventStatus]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetEventStatus, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetEventStatus(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetEventStatus]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetEventStatus, intercept->container_type);
         intercept->PreCallRecordGetEventStatus(device, event);
     }
     VkResult result = DispatchGetEventStatus(device, event);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetEventStatus]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetEventStatus, intercept->container_type);
         intercept->PostCallRecordGetEventStatus(device, event, result);
     }
     return result;
@@ -1728,18 +1846,21 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(
     VkEvent                                     event) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetEvent]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateSetEvent, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetEvent]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordSetEvent, intercept->container_type);
         intercept->PreCallRecordSetEvent(device, event);
     }
     VkResult result = DispatchSetEvent(device, event);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetEvent]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordSetEvent, intercept->container_type);
         intercept->PostCallRecordSetEvent(device, event, result);
     }
     return result;
@@ -1750,18 +1871,21 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(
     VkEvent                                     event) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetEvent]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateResetEvent, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetEvent]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordResetEvent, intercept->container_type);
         intercept->PreCallRecordResetEvent(device, event);
     }
     VkResult result = DispatchResetEvent(device, event);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetEvent]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordResetEvent, intercept->container_type);
         intercept->PostCallRecordResetEvent(device, event, result);
     }
     return result;
@@ -1774,18 +1898,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(
     VkQueryPool*                                pQueryPool) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateQueryPool]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateQueryPool, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateQueryPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateQueryPool, intercept->container_type);
         intercept->PreCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     }
     VkResult result = DispatchCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateQueryPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateQueryPool, intercept->container_type);
         intercept->PostCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool, result);
     }
     return result;
@@ -1797,18 +1924,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyQueryPool]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyQueryPool, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyQueryPool(device, queryPool, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyQueryPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyQueryPool, intercept->container_type);
         intercept->PreCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
     DispatchDestroyQueryPool(device, queryPool, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyQueryPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyQueryPool, intercept->container_type);
         intercept->PostCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
 }
@@ -1824,18 +1954,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(
     VkQueryResultFlags                          flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueryPoolResults]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetQueryPoolResults, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueryPoolResults]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetQueryPoolResults, intercept->container_type);
         intercept->PreCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     }
     VkResult result = DispatchGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueryPoolResults]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetQueryPoolResults, intercept->container_type);
         intercept->PostCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags, result);
     }
     return result;
@@ -1847,18 +1980,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBuffer]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyBuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBuffer(device, buffer, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyBuffer, intercept->container_type);
         intercept->PreCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
     DispatchDestroyBuffer(device, buffer, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyBuffer, intercept->container_type);
         intercept->PostCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
 }
@@ -1870,18 +2006,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(
     VkBufferView*                               pView) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBufferView]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateBufferView, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBufferView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateBufferView]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateBufferView, intercept->container_type);
         intercept->PreCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateBufferView(device, pCreateInfo, pAllocator, pView);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateBufferView]) {
+        auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateBufferView, intercept->container_type);
         intercept->PostCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView, result);
     }
     return result;
@@ -1893,18 +2032,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBufferView]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyBufferView, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBufferView(device, bufferView, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBufferView]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyBufferView, intercept->container_type);
         intercept->PreCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
     DispatchDestroyBufferView(device, bufferView, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBufferView]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyBufferView, intercept->container_type);
         intercept->PostCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
 }
@@ -1916,18 +2058,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(
     VkImage*                                    pImage) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImage]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateImage, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImage(device, pCreateInfo, pAllocator, pImage);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateImage]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateImage, intercept->container_type);
         intercept->PreCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage);
     }
     VkResult result = DispatchCreateImage(device, pCreateInfo, pAllocator, pImage);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateImage]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateImage, intercept->container_type);
         intercept->PostCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage, result);
     }
     return result;
@@ -1939,18 +2084,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImage]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyImage, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImage(device, image, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyImage]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyImage, intercept->container_type);
         intercept->PreCallRecordDestroyImage(device, image, pAllocator);
     }
     DispatchDestroyImage(device, image, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyImage]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyImage, intercept->container_type);
         intercept->PostCallRecordDestroyImage(device, image, pAllocator);
     }
 }
@@ -1962,18 +2110,21 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(
     VkSubresourceLayout*                        pLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSubresourceLayout]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetImageSubresourceLayout, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSubresourceLayout(device, image, pSubresource, pLayout);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSubresourceLayout]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetImageSubresourceLayout, intercept->container_type);
         intercept->PreCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
     DispatchGetImageSubresourceLayout(device, image, pSubresource, pLayout);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSubresourceLayout]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetImageSubresourceLayout, intercept->container_type);
         intercept->PostCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
 }
@@ -1985,18 +2136,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(
     VkImageView*                                pView) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImageView]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateImageView, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImageView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateImageView]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateImageView, intercept->container_type);
         intercept->PreCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateImageView(device, pCreateInfo, pAllocator, pView);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateImageView]) {
+        auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateImageView, intercept->container_type);
         intercept->PostCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView, result);
     }
     return result;
@@ -2008,18 +2162,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImageView]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyImageView, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImageView(device, imageView, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyImageView]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyImageView, intercept->container_type);
         intercept->PreCallRecordDestroyImageView(device, imageView, pAllocator);
     }
     DispatchDestroyImageView(device, imageView, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyImageView]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyImageView, intercept->container_type);
         intercept->PostCallRecordDestroyImageView(device, imageView, pAllocator);
     }
 }
@@ -2030,18 +2187,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyShaderModule]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyShaderModule, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyShaderModule(device, shaderModule, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyShaderModule]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyShaderModule, intercept->container_type);
         intercept->PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
     DispatchDestroyShaderModule(device, shaderModule, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyShaderModule]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyShaderModule, intercept->container_type);
         intercept->PostCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
 }
@@ -2053,18 +2213,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(
     VkPipelineCache*                            pPipelineCache) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineCache]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreatePipelineCache, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePipelineCache]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreatePipelineCache, intercept->container_type);
         intercept->PreCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     }
     VkResult result = DispatchCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePipelineCache]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreatePipelineCache, intercept->container_type);
         intercept->PostCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache, result);
     }
     return result;
@@ -2076,18 +2239,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineCache]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyPipelineCache, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineCache(device, pipelineCache, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipelineCache]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyPipelineCache, intercept->container_type);
         intercept->PreCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
     DispatchDestroyPipelineCache(device, pipelineCache, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipelineCache]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyPipelineCache, intercept->container_type);
         intercept->PostCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
 }
@@ -2099,18 +2265,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineCacheData]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetPipelineCacheData, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineCacheData]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetPipelineCacheData, intercept->container_type);
         intercept->PreCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     }
     VkResult result = DispatchGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineCacheData]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetPipelineCacheData, intercept->container_type);
         intercept->PostCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData, result);
     }
     return result;
@@ -2123,18 +2292,21 @@ VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(
     const VkPipelineCache*                      pSrcCaches) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMergePipelineCaches]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateMergePipelineCaches, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordMergePipelineCaches]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordMergePipelineCaches, intercept->container_type);
         intercept->PreCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     }
     VkResult result = DispatchMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordMergePipelineCaches]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordMergePipelineCaches, intercept->container_type);
         intercept->PostCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches, result);
     }
     return result;
@@ -2146,18 +2318,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipeline]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyPipeline, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipeline(device, pipeline, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipeline]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyPipeline, intercept->container_type);
         intercept->PreCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
     DispatchDestroyPipeline(device, pipeline, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipeline]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyPipeline, intercept->container_type);
         intercept->PostCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
 }
@@ -2168,18 +2343,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineLayout]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyPipelineLayout, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineLayout(device, pipelineLayout, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipelineLayout]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyPipelineLayout, intercept->container_type);
         intercept->PreCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
     DispatchDestroyPipelineLayout(device, pipelineLayout, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipelineLayout]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyPipelineLayout, intercept->container_type);
         intercept->PostCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
 }
@@ -2191,18 +2369,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(
     VkSampler*                                  pSampler) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSampler]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateSampler, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSampler(device, pCreateInfo, pAllocator, pSampler);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSampler]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateSampler, intercept->container_type);
         intercept->PreCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     }
     VkResult result = DispatchCreateSampler(device, pCreateInfo, pAllocator, pSampler);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSampler]) {
+        auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateSampler, intercept->container_type);
         intercept->PostCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler, result);
     }
     return result;
@@ -2214,18 +2395,21 @@ VKAPI_ATTR void VKAPI_CALL DestroySampler(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySampler]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroySampler, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySampler(device, sampler, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySampler]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroySampler, intercept->container_type);
         intercept->PreCallRecordDestroySampler(device, sampler, pAllocator);
     }
     DispatchDestroySampler(device, sampler, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySampler]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroySampler, intercept->container_type);
         intercept->PostCallRecordDestroySampler(device, sampler, pAllocator);
     }
 }
@@ -2237,18 +2421,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(
     VkDescriptorSetLayout*                      pSetLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorSetLayout]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateDescriptorSetLayout, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorSetLayout]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateDescriptorSetLayout, intercept->container_type);
         intercept->PreCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     }
     VkResult result = DispatchCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorSetLayout]) {
+        auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateDescriptorSetLayout, intercept->container_type);
         intercept->PostCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout, result);
     }
     return result;
@@ -2260,18 +2447,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorSetLayout]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyDescriptorSetLayout, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorSetLayout]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyDescriptorSetLayout, intercept->container_type);
         intercept->PreCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
     DispatchDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorSetLayout]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyDescriptorSetLayout, intercept->container_type);
         intercept->PostCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
 }
@@ -2283,18 +2473,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(
     VkDescriptorPool*                           pDescriptorPool) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorPool]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateDescriptorPool, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateDescriptorPool, intercept->container_type);
         intercept->PreCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     }
     VkResult result = DispatchCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateDescriptorPool, intercept->container_type);
         intercept->PostCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool, result);
     }
     return result;
@@ -2306,18 +2499,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorPool]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyDescriptorPool, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorPool(device, descriptorPool, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyDescriptorPool, intercept->container_type);
         intercept->PreCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
     DispatchDestroyDescriptorPool(device, descriptorPool, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyDescriptorPool, intercept->container_type);
         intercept->PostCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
 }
@@ -2328,18 +2524,21 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(
     VkDescriptorPoolResetFlags                  flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetDescriptorPool]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateResetDescriptorPool, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetDescriptorPool(device, descriptorPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetDescriptorPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordResetDescriptorPool, intercept->container_type);
         intercept->PreCallRecordResetDescriptorPool(device, descriptorPool, flags);
     }
     VkResult result = DispatchResetDescriptorPool(device, descriptorPool, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetDescriptorPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordResetDescriptorPool, intercept->container_type);
         intercept->PostCallRecordResetDescriptorPool(device, descriptorPool, flags, result);
     }
     return result;
@@ -2352,18 +2551,21 @@ VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(
     const VkDescriptorSet*                      pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeDescriptorSets]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateFreeDescriptorSets, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeDescriptorSets]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordFreeDescriptorSets, intercept->container_type);
         intercept->PreCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     }
     VkResult result = DispatchFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeDescriptorSets]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordFreeDescriptorSets, intercept->container_type);
         intercept->PostCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets, result);
     }
     return result;
@@ -2377,18 +2579,21 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(
     const VkCopyDescriptorSet*                  pDescriptorCopies) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSets]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateUpdateDescriptorSets, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSets]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordUpdateDescriptorSets, intercept->container_type);
         intercept->PreCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
     DispatchUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSets]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordUpdateDescriptorSets, intercept->container_type);
         intercept->PostCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
 }
@@ -2400,18 +2605,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(
     VkFramebuffer*                              pFramebuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFramebuffer]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateFramebuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateFramebuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateFramebuffer, intercept->container_type);
         intercept->PreCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     }
     VkResult result = DispatchCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateFramebuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateFramebuffer, intercept->container_type);
         intercept->PostCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer, result);
     }
     return result;
@@ -2423,18 +2631,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFramebuffer]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyFramebuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFramebuffer(device, framebuffer, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyFramebuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyFramebuffer, intercept->container_type);
         intercept->PreCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
     DispatchDestroyFramebuffer(device, framebuffer, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyFramebuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyFramebuffer, intercept->container_type);
         intercept->PostCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
 }
@@ -2446,18 +2657,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(
     VkRenderPass*                               pRenderPass) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateRenderPass, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateRenderPass, intercept->container_type);
         intercept->PreCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateRenderPass, intercept->container_type);
         intercept->PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -2469,18 +2683,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyRenderPass]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyRenderPass, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyRenderPass(device, renderPass, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyRenderPass]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyRenderPass, intercept->container_type);
         intercept->PreCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
     DispatchDestroyRenderPass(device, renderPass, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyRenderPass]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyRenderPass, intercept->container_type);
         intercept->PostCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
 }
@@ -2491,18 +2708,21 @@ VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(
     VkExtent2D*                                 pGranularity) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRenderAreaGranularity]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetRenderAreaGranularity, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRenderAreaGranularity(device, renderPass, pGranularity);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRenderAreaGranularity]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetRenderAreaGranularity, intercept->container_type);
         intercept->PreCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
     DispatchGetRenderAreaGranularity(device, renderPass, pGranularity);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRenderAreaGranularity]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetRenderAreaGranularity, intercept->container_type);
         intercept->PostCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
 }
@@ -2514,18 +2734,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(
     VkCommandPool*                              pCommandPool) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCommandPool]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateCommandPool, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateCommandPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateCommandPool, intercept->container_type);
         intercept->PreCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     }
     VkResult result = DispatchCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateCommandPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateCommandPool, intercept->container_type);
         intercept->PostCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool, result);
     }
     return result;
@@ -2537,18 +2760,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCommandPool]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyCommandPool, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyCommandPool(device, commandPool, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyCommandPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyCommandPool, intercept->container_type);
         intercept->PreCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
     DispatchDestroyCommandPool(device, commandPool, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyCommandPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyCommandPool, intercept->container_type);
         intercept->PostCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
 }
@@ -2559,18 +2785,21 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(
     VkCommandPoolResetFlags                     flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandPool]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateResetCommandPool, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandPool(device, commandPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetCommandPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordResetCommandPool, intercept->container_type);
         intercept->PreCallRecordResetCommandPool(device, commandPool, flags);
     }
     VkResult result = DispatchResetCommandPool(device, commandPool, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetCommandPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordResetCommandPool, intercept->container_type);
         intercept->PostCallRecordResetCommandPool(device, commandPool, flags, result);
     }
     return result;
@@ -2582,18 +2811,21 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(
     VkCommandBuffer*                            pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateCommandBuffers]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateAllocateCommandBuffers, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateCommandBuffers]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordAllocateCommandBuffers, intercept->container_type);
         intercept->PreCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
     }
     VkResult result = DispatchAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAllocateCommandBuffers]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordAllocateCommandBuffers, intercept->container_type);
         intercept->PostCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers, result);
     }
     return result;
@@ -2606,18 +2838,21 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(
     const VkCommandBuffer*                      pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeCommandBuffers]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateFreeCommandBuffers, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeCommandBuffers]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordFreeCommandBuffers, intercept->container_type);
         intercept->PreCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
     DispatchFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeCommandBuffers]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordFreeCommandBuffers, intercept->container_type);
         intercept->PostCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
 }
@@ -2627,18 +2862,21 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(
     const VkCommandBufferBeginInfo*             pBeginInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateBeginCommandBuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBeginCommandBuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordBeginCommandBuffer, intercept->container_type);
         intercept->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo);
     }
     VkResult result = DispatchBeginCommandBuffer(commandBuffer, pBeginInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBeginCommandBuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordBeginCommandBuffer, intercept->container_type);
         intercept->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, result);
     }
     return result;
@@ -2648,18 +2886,21 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateEndCommandBuffer]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateEndCommandBuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEndCommandBuffer(commandBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordEndCommandBuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordEndCommandBuffer, intercept->container_type);
         intercept->PreCallRecordEndCommandBuffer(commandBuffer);
     }
     VkResult result = DispatchEndCommandBuffer(commandBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordEndCommandBuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordEndCommandBuffer, intercept->container_type);
         intercept->PostCallRecordEndCommandBuffer(commandBuffer, result);
     }
     return result;
@@ -2670,18 +2911,21 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(
     VkCommandBufferResetFlags                   flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandBuffer]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateResetCommandBuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandBuffer(commandBuffer, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetCommandBuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordResetCommandBuffer, intercept->container_type);
         intercept->PreCallRecordResetCommandBuffer(commandBuffer, flags);
     }
     VkResult result = DispatchResetCommandBuffer(commandBuffer, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetCommandBuffer]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordResetCommandBuffer, intercept->container_type);
         intercept->PostCallRecordResetCommandBuffer(commandBuffer, flags, result);
     }
     return result;
@@ -2693,18 +2937,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(
     VkPipeline                                  pipeline) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipeline]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBindPipeline, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipeline]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBindPipeline, intercept->container_type);
         intercept->PreCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
     DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipeline]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBindPipeline, intercept->container_type);
         intercept->PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
 }
@@ -2716,18 +2963,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(
     const VkViewport*                           pViewports) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewport]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetViewport, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewport]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetViewport, intercept->container_type);
         intercept->PreCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
     DispatchCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewport]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetViewport, intercept->container_type);
         intercept->PostCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
 }
@@ -2739,18 +2989,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(
     const VkRect2D*                             pScissors) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissor]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetScissor, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissor]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetScissor, intercept->container_type);
         intercept->PreCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
     DispatchCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissor]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetScissor, intercept->container_type);
         intercept->PostCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
 }
@@ -2760,18 +3013,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(
     float                                       lineWidth) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineWidth]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetLineWidth, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineWidth(commandBuffer, lineWidth);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineWidth]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetLineWidth, intercept->container_type);
         intercept->PreCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
     DispatchCmdSetLineWidth(commandBuffer, lineWidth);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineWidth]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetLineWidth, intercept->container_type);
         intercept->PostCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
 }
@@ -2783,18 +3039,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(
     float                                       depthBiasSlopeFactor) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBias]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetDepthBias, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBias]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetDepthBias, intercept->container_type);
         intercept->PreCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
     DispatchCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBias]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetDepthBias, intercept->container_type);
         intercept->PostCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
 }
@@ -2804,18 +3063,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(
     const float                                 blendConstants[4]) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetBlendConstants]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetBlendConstants, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetBlendConstants(commandBuffer, blendConstants);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetBlendConstants]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetBlendConstants, intercept->container_type);
         intercept->PreCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
     DispatchCmdSetBlendConstants(commandBuffer, blendConstants);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetBlendConstants]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetBlendConstants, intercept->container_type);
         intercept->PostCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
 }
@@ -2826,18 +3088,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(
     float                                       maxDepthBounds) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBounds]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetDepthBounds, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBounds]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetDepthBounds, intercept->container_type);
         intercept->PreCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
     DispatchCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBounds]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetDepthBounds, intercept->container_type);
         intercept->PostCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
 }
@@ -2848,18 +3113,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(
     uint32_t                                    compareMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilCompareMask]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetStencilCompareMask, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilCompareMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetStencilCompareMask, intercept->container_type);
         intercept->PreCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
     DispatchCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilCompareMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetStencilCompareMask, intercept->container_type);
         intercept->PostCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
 }
@@ -2870,18 +3138,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(
     uint32_t                                    writeMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilWriteMask]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetStencilWriteMask, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilWriteMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetStencilWriteMask, intercept->container_type);
         intercept->PreCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
     DispatchCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilWriteMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetStencilWriteMask, intercept->container_type);
         intercept->PostCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
 }
@@ -2892,18 +3163,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(
     uint32_t                                    reference) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilReference]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetStencilReference, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilReference(commandBuffer, faceMask, reference);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilReference]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetStencilReference, intercept->container_type);
         intercept->PreCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
     DispatchCmdSetStencilReference(commandBuffer, faceMask, reference);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilReference]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetStencilReference, intercept->container_type);
         intercept->PostCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
 }
@@ -2919,18 +3193,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(
     const uint32_t*                             pDynamicOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorSets]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBindDescriptorSets, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorSets]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBindDescriptorSets, intercept->container_type);
         intercept->PreCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
     DispatchCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorSets]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBindDescriptorSets, intercept->container_type);
         intercept->PostCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 }
@@ -2942,18 +3219,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(
     VkIndexType                                 indexType) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBindIndexBuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindIndexBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBindIndexBuffer, intercept->container_type);
         intercept->PreCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
     DispatchCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindIndexBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBindIndexBuffer, intercept->container_type);
         intercept->PostCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
 }
@@ -2966,18 +3246,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(
     const VkDeviceSize*                         pOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBindVertexBuffers, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBindVertexBuffers, intercept->container_type);
         intercept->PreCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
     DispatchCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBindVertexBuffers, intercept->container_type);
         intercept->PostCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
 }
@@ -2990,18 +3273,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(
     uint32_t                                    firstInstance) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDraw]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDraw, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDraw]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDraw, intercept->container_type);
         intercept->PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
     DispatchCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDraw]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDraw, intercept->container_type);
         intercept->PostCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
 }
@@ -3015,18 +3301,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(
     uint32_t                                    firstInstance) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexed]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawIndexed, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexed]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawIndexed, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
     DispatchCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexed]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawIndexed, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
 }
@@ -3039,18 +3328,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirect]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawIndirect, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawIndirect, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawIndirect, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3063,18 +3355,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirect]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawIndexedIndirect, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawIndexedIndirect, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawIndexedIndirect, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3086,18 +3381,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatch]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDispatch, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatch]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDispatch, intercept->container_type);
         intercept->PreCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatch]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDispatch, intercept->container_type);
         intercept->PostCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -3108,18 +3406,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(
     VkDeviceSize                                offset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchIndirect]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDispatchIndirect, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchIndirect(commandBuffer, buffer, offset);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDispatchIndirect, intercept->container_type);
         intercept->PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
     DispatchCmdDispatchIndirect(commandBuffer, buffer, offset);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDispatchIndirect, intercept->container_type);
         intercept->PostCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
 }
@@ -3132,18 +3433,21 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(
     const VkBufferCopy*                         pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdCopyBuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdCopyBuffer, intercept->container_type);
         intercept->PreCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdCopyBuffer, intercept->container_type);
         intercept->PostCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3158,18 +3462,21 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(
     const VkImageCopy*                          pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdCopyImage, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdCopyImage, intercept->container_type);
         intercept->PreCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdCopyImage, intercept->container_type);
         intercept->PostCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3185,18 +3492,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(
     VkFilter                                    filter) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBlitImage, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBlitImage, intercept->container_type);
         intercept->PreCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
     DispatchCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBlitImage, intercept->container_type);
         intercept->PostCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
 }
@@ -3210,18 +3520,21 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(
     const VkBufferImageCopy*                    pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdCopyBufferToImage, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdCopyBufferToImage, intercept->container_type);
         intercept->PreCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdCopyBufferToImage, intercept->container_type);
         intercept->PostCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3235,18 +3548,21 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(
     const VkBufferImageCopy*                    pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdCopyImageToBuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdCopyImageToBuffer, intercept->container_type);
         intercept->PreCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdCopyImageToBuffer, intercept->container_type);
         intercept->PostCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3259,18 +3575,21 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdUpdateBuffer]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdUpdateBuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdUpdateBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdUpdateBuffer, intercept->container_type);
         intercept->PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
     DispatchCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdUpdateBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdUpdateBuffer, intercept->container_type);
         intercept->PostCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
 }
@@ -3283,18 +3602,21 @@ VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(
     uint32_t                                    data) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdFillBuffer]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdFillBuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdFillBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdFillBuffer, intercept->container_type);
         intercept->PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
     DispatchCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdFillBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdFillBuffer, intercept->container_type);
         intercept->PostCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
 }
@@ -3308,18 +3630,21 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(
     const VkImageSubresourceRange*              pRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearColorImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdClearColorImage, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearColorImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdClearColorImage, intercept->container_type);
         intercept->PreCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
     DispatchCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearColorImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdClearColorImage, intercept->container_type);
         intercept->PostCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
 }
@@ -3333,18 +3658,21 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(
     const VkImageSubresourceRange*              pRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearDepthStencilImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdClearDepthStencilImage, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearDepthStencilImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdClearDepthStencilImage, intercept->container_type);
         intercept->PreCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
     DispatchCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearDepthStencilImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdClearDepthStencilImage, intercept->container_type);
         intercept->PostCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
 }
@@ -3357,18 +3685,21 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(
     const VkClearRect*                          pRects) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearAttachments]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdClearAttachments, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearAttachments]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdClearAttachments, intercept->container_type);
         intercept->PreCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
     DispatchCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearAttachments]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdClearAttachments, intercept->container_type);
         intercept->PostCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
 }
@@ -3383,18 +3714,21 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(
     const VkImageResolve*                       pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdResolveImage, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdResolveImage, intercept->container_type);
         intercept->PreCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdResolveImage, intercept->container_type);
         intercept->PostCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3405,18 +3739,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(
     VkPipelineStageFlags                        stageMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetEvent, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetEvent, intercept->container_type);
         intercept->PreCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdSetEvent(commandBuffer, event, stageMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetEvent, intercept->container_type);
         intercept->PostCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3427,18 +3764,21 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(
     VkPipelineStageFlags                        stageMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdResetEvent, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdResetEvent, intercept->container_type);
         intercept->PreCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdResetEvent(commandBuffer, event, stageMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdResetEvent, intercept->container_type);
         intercept->PostCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3457,18 +3797,21 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(
     const VkImageMemoryBarrier*                 pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdWaitEvents, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdWaitEvents, intercept->container_type);
         intercept->PreCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdWaitEvents, intercept->container_type);
         intercept->PostCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3486,18 +3829,21 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(
     const VkImageMemoryBarrier*                 pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdPipelineBarrier, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdPipelineBarrier, intercept->container_type);
         intercept->PreCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdPipelineBarrier, intercept->container_type);
         intercept->PostCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3509,18 +3855,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(
     VkQueryControlFlags                         flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQuery]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBeginQuery, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQuery(commandBuffer, queryPool, query, flags);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQuery]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBeginQuery, intercept->container_type);
         intercept->PreCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
     DispatchCmdBeginQuery(commandBuffer, queryPool, query, flags);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQuery]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBeginQuery, intercept->container_type);
         intercept->PostCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
 }
@@ -3531,18 +3880,21 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(
     uint32_t                                    query) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQuery]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdEndQuery, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQuery(commandBuffer, queryPool, query);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQuery]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdEndQuery, intercept->container_type);
         intercept->PreCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
     DispatchCmdEndQuery(commandBuffer, queryPool, query);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQuery]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdEndQuery, intercept->container_type);
         intercept->PostCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
 }
@@ -3554,18 +3906,21 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(
     uint32_t                                    queryCount) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetQueryPool]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdResetQueryPool, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetQueryPool]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdResetQueryPool, intercept->container_type);
         intercept->PreCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
     DispatchCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetQueryPool]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdResetQueryPool, intercept->container_type);
         intercept->PostCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
 }
@@ -3577,18 +3932,21 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(
     uint32_t                                    query) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdWriteTimestamp, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdWriteTimestamp, intercept->container_type);
         intercept->PreCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
     DispatchCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdWriteTimestamp, intercept->container_type);
         intercept->PostCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
 }
@@ -3604,18 +3962,21 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(
     VkQueryResultFlags                          flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyQueryPoolResults]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdCopyQueryPoolResults, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyQueryPoolResults]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdCopyQueryPoolResults, intercept->container_type);
         intercept->PreCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
     DispatchCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyQueryPoolResults]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdCopyQueryPoolResults, intercept->container_type);
         intercept->PostCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
 }
@@ -3629,18 +3990,21 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(
     const void*                                 pValues) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushConstants]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdPushConstants, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushConstants]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdPushConstants, intercept->container_type);
         intercept->PreCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
     DispatchCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushConstants]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdPushConstants, intercept->container_type);
         intercept->PostCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
 }
@@ -3651,18 +4015,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(
     VkSubpassContents                           contents) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBeginRenderPass, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBeginRenderPass, intercept->container_type);
         intercept->PreCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
     DispatchCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBeginRenderPass, intercept->container_type);
         intercept->PostCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
 }
@@ -3672,18 +4039,21 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(
     VkSubpassContents                           contents) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdNextSubpass, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass(commandBuffer, contents);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdNextSubpass, intercept->container_type);
         intercept->PreCallRecordCmdNextSubpass(commandBuffer, contents);
     }
     DispatchCmdNextSubpass(commandBuffer, contents);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdNextSubpass, intercept->container_type);
         intercept->PostCallRecordCmdNextSubpass(commandBuffer, contents);
     }
 }
@@ -3692,18 +4062,21 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdEndRenderPass, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdEndRenderPass, intercept->container_type);
         intercept->PreCallRecordCmdEndRenderPass(commandBuffer);
     }
     DispatchCmdEndRenderPass(commandBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdEndRenderPass, intercept->container_type);
         intercept->PostCallRecordCmdEndRenderPass(commandBuffer);
     }
 }
@@ -3714,18 +4087,21 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(
     const VkCommandBuffer*                      pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteCommands]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdExecuteCommands, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteCommands]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdExecuteCommands, intercept->container_type);
         intercept->PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
     DispatchCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteCommands]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdExecuteCommands, intercept->container_type);
         intercept->PostCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
 }
@@ -3737,18 +4113,21 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(
     const VkBindBufferMemoryInfo*               pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateBindBufferMemory2, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordBindBufferMemory2, intercept->container_type);
         intercept->PreCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordBindBufferMemory2, intercept->container_type);
         intercept->PostCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -3760,18 +4139,21 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2(
     const VkBindImageMemoryInfo*                pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateBindImageMemory2, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordBindImageMemory2, intercept->container_type);
         intercept->PreCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordBindImageMemory2, intercept->container_type);
         intercept->PostCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -3785,18 +4167,21 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(
     VkPeerMemoryFeatureFlags*                   pPeerMemoryFeatures) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeatures]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeatures, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeatures]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeatures, intercept->container_type);
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeatures]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeatures, intercept->container_type);
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
 }
@@ -3806,18 +4191,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(
     uint32_t                                    deviceMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMask]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetDeviceMask, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMask(commandBuffer, deviceMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetDeviceMask, intercept->container_type);
         intercept->PreCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMask(commandBuffer, deviceMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetDeviceMask, intercept->container_type);
         intercept->PostCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
 }
@@ -3832,18 +4220,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBase]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDispatchBase, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBase]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDispatchBase, intercept->container_type);
         intercept->PreCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBase]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDispatchBase, intercept->container_type);
         intercept->PostCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -3877,18 +4268,21 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetImageMemoryRequirements2, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetImageMemoryRequirements2, intercept->container_type);
         intercept->PreCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetImageMemoryRequirements2, intercept->container_type);
         intercept->PostCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
 }
@@ -3899,18 +4293,21 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements2]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetBufferMemoryRequirements2, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetBufferMemoryRequirements2, intercept->container_type);
         intercept->PreCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetBufferMemoryRequirements2, intercept->container_type);
         intercept->PostCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
 }
@@ -3922,18 +4319,21 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(
     VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements2]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetImageSparseMemoryRequirements2, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetImageSparseMemoryRequirements2, intercept->container_type);
         intercept->PreCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetImageSparseMemoryRequirements2, intercept->container_type);
         intercept->PostCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -4097,18 +4497,21 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPool(
     VkCommandPoolTrimFlags                      flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPool]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateTrimCommandPool, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPool(device, commandPool, flags);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordTrimCommandPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordTrimCommandPool, intercept->container_type);
         intercept->PreCallRecordTrimCommandPool(device, commandPool, flags);
     }
     DispatchTrimCommandPool(device, commandPool, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordTrimCommandPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordTrimCommandPool, intercept->container_type);
         intercept->PostCallRecordTrimCommandPool(device, commandPool, flags);
     }
 }
@@ -4119,18 +4522,21 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(
     VkQueue*                                    pQueue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue2]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeviceQueue2, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue2(device, pQueueInfo, pQueue);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceQueue2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeviceQueue2, intercept->container_type);
         intercept->PreCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
     DispatchGetDeviceQueue2(device, pQueueInfo, pQueue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceQueue2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeviceQueue2, intercept->container_type);
         intercept->PostCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
 }
@@ -4142,18 +4548,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(
     VkSamplerYcbcrConversion*                   pYcbcrConversion) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSamplerYcbcrConversion]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateSamplerYcbcrConversion, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSamplerYcbcrConversion]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateSamplerYcbcrConversion, intercept->container_type);
         intercept->PreCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSamplerYcbcrConversion]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateSamplerYcbcrConversion, intercept->container_type);
         intercept->PostCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
     return result;
@@ -4165,18 +4574,21 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversion(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySamplerYcbcrConversion]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroySamplerYcbcrConversion, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySamplerYcbcrConversion]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroySamplerYcbcrConversion, intercept->container_type);
         intercept->PreCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySamplerYcbcrConversion]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroySamplerYcbcrConversion, intercept->container_type);
         intercept->PostCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
 }
@@ -4188,18 +4600,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(
     VkDescriptorUpdateTemplate*                 pDescriptorUpdateTemplate) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorUpdateTemplate]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateDescriptorUpdateTemplate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorUpdateTemplate]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateDescriptorUpdateTemplate, intercept->container_type);
         intercept->PreCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorUpdateTemplate]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateDescriptorUpdateTemplate, intercept->container_type);
         intercept->PostCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
     return result;
@@ -4211,18 +4626,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorUpdateTemplate]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyDescriptorUpdateTemplate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorUpdateTemplate]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyDescriptorUpdateTemplate, intercept->container_type);
         intercept->PreCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorUpdateTemplate]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyDescriptorUpdateTemplate, intercept->container_type);
         intercept->PostCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
 }
@@ -4234,18 +4652,21 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplate(
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSetWithTemplate]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateUpdateDescriptorSetWithTemplate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSetWithTemplate]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordUpdateDescriptorSetWithTemplate, intercept->container_type);
         intercept->PreCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSetWithTemplate]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordUpdateDescriptorSetWithTemplate, intercept->container_type);
         intercept->PostCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
 }
@@ -4322,18 +4743,21 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(
     VkDescriptorSetLayoutSupport*               pSupport) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutSupport]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDescriptorSetLayoutSupport, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutSupport]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDescriptorSetLayoutSupport, intercept->container_type);
         intercept->PreCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutSupport]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDescriptorSetLayoutSupport, intercept->container_type);
         intercept->PostCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
 }
@@ -4349,18 +4773,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCount]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawIndirectCount, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCount]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawIndirectCount, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCount]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawIndirectCount, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4375,18 +4802,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCount]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawIndexedIndirectCount, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCount]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawIndexedIndirectCount, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCount]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawIndexedIndirectCount, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4398,18 +4828,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(
     VkRenderPass*                               pRenderPass) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateRenderPass2, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateRenderPass2, intercept->container_type);
         intercept->PreCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass2]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateRenderPass2, intercept->container_type);
         intercept->PostCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -4421,18 +4854,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(
     const VkSubpassBeginInfo*                   pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBeginRenderPass2, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBeginRenderPass2, intercept->container_type);
         intercept->PreCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBeginRenderPass2, intercept->container_type);
         intercept->PostCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -4443,18 +4879,21 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdNextSubpass2, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdNextSubpass2, intercept->container_type);
         intercept->PreCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdNextSubpass2, intercept->container_type);
         intercept->PostCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -4464,18 +4903,21 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdEndRenderPass2, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdEndRenderPass2, intercept->container_type);
         intercept->PreCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdEndRenderPass2, intercept->container_type);
         intercept->PostCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -4487,18 +4929,21 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPool(
     uint32_t                                    queryCount) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPool]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateResetQueryPool, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPool(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetQueryPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordResetQueryPool, intercept->container_type);
         intercept->PreCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPool(device, queryPool, firstQuery, queryCount);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetQueryPool]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordResetQueryPool, intercept->container_type);
         intercept->PostCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
 }
@@ -4509,18 +4954,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(
     uint64_t*                                   pValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValue]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetSemaphoreCounterValue, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValue(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreCounterValue]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetSemaphoreCounterValue, intercept->container_type);
         intercept->PreCallRecordGetSemaphoreCounterValue(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValue(device, semaphore, pValue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreCounterValue]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetSemaphoreCounterValue, intercept->container_type);
         intercept->PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, result);
     }
     return result;
@@ -4532,18 +4980,21 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(
     uint64_t                                    timeout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphores]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateWaitSemaphores, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphores(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitSemaphores]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordWaitSemaphores, intercept->container_type);
         intercept->PreCallRecordWaitSemaphores(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphores(device, pWaitInfo, timeout);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitSemaphores]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordWaitSemaphores, intercept->container_type);
         intercept->PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, result);
     }
     return result;
@@ -4554,18 +5005,21 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(
     const VkSemaphoreSignalInfo*                pSignalInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphore]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateSignalSemaphore, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphore(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSignalSemaphore]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordSignalSemaphore, intercept->container_type);
         intercept->PreCallRecordSignalSemaphore(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphore(device, pSignalInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSignalSemaphore]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordSignalSemaphore, intercept->container_type);
         intercept->PostCallRecordSignalSemaphore(device, pSignalInfo, result);
     }
     return result;
@@ -4576,18 +5030,21 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddress]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetBufferDeviceAddress, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddress(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddress]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetBufferDeviceAddress, intercept->container_type);
         intercept->PreCallRecordGetBufferDeviceAddress(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddress(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddress]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetBufferDeviceAddress, intercept->container_type);
         intercept->PostCallRecordGetBufferDeviceAddress(device, pInfo, result);
     }
     return result;
@@ -4598,18 +5055,21 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferOpaqueCaptureAddress]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetBufferOpaqueCaptureAddress, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferOpaqueCaptureAddress]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetBufferOpaqueCaptureAddress, intercept->container_type);
         intercept->PreCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddress(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferOpaqueCaptureAddress]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetBufferOpaqueCaptureAddress, intercept->container_type);
         intercept->PostCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     return result;
@@ -4620,18 +5080,21 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(
     const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddress]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddress, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddress]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddress, intercept->container_type);
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddress]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddress, intercept->container_type);
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     return result;
@@ -4763,18 +5226,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(
     VkSwapchainKHR*                             pSwapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSwapchainKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateSwapchainKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSwapchainKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateSwapchainKHR, intercept->container_type);
         intercept->PreCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     }
     VkResult result = DispatchCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSwapchainKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateSwapchainKHR, intercept->container_type);
         intercept->PostCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain, result);
     }
     return result;
@@ -4786,18 +5252,21 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySwapchainKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroySwapchainKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySwapchainKHR(device, swapchain, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySwapchainKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroySwapchainKHR, intercept->container_type);
         intercept->PreCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
     DispatchDestroySwapchainKHR(device, swapchain, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySwapchainKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroySwapchainKHR, intercept->container_type);
         intercept->PostCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
 }
@@ -4809,18 +5278,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(
     VkImage*                                    pSwapchainImages) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainImagesKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetSwapchainImagesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainImagesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetSwapchainImagesKHR, intercept->container_type);
         intercept->PreCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     }
     VkResult result = DispatchGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainImagesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetSwapchainImagesKHR, intercept->container_type);
         intercept->PostCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages, result);
     }
     return result;
@@ -4835,18 +5307,21 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(
     uint32_t*                                   pImageIndex) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImageKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateAcquireNextImageKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireNextImageKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordAcquireNextImageKHR, intercept->container_type);
         intercept->PreCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireNextImageKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordAcquireNextImageKHR, intercept->container_type);
         intercept->PostCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex, result);
     }
     return result;
@@ -4857,18 +5332,22 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(
     const VkPresentInfoKHR*                     pPresentInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueuePresentKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateQueuePresentKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueuePresentKHR(queue, pPresentInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueuePresentKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordQueuePresentKHR, intercept->container_type);
         intercept->PreCallRecordQueuePresentKHR(queue, pPresentInfo);
     }
     VkResult result = DispatchQueuePresentKHR(queue, pPresentInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    if (layer_data->hook_profile) layer_data->hook_profile->CountPresent();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueuePresentKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordQueuePresentKHR, intercept->container_type);
         intercept->PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
     }
     return result;
@@ -4879,18 +5358,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupPresentCapabilitiesKHR(
     VkDeviceGroupPresentCapabilitiesKHR*        pDeviceGroupPresentCapabilities) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPresentCapabilitiesKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeviceGroupPresentCapabilitiesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPresentCapabilitiesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeviceGroupPresentCapabilitiesKHR, intercept->container_type);
         intercept->PreCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     }
     VkResult result = DispatchGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPresentCapabilitiesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeviceGroupPresentCapabilitiesKHR, intercept->container_type);
         intercept->PostCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities, result);
     }
     return result;
@@ -4902,18 +5384,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModesKHR(
     VkDeviceGroupPresentModeFlagsKHR*           pModes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModesKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModesKHR, intercept->container_type);
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModesKHR, intercept->container_type);
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes, result);
     }
     return result;
@@ -4949,18 +5434,21 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage2KHR(
     uint32_t*                                   pImageIndex) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImage2KHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateAcquireNextImage2KHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireNextImage2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordAcquireNextImage2KHR, intercept->container_type);
         intercept->PreCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireNextImage2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordAcquireNextImage2KHR, intercept->container_type);
         intercept->PostCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex, result);
     }
     return result;
@@ -5143,18 +5631,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(
     VkSwapchainKHR*                             pSwapchains) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSharedSwapchainsKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateSharedSwapchainsKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSharedSwapchainsKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateSharedSwapchainsKHR, intercept->container_type);
         intercept->PreCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     }
     VkResult result = DispatchCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSharedSwapchainsKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateSharedSwapchainsKHR, intercept->container_type);
         intercept->PostCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains, result);
     }
     return result;
@@ -5553,18 +6044,21 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeaturesKHR(
     VkPeerMemoryFeatureFlags*                   pPeerMemoryFeatures) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR, intercept->container_type);
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR, intercept->container_type);
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
 }
@@ -5574,18 +6068,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(
     uint32_t                                    deviceMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMaskKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetDeviceMaskKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMaskKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetDeviceMaskKHR, intercept->container_type);
         intercept->PreCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMaskKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetDeviceMaskKHR, intercept->container_type);
         intercept->PostCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
 }
@@ -5600,18 +6097,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBaseKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDispatchBaseKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBaseKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDispatchBaseKHR, intercept->container_type);
         intercept->PreCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBaseKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDispatchBaseKHR, intercept->container_type);
         intercept->PostCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -5624,18 +6124,21 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPoolKHR(
     VkCommandPoolTrimFlags                      flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPoolKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateTrimCommandPoolKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPoolKHR(device, commandPool, flags);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordTrimCommandPoolKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordTrimCommandPoolKHR, intercept->container_type);
         intercept->PreCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
     DispatchTrimCommandPoolKHR(device, commandPool, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordTrimCommandPoolKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordTrimCommandPoolKHR, intercept->container_type);
         intercept->PostCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
 }
@@ -5696,18 +6199,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleKHR(
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetMemoryWin32HandleKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandleKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetMemoryWin32HandleKHR, intercept->container_type);
         intercept->PreCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandleKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetMemoryWin32HandleKHR, intercept->container_type);
         intercept->PostCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -5720,18 +6226,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandlePropertiesKHR(
     VkMemoryWin32HandlePropertiesKHR*           pMemoryWin32HandleProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandlePropertiesKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetMemoryWin32HandlePropertiesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandlePropertiesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetMemoryWin32HandlePropertiesKHR, intercept->container_type);
         intercept->PreCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     }
     VkResult result = DispatchGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandlePropertiesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetMemoryWin32HandlePropertiesKHR, intercept->container_type);
         intercept->PostCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties, result);
     }
     return result;
@@ -5745,18 +6254,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(
     int*                                        pFd) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetMemoryFdKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryFdKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetMemoryFdKHR, intercept->container_type);
         intercept->PreCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetMemoryFdKHR(device, pGetFdInfo, pFd);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryFdKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetMemoryFdKHR, intercept->container_type);
         intercept->PostCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -5769,18 +6281,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdPropertiesKHR(
     VkMemoryFdPropertiesKHR*                    pMemoryFdProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdPropertiesKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetMemoryFdPropertiesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryFdPropertiesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetMemoryFdPropertiesKHR, intercept->container_type);
         intercept->PreCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     }
     VkResult result = DispatchGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryFdPropertiesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetMemoryFdPropertiesKHR, intercept->container_type);
         intercept->PostCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties, result);
     }
     return result;
@@ -5820,18 +6335,21 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreWin32HandleKHR(
     const VkImportSemaphoreWin32HandleInfoKHR*  pImportSemaphoreWin32HandleInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreWin32HandleKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateImportSemaphoreWin32HandleKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreWin32HandleKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordImportSemaphoreWin32HandleKHR, intercept->container_type);
         intercept->PreCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     }
     VkResult result = DispatchImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreWin32HandleKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordImportSemaphoreWin32HandleKHR, intercept->container_type);
         intercept->PostCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo, result);
     }
     return result;
@@ -5843,18 +6361,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreWin32HandleKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetSemaphoreWin32HandleKHR, intercept->container_type);
         intercept->PreCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreWin32HandleKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetSemaphoreWin32HandleKHR, intercept->container_type);
         intercept->PostCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -5867,18 +6388,21 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(
     const VkImportSemaphoreFdInfoKHR*           pImportSemaphoreFdInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreFdKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateImportSemaphoreFdKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreFdKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordImportSemaphoreFdKHR, intercept->container_type);
         intercept->PreCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     }
     VkResult result = DispatchImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreFdKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordImportSemaphoreFdKHR, intercept->container_type);
         intercept->PostCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo, result);
     }
     return result;
@@ -5890,18 +6414,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreFdKHR(
     int*                                        pFd) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreFdKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetSemaphoreFdKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreFdKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetSemaphoreFdKHR, intercept->container_type);
         intercept->PreCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreFdKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetSemaphoreFdKHR, intercept->container_type);
         intercept->PostCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -5917,18 +6444,21 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(
     const VkWriteDescriptorSet*                 pDescriptorWrites) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdPushDescriptorSetKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdPushDescriptorSetKHR, intercept->container_type);
         intercept->PreCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
     DispatchCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdPushDescriptorSetKHR, intercept->container_type);
         intercept->PostCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
 }
@@ -5941,18 +6471,21 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplateKHR, intercept->container_type);
         intercept->PreCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
     DispatchCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR, intercept->container_type);
         intercept->PostCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
 }
@@ -5968,18 +6501,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(
     VkDescriptorUpdateTemplate*                 pDescriptorUpdateTemplate) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateDescriptorUpdateTemplateKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateDescriptorUpdateTemplateKHR, intercept->container_type);
         intercept->PreCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateDescriptorUpdateTemplateKHR, intercept->container_type);
         intercept->PostCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
     return result;
@@ -5991,18 +6527,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyDescriptorUpdateTemplateKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyDescriptorUpdateTemplateKHR, intercept->container_type);
         intercept->PreCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyDescriptorUpdateTemplateKHR, intercept->container_type);
         intercept->PostCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
 }
@@ -6014,18 +6553,21 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSetWithTemplateKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateUpdateDescriptorSetWithTemplateKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSetWithTemplateKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordUpdateDescriptorSetWithTemplateKHR, intercept->container_type);
         intercept->PreCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSetWithTemplateKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordUpdateDescriptorSetWithTemplateKHR, intercept->container_type);
         intercept->PostCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
 }
@@ -6039,18 +6581,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(
     VkRenderPass*                               pRenderPass) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2KHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateRenderPass2KHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateRenderPass2KHR, intercept->container_type);
         intercept->PreCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateRenderPass2KHR, intercept->container_type);
         intercept->PostCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -6062,18 +6607,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(
     const VkSubpassBeginInfo*                   pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBeginRenderPass2KHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBeginRenderPass2KHR, intercept->container_type);
         intercept->PreCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBeginRenderPass2KHR, intercept->container_type);
         intercept->PostCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -6084,18 +6632,21 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdNextSubpass2KHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdNextSubpass2KHR, intercept->container_type);
         intercept->PreCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdNextSubpass2KHR, intercept->container_type);
         intercept->PostCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -6105,18 +6656,21 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdEndRenderPass2KHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdEndRenderPass2KHR, intercept->container_type);
         intercept->PreCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdEndRenderPass2KHR, intercept->container_type);
         intercept->PostCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -6127,18 +6681,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainStatusKHR(
     VkSwapchainKHR                              swapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainStatusKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetSwapchainStatusKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainStatusKHR(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainStatusKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetSwapchainStatusKHR, intercept->container_type);
         intercept->PreCallRecordGetSwapchainStatusKHR(device, swapchain);
     }
     VkResult result = DispatchGetSwapchainStatusKHR(device, swapchain);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainStatusKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetSwapchainStatusKHR, intercept->container_type);
         intercept->PostCallRecordGetSwapchainStatusKHR(device, swapchain, result);
     }
     return result;
@@ -6175,18 +6732,21 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(
     const VkImportFenceWin32HandleInfoKHR*      pImportFenceWin32HandleInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceWin32HandleKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateImportFenceWin32HandleKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportFenceWin32HandleKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordImportFenceWin32HandleKHR, intercept->container_type);
         intercept->PreCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     }
     VkResult result = DispatchImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportFenceWin32HandleKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordImportFenceWin32HandleKHR, intercept->container_type);
         intercept->PostCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo, result);
     }
     return result;
@@ -6198,18 +6758,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceWin32HandleKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetFenceWin32HandleKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceWin32HandleKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetFenceWin32HandleKHR, intercept->container_type);
         intercept->PreCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceWin32HandleKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetFenceWin32HandleKHR, intercept->container_type);
         intercept->PostCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -6222,18 +6785,21 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(
     const VkImportFenceFdInfoKHR*               pImportFenceFdInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceFdKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateImportFenceFdKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceFdKHR(device, pImportFenceFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportFenceFdKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordImportFenceFdKHR, intercept->container_type);
         intercept->PreCallRecordImportFenceFdKHR(device, pImportFenceFdInfo);
     }
     VkResult result = DispatchImportFenceFdKHR(device, pImportFenceFdInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportFenceFdKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordImportFenceFdKHR, intercept->container_type);
         intercept->PostCallRecordImportFenceFdKHR(device, pImportFenceFdInfo, result);
     }
     return result;
@@ -6245,18 +6811,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceFdKHR(
     int*                                        pFd) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceFdKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetFenceFdKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceFdKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetFenceFdKHR, intercept->container_type);
         intercept->PreCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetFenceFdKHR(device, pGetFdInfo, pFd);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceFdKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetFenceFdKHR, intercept->container_type);
         intercept->PostCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -6315,18 +6884,21 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(
     const VkAcquireProfilingLockInfoKHR*        pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireProfilingLockKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateAcquireProfilingLockKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireProfilingLockKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireProfilingLockKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordAcquireProfilingLockKHR, intercept->container_type);
         intercept->PreCallRecordAcquireProfilingLockKHR(device, pInfo);
     }
     VkResult result = DispatchAcquireProfilingLockKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireProfilingLockKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordAcquireProfilingLockKHR, intercept->container_type);
         intercept->PostCallRecordAcquireProfilingLockKHR(device, pInfo, result);
     }
     return result;
@@ -6336,18 +6908,21 @@ VKAPI_ATTR void VKAPI_CALL ReleaseProfilingLockKHR(
     VkDevice                                    device) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseProfilingLockKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateReleaseProfilingLockKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseProfilingLockKHR(device);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleaseProfilingLockKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordReleaseProfilingLockKHR, intercept->container_type);
         intercept->PreCallRecordReleaseProfilingLockKHR(device);
     }
     DispatchReleaseProfilingLockKHR(device);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleaseProfilingLockKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordReleaseProfilingLockKHR, intercept->container_type);
         intercept->PostCallRecordReleaseProfilingLockKHR(device);
     }
 }
@@ -6506,18 +7081,21 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2KHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetImageMemoryRequirements2KHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetImageMemoryRequirements2KHR, intercept->container_type);
         intercept->PreCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetImageMemoryRequirements2KHR, intercept->container_type);
         intercept->PostCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -6528,18 +7106,21 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2KHR(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements2KHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetBufferMemoryRequirements2KHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetBufferMemoryRequirements2KHR, intercept->container_type);
         intercept->PreCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetBufferMemoryRequirements2KHR, intercept->container_type);
         intercept->PostCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -6551,18 +7132,21 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2KHR(
     VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements2KHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetImageSparseMemoryRequirements2KHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetImageSparseMemoryRequirements2KHR, intercept->container_type);
         intercept->PreCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetImageSparseMemoryRequirements2KHR, intercept->container_type);
         intercept->PostCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -6576,18 +7160,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(
     VkSamplerYcbcrConversion*                   pYcbcrConversion) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSamplerYcbcrConversionKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateSamplerYcbcrConversionKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSamplerYcbcrConversionKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateSamplerYcbcrConversionKHR, intercept->container_type);
         intercept->PreCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSamplerYcbcrConversionKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateSamplerYcbcrConversionKHR, intercept->container_type);
         intercept->PostCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
     return result;
@@ -6599,18 +7186,21 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySamplerYcbcrConversionKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroySamplerYcbcrConversionKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySamplerYcbcrConversionKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroySamplerYcbcrConversionKHR, intercept->container_type);
         intercept->PreCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySamplerYcbcrConversionKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroySamplerYcbcrConversionKHR, intercept->container_type);
         intercept->PostCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
 }
@@ -6622,18 +7212,21 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(
     const VkBindBufferMemoryInfo*               pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2KHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateBindBufferMemory2KHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordBindBufferMemory2KHR, intercept->container_type);
         intercept->PreCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordBindBufferMemory2KHR, intercept->container_type);
         intercept->PostCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -6645,18 +7238,21 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(
     const VkBindImageMemoryInfo*                pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2KHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateBindImageMemory2KHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordBindImageMemory2KHR, intercept->container_type);
         intercept->PreCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory2KHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordBindImageMemory2KHR, intercept->container_type);
         intercept->PostCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -6669,18 +7265,21 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupportKHR(
     VkDescriptorSetLayoutSupport*               pSupport) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutSupportKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDescriptorSetLayoutSupportKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutSupportKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDescriptorSetLayoutSupportKHR, intercept->container_type);
         intercept->PreCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutSupportKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDescriptorSetLayoutSupportKHR, intercept->container_type);
         intercept->PostCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
 }
@@ -6696,18 +7295,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawIndirectCountKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawIndirectCountKHR, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawIndirectCountKHR, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -6722,18 +7324,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawIndexedIndirectCountKHR, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -6753,18 +7358,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(
     uint64_t*                                   pValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValueKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetSemaphoreCounterValueKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValueKHR(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreCounterValueKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetSemaphoreCounterValueKHR, intercept->container_type);
         intercept->PreCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValueKHR(device, semaphore, pValue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreCounterValueKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetSemaphoreCounterValueKHR, intercept->container_type);
         intercept->PostCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue, result);
     }
     return result;
@@ -6776,18 +7384,21 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(
     uint64_t                                    timeout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphoresKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateWaitSemaphoresKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphoresKHR(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitSemaphoresKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordWaitSemaphoresKHR, intercept->container_type);
         intercept->PreCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphoresKHR(device, pWaitInfo, timeout);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitSemaphoresKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordWaitSemaphoresKHR, intercept->container_type);
         intercept->PostCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout, result);
     }
     return result;
@@ -6798,18 +7409,21 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphoreKHR(
     const VkSemaphoreSignalInfo*                pSignalInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphoreKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateSignalSemaphoreKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphoreKHR(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSignalSemaphoreKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordSignalSemaphoreKHR, intercept->container_type);
         intercept->PreCallRecordSignalSemaphoreKHR(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphoreKHR(device, pSignalInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSignalSemaphoreKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordSignalSemaphoreKHR, intercept->container_type);
         intercept->PostCallRecordSignalSemaphoreKHR(device, pSignalInfo, result);
     }
     return result;
@@ -6826,18 +7440,21 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetBufferDeviceAddressKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddressKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetBufferDeviceAddressKHR, intercept->container_type);
         intercept->PreCallRecordGetBufferDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddressKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetBufferDeviceAddressKHR, intercept->container_type);
         intercept->PostCallRecordGetBufferDeviceAddressKHR(device, pInfo, result);
     }
     return result;
@@ -6848,18 +7465,21 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferOpaqueCaptureAddressKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetBufferOpaqueCaptureAddressKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferOpaqueCaptureAddressKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetBufferOpaqueCaptureAddressKHR, intercept->container_type);
         intercept->PreCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddressKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferOpaqueCaptureAddressKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetBufferOpaqueCaptureAddressKHR, intercept->container_type);
         intercept->PostCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     return result;
@@ -6870,18 +7490,21 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(
     const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR, intercept->container_type);
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR, intercept->container_type);
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     return result;
@@ -6895,18 +7518,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(
     VkDeferredOperationKHR*                     pDeferredOperation) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDeferredOperationKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateDeferredOperationKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDeferredOperationKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateDeferredOperationKHR, intercept->container_type);
         intercept->PreCallRecordCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
     }
     VkResult result = DispatchCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDeferredOperationKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateDeferredOperationKHR, intercept->container_type);
         intercept->PostCallRecordCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation, result);
     }
     return result;
@@ -6918,18 +7544,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyDeferredOperationKHR(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDeferredOperationKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyDeferredOperationKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDeferredOperationKHR(device, operation, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDeferredOperationKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyDeferredOperationKHR, intercept->container_type);
         intercept->PreCallRecordDestroyDeferredOperationKHR(device, operation, pAllocator);
     }
     DispatchDestroyDeferredOperationKHR(device, operation, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDeferredOperationKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyDeferredOperationKHR, intercept->container_type);
         intercept->PostCallRecordDestroyDeferredOperationKHR(device, operation, pAllocator);
     }
 }
@@ -6939,18 +7568,21 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetDeferredOperationMaxConcurrencyKHR(
     VkDeferredOperationKHR                      operation) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeferredOperationMaxConcurrencyKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeferredOperationMaxConcurrencyKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeferredOperationMaxConcurrencyKHR(device, operation);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeferredOperationMaxConcurrencyKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeferredOperationMaxConcurrencyKHR, intercept->container_type);
         intercept->PreCallRecordGetDeferredOperationMaxConcurrencyKHR(device, operation);
     }
     uint32_t result = DispatchGetDeferredOperationMaxConcurrencyKHR(device, operation);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeferredOperationMaxConcurrencyKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeferredOperationMaxConcurrencyKHR, intercept->container_type);
         intercept->PostCallRecordGetDeferredOperationMaxConcurrencyKHR(device, operation);
     }
     return result;
@@ -6961,18 +7593,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeferredOperationResultKHR(
     VkDeferredOperationKHR                      operation) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeferredOperationResultKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeferredOperationResultKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeferredOperationResultKHR(device, operation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeferredOperationResultKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeferredOperationResultKHR, intercept->container_type);
         intercept->PreCallRecordGetDeferredOperationResultKHR(device, operation);
     }
     VkResult result = DispatchGetDeferredOperationResultKHR(device, operation);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeferredOperationResultKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeferredOperationResultKHR, intercept->container_type);
         intercept->PostCallRecordGetDeferredOperationResultKHR(device, operation, result);
     }
     return result;
@@ -6983,18 +7618,21 @@ VKAPI_ATTR VkResult VKAPI_CALL DeferredOperationJoinKHR(
     VkDeferredOperationKHR                      operation) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeferredOperationJoinKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDeferredOperationJoinKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeferredOperationJoinKHR(device, operation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDeferredOperationJoinKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDeferredOperationJoinKHR, intercept->container_type);
         intercept->PreCallRecordDeferredOperationJoinKHR(device, operation);
     }
     VkResult result = DispatchDeferredOperationJoinKHR(device, operation);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDeferredOperationJoinKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDeferredOperationJoinKHR, intercept->container_type);
         intercept->PostCallRecordDeferredOperationJoinKHR(device, operation, result);
     }
     return result;
@@ -7009,18 +7647,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutablePropertiesKHR(
     VkPipelineExecutablePropertiesKHR*          pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutablePropertiesKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetPipelineExecutablePropertiesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutablePropertiesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetPipelineExecutablePropertiesKHR, intercept->container_type);
         intercept->PreCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     }
     VkResult result = DispatchGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutablePropertiesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetPipelineExecutablePropertiesKHR, intercept->container_type);
         intercept->PostCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties, result);
     }
     return result;
@@ -7033,18 +7674,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableStatisticsKHR(
     VkPipelineExecutableStatisticKHR*           pStatistics) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutableStatisticsKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetPipelineExecutableStatisticsKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutableStatisticsKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetPipelineExecutableStatisticsKHR, intercept->container_type);
         intercept->PreCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     }
     VkResult result = DispatchGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutableStatisticsKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetPipelineExecutableStatisticsKHR, intercept->container_type);
         intercept->PostCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics, result);
     }
     return result;
@@ -7057,18 +7701,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
     VkPipelineExecutableInternalRepresentationKHR* pInternalRepresentations) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutableInternalRepresentationsKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetPipelineExecutableInternalRepresentationsKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutableInternalRepresentationsKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetPipelineExecutableInternalRepresentationsKHR, intercept->container_type);
         intercept->PreCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     }
     VkResult result = DispatchGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutableInternalRepresentationsKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetPipelineExecutableInternalRepresentationsKHR, intercept->container_type);
         intercept->PostCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations, result);
     }
     return result;
@@ -7166,18 +7813,21 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(
     const VkDebugMarkerObjectTagInfoEXT*        pTagInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDebugMarkerSetObjectTagEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDebugMarkerSetObjectTagEXT, intercept->container_type);
         intercept->PreCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchDebugMarkerSetObjectTagEXT(device, pTagInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDebugMarkerSetObjectTagEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDebugMarkerSetObjectTagEXT, intercept->container_type);
         intercept->PostCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo, result);
     }
     return result;
@@ -7188,19 +7838,22 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectNameEXT(
     const VkDebugMarkerObjectNameInfoEXT*       pNameInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectNameEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDebugMarkerSetObjectNameEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDebugMarkerSetObjectNameEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDebugMarkerSetObjectNameEXT, intercept->container_type);
         intercept->PreCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetMarkerObjectName(pNameInfo);
     VkResult result = DispatchDebugMarkerSetObjectNameEXT(device, pNameInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDebugMarkerSetObjectNameEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDebugMarkerSetObjectNameEXT, intercept->container_type);
         intercept->PostCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo, result);
     }
     return result;
@@ -7211,18 +7864,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(
     const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerBeginEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDebugMarkerBeginEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerBeginEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDebugMarkerBeginEXT, intercept->container_type);
         intercept->PreCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerBeginEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDebugMarkerBeginEXT, intercept->container_type);
         intercept->PostCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -7231,18 +7887,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerEndEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDebugMarkerEndEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerEndEXT(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerEndEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDebugMarkerEndEXT, intercept->container_type);
         intercept->PreCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
     DispatchCmdDebugMarkerEndEXT(commandBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerEndEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDebugMarkerEndEXT, intercept->container_type);
         intercept->PostCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
 }
@@ -7252,18 +7911,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(
     const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerInsertEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDebugMarkerInsertEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerInsertEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDebugMarkerInsertEXT, intercept->container_type);
         intercept->PreCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerInsertEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDebugMarkerInsertEXT, intercept->container_type);
         intercept->PostCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -7280,18 +7942,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(
     const VkDeviceSize*                         pSizes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindTransformFeedbackBuffersEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBindTransformFeedbackBuffersEXT, intercept->container_type);
         intercept->PreCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
     DispatchCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT, intercept->container_type);
         intercept->PostCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
 }
@@ -7304,18 +7969,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(
     const VkDeviceSize*                         pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBeginTransformFeedbackEXT, intercept->container_type);
         intercept->PreCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT, intercept->container_type);
         intercept->PostCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -7328,18 +7996,21 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(
     const VkDeviceSize*                         pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdEndTransformFeedbackEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdEndTransformFeedbackEXT, intercept->container_type);
         intercept->PreCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdEndTransformFeedbackEXT, intercept->container_type);
         intercept->PostCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -7352,18 +8023,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(
     uint32_t                                    index) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBeginQueryIndexedEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBeginQueryIndexedEXT, intercept->container_type);
         intercept->PreCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
     DispatchCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBeginQueryIndexedEXT, intercept->container_type);
         intercept->PostCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
 }
@@ -7375,18 +8049,21 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(
     uint32_t                                    index) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdEndQueryIndexedEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdEndQueryIndexedEXT, intercept->container_type);
         intercept->PreCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
     DispatchCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdEndQueryIndexedEXT, intercept->container_type);
         intercept->PostCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
 }
@@ -7401,18 +8078,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(
     uint32_t                                    vertexStride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectByteCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawIndirectByteCountEXT, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
     DispatchCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
 }
@@ -7423,18 +8103,21 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(
     const VkImageViewHandleInfoNVX*             pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewHandleNVX]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetImageViewHandleNVX, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewHandleNVX(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageViewHandleNVX]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetImageViewHandleNVX, intercept->container_type);
         intercept->PreCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     uint32_t result = DispatchGetImageViewHandleNVX(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageViewHandleNVX]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetImageViewHandleNVX, intercept->container_type);
         intercept->PostCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     return result;
@@ -7446,18 +8129,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageViewAddressNVX(
     VkImageViewAddressPropertiesNVX*            pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewAddressNVX]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetImageViewAddressNVX, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewAddressNVX(device, imageView, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageViewAddressNVX]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetImageViewAddressNVX, intercept->container_type);
         intercept->PreCallRecordGetImageViewAddressNVX(device, imageView, pProperties);
     }
     VkResult result = DispatchGetImageViewAddressNVX(device, imageView, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageViewAddressNVX]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetImageViewAddressNVX, intercept->container_type);
         intercept->PostCallRecordGetImageViewAddressNVX(device, imageView, pProperties, result);
     }
     return result;
@@ -7474,18 +8160,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawIndirectCountAMD, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawIndirectCountAMD, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawIndirectCountAMD, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7500,18 +8189,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawIndexedIndirectCountAMD, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7530,18 +8222,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderInfoAMD(
     void*                                       pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetShaderInfoAMD]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetShaderInfoAMD, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetShaderInfoAMD]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetShaderInfoAMD, intercept->container_type);
         intercept->PreCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     }
     VkResult result = DispatchGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetShaderInfoAMD]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetShaderInfoAMD, intercept->container_type);
         intercept->PostCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo, result);
     }
     return result;
@@ -7616,18 +8311,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleNV(
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetMemoryWin32HandleNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandleNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetMemoryWin32HandleNV, intercept->container_type);
         intercept->PreCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandleNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetMemoryWin32HandleNV, intercept->container_type);
         intercept->PostCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle, result);
     }
     return result;
@@ -7675,18 +8373,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(
     const VkConditionalRenderingBeginInfoEXT*   pConditionalRenderingBegin) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBeginConditionalRenderingEXT, intercept->container_type);
         intercept->PreCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
     DispatchCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT, intercept->container_type);
         intercept->PostCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
 }
@@ -7695,18 +8396,21 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdEndConditionalRenderingEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndConditionalRenderingEXT(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdEndConditionalRenderingEXT, intercept->container_type);
         intercept->PreCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
     DispatchCmdEndConditionalRenderingEXT(commandBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdEndConditionalRenderingEXT, intercept->container_type);
         intercept->PostCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
 }
@@ -7719,18 +8423,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(
     const VkViewportWScalingNV*                 pViewportWScalings) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWScalingNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetViewportWScalingNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWScalingNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetViewportWScalingNV, intercept->container_type);
         intercept->PreCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
     DispatchCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWScalingNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetViewportWScalingNV, intercept->container_type);
         intercept->PostCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
 }
@@ -7839,18 +8546,21 @@ VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(
     const VkDisplayPowerInfoEXT*                pDisplayPowerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDisplayPowerControlEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDisplayPowerControlEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDisplayPowerControlEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDisplayPowerControlEXT, intercept->container_type);
         intercept->PreCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     }
     VkResult result = DispatchDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDisplayPowerControlEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDisplayPowerControlEXT, intercept->container_type);
         intercept->PostCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo, result);
     }
     return result;
@@ -7863,18 +8573,21 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDeviceEventEXT(
     VkFence*                                    pFence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDeviceEventEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateRegisterDeviceEventEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordRegisterDeviceEventEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordRegisterDeviceEventEXT, intercept->container_type);
         intercept->PreCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordRegisterDeviceEventEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordRegisterDeviceEventEXT, intercept->container_type);
         intercept->PostCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence, result);
     }
     return result;
@@ -7888,18 +8601,21 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(
     VkFence*                                    pFence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDisplayEventEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateRegisterDisplayEventEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordRegisterDisplayEventEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordRegisterDisplayEventEXT, intercept->container_type);
         intercept->PreCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordRegisterDisplayEventEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordRegisterDisplayEventEXT, intercept->container_type);
         intercept->PostCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence, result);
     }
     return result;
@@ -7912,18 +8628,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(
     uint64_t*                                   pCounterValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainCounterEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetSwapchainCounterEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainCounterEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetSwapchainCounterEXT, intercept->container_type);
         intercept->PreCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     }
     VkResult result = DispatchGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainCounterEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetSwapchainCounterEXT, intercept->container_type);
         intercept->PostCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue, result);
     }
     return result;
@@ -7936,18 +8655,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRefreshCycleDurationGOOGLE(
     VkRefreshCycleDurationGOOGLE*               pDisplayTimingProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRefreshCycleDurationGOOGLE]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetRefreshCycleDurationGOOGLE, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRefreshCycleDurationGOOGLE]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetRefreshCycleDurationGOOGLE, intercept->container_type);
         intercept->PreCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     }
     VkResult result = DispatchGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRefreshCycleDurationGOOGLE]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetRefreshCycleDurationGOOGLE, intercept->container_type);
         intercept->PostCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties, result);
     }
     return result;
@@ -7960,18 +8682,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTimingGOOGLE(
     VkPastPresentationTimingGOOGLE*             pPresentationTimings) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPastPresentationTimingGOOGLE]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetPastPresentationTimingGOOGLE, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPastPresentationTimingGOOGLE]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetPastPresentationTimingGOOGLE, intercept->container_type);
         intercept->PreCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     }
     VkResult result = DispatchGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPastPresentationTimingGOOGLE]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetPastPresentationTimingGOOGLE, intercept->container_type);
         intercept->PostCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings, result);
     }
     return result;
@@ -7990,18 +8715,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(
     const VkRect2D*                             pDiscardRectangles) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDiscardRectangleEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetDiscardRectangleEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDiscardRectangleEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetDiscardRectangleEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
     DispatchCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDiscardRectangleEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetDiscardRectangleEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
 }
@@ -8017,18 +8745,21 @@ VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(
     const VkHdrMetadataEXT*                     pMetadata) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetHdrMetadataEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateSetHdrMetadataEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetHdrMetadataEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordSetHdrMetadataEXT, intercept->container_type);
         intercept->PreCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
     DispatchSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetHdrMetadataEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordSetHdrMetadataEXT, intercept->container_type);
         intercept->PostCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
 }
@@ -8095,19 +8826,22 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectNameEXT(
     const VkDebugUtilsObjectNameInfoEXT*        pNameInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectNameEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateSetDebugUtilsObjectNameEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDebugUtilsObjectNameEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordSetDebugUtilsObjectNameEXT, intercept->container_type);
         intercept->PreCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetUtilsObjectName(pNameInfo);
     VkResult result = DispatchSetDebugUtilsObjectNameEXT(device, pNameInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDebugUtilsObjectNameEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordSetDebugUtilsObjectNameEXT, intercept->container_type);
         intercept->PostCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo, result);
     }
     return result;
@@ -8118,18 +8852,21 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectTagEXT(
     const VkDebugUtilsObjectTagInfoEXT*         pTagInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDebugUtilsObjectTagEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordSetDebugUtilsObjectTagEXT, intercept->container_type);
         intercept->PreCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchSetDebugUtilsObjectTagEXT(device, pTagInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDebugUtilsObjectTagEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordSetDebugUtilsObjectTagEXT, intercept->container_type);
         intercept->PostCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo, result);
     }
     return result;
@@ -8140,19 +8877,22 @@ VKAPI_ATTR void VKAPI_CALL QueueBeginDebugUtilsLabelEXT(
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBeginDebugUtilsLabelEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateQueueBeginDebugUtilsLabelEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueBeginDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordQueueBeginDebugUtilsLabelEXT, intercept->container_type);
         intercept->PreCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     BeginQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueBeginDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordQueueBeginDebugUtilsLabelEXT, intercept->container_type);
         intercept->PostCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
 }
@@ -8161,19 +8901,22 @@ VKAPI_ATTR void VKAPI_CALL QueueEndDebugUtilsLabelEXT(
     VkQueue                                     queue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueEndDebugUtilsLabelEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateQueueEndDebugUtilsLabelEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueEndDebugUtilsLabelEXT(queue);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueEndDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordQueueEndDebugUtilsLabelEXT, intercept->container_type);
         intercept->PreCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
     DispatchQueueEndDebugUtilsLabelEXT(queue);
     EndQueueDebugUtilsLabel(layer_data->report_data, queue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueEndDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordQueueEndDebugUtilsLabelEXT, intercept->container_type);
         intercept->PostCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
 }
@@ -8183,19 +8926,22 @@ VKAPI_ATTR void VKAPI_CALL QueueInsertDebugUtilsLabelEXT(
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueInsertDebugUtilsLabelEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateQueueInsertDebugUtilsLabelEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueInsertDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordQueueInsertDebugUtilsLabelEXT, intercept->container_type);
         intercept->PreCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     InsertQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueInsertDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordQueueInsertDebugUtilsLabelEXT, intercept->container_type);
         intercept->PostCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
 }
@@ -8205,18 +8951,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBeginDebugUtilsLabelEXT, intercept->container_type);
         intercept->PreCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT, intercept->container_type);
         intercept->PostCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -8225,18 +8974,21 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndDebugUtilsLabelEXT(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdEndDebugUtilsLabelEXT, intercept->container_type);
         intercept->PreCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
     DispatchCmdEndDebugUtilsLabelEXT(commandBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT, intercept->container_type);
         intercept->PostCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
 }
@@ -8246,18 +8998,21 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdInsertDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdInsertDebugUtilsLabelEXT, intercept->container_type);
         intercept->PreCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT, intercept->container_type);
         intercept->PostCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -8341,18 +9096,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAndroidHardwareBufferPropertiesANDROID(
     VkAndroidHardwareBufferPropertiesANDROID*   pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAndroidHardwareBufferPropertiesANDROID]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetAndroidHardwareBufferPropertiesANDROID, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAndroidHardwareBufferPropertiesANDROID]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetAndroidHardwareBufferPropertiesANDROID, intercept->container_type);
         intercept->PreCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     }
     VkResult result = DispatchGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAndroidHardwareBufferPropertiesANDROID]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetAndroidHardwareBufferPropertiesANDROID, intercept->container_type);
         intercept->PostCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties, result);
     }
     return result;
@@ -8364,18 +9122,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryAndroidHardwareBufferANDROID(
     struct AHardwareBuffer**                    pBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryAndroidHardwareBufferANDROID]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetMemoryAndroidHardwareBufferANDROID, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryAndroidHardwareBufferANDROID]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetMemoryAndroidHardwareBufferANDROID, intercept->container_type);
         intercept->PreCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     }
     VkResult result = DispatchGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryAndroidHardwareBufferANDROID]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetMemoryAndroidHardwareBufferANDROID, intercept->container_type);
         intercept->PostCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer, result);
     }
     return result;
@@ -8394,18 +9155,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(
     const VkSampleLocationsInfoEXT*             pSampleLocationsInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleLocationsEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetSampleLocationsEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetSampleLocationsEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetSampleLocationsEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
     DispatchCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetSampleLocationsEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetSampleLocationsEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
 }
@@ -8445,18 +9209,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(
     VkImageDrmFormatModifierPropertiesEXT*      pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageDrmFormatModifierPropertiesEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetImageDrmFormatModifierPropertiesEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageDrmFormatModifierPropertiesEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetImageDrmFormatModifierPropertiesEXT, intercept->container_type);
         intercept->PreCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     }
     VkResult result = DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageDrmFormatModifierPropertiesEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetImageDrmFormatModifierPropertiesEXT, intercept->container_type);
         intercept->PostCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties, result);
     }
     return result;
@@ -8472,18 +9239,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(
     VkImageLayout                               imageLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindShadingRateImageNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBindShadingRateImageNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindShadingRateImageNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBindShadingRateImageNV, intercept->container_type);
         intercept->PreCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
     DispatchCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindShadingRateImageNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBindShadingRateImageNV, intercept->container_type);
         intercept->PostCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
 }
@@ -8495,18 +9265,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(
     const VkShadingRatePaletteNV*               pShadingRatePalettes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportShadingRatePaletteNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetViewportShadingRatePaletteNV, intercept->container_type);
         intercept->PreCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
     DispatchCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV, intercept->container_type);
         intercept->PostCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
 }
@@ -8518,18 +9291,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(
     const VkCoarseSampleOrderCustomNV*          pCustomSampleOrders) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoarseSampleOrderNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetCoarseSampleOrderNV, intercept->container_type);
         intercept->PreCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
     DispatchCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV, intercept->container_type);
         intercept->PostCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
 }
@@ -8542,18 +9318,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(
     VkAccelerationStructureNV*                  pAccelerationStructure) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateAccelerationStructureNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateAccelerationStructureNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateAccelerationStructureNV, intercept->container_type);
         intercept->PreCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateAccelerationStructureNV, intercept->container_type);
         intercept->PostCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
     return result;
@@ -8565,18 +9344,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureKHR(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyAccelerationStructureKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyAccelerationStructureKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyAccelerationStructureKHR, intercept->container_type);
         intercept->PreCallRecordDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyAccelerationStructureKHR, intercept->container_type);
         intercept->PostCallRecordDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     }
 }
@@ -8587,18 +9369,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyAccelerationStructureNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyAccelerationStructureNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyAccelerationStructureNV, intercept->container_type);
         intercept->PreCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyAccelerationStructureNV, intercept->container_type);
         intercept->PostCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
 }
@@ -8609,18 +9394,21 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
     VkMemoryRequirements2KHR*                   pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsNV, intercept->container_type);
         intercept->PreCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsNV, intercept->container_type);
         intercept->PostCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
 }
@@ -8631,18 +9419,21 @@ VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryKHR(
     const VkBindAccelerationStructureMemoryInfoKHR* pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindAccelerationStructureMemoryKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateBindAccelerationStructureMemoryKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindAccelerationStructureMemoryKHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindAccelerationStructureMemoryKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordBindAccelerationStructureMemoryKHR, intercept->container_type);
         intercept->PreCallRecordBindAccelerationStructureMemoryKHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindAccelerationStructureMemoryKHR(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindAccelerationStructureMemoryKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordBindAccelerationStructureMemoryKHR, intercept->container_type);
         intercept->PostCallRecordBindAccelerationStructureMemoryKHR(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -8654,18 +9445,21 @@ VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryNV(
     const VkBindAccelerationStructureMemoryInfoKHR* pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindAccelerationStructureMemoryNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateBindAccelerationStructureMemoryNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindAccelerationStructureMemoryNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordBindAccelerationStructureMemoryNV, intercept->container_type);
         intercept->PreCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindAccelerationStructureMemoryNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordBindAccelerationStructureMemoryNV, intercept->container_type);
         intercept->PostCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -8683,18 +9477,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(
     VkDeviceSize                                scratchOffset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructureNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBuildAccelerationStructureNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructureNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBuildAccelerationStructureNV, intercept->container_type);
         intercept->PreCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
     DispatchCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructureNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBuildAccelerationStructureNV, intercept->container_type);
         intercept->PostCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
 }
@@ -8706,18 +9503,21 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(
     VkCopyAccelerationStructureModeKHR          mode) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdCopyAccelerationStructureNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdCopyAccelerationStructureNV, intercept->container_type);
         intercept->PreCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
     DispatchCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdCopyAccelerationStructureNV, intercept->container_type);
         intercept->PostCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
 }
@@ -8740,18 +9540,21 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(
     uint32_t                                    depth) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdTraceRaysNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdTraceRaysNV, intercept->container_type);
         intercept->PreCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
     DispatchCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdTraceRaysNV, intercept->container_type);
         intercept->PostCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
 }
@@ -8765,18 +9568,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesKHR(
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesKHR, intercept->container_type);
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesKHR, intercept->container_type);
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
     return result;
@@ -8791,18 +9597,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesNV(
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesNV, intercept->container_type);
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesNV, intercept->container_type);
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
     return result;
@@ -8815,18 +9624,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureHandleNV(
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureHandleNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetAccelerationStructureHandleNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureHandleNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetAccelerationStructureHandleNV, intercept->container_type);
         intercept->PreCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     }
     VkResult result = DispatchGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureHandleNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetAccelerationStructureHandleNV, intercept->container_type);
         intercept->PostCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData, result);
     }
     return result;
@@ -8841,18 +9653,21 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesKHR(
     uint32_t                                    firstQuery) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesKHR, intercept->container_type);
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesKHR, intercept->container_type);
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
 }
@@ -8866,18 +9681,21 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(
     uint32_t                                    firstQuery) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesNV, intercept->container_type);
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV, intercept->container_type);
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
 }
@@ -8888,18 +9706,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CompileDeferredNV(
     uint32_t                                    shader) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCompileDeferredNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCompileDeferredNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCompileDeferredNV(device, pipeline, shader);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCompileDeferredNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCompileDeferredNV, intercept->container_type);
         intercept->PreCallRecordCompileDeferredNV(device, pipeline, shader);
     }
     VkResult result = DispatchCompileDeferredNV(device, pipeline, shader);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCompileDeferredNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCompileDeferredNV, intercept->container_type);
         intercept->PostCallRecordCompileDeferredNV(device, pipeline, shader, result);
     }
     return result;
@@ -8917,18 +9738,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryHostPointerPropertiesEXT(
     VkMemoryHostPointerPropertiesEXT*           pMemoryHostPointerProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryHostPointerPropertiesEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetMemoryHostPointerPropertiesEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryHostPointerPropertiesEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetMemoryHostPointerPropertiesEXT, intercept->container_type);
         intercept->PreCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     }
     VkResult result = DispatchGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryHostPointerPropertiesEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetMemoryHostPointerPropertiesEXT, intercept->container_type);
         intercept->PostCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties, result);
     }
     return result;
@@ -8943,18 +9767,21 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(
     uint32_t                                    marker) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarkerAMD]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdWriteBufferMarkerAMD, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteBufferMarkerAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdWriteBufferMarkerAMD, intercept->container_type);
         intercept->PreCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
     DispatchCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteBufferMarkerAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdWriteBufferMarkerAMD, intercept->container_type);
         intercept->PostCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
 }
@@ -8992,18 +9819,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(
     uint64_t*                                   pMaxDeviation) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetCalibratedTimestampsEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetCalibratedTimestampsEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetCalibratedTimestampsEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetCalibratedTimestampsEXT, intercept->container_type);
         intercept->PreCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     }
     VkResult result = DispatchGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetCalibratedTimestampsEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetCalibratedTimestampsEXT, intercept->container_type);
         intercept->PostCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation, result);
     }
     return result;
@@ -9025,18 +9855,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(
     uint32_t                                    firstTask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawMeshTasksNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawMeshTasksNV, intercept->container_type);
         intercept->PreCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
     DispatchCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawMeshTasksNV, intercept->container_type);
         intercept->PostCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
 }
@@ -9049,18 +9882,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawMeshTasksIndirectNV, intercept->container_type);
         intercept->PreCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV, intercept->container_type);
         intercept->PostCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -9075,18 +9911,21 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountNV, intercept->container_type);
         intercept->PreCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV, intercept->container_type);
         intercept->PostCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -9101,18 +9940,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(
     const VkRect2D*                             pExclusiveScissors) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetExclusiveScissorNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetExclusiveScissorNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetExclusiveScissorNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetExclusiveScissorNV, intercept->container_type);
         intercept->PreCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
     DispatchCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetExclusiveScissorNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetExclusiveScissorNV, intercept->container_type);
         intercept->PostCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
 }
@@ -9123,18 +9965,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(
     const void*                                 pCheckpointMarker) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCheckpointNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetCheckpointNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCheckpointNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetCheckpointNV, intercept->container_type);
         intercept->PreCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
     DispatchCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCheckpointNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetCheckpointNV, intercept->container_type);
         intercept->PostCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
 }
@@ -9145,18 +9990,21 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointDataNV(
     VkCheckpointDataNV*                         pCheckpointData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueueCheckpointDataNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetQueueCheckpointDataNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueueCheckpointDataNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetQueueCheckpointDataNV, intercept->container_type);
         intercept->PreCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
     DispatchGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueueCheckpointDataNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetQueueCheckpointDataNV, intercept->container_type);
         intercept->PostCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
 }
@@ -9168,18 +10016,21 @@ VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(
     const VkInitializePerformanceApiInfoINTEL*  pInitializeInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateInitializePerformanceApiINTEL]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateInitializePerformanceApiINTEL, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInitializePerformanceApiINTEL(device, pInitializeInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordInitializePerformanceApiINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordInitializePerformanceApiINTEL, intercept->container_type);
         intercept->PreCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo);
     }
     VkResult result = DispatchInitializePerformanceApiINTEL(device, pInitializeInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordInitializePerformanceApiINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordInitializePerformanceApiINTEL, intercept->container_type);
         intercept->PostCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo, result);
     }
     return result;
@@ -9189,18 +10040,21 @@ VKAPI_ATTR void VKAPI_CALL UninitializePerformanceApiINTEL(
     VkDevice                                    device) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUninitializePerformanceApiINTEL]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateUninitializePerformanceApiINTEL, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUninitializePerformanceApiINTEL(device);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUninitializePerformanceApiINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordUninitializePerformanceApiINTEL, intercept->container_type);
         intercept->PreCallRecordUninitializePerformanceApiINTEL(device);
     }
     DispatchUninitializePerformanceApiINTEL(device);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUninitializePerformanceApiINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordUninitializePerformanceApiINTEL, intercept->container_type);
         intercept->PostCallRecordUninitializePerformanceApiINTEL(device);
     }
 }
@@ -9210,18 +10064,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(
     const VkPerformanceMarkerInfoINTEL*         pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetPerformanceMarkerINTEL, intercept->container_type);
         intercept->PreCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL, intercept->container_type);
         intercept->PostCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -9232,18 +10089,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(
     const VkPerformanceStreamMarkerInfoINTEL*   pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetPerformanceStreamMarkerINTEL, intercept->container_type);
         intercept->PreCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL, intercept->container_type);
         intercept->PostCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -9254,18 +10114,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(
     const VkPerformanceOverrideInfoINTEL*       pOverrideInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceOverrideINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetPerformanceOverrideINTEL, intercept->container_type);
         intercept->PreCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
     }
     VkResult result = DispatchCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL, intercept->container_type);
         intercept->PostCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, result);
     }
     return result;
@@ -9277,18 +10140,21 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(
     VkPerformanceConfigurationINTEL*            pConfiguration) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquirePerformanceConfigurationINTEL]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateAcquirePerformanceConfigurationINTEL, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquirePerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordAcquirePerformanceConfigurationINTEL, intercept->container_type);
         intercept->PreCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     }
     VkResult result = DispatchAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquirePerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordAcquirePerformanceConfigurationINTEL, intercept->container_type);
         intercept->PostCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration, result);
     }
     return result;
@@ -9299,18 +10165,21 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(
     VkPerformanceConfigurationINTEL             configuration) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleasePerformanceConfigurationINTEL]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateReleasePerformanceConfigurationINTEL, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleasePerformanceConfigurationINTEL(device, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleasePerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordReleasePerformanceConfigurationINTEL, intercept->container_type);
         intercept->PreCallRecordReleasePerformanceConfigurationINTEL(device, configuration);
     }
     VkResult result = DispatchReleasePerformanceConfigurationINTEL(device, configuration);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleasePerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordReleasePerformanceConfigurationINTEL, intercept->container_type);
         intercept->PostCallRecordReleasePerformanceConfigurationINTEL(device, configuration, result);
     }
     return result;
@@ -9321,18 +10190,21 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSetPerformanceConfigurationINTEL(
     VkPerformanceConfigurationINTEL             configuration) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSetPerformanceConfigurationINTEL]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateQueueSetPerformanceConfigurationINTEL, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSetPerformanceConfigurationINTEL(queue, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSetPerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordQueueSetPerformanceConfigurationINTEL, intercept->container_type);
         intercept->PreCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration);
     }
     VkResult result = DispatchQueueSetPerformanceConfigurationINTEL(queue, configuration);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSetPerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordQueueSetPerformanceConfigurationINTEL, intercept->container_type);
         intercept->PostCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration, result);
     }
     return result;
@@ -9344,18 +10216,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPerformanceParameterINTEL(
     VkPerformanceValueINTEL*                    pValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPerformanceParameterINTEL]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetPerformanceParameterINTEL, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPerformanceParameterINTEL(device, parameter, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPerformanceParameterINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetPerformanceParameterINTEL, intercept->container_type);
         intercept->PreCallRecordGetPerformanceParameterINTEL(device, parameter, pValue);
     }
     VkResult result = DispatchGetPerformanceParameterINTEL(device, parameter, pValue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPerformanceParameterINTEL]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetPerformanceParameterINTEL, intercept->container_type);
         intercept->PostCallRecordGetPerformanceParameterINTEL(device, parameter, pValue, result);
     }
     return result;
@@ -9369,18 +10244,21 @@ VKAPI_ATTR void VKAPI_CALL SetLocalDimmingAMD(
     VkBool32                                    localDimmingEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetLocalDimmingAMD]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateSetLocalDimmingAMD, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetLocalDimmingAMD]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordSetLocalDimmingAMD, intercept->container_type);
         intercept->PreCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
     DispatchSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetLocalDimmingAMD]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordSetLocalDimmingAMD, intercept->container_type);
         intercept->PostCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
 }
@@ -9455,18 +10333,21 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressEXT(
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetBufferDeviceAddressEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressEXT(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddressEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetBufferDeviceAddressEXT, intercept->container_type);
         intercept->PreCallRecordGetBufferDeviceAddressEXT(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressEXT(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddressEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetBufferDeviceAddressEXT, intercept->container_type);
         intercept->PostCallRecordGetBufferDeviceAddressEXT(device, pInfo, result);
     }
     return result;
@@ -9556,18 +10437,21 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireFullScreenExclusiveModeEXT(
     VkSwapchainKHR                              swapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireFullScreenExclusiveModeEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateAcquireFullScreenExclusiveModeEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireFullScreenExclusiveModeEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordAcquireFullScreenExclusiveModeEXT, intercept->container_type);
         intercept->PreCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchAcquireFullScreenExclusiveModeEXT(device, swapchain);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireFullScreenExclusiveModeEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordAcquireFullScreenExclusiveModeEXT, intercept->container_type);
         intercept->PostCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain, result);
     }
     return result;
@@ -9578,18 +10462,21 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleaseFullScreenExclusiveModeEXT(
     VkSwapchainKHR                              swapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseFullScreenExclusiveModeEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateReleaseFullScreenExclusiveModeEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleaseFullScreenExclusiveModeEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordReleaseFullScreenExclusiveModeEXT, intercept->container_type);
         intercept->PreCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchReleaseFullScreenExclusiveModeEXT(device, swapchain);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleaseFullScreenExclusiveModeEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordReleaseFullScreenExclusiveModeEXT, intercept->container_type);
         intercept->PostCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain, result);
     }
     return result;
@@ -9601,18 +10488,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(
     VkDeviceGroupPresentModeFlagsKHR*           pModes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModes2EXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModes2EXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModes2EXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModes2EXT, intercept->container_type);
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModes2EXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModes2EXT, intercept->container_type);
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes, result);
     }
     return result;
@@ -9651,18 +10541,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(
     uint16_t                                    lineStipplePattern) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetLineStippleEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineStippleEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetLineStippleEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
     DispatchCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineStippleEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetLineStippleEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
 }
@@ -9676,18 +10569,21 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(
     uint32_t                                    queryCount) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPoolEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateResetQueryPoolEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetQueryPoolEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordResetQueryPoolEXT, intercept->container_type);
         intercept->PreCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetQueryPoolEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordResetQueryPoolEXT, intercept->container_type);
         intercept->PostCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
 }
@@ -9699,18 +10595,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(
     VkCullModeFlags                             cullMode) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullModeEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetCullModeEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCullModeEXT(commandBuffer, cullMode);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCullModeEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetCullModeEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetCullModeEXT(commandBuffer, cullMode);
     }
     DispatchCmdSetCullModeEXT(commandBuffer, cullMode);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCullModeEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetCullModeEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetCullModeEXT(commandBuffer, cullMode);
     }
 }
@@ -9720,18 +10619,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(
     VkFrontFace                                 frontFace) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFaceEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetFrontFaceEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFrontFaceEXT(commandBuffer, frontFace);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFrontFaceEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetFrontFaceEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace);
     }
     DispatchCmdSetFrontFaceEXT(commandBuffer, frontFace);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFrontFaceEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetFrontFaceEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace);
     }
 }
@@ -9741,18 +10643,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(
     VkPrimitiveTopology                         primitiveTopology) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveTopologyEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetPrimitiveTopologyEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveTopologyEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetPrimitiveTopologyEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     }
     DispatchCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveTopologyEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetPrimitiveTopologyEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     }
 }
@@ -9763,18 +10668,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(
     const VkViewport*                           pViewports) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetViewportWithCountEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetViewportWithCountEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     }
     DispatchCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetViewportWithCountEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     }
 }
@@ -9785,18 +10693,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(
     const VkRect2D*                             pScissors) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetScissorWithCountEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissorWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetScissorWithCountEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     }
     DispatchCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissorWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetScissorWithCountEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     }
 }
@@ -9811,18 +10722,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(
     const VkDeviceSize*                         pStrides) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2EXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBindVertexBuffers2EXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers2EXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBindVertexBuffers2EXT, intercept->container_type);
         intercept->PreCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
     DispatchCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers2EXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBindVertexBuffers2EXT, intercept->container_type);
         intercept->PostCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
 }
@@ -9832,18 +10746,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(
     VkBool32                                    depthTestEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetDepthTestEnableEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetDepthTestEnableEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     }
     DispatchCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetDepthTestEnableEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     }
 }
@@ -9853,18 +10770,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(
     VkBool32                                    depthWriteEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthWriteEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetDepthWriteEnableEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     }
     DispatchCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthWriteEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetDepthWriteEnableEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     }
 }
@@ -9874,18 +10794,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(
     VkCompareOp                                 depthCompareOp) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOpEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetDepthCompareOpEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthCompareOpEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetDepthCompareOpEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     }
     DispatchCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthCompareOpEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetDepthCompareOpEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     }
 }
@@ -9895,18 +10818,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(
     VkBool32                                    depthBoundsTestEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBoundsTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetDepthBoundsTestEnableEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBoundsTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetDepthBoundsTestEnableEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     }
     DispatchCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBoundsTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetDepthBoundsTestEnableEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     }
 }
@@ -9916,18 +10842,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(
     VkBool32                                    stencilTestEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetStencilTestEnableEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetStencilTestEnableEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     }
     DispatchCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetStencilTestEnableEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     }
 }
@@ -9941,18 +10870,21 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(
     VkCompareOp                                 compareOp) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOpEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdSetStencilOpEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilOpEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdSetStencilOpEXT, intercept->container_type);
         intercept->PreCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
     DispatchCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilOpEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdSetStencilOpEXT, intercept->container_type);
         intercept->PostCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
 }
@@ -9965,18 +10897,21 @@ VKAPI_ATTR void VKAPI_CALL GetGeneratedCommandsMemoryRequirementsNV(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetGeneratedCommandsMemoryRequirementsNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetGeneratedCommandsMemoryRequirementsNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetGeneratedCommandsMemoryRequirementsNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetGeneratedCommandsMemoryRequirementsNV, intercept->container_type);
         intercept->PreCallRecordGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetGeneratedCommandsMemoryRequirementsNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetGeneratedCommandsMemoryRequirementsNV, intercept->container_type);
         intercept->PostCallRecordGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
 }
@@ -9986,18 +10921,21 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(
     const VkGeneratedCommandsInfoNV*            pGeneratedCommandsInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPreprocessGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdPreprocessGeneratedCommandsNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPreprocessGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdPreprocessGeneratedCommandsNV, intercept->container_type);
         intercept->PreCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     }
     DispatchCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPreprocessGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdPreprocessGeneratedCommandsNV, intercept->container_type);
         intercept->PostCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     }
 }
@@ -10008,18 +10946,21 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(
     const VkGeneratedCommandsInfoNV*            pGeneratedCommandsInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdExecuteGeneratedCommandsNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdExecuteGeneratedCommandsNV, intercept->container_type);
         intercept->PreCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     }
     DispatchCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdExecuteGeneratedCommandsNV, intercept->container_type);
         intercept->PostCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     }
 }
@@ -10031,18 +10972,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipelineShaderGroupNV(
     uint32_t                                    groupIndex) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipelineShaderGroupNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBindPipelineShaderGroupNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipelineShaderGroupNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBindPipelineShaderGroupNV, intercept->container_type);
         intercept->PreCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     }
     DispatchCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipelineShaderGroupNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBindPipelineShaderGroupNV, intercept->container_type);
         intercept->PostCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     }
 }
@@ -10054,18 +10998,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(
     VkIndirectCommandsLayoutNV*                 pIndirectCommandsLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateIndirectCommandsLayoutNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateIndirectCommandsLayoutNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateIndirectCommandsLayoutNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateIndirectCommandsLayoutNV, intercept->container_type);
         intercept->PreCallRecordCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     }
     VkResult result = DispatchCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateIndirectCommandsLayoutNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateIndirectCommandsLayoutNV, intercept->container_type);
         intercept->PostCallRecordCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout, result);
     }
     return result;
@@ -10077,18 +11024,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNV(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyIndirectCommandsLayoutNV]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyIndirectCommandsLayoutNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyIndirectCommandsLayoutNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyIndirectCommandsLayoutNV, intercept->container_type);
         intercept->PreCallRecordDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     }
     DispatchDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyIndirectCommandsLayoutNV]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyIndirectCommandsLayoutNV, intercept->container_type);
         intercept->PostCallRecordDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     }
 }
@@ -10106,18 +11056,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlotEXT(
     VkPrivateDataSlotEXT*                       pPrivateDataSlot) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePrivateDataSlotEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreatePrivateDataSlotEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePrivateDataSlotEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreatePrivateDataSlotEXT, intercept->container_type);
         intercept->PreCallRecordCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     }
     VkResult result = DispatchCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePrivateDataSlotEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreatePrivateDataSlotEXT, intercept->container_type);
         intercept->PostCallRecordCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot, result);
     }
     return result;
@@ -10129,18 +11082,21 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlotEXT(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPrivateDataSlotEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateDestroyPrivateDataSlotEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPrivateDataSlotEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordDestroyPrivateDataSlotEXT, intercept->container_type);
         intercept->PreCallRecordDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     }
     DispatchDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPrivateDataSlotEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordDestroyPrivateDataSlotEXT, intercept->container_type);
         intercept->PostCallRecordDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     }
 }
@@ -10153,18 +11109,21 @@ VKAPI_ATTR VkResult VKAPI_CALL SetPrivateDataEXT(
     uint64_t                                    data) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetPrivateDataEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateSetPrivateDataEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetPrivateDataEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordSetPrivateDataEXT, intercept->container_type);
         intercept->PreCallRecordSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
     }
     VkResult result = DispatchSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetPrivateDataEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordSetPrivateDataEXT, intercept->container_type);
         intercept->PostCallRecordSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data, result);
     }
     return result;
@@ -10178,18 +11137,21 @@ VKAPI_ATTR void VKAPI_CALL GetPrivateDataEXT(
     uint64_t*                                   pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPrivateDataEXT]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetPrivateDataEXT, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPrivateDataEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetPrivateDataEXT, intercept->container_type);
         intercept->PreCallRecordGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     }
     DispatchGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPrivateDataEXT]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetPrivateDataEXT, intercept->container_type);
         intercept->PostCallRecordGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     }
 }
@@ -10259,18 +11221,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(
     VkAccelerationStructureKHR*                 pAccelerationStructure) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateAccelerationStructureKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateAccelerationStructureKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateAccelerationStructureKHR, intercept->container_type);
         intercept->PreCallRecordCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateAccelerationStructureKHR, intercept->container_type);
         intercept->PostCallRecordCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
     return result;
@@ -10282,18 +11247,21 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsKHR(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsKHR, intercept->container_type);
         intercept->PreCallRecordGetAccelerationStructureMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetAccelerationStructureMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsKHR, intercept->container_type);
         intercept->PostCallRecordGetAccelerationStructureMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -10305,18 +11273,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureKHR(
     const VkAccelerationStructureBuildOffsetInfoKHR* const* ppOffsetInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBuildAccelerationStructureKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructureKHR(commandBuffer, infoCount, pInfos, ppOffsetInfos);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBuildAccelerationStructureKHR, intercept->container_type);
         intercept->PreCallRecordCmdBuildAccelerationStructureKHR(commandBuffer, infoCount, pInfos, ppOffsetInfos);
     }
     DispatchCmdBuildAccelerationStructureKHR(commandBuffer, infoCount, pInfos, ppOffsetInfos);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBuildAccelerationStructureKHR, intercept->container_type);
         intercept->PostCallRecordCmdBuildAccelerationStructureKHR(commandBuffer, infoCount, pInfos, ppOffsetInfos);
     }
 }
@@ -10329,18 +11300,21 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureIndirectKHR(
     uint32_t                                    indirectStride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructureIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdBuildAccelerationStructureIndirectKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructureIndirectKHR(commandBuffer, pInfo, indirectBuffer, indirectOffset, indirectStride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructureIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdBuildAccelerationStructureIndirectKHR, intercept->container_type);
         intercept->PreCallRecordCmdBuildAccelerationStructureIndirectKHR(commandBuffer, pInfo, indirectBuffer, indirectOffset, indirectStride);
     }
     DispatchCmdBuildAccelerationStructureIndirectKHR(commandBuffer, pInfo, indirectBuffer, indirectOffset, indirectStride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructureIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdBuildAccelerationStructureIndirectKHR, intercept->container_type);
         intercept->PostCallRecordCmdBuildAccelerationStructureIndirectKHR(commandBuffer, pInfo, indirectBuffer, indirectOffset, indirectStride);
     }
 }
@@ -10352,18 +11326,21 @@ VKAPI_ATTR VkResult VKAPI_CALL BuildAccelerationStructureKHR(
     const VkAccelerationStructureBuildOffsetInfoKHR* const* ppOffsetInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBuildAccelerationStructureKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateBuildAccelerationStructureKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBuildAccelerationStructureKHR(device, infoCount, pInfos, ppOffsetInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBuildAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordBuildAccelerationStructureKHR, intercept->container_type);
         intercept->PreCallRecordBuildAccelerationStructureKHR(device, infoCount, pInfos, ppOffsetInfos);
     }
     VkResult result = DispatchBuildAccelerationStructureKHR(device, infoCount, pInfos, ppOffsetInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBuildAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordBuildAccelerationStructureKHR, intercept->container_type);
         intercept->PostCallRecordBuildAccelerationStructureKHR(device, infoCount, pInfos, ppOffsetInfos, result);
     }
     return result;
@@ -10374,18 +11351,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureKHR(
     const VkCopyAccelerationStructureInfoKHR*   pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyAccelerationStructureKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCopyAccelerationStructureKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyAccelerationStructureKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCopyAccelerationStructureKHR, intercept->container_type);
         intercept->PreCallRecordCopyAccelerationStructureKHR(device, pInfo);
     }
     VkResult result = DispatchCopyAccelerationStructureKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCopyAccelerationStructureKHR, intercept->container_type);
         intercept->PostCallRecordCopyAccelerationStructureKHR(device, pInfo, result);
     }
     return result;
@@ -10396,18 +11376,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureToMemoryKHR(
     const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyAccelerationStructureToMemoryKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCopyAccelerationStructureToMemoryKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyAccelerationStructureToMemoryKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyAccelerationStructureToMemoryKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCopyAccelerationStructureToMemoryKHR, intercept->container_type);
         intercept->PreCallRecordCopyAccelerationStructureToMemoryKHR(device, pInfo);
     }
     VkResult result = DispatchCopyAccelerationStructureToMemoryKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyAccelerationStructureToMemoryKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCopyAccelerationStructureToMemoryKHR, intercept->container_type);
         intercept->PostCallRecordCopyAccelerationStructureToMemoryKHR(device, pInfo, result);
     }
     return result;
@@ -10418,18 +11401,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToAccelerationStructureKHR(
     const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMemoryToAccelerationStructureKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCopyMemoryToAccelerationStructureKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyMemoryToAccelerationStructureKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyMemoryToAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCopyMemoryToAccelerationStructureKHR, intercept->container_type);
         intercept->PreCallRecordCopyMemoryToAccelerationStructureKHR(device, pInfo);
     }
     VkResult result = DispatchCopyMemoryToAccelerationStructureKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyMemoryToAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCopyMemoryToAccelerationStructureKHR, intercept->container_type);
         intercept->PostCallRecordCopyMemoryToAccelerationStructureKHR(device, pInfo, result);
     }
     return result;
@@ -10445,18 +11431,21 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteAccelerationStructuresPropertiesKHR(
     size_t                                      stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWriteAccelerationStructuresPropertiesKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateWriteAccelerationStructuresPropertiesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWriteAccelerationStructuresPropertiesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordWriteAccelerationStructuresPropertiesKHR, intercept->container_type);
         intercept->PreCallRecordWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
     }
     VkResult result = DispatchWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWriteAccelerationStructuresPropertiesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordWriteAccelerationStructuresPropertiesKHR, intercept->container_type);
         intercept->PostCallRecordWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride, result);
     }
     return result;
@@ -10467,18 +11456,21 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(
     const VkCopyAccelerationStructureInfoKHR*   pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdCopyAccelerationStructureKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdCopyAccelerationStructureKHR, intercept->container_type);
         intercept->PreCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdCopyAccelerationStructureKHR, intercept->container_type);
         intercept->PostCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     }
 }
@@ -10488,18 +11480,21 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(
     const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureToMemoryKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdCopyAccelerationStructureToMemoryKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdCopyAccelerationStructureToMemoryKHR, intercept->container_type);
         intercept->PreCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdCopyAccelerationStructureToMemoryKHR, intercept->container_type);
         intercept->PostCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     }
 }
@@ -10509,18 +11504,21 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(
     const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryToAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdCopyMemoryToAccelerationStructureKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdCopyMemoryToAccelerationStructureKHR, intercept->container_type);
         intercept->PreCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdCopyMemoryToAccelerationStructureKHR, intercept->container_type);
         intercept->PostCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     }
 }
@@ -10536,18 +11534,21 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(
     uint32_t                                    depth) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdTraceRaysKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdTraceRaysKHR, intercept->container_type);
         intercept->PreCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     }
     DispatchCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdTraceRaysKHR, intercept->container_type);
         intercept->PostCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     }
 }
@@ -10557,18 +11558,21 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetAccelerationStructureDeviceAddressKHR(
     const VkAccelerationStructureDeviceAddressInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureDeviceAddressKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetAccelerationStructureDeviceAddressKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureDeviceAddressKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetAccelerationStructureDeviceAddressKHR, intercept->container_type);
         intercept->PreCallRecordGetAccelerationStructureDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetAccelerationStructureDeviceAddressKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureDeviceAddressKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetAccelerationStructureDeviceAddressKHR, intercept->container_type);
         intercept->PostCallRecordGetAccelerationStructureDeviceAddressKHR(device, pInfo, result);
     }
     return result;
@@ -10583,18 +11587,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingCaptureReplayShaderGroupHandlesKHR(
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR, intercept->container_type);
         intercept->PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR, intercept->container_type);
         intercept->PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
     return result;
@@ -10610,18 +11617,21 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(
     VkDeviceSize                                offset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCmdTraceRaysIndirectKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, buffer, offset);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCmdTraceRaysIndirectKHR, intercept->container_type);
         intercept->PreCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, buffer, offset);
     }
     DispatchCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, buffer, offset);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCmdTraceRaysIndirectKHR, intercept->container_type);
         intercept->PostCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, buffer, offset);
     }
 }
@@ -10631,18 +11641,21 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceAccelerationStructureCompatibilityKHR(
     const VkAccelerationStructureVersionKHR*    version) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceAccelerationStructureCompatibilityKHR]) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateGetDeviceAccelerationStructureCompatibilityKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceAccelerationStructureCompatibilityKHR(device, version);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceAccelerationStructureCompatibilityKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordGetDeviceAccelerationStructureCompatibilityKHR, intercept->container_type);
         intercept->PreCallRecordGetDeviceAccelerationStructureCompatibilityKHR(device, version);
     }
     VkResult result = DispatchGetDeviceAccelerationStructureCompatibilityKHR(device, version);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceAccelerationStructureCompatibilityKHR]) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordGetDeviceAccelerationStructureCompatibilityKHR, intercept->container_type);
         intercept->PostCallRecordGetDeviceAccelerationStructureCompatibilityKHR(device, version, result);
     }
     return result;
@@ -11202,6 +12215,2331 @@ const std::unordered_map<std::string, function_data> name_to_funcptr_map = {
 
 } // namespace vulkan_layer_chassis
 
+
+// A validation object's class (or one of its bases) overrides a hook exactly when naming the hook through the class no longer
+// resolves to the ValidationObject member, so the member pointer types differ. No RTTI is needed to tell them apart.
+#define VALIDATION_OBJECT_OVERRIDES(type, name) \
+    (!std::is_same<decltype(&ValidationObject::name), decltype(&type::name)>::value)
+
+#define BUILD_DISPATCH_VECTOR(name) \
+    init_object_dispatch_vector(InterceptId ## name, \
+                                VALIDATION_OBJECT_OVERRIDES(ThreadSafety, name), \
+                                VALIDATION_OBJECT_OVERRIDES(StatelessValidation, name), \
+                                VALIDATION_OBJECT_OVERRIDES(ObjectLifetimes, name), \
+                                VALIDATION_OBJECT_OVERRIDES(CoreChecks, name), \
+                                VALIDATION_OBJECT_OVERRIDES(BestPractices, name), \
+                                VALIDATION_OBJECT_OVERRIDES(GpuAssisted, name), \
+                                VALIDATION_OBJECT_OVERRIDES(DebugPrintf, name), \
+                                VALIDATION_OBJECT_OVERRIDES(CommandCounter, name), \
+                                VALIDATION_OBJECT_OVERRIDES(SyncValidator, name))
+
+void ValidationObject::InitObjectDispatchVectors() {
+    auto init_object_dispatch_vector = [this](InterceptId id, bool thread_safety, bool stateless_validation, bool object_tracker,
+                                              bool core_checks, bool best_practices, bool gpu_assisted, bool debug_printf,
+                                              bool command_counter, bool sync_validation) {
+        auto &intercept_vector = intercept_vectors[id];
+        for (auto item : object_dispatch) {
+            bool overrides = true;
+            switch (item->container_type) {
+                case LayerObjectTypeThreading:
+                    overrides = thread_safety;
+                    break;
+                case LayerObjectTypeParameterValidation:
+                    overrides = stateless_validation;
+                    break;
+                case LayerObjectTypeObjectTracker:
+                    overrides = object_tracker;
+                    break;
+                case LayerObjectTypeCoreValidation:
+                    overrides = core_checks;
+                    break;
+                case LayerObjectTypeBestPractices:
+                    overrides = best_practices;
+                    break;
+                case LayerObjectTypeGpuAssisted:
+                    overrides = gpu_assisted;
+                    break;
+                case LayerObjectTypeDebugPrintf:
+                    overrides = debug_printf;
+                    break;
+                case LayerObjectTypeCommandCounter:
+                    overrides = command_counter;
+                    break;
+                case LayerObjectTypeSyncValidation:
+                    overrides = sync_validation;
+                    break;
+                default:
+                    // Chassis codegen needs to be updated for unknown validation object types; call every hook until it is
+                    assert(0);
+                    break;
+            }
+            if (overrides) intercept_vector.push_back(item);
+        }
+    };
+
+    intercept_vectors.clear();
+    intercept_vectors.resize(InterceptIdCount);
+
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSubmit);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueSubmit);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueSubmit);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueWaitIdle);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueWaitIdle);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueWaitIdle);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDeviceWaitIdle);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDeviceWaitIdle);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDeviceWaitIdle);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAllocateMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAllocateMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAllocateMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateFreeMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordFreeMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordFreeMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateMapMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordMapMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordMapMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateUnmapMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordUnmapMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordUnmapMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateFlushMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PreCallRecordFlushMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PostCallRecordFlushMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PreCallValidateInvalidateMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PreCallRecordInvalidateMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PostCallRecordInvalidateMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryCommitment);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryCommitment);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryCommitment);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueBindSparse);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueBindSparse);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueBindSparse);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateFence);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateFence);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateFence);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyFence);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyFence);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyFence);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetFences);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetFences);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetFences);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceStatus);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceStatus);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceStatus);
+    BUILD_DISPATCH_VECTOR(PreCallValidateWaitForFences);
+    BUILD_DISPATCH_VECTOR(PreCallRecordWaitForFences);
+    BUILD_DISPATCH_VECTOR(PostCallRecordWaitForFences);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSemaphore);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroySemaphore);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroySemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetEventStatus);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetEventStatus);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetEventStatus);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateQueryPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyQueryPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateBufferView);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateBufferView);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateBufferView);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyBufferView);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyBufferView);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyBufferView);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSubresourceLayout);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSubresourceLayout);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSubresourceLayout);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateImageView);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateImageView);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateImageView);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyImageView);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyImageView);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyImageView);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyShaderModule);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyShaderModule);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyShaderModule);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreatePipelineCache);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreatePipelineCache);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreatePipelineCache);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipelineCache);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipelineCache);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipelineCache);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineCacheData);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineCacheData);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineCacheData);
+    BUILD_DISPATCH_VECTOR(PreCallValidateMergePipelineCaches);
+    BUILD_DISPATCH_VECTOR(PreCallRecordMergePipelineCaches);
+    BUILD_DISPATCH_VECTOR(PostCallRecordMergePipelineCaches);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipeline);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipeline);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipeline);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipelineLayout);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipelineLayout);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipelineLayout);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSampler);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSampler);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSampler);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySampler);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroySampler);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroySampler);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateFreeDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallRecordFreeDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PostCallRecordFreeDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateFramebuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateFramebuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateFramebuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyFramebuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyFramebuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyFramebuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyRenderPass);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetRenderAreaGranularity);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetRenderAreaGranularity);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetRenderAreaGranularity);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateCommandPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCommandPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetCommandPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAllocateCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAllocateCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAllocateCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallValidateFreeCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallRecordFreeCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PostCallRecordFreeCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBeginCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBeginCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBeginCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateEndCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordEndCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordEndCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindPipeline);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindPipeline);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindPipeline);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewport);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewport);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewport);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetScissor);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetScissor);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetScissor);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineWidth);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineWidth);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineWidth);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBias);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBias);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBias);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetBlendConstants);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetBlendConstants);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetBlendConstants);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBounds);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBounds);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBounds);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilCompareMask);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilCompareMask);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilCompareMask);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilWriteMask);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilWriteMask);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilWriteMask);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilReference);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilReference);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilReference);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindIndexBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindIndexBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindIndexBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindVertexBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindVertexBuffers);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindVertexBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDraw);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDraw);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDraw);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexed);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexed);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexed);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirect);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirect);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatch);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatch);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatch);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchIndirect);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBlitImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBlitImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBlitImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBufferToImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBufferToImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBufferToImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImageToBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImageToBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImageToBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdUpdateBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdUpdateBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdUpdateBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdFillBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdFillBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdFillBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearColorImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearColorImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearColorImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearDepthStencilImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearDepthStencilImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearDepthStencilImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearAttachments);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearAttachments);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearAttachments);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResolveImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdResolveImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdResolveImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWaitEvents);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdWaitEvents);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdWaitEvents);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPipelineBarrier);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdPipelineBarrier);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdPipelineBarrier);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginQuery);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginQuery);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginQuery);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndQuery);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndQuery);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndQuery);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteTimestamp);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteTimestamp);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteTimestamp);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushConstants);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushConstants);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushConstants);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdExecuteCommands);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdExecuteCommands);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdExecuteCommands);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPeerMemoryFeatures);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPeerMemoryFeatures);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPeerMemoryFeatures);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDeviceMask);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDeviceMask);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDeviceMask);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchBase);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchBase);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchBase);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateTrimCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordTrimCommandPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordTrimCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroySamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroySamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSetWithTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSetWithTemplate);
+    BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSetWithTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutSupport);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutSupport);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutSupport);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCount);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCount);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCount);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCount);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCount);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCount);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreCounterValue);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreCounterValue);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreCounterValue);
+    BUILD_DISPATCH_VECTOR(PreCallValidateWaitSemaphores);
+    BUILD_DISPATCH_VECTOR(PreCallRecordWaitSemaphores);
+    BUILD_DISPATCH_VECTOR(PostCallRecordWaitSemaphores);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSignalSemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSignalSemaphore);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSignalSemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddress);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddress);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddress);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroySwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroySwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainImagesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainImagesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainImagesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireNextImageKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAcquireNextImageKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAcquireNextImageKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueuePresentKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueuePresentKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueuePresentKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPresentCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPresentCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPresentCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupSurfacePresentModesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupSurfacePresentModesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupSurfacePresentModesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireNextImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAcquireNextImage2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAcquireNextImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSharedSwapchainsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSharedSwapchainsKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSharedSwapchainsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDeviceMaskKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDeviceMaskKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDeviceMaskKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchBaseKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchBaseKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchBaseKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateTrimCommandPoolKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordTrimCommandPoolKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordTrimCommandPoolKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandleKHR);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandlePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandlePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandlePropertiesKHR);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryFdKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryFdPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryFdPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryFdPropertiesKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateImportSemaphoreWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordImportSemaphoreWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordImportSemaphoreWin32HandleKHR);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreWin32HandleKHR);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateImportSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordImportSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordImportSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSetKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSetKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSetKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainStatusKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainStatusKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainStatusKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateImportFenceWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordImportFenceWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordImportFenceWin32HandleKHR);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceWin32HandleKHR);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateImportFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordImportFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordImportFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAcquireProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAcquireProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateReleaseProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordReleaseProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordReleaseProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroySamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroySamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutSupportKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutSupportKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutSupportKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreCounterValueKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreCounterValueKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreCounterValueKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateWaitSemaphoresKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordWaitSemaphoresKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordWaitSemaphoresKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSignalSemaphoreKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSignalSemaphoreKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSignalSemaphoreKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddressKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferOpaqueCaptureAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferOpaqueCaptureAddressKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferOpaqueCaptureAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDeferredOperationKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDeferredOperationKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDeferredOperationKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDeferredOperationKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDeferredOperationKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDeferredOperationKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeferredOperationMaxConcurrencyKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeferredOperationMaxConcurrencyKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeferredOperationMaxConcurrencyKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeferredOperationResultKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeferredOperationResultKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeferredOperationResultKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateDeferredOperationJoinKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDeferredOperationJoinKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDeferredOperationJoinKHR);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutablePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutablePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutablePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutableStatisticsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutableStatisticsKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutableStatisticsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutableInternalRepresentationsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutableInternalRepresentationsKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutableInternalRepresentationsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDebugMarkerSetObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDebugMarkerSetObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDebugMarkerSetObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDebugMarkerSetObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDebugMarkerSetObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDebugMarkerSetObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerBeginEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerBeginEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerBeginEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerEndEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerEndEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerEndEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerInsertEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerInsertEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerInsertEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindTransformFeedbackBuffersEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindTransformFeedbackBuffersEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindTransformFeedbackBuffersEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectByteCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectByteCountEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectByteCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageViewHandleNVX);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageViewHandleNVX);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageViewHandleNVX);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageViewAddressNVX);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageViewAddressNVX);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageViewAddressNVX);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetShaderInfoAMD);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetShaderInfoAMD);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetShaderInfoAMD);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandleNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandleNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandleNV);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWScalingNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWScalingNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWScalingNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDisplayPowerControlEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDisplayPowerControlEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDisplayPowerControlEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateRegisterDeviceEventEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordRegisterDeviceEventEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordRegisterDeviceEventEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateRegisterDisplayEventEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordRegisterDisplayEventEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordRegisterDisplayEventEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainCounterEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainCounterEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainCounterEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetRefreshCycleDurationGOOGLE);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetRefreshCycleDurationGOOGLE);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetRefreshCycleDurationGOOGLE);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPastPresentationTimingGOOGLE);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPastPresentationTimingGOOGLE);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPastPresentationTimingGOOGLE);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDiscardRectangleEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDiscardRectangleEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDiscardRectangleEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetHdrMetadataEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetHdrMetadataEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetHdrMetadataEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetDebugUtilsObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetDebugUtilsObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetDebugUtilsObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetDebugUtilsObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetDebugUtilsObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetDebugUtilsObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueInsertDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueInsertDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueInsertDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdInsertDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdInsertDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdInsertDebugUtilsLabelEXT);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetAndroidHardwareBufferPropertiesANDROID);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetAndroidHardwareBufferPropertiesANDROID);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetAndroidHardwareBufferPropertiesANDROID);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryAndroidHardwareBufferANDROID);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryAndroidHardwareBufferANDROID);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryAndroidHardwareBufferANDROID);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetSampleLocationsEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetSampleLocationsEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetSampleLocationsEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageDrmFormatModifierPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageDrmFormatModifierPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageDrmFormatModifierPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindShadingRateImageNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindShadingRateImageNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindShadingRateImageNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportShadingRatePaletteNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportShadingRatePaletteNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportShadingRatePaletteNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoarseSampleOrderNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoarseSampleOrderNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoarseSampleOrderNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindAccelerationStructureMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindAccelerationStructureMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindAccelerationStructureMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindAccelerationStructureMemoryNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindAccelerationStructureMemoryNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindAccelerationStructureMemoryNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingShaderGroupHandlesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingShaderGroupHandlesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingShaderGroupHandlesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingShaderGroupHandlesNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingShaderGroupHandlesNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingShaderGroupHandlesNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureHandleNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureHandleNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureHandleNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteAccelerationStructuresPropertiesNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteAccelerationStructuresPropertiesNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteAccelerationStructuresPropertiesNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCompileDeferredNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCompileDeferredNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCompileDeferredNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryHostPointerPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryHostPointerPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryHostPointerPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteBufferMarkerAMD);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteBufferMarkerAMD);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteBufferMarkerAMD);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetCalibratedTimestampsEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetCalibratedTimestampsEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetCalibratedTimestampsEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectCountNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectCountNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectCountNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetExclusiveScissorNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetExclusiveScissorNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetExclusiveScissorNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCheckpointNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCheckpointNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCheckpointNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetQueueCheckpointDataNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetQueueCheckpointDataNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetQueueCheckpointDataNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateInitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordInitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordInitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateUninitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordUninitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordUninitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceStreamMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceStreamMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceStreamMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceOverrideINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceOverrideINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceOverrideINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAcquirePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAcquirePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAcquirePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateReleasePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordReleasePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordReleasePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSetPerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueSetPerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueSetPerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPerformanceParameterINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPerformanceParameterINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPerformanceParameterINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetLocalDimmingAMD);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetLocalDimmingAMD);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetLocalDimmingAMD);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddressEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddressEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddressEXT);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireFullScreenExclusiveModeEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAcquireFullScreenExclusiveModeEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAcquireFullScreenExclusiveModeEXT);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateReleaseFullScreenExclusiveModeEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordReleaseFullScreenExclusiveModeEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordReleaseFullScreenExclusiveModeEXT);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupSurfacePresentModes2EXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupSurfacePresentModes2EXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupSurfacePresentModes2EXT);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineStippleEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineStippleEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineStippleEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetQueryPoolEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetQueryPoolEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetQueryPoolEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCullModeEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCullModeEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCullModeEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetFrontFaceEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetFrontFaceEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetFrontFaceEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPrimitiveTopologyEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPrimitiveTopologyEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPrimitiveTopologyEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetScissorWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetScissorWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetScissorWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindVertexBuffers2EXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindVertexBuffers2EXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindVertexBuffers2EXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthWriteEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthWriteEnableEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthWriteEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthCompareOpEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthCompareOpEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthCompareOpEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBoundsTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBoundsTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBoundsTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilOpEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilOpEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilOpEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetGeneratedCommandsMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetGeneratedCommandsMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetGeneratedCommandsMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPreprocessGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdPreprocessGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdPreprocessGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdExecuteGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdExecuteGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdExecuteGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindPipelineShaderGroupNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindPipelineShaderGroupNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindPipelineShaderGroupNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreatePrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreatePrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreatePrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetPrivateDataEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetPrivateDataEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetPrivateDataEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPrivateDataEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPrivateDataEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPrivateDataEXT);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureMemoryRequirementsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureMemoryRequirementsKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureMemoryRequirementsKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructureIndirectKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructureIndirectKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructureIndirectKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateBuildAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBuildAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBuildAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCopyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCopyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCopyAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCopyAccelerationStructureToMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCopyAccelerationStructureToMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCopyAccelerationStructureToMemoryKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCopyMemoryToAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCopyMemoryToAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCopyMemoryToAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateWriteAccelerationStructuresPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordWriteAccelerationStructuresPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordWriteAccelerationStructuresPropertiesKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureToMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureToMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureToMemoryKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMemoryToAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMemoryToAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMemoryToAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureDeviceAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureDeviceAddressKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureDeviceAddressKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysIndirectKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysIndirectKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysIndirectKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceAccelerationStructureCompatibilityKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceAccelerationStructureCompatibilityKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceAccelerationStructureCompatibilityKHR);
+#endif
+}
+
+#undef BUILD_DISPATCH_VECTOR
+#undef VALIDATION_OBJECT_OVERRIDES
+
+// Hook names for the chassis profile report, indexed by InterceptId
+static const char *const intercept_id_names[] = {
+    "PreCallValidateGetDeviceQueue",
+    "PreCallRecordGetDeviceQueue",
+    "PostCallRecordGetDeviceQueue",
+    "PreCallValidateQueueSubmit",
+    "PreCallRecordQueueSubmit",
+    "PostCallRecordQueueSubmit",
+    "PreCallValidateQueueWaitIdle",
+    "PreCallRecordQueueWaitIdle",
+    "PostCallRecordQueueWaitIdle",
+    "PreCallValidateDeviceWaitIdle",
+    "PreCallRecordDeviceWaitIdle",
+    "PostCallRecordDeviceWaitIdle",
+    "PreCallValidateAllocateMemory",
+    "PreCallRecordAllocateMemory",
+    "PostCallRecordAllocateMemory",
+    "PreCallValidateFreeMemory",
+    "PreCallRecordFreeMemory",
+    "PostCallRecordFreeMemory",
+    "PreCallValidateMapMemory",
+    "PreCallRecordMapMemory",
+    "PostCallRecordMapMemory",
+    "PreCallValidateUnmapMemory",
+    "PreCallRecordUnmapMemory",
+    "PostCallRecordUnmapMemory",
+    "PreCallValidateFlushMappedMemoryRanges",
+    "PreCallRecordFlushMappedMemoryRanges",
+    "PostCallRecordFlushMappedMemoryRanges",
+    "PreCallValidateInvalidateMappedMemoryRanges",
+    "PreCallRecordInvalidateMappedMemoryRanges",
+    "PostCallRecordInvalidateMappedMemoryRanges",
+    "PreCallValidateGetDeviceMemoryCommitment",
+    "PreCallRecordGetDeviceMemoryCommitment",
+    "PostCallRecordGetDeviceMemoryCommitment",
+    "PreCallValidateBindBufferMemory",
+    "PreCallRecordBindBufferMemory",
+    "PostCallRecordBindBufferMemory",
+    "PreCallValidateBindImageMemory",
+    "PreCallRecordBindImageMemory",
+    "PostCallRecordBindImageMemory",
+    "PreCallValidateGetBufferMemoryRequirements",
+    "PreCallRecordGetBufferMemoryRequirements",
+    "PostCallRecordGetBufferMemoryRequirements",
+    "PreCallValidateGetImageMemoryRequirements",
+    "PreCallRecordGetImageMemoryRequirements",
+    "PostCallRecordGetImageMemoryRequirements",
+    "PreCallValidateGetImageSparseMemoryRequirements",
+    "PreCallRecordGetImageSparseMemoryRequirements",
+    "PostCallRecordGetImageSparseMemoryRequirements",
+    "PreCallValidateQueueBindSparse",
+    "PreCallRecordQueueBindSparse",
+    "PostCallRecordQueueBindSparse",
+    "PreCallValidateCreateFence",
+    "PreCallRecordCreateFence",
+    "PostCallRecordCreateFence",
+    "PreCallValidateDestroyFence",
+    "PreCallRecordDestroyFence",
+    "PostCallRecordDestroyFence",
+    "PreCallValidateResetFences",
+    "PreCallRecordResetFences",
+    "PostCallRecordResetFences",
+    "PreCallValidateGetFenceStatus",
+    "PreCallRecordGetFenceStatus",
+    "PostCallRecordGetFenceStatus",
+    "PreCallValidateWaitForFences",
+    "PreCallRecordWaitForFences",
+    "PostCallRecordWaitForFences",
+    "PreCallValidateCreateSemaphore",
+    "PreCallRecordCreateSemaphore",
+    "PostCallRecordCreateSemaphore",
+    "PreCallValidateDestroySemaphore",
+    "PreCallRecordDestroySemaphore",
+    "PostCallRecordDestroySemaphore",
+    "PreCallValidateCreateEvent",
+    "PreCallRecordCreateEvent",
+    "PostCallRecordCreateEvent",
+    "PreCallValidateDestroyEvent",
+    "PreCallRecordDestroyEvent",
+    "PostCallRecordDestroyEvent",
+    "PreCallValidateGetEventStatus",
+    "PreCallRecordGetEventStatus",
+    "PostCallRecordGetEventStatus",
+    "PreCallValidateSetEvent",
+    "PreCallRecordSetEvent",
+    "PostCallRecordSetEvent",
+    "PreCallValidateResetEvent",
+    "PreCallRecordResetEvent",
+    "PostCallRecordResetEvent",
+    "PreCallValidateCreateQueryPool",
+    "PreCallRecordCreateQueryPool",
+    "PostCallRecordCreateQueryPool",
+    "PreCallValidateDestroyQueryPool",
+    "PreCallRecordDestroyQueryPool",
+    "PostCallRecordDestroyQueryPool",
+    "PreCallValidateGetQueryPoolResults",
+    "PreCallRecordGetQueryPoolResults",
+    "PostCallRecordGetQueryPoolResults",
+    "PreCallValidateCreateBuffer",
+    "PreCallRecordCreateBuffer",
+    "PostCallRecordCreateBuffer",
+    "PreCallValidateDestroyBuffer",
+    "PreCallRecordDestroyBuffer",
+    "PostCallRecordDestroyBuffer",
+    "PreCallValidateCreateBufferView",
+    "PreCallRecordCreateBufferView",
+    "PostCallRecordCreateBufferView",
+    "PreCallValidateDestroyBufferView",
+    "PreCallRecordDestroyBufferView",
+    "PostCallRecordDestroyBufferView",
+    "PreCallValidateCreateImage",
+    "PreCallRecordCreateImage",
+    "PostCallRecordCreateImage",
+    "PreCallValidateDestroyImage",
+    "PreCallRecordDestroyImage",
+    "PostCallRecordDestroyImage",
+    "PreCallValidateGetImageSubresourceLayout",
+    "PreCallRecordGetImageSubresourceLayout",
+    "PostCallRecordGetImageSubresourceLayout",
+    "PreCallValidateCreateImageView",
+    "PreCallRecordCreateImageView",
+    "PostCallRecordCreateImageView",
+    "PreCallValidateDestroyImageView",
+    "PreCallRecordDestroyImageView",
+    "PostCallRecordDestroyImageView",
+    "PreCallValidateCreateShaderModule",
+    "PreCallRecordCreateShaderModule",
+    "PostCallRecordCreateShaderModule",
+    "PreCallValidateDestroyShaderModule",
+    "PreCallRecordDestroyShaderModule",
+    "PostCallRecordDestroyShaderModule",
+    "PreCallValidateCreatePipelineCache",
+    "PreCallRecordCreatePipelineCache",
+    "PostCallRecordCreatePipelineCache",
+    "PreCallValidateDestroyPipelineCache",
+    "PreCallRecordDestroyPipelineCache",
+    "PostCallRecordDestroyPipelineCache",
+    "PreCallValidateGetPipelineCacheData",
+    "PreCallRecordGetPipelineCacheData",
+    "PostCallRecordGetPipelineCacheData",
+    "PreCallValidateMergePipelineCaches",
+    "PreCallRecordMergePipelineCaches",
+    "PostCallRecordMergePipelineCaches",
+    "PreCallValidateCreateGraphicsPipelines",
+    "PreCallRecordCreateGraphicsPipelines",
+    "PostCallRecordCreateGraphicsPipelines",
+    "PreCallValidateCreateComputePipelines",
+    "PreCallRecordCreateComputePipelines",
+    "PostCallRecordCreateComputePipelines",
+    "PreCallValidateDestroyPipeline",
+    "PreCallRecordDestroyPipeline",
+    "PostCallRecordDestroyPipeline",
+    "PreCallValidateCreatePipelineLayout",
+    "PreCallRecordCreatePipelineLayout",
+    "PostCallRecordCreatePipelineLayout",
+    "PreCallValidateDestroyPipelineLayout",
+    "PreCallRecordDestroyPipelineLayout",
+    "PostCallRecordDestroyPipelineLayout",
+    "PreCallValidateCreateSampler",
+    "PreCallRecordCreateSampler",
+    "PostCallRecordCreateSampler",
+    "PreCallValidateDestroySampler",
+    "PreCallRecordDestroySampler",
+    "PostCallRecordDestroySampler",
+    "PreCallValidateCreateDescriptorSetLayout",
+    "PreCallRecordCreateDescriptorSetLayout",
+    "PostCallRecordCreateDescriptorSetLayout",
+    "PreCallValidateDestroyDescriptorSetLayout",
+    "PreCallRecordDestroyDescriptorSetLayout",
+    "PostCallRecordDestroyDescriptorSetLayout",
+    "PreCallValidateCreateDescriptorPool",
+    "PreCallRecordCreateDescriptorPool",
+    "PostCallRecordCreateDescriptorPool",
+    "PreCallValidateDestroyDescriptorPool",
+    "PreCallRecordDestroyDescriptorPool",
+    "PostCallRecordDestroyDescriptorPool",
+    "PreCallValidateResetDescriptorPool",
+    "PreCallRecordResetDescriptorPool",
+    "PostCallRecordResetDescriptorPool",
+    "PreCallValidateAllocateDescriptorSets",
+    "PreCallRecordAllocateDescriptorSets",
+    "PostCallRecordAllocateDescriptorSets",
+    "PreCallValidateFreeDescriptorSets",
+    "PreCallRecordFreeDescriptorSets",
+    "PostCallRecordFreeDescriptorSets",
+    "PreCallValidateUpdateDescriptorSets",
+    "PreCallRecordUpdateDescriptorSets",
+    "PostCallRecordUpdateDescriptorSets",
+    "PreCallValidateCreateFramebuffer",
+    "PreCallRecordCreateFramebuffer",
+    "PostCallRecordCreateFramebuffer",
+    "PreCallValidateDestroyFramebuffer",
+    "PreCallRecordDestroyFramebuffer",
+    "PostCallRecordDestroyFramebuffer",
+    "PreCallValidateCreateRenderPass",
+    "PreCallRecordCreateRenderPass",
+    "PostCallRecordCreateRenderPass",
+    "PreCallValidateDestroyRenderPass",
+    "PreCallRecordDestroyRenderPass",
+    "PostCallRecordDestroyRenderPass",
+    "PreCallValidateGetRenderAreaGranularity",
+    "PreCallRecordGetRenderAreaGranularity",
+    "PostCallRecordGetRenderAreaGranularity",
+    "PreCallValidateCreateCommandPool",
+    "PreCallRecordCreateCommandPool",
+    "PostCallRecordCreateCommandPool",
+    "PreCallValidateDestroyCommandPool",
+    "PreCallRecordDestroyCommandPool",
+    "PostCallRecordDestroyCommandPool",
+    "PreCallValidateResetCommandPool",
+    "PreCallRecordResetCommandPool",
+    "PostCallRecordResetCommandPool",
+    "PreCallValidateAllocateCommandBuffers",
+    "PreCallRecordAllocateCommandBuffers",
+    "PostCallRecordAllocateCommandBuffers",
+    "PreCallValidateFreeCommandBuffers",
+    "PreCallRecordFreeCommandBuffers",
+    "PostCallRecordFreeCommandBuffers",
+    "PreCallValidateBeginCommandBuffer",
+    "PreCallRecordBeginCommandBuffer",
+    "PostCallRecordBeginCommandBuffer",
+    "PreCallValidateEndCommandBuffer",
+    "PreCallRecordEndCommandBuffer",
+    "PostCallRecordEndCommandBuffer",
+    "PreCallValidateResetCommandBuffer",
+    "PreCallRecordResetCommandBuffer",
+    "PostCallRecordResetCommandBuffer",
+    "PreCallValidateCmdBindPipeline",
+    "PreCallRecordCmdBindPipeline",
+    "PostCallRecordCmdBindPipeline",
+    "PreCallValidateCmdSetViewport",
+    "PreCallRecordCmdSetViewport",
+    "PostCallRecordCmdSetViewport",
+    "PreCallValidateCmdSetScissor",
+    "PreCallRecordCmdSetScissor",
+    "PostCallRecordCmdSetScissor",
+    "PreCallValidateCmdSetLineWidth",
+    "PreCallRecordCmdSetLineWidth",
+    "PostCallRecordCmdSetLineWidth",
+    "PreCallValidateCmdSetDepthBias",
+    "PreCallRecordCmdSetDepthBias",
+    "PostCallRecordCmdSetDepthBias",
+    "PreCallValidateCmdSetBlendConstants",
+    "PreCallRecordCmdSetBlendConstants",
+    "PostCallRecordCmdSetBlendConstants",
+    "PreCallValidateCmdSetDepthBounds",
+    "PreCallRecordCmdSetDepthBounds",
+    "PostCallRecordCmdSetDepthBounds",
+    "PreCallValidateCmdSetStencilCompareMask",
+    "PreCallRecordCmdSetStencilCompareMask",
+    "PostCallRecordCmdSetStencilCompareMask",
+    "PreCallValidateCmdSetStencilWriteMask",
+    "PreCallRecordCmdSetStencilWriteMask",
+    "PostCallRecordCmdSetStencilWriteMask",
+    "PreCallValidateCmdSetStencilReference",
+    "PreCallRecordCmdSetStencilReference",
+    "PostCallRecordCmdSetStencilReference",
+    "PreCallValidateCmdBindDescriptorSets",
+    "PreCallRecordCmdBindDescriptorSets",
+    "PostCallRecordCmdBindDescriptorSets",
+    "PreCallValidateCmdBindIndexBuffer",
+    "PreCallRecordCmdBindIndexBuffer",
+    "PostCallRecordCmdBindIndexBuffer",
+    "PreCallValidateCmdBindVertexBuffers",
+    "PreCallRecordCmdBindVertexBuffers",
+    "PostCallRecordCmdBindVertexBuffers",
+    "PreCallValidateCmdDraw",
+    "PreCallRecordCmdDraw",
+    "PostCallRecordCmdDraw",
+    "PreCallValidateCmdDrawIndexed",
+    "PreCallRecordCmdDrawIndexed",
+    "PostCallRecordCmdDrawIndexed",
+    "PreCallValidateCmdDrawIndirect",
+    "PreCallRecordCmdDrawIndirect",
+    "PostCallRecordCmdDrawIndirect",
+    "PreCallValidateCmdDrawIndexedIndirect",
+    "PreCallRecordCmdDrawIndexedIndirect",
+    "PostCallRecordCmdDrawIndexedIndirect",
+    "PreCallValidateCmdDispatch",
+    "PreCallRecordCmdDispatch",
+    "PostCallRecordCmdDispatch",
+    "PreCallValidateCmdDispatchIndirect",
+    "PreCallRecordCmdDispatchIndirect",
+    "PostCallRecordCmdDispatchIndirect",
+    "PreCallValidateCmdCopyBuffer",
+    "PreCallRecordCmdCopyBuffer",
+    "PostCallRecordCmdCopyBuffer",
+    "PreCallValidateCmdCopyImage",
+    "PreCallRecordCmdCopyImage",
+    "PostCallRecordCmdCopyImage",
+    "PreCallValidateCmdBlitImage",
+    "PreCallRecordCmdBlitImage",
+    "PostCallRecordCmdBlitImage",
+    "PreCallValidateCmdCopyBufferToImage",
+    "PreCallRecordCmdCopyBufferToImage",
+    "PostCallRecordCmdCopyBufferToImage",
+    "PreCallValidateCmdCopyImageToBuffer",
+    "PreCallRecordCmdCopyImageToBuffer",
+    "PostCallRecordCmdCopyImageToBuffer",
+    "PreCallValidateCmdUpdateBuffer",
+    "PreCallRecordCmdUpdateBuffer",
+    "PostCallRecordCmdUpdateBuffer",
+    "PreCallValidateCmdFillBuffer",
+    "PreCallRecordCmdFillBuffer",
+    "PostCallRecordCmdFillBuffer",
+    "PreCallValidateCmdClearColorImage",
+    "PreCallRecordCmdClearColorImage",
+    "PostCallRecordCmdClearColorImage",
+    "PreCallValidateCmdClearDepthStencilImage",
+    "PreCallRecordCmdClearDepthStencilImage",
+    "PostCallRecordCmdClearDepthStencilImage",
+    "PreCallValidateCmdClearAttachments",
+    "PreCallRecordCmdClearAttachments",
+    "PostCallRecordCmdClearAttachments",
+    "PreCallValidateCmdResolveImage",
+    "PreCallRecordCmdResolveImage",
+    "PostCallRecordCmdResolveImage",
+    "PreCallValidateCmdSetEvent",
+    "PreCallRecordCmdSetEvent",
+    "PostCallRecordCmdSetEvent",
+    "PreCallValidateCmdResetEvent",
+    "PreCallRecordCmdResetEvent",
+    "PostCallRecordCmdResetEvent",
+    "PreCallValidateCmdWaitEvents",
+    "PreCallRecordCmdWaitEvents",
+    "PostCallRecordCmdWaitEvents",
+    "PreCallValidateCmdPipelineBarrier",
+    "PreCallRecordCmdPipelineBarrier",
+    "PostCallRecordCmdPipelineBarrier",
+    "PreCallValidateCmdBeginQuery",
+    "PreCallRecordCmdBeginQuery",
+    "PostCallRecordCmdBeginQuery",
+    "PreCallValidateCmdEndQuery",
+    "PreCallRecordCmdEndQuery",
+    "PostCallRecordCmdEndQuery",
+    "PreCallValidateCmdResetQueryPool",
+    "PreCallRecordCmdResetQueryPool",
+    "PostCallRecordCmdResetQueryPool",
+    "PreCallValidateCmdWriteTimestamp",
+    "PreCallRecordCmdWriteTimestamp",
+    "PostCallRecordCmdWriteTimestamp",
+    "PreCallValidateCmdCopyQueryPoolResults",
+    "PreCallRecordCmdCopyQueryPoolResults",
+    "PostCallRecordCmdCopyQueryPoolResults",
+    "PreCallValidateCmdPushConstants",
+    "PreCallRecordCmdPushConstants",
+    "PostCallRecordCmdPushConstants",
+    "PreCallValidateCmdBeginRenderPass",
+    "PreCallRecordCmdBeginRenderPass",
+    "PostCallRecordCmdBeginRenderPass",
+    "PreCallValidateCmdNextSubpass",
+    "PreCallRecordCmdNextSubpass",
+    "PostCallRecordCmdNextSubpass",
+    "PreCallValidateCmdEndRenderPass",
+    "PreCallRecordCmdEndRenderPass",
+    "PostCallRecordCmdEndRenderPass",
+    "PreCallValidateCmdExecuteCommands",
+    "PreCallRecordCmdExecuteCommands",
+    "PostCallRecordCmdExecuteCommands",
+    "PreCallValidateBindBufferMemory2",
+    "PreCallRecordBindBufferMemory2",
+    "PostCallRecordBindBufferMemory2",
+    "PreCallValidateBindImageMemory2",
+    "PreCallRecordBindImageMemory2",
+    "PostCallRecordBindImageMemory2",
+    "PreCallValidateGetDeviceGroupPeerMemoryFeatures",
+    "PreCallRecordGetDeviceGroupPeerMemoryFeatures",
+    "PostCallRecordGetDeviceGroupPeerMemoryFeatures",
+    "PreCallValidateCmdSetDeviceMask",
+    "PreCallRecordCmdSetDeviceMask",
+    "PostCallRecordCmdSetDeviceMask",
+    "PreCallValidateCmdDispatchBase",
+    "PreCallRecordCmdDispatchBase",
+    "PostCallRecordCmdDispatchBase",
+    "PreCallValidateGetImageMemoryRequirements2",
+    "PreCallRecordGetImageMemoryRequirements2",
+    "PostCallRecordGetImageMemoryRequirements2",
+    "PreCallValidateGetBufferMemoryRequirements2",
+    "PreCallRecordGetBufferMemoryRequirements2",
+    "PostCallRecordGetBufferMemoryRequirements2",
+    "PreCallValidateGetImageSparseMemoryRequirements2",
+    "PreCallRecordGetImageSparseMemoryRequirements2",
+    "PostCallRecordGetImageSparseMemoryRequirements2",
+    "PreCallValidateTrimCommandPool",
+    "PreCallRecordTrimCommandPool",
+    "PostCallRecordTrimCommandPool",
+    "PreCallValidateGetDeviceQueue2",
+    "PreCallRecordGetDeviceQueue2",
+    "PostCallRecordGetDeviceQueue2",
+    "PreCallValidateCreateSamplerYcbcrConversion",
+    "PreCallRecordCreateSamplerYcbcrConversion",
+    "PostCallRecordCreateSamplerYcbcrConversion",
+    "PreCallValidateDestroySamplerYcbcrConversion",
+    "PreCallRecordDestroySamplerYcbcrConversion",
+    "PostCallRecordDestroySamplerYcbcrConversion",
+    "PreCallValidateCreateDescriptorUpdateTemplate",
+    "PreCallRecordCreateDescriptorUpdateTemplate",
+    "PostCallRecordCreateDescriptorUpdateTemplate",
+    "PreCallValidateDestroyDescriptorUpdateTemplate",
+    "PreCallRecordDestroyDescriptorUpdateTemplate",
+    "PostCallRecordDestroyDescriptorUpdateTemplate",
+    "PreCallValidateUpdateDescriptorSetWithTemplate",
+    "PreCallRecordUpdateDescriptorSetWithTemplate",
+    "PostCallRecordUpdateDescriptorSetWithTemplate",
+    "PreCallValidateGetDescriptorSetLayoutSupport",
+    "PreCallRecordGetDescriptorSetLayoutSupport",
+    "PostCallRecordGetDescriptorSetLayoutSupport",
+    "PreCallValidateCmdDrawIndirectCount",
+    "PreCallRecordCmdDrawIndirectCount",
+    "PostCallRecordCmdDrawIndirectCount",
+    "PreCallValidateCmdDrawIndexedIndirectCount",
+    "PreCallRecordCmdDrawIndexedIndirectCount",
+    "PostCallRecordCmdDrawIndexedIndirectCount",
+    "PreCallValidateCreateRenderPass2",
+    "PreCallRecordCreateRenderPass2",
+    "PostCallRecordCreateRenderPass2",
+    "PreCallValidateCmdBeginRenderPass2",
+    "PreCallRecordCmdBeginRenderPass2",
+    "PostCallRecordCmdBeginRenderPass2",
+    "PreCallValidateCmdNextSubpass2",
+    "PreCallRecordCmdNextSubpass2",
+    "PostCallRecordCmdNextSubpass2",
+    "PreCallValidateCmdEndRenderPass2",
+    "PreCallRecordCmdEndRenderPass2",
+    "PostCallRecordCmdEndRenderPass2",
+    "PreCallValidateResetQueryPool",
+    "PreCallRecordResetQueryPool",
+    "PostCallRecordResetQueryPool",
+    "PreCallValidateGetSemaphoreCounterValue",
+    "PreCallRecordGetSemaphoreCounterValue",
+    "PostCallRecordGetSemaphoreCounterValue",
+    "PreCallValidateWaitSemaphores",
+    "PreCallRecordWaitSemaphores",
+    "PostCallRecordWaitSemaphores",
+    "PreCallValidateSignalSemaphore",
+    "PreCallRecordSignalSemaphore",
+    "PostCallRecordSignalSemaphore",
+    "PreCallValidateGetBufferDeviceAddress",
+    "PreCallRecordGetBufferDeviceAddress",
+    "PostCallRecordGetBufferDeviceAddress",
+    "PreCallValidateGetBufferOpaqueCaptureAddress",
+    "PreCallRecordGetBufferOpaqueCaptureAddress",
+    "PostCallRecordGetBufferOpaqueCaptureAddress",
+    "PreCallValidateGetDeviceMemoryOpaqueCaptureAddress",
+    "PreCallRecordGetDeviceMemoryOpaqueCaptureAddress",
+    "PostCallRecordGetDeviceMemoryOpaqueCaptureAddress",
+    "PreCallValidateCreateSwapchainKHR",
+    "PreCallRecordCreateSwapchainKHR",
+    "PostCallRecordCreateSwapchainKHR",
+    "PreCallValidateDestroySwapchainKHR",
+    "PreCallRecordDestroySwapchainKHR",
+    "PostCallRecordDestroySwapchainKHR",
+    "PreCallValidateGetSwapchainImagesKHR",
+    "PreCallRecordGetSwapchainImagesKHR",
+    "PostCallRecordGetSwapchainImagesKHR",
+    "PreCallValidateAcquireNextImageKHR",
+    "PreCallRecordAcquireNextImageKHR",
+    "PostCallRecordAcquireNextImageKHR",
+    "PreCallValidateQueuePresentKHR",
+    "PreCallRecordQueuePresentKHR",
+    "PostCallRecordQueuePresentKHR",
+    "PreCallValidateGetDeviceGroupPresentCapabilitiesKHR",
+    "PreCallRecordGetDeviceGroupPresentCapabilitiesKHR",
+    "PostCallRecordGetDeviceGroupPresentCapabilitiesKHR",
+    "PreCallValidateGetDeviceGroupSurfacePresentModesKHR",
+    "PreCallRecordGetDeviceGroupSurfacePresentModesKHR",
+    "PostCallRecordGetDeviceGroupSurfacePresentModesKHR",
+    "PreCallValidateAcquireNextImage2KHR",
+    "PreCallRecordAcquireNextImage2KHR",
+    "PostCallRecordAcquireNextImage2KHR",
+    "PreCallValidateCreateSharedSwapchainsKHR",
+    "PreCallRecordCreateSharedSwapchainsKHR",
+    "PostCallRecordCreateSharedSwapchainsKHR",
+    "PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR",
+    "PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR",
+    "PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR",
+    "PreCallValidateCmdSetDeviceMaskKHR",
+    "PreCallRecordCmdSetDeviceMaskKHR",
+    "PostCallRecordCmdSetDeviceMaskKHR",
+    "PreCallValidateCmdDispatchBaseKHR",
+    "PreCallRecordCmdDispatchBaseKHR",
+    "PostCallRecordCmdDispatchBaseKHR",
+    "PreCallValidateTrimCommandPoolKHR",
+    "PreCallRecordTrimCommandPoolKHR",
+    "PostCallRecordTrimCommandPoolKHR",
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "PreCallValidateGetMemoryWin32HandleKHR",
+    "PreCallRecordGetMemoryWin32HandleKHR",
+    "PostCallRecordGetMemoryWin32HandleKHR",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "PreCallValidateGetMemoryWin32HandlePropertiesKHR",
+    "PreCallRecordGetMemoryWin32HandlePropertiesKHR",
+    "PostCallRecordGetMemoryWin32HandlePropertiesKHR",
+#endif
+    "PreCallValidateGetMemoryFdKHR",
+    "PreCallRecordGetMemoryFdKHR",
+    "PostCallRecordGetMemoryFdKHR",
+    "PreCallValidateGetMemoryFdPropertiesKHR",
+    "PreCallRecordGetMemoryFdPropertiesKHR",
+    "PostCallRecordGetMemoryFdPropertiesKHR",
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "PreCallValidateImportSemaphoreWin32HandleKHR",
+    "PreCallRecordImportSemaphoreWin32HandleKHR",
+    "PostCallRecordImportSemaphoreWin32HandleKHR",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "PreCallValidateGetSemaphoreWin32HandleKHR",
+    "PreCallRecordGetSemaphoreWin32HandleKHR",
+    "PostCallRecordGetSemaphoreWin32HandleKHR",
+#endif
+    "PreCallValidateImportSemaphoreFdKHR",
+    "PreCallRecordImportSemaphoreFdKHR",
+    "PostCallRecordImportSemaphoreFdKHR",
+    "PreCallValidateGetSemaphoreFdKHR",
+    "PreCallRecordGetSemaphoreFdKHR",
+    "PostCallRecordGetSemaphoreFdKHR",
+    "PreCallValidateCmdPushDescriptorSetKHR",
+    "PreCallRecordCmdPushDescriptorSetKHR",
+    "PostCallRecordCmdPushDescriptorSetKHR",
+    "PreCallValidateCmdPushDescriptorSetWithTemplateKHR",
+    "PreCallRecordCmdPushDescriptorSetWithTemplateKHR",
+    "PostCallRecordCmdPushDescriptorSetWithTemplateKHR",
+    "PreCallValidateCreateDescriptorUpdateTemplateKHR",
+    "PreCallRecordCreateDescriptorUpdateTemplateKHR",
+    "PostCallRecordCreateDescriptorUpdateTemplateKHR",
+    "PreCallValidateDestroyDescriptorUpdateTemplateKHR",
+    "PreCallRecordDestroyDescriptorUpdateTemplateKHR",
+    "PostCallRecordDestroyDescriptorUpdateTemplateKHR",
+    "PreCallValidateUpdateDescriptorSetWithTemplateKHR",
+    "PreCallRecordUpdateDescriptorSetWithTemplateKHR",
+    "PostCallRecordUpdateDescriptorSetWithTemplateKHR",
+    "PreCallValidateCreateRenderPass2KHR",
+    "PreCallRecordCreateRenderPass2KHR",
+    "PostCallRecordCreateRenderPass2KHR",
+    "PreCallValidateCmdBeginRenderPass2KHR",
+    "PreCallRecordCmdBeginRenderPass2KHR",
+    "PostCallRecordCmdBeginRenderPass2KHR",
+    "PreCallValidateCmdNextSubpass2KHR",
+    "PreCallRecordCmdNextSubpass2KHR",
+    "PostCallRecordCmdNextSubpass2KHR",
+    "PreCallValidateCmdEndRenderPass2KHR",
+    "PreCallRecordCmdEndRenderPass2KHR",
+    "PostCallRecordCmdEndRenderPass2KHR",
+    "PreCallValidateGetSwapchainStatusKHR",
+    "PreCallRecordGetSwapchainStatusKHR",
+    "PostCallRecordGetSwapchainStatusKHR",
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "PreCallValidateImportFenceWin32HandleKHR",
+    "PreCallRecordImportFenceWin32HandleKHR",
+    "PostCallRecordImportFenceWin32HandleKHR",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "PreCallValidateGetFenceWin32HandleKHR",
+    "PreCallRecordGetFenceWin32HandleKHR",
+    "PostCallRecordGetFenceWin32HandleKHR",
+#endif
+    "PreCallValidateImportFenceFdKHR",
+    "PreCallRecordImportFenceFdKHR",
+    "PostCallRecordImportFenceFdKHR",
+    "PreCallValidateGetFenceFdKHR",
+    "PreCallRecordGetFenceFdKHR",
+    "PostCallRecordGetFenceFdKHR",
+    "PreCallValidateAcquireProfilingLockKHR",
+    "PreCallRecordAcquireProfilingLockKHR",
+    "PostCallRecordAcquireProfilingLockKHR",
+    "PreCallValidateReleaseProfilingLockKHR",
+    "PreCallRecordReleaseProfilingLockKHR",
+    "PostCallRecordReleaseProfilingLockKHR",
+    "PreCallValidateGetImageMemoryRequirements2KHR",
+    "PreCallRecordGetImageMemoryRequirements2KHR",
+    "PostCallRecordGetImageMemoryRequirements2KHR",
+    "PreCallValidateGetBufferMemoryRequirements2KHR",
+    "PreCallRecordGetBufferMemoryRequirements2KHR",
+    "PostCallRecordGetBufferMemoryRequirements2KHR",
+    "PreCallValidateGetImageSparseMemoryRequirements2KHR",
+    "PreCallRecordGetImageSparseMemoryRequirements2KHR",
+    "PostCallRecordGetImageSparseMemoryRequirements2KHR",
+    "PreCallValidateCreateSamplerYcbcrConversionKHR",
+    "PreCallRecordCreateSamplerYcbcrConversionKHR",
+    "PostCallRecordCreateSamplerYcbcrConversionKHR",
+    "PreCallValidateDestroySamplerYcbcrConversionKHR",
+    "PreCallRecordDestroySamplerYcbcrConversionKHR",
+    "PostCallRecordDestroySamplerYcbcrConversionKHR",
+    "PreCallValidateBindBufferMemory2KHR",
+    "PreCallRecordBindBufferMemory2KHR",
+    "PostCallRecordBindBufferMemory2KHR",
+    "PreCallValidateBindImageMemory2KHR",
+    "PreCallRecordBindImageMemory2KHR",
+    "PostCallRecordBindImageMemory2KHR",
+    "PreCallValidateGetDescriptorSetLayoutSupportKHR",
+    "PreCallRecordGetDescriptorSetLayoutSupportKHR",
+    "PostCallRecordGetDescriptorSetLayoutSupportKHR",
+    "PreCallValidateCmdDrawIndirectCountKHR",
+    "PreCallRecordCmdDrawIndirectCountKHR",
+    "PostCallRecordCmdDrawIndirectCountKHR",
+    "PreCallValidateCmdDrawIndexedIndirectCountKHR",
+    "PreCallRecordCmdDrawIndexedIndirectCountKHR",
+    "PostCallRecordCmdDrawIndexedIndirectCountKHR",
+    "PreCallValidateGetSemaphoreCounterValueKHR",
+    "PreCallRecordGetSemaphoreCounterValueKHR",
+    "PostCallRecordGetSemaphoreCounterValueKHR",
+    "PreCallValidateWaitSemaphoresKHR",
+    "PreCallRecordWaitSemaphoresKHR",
+    "PostCallRecordWaitSemaphoresKHR",
+    "PreCallValidateSignalSemaphoreKHR",
+    "PreCallRecordSignalSemaphoreKHR",
+    "PostCallRecordSignalSemaphoreKHR",
+    "PreCallValidateGetBufferDeviceAddressKHR",
+    "PreCallRecordGetBufferDeviceAddressKHR",
+    "PostCallRecordGetBufferDeviceAddressKHR",
+    "PreCallValidateGetBufferOpaqueCaptureAddressKHR",
+    "PreCallRecordGetBufferOpaqueCaptureAddressKHR",
+    "PostCallRecordGetBufferOpaqueCaptureAddressKHR",
+    "PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR",
+    "PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR",
+    "PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR",
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCreateDeferredOperationKHR",
+    "PreCallRecordCreateDeferredOperationKHR",
+    "PostCallRecordCreateDeferredOperationKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateDestroyDeferredOperationKHR",
+    "PreCallRecordDestroyDeferredOperationKHR",
+    "PostCallRecordDestroyDeferredOperationKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateGetDeferredOperationMaxConcurrencyKHR",
+    "PreCallRecordGetDeferredOperationMaxConcurrencyKHR",
+    "PostCallRecordGetDeferredOperationMaxConcurrencyKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateGetDeferredOperationResultKHR",
+    "PreCallRecordGetDeferredOperationResultKHR",
+    "PostCallRecordGetDeferredOperationResultKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateDeferredOperationJoinKHR",
+    "PreCallRecordDeferredOperationJoinKHR",
+    "PostCallRecordDeferredOperationJoinKHR",
+#endif
+    "PreCallValidateGetPipelineExecutablePropertiesKHR",
+    "PreCallRecordGetPipelineExecutablePropertiesKHR",
+    "PostCallRecordGetPipelineExecutablePropertiesKHR",
+    "PreCallValidateGetPipelineExecutableStatisticsKHR",
+    "PreCallRecordGetPipelineExecutableStatisticsKHR",
+    "PostCallRecordGetPipelineExecutableStatisticsKHR",
+    "PreCallValidateGetPipelineExecutableInternalRepresentationsKHR",
+    "PreCallRecordGetPipelineExecutableInternalRepresentationsKHR",
+    "PostCallRecordGetPipelineExecutableInternalRepresentationsKHR",
+    "PreCallValidateDebugMarkerSetObjectTagEXT",
+    "PreCallRecordDebugMarkerSetObjectTagEXT",
+    "PostCallRecordDebugMarkerSetObjectTagEXT",
+    "PreCallValidateDebugMarkerSetObjectNameEXT",
+    "PreCallRecordDebugMarkerSetObjectNameEXT",
+    "PostCallRecordDebugMarkerSetObjectNameEXT",
+    "PreCallValidateCmdDebugMarkerBeginEXT",
+    "PreCallRecordCmdDebugMarkerBeginEXT",
+    "PostCallRecordCmdDebugMarkerBeginEXT",
+    "PreCallValidateCmdDebugMarkerEndEXT",
+    "PreCallRecordCmdDebugMarkerEndEXT",
+    "PostCallRecordCmdDebugMarkerEndEXT",
+    "PreCallValidateCmdDebugMarkerInsertEXT",
+    "PreCallRecordCmdDebugMarkerInsertEXT",
+    "PostCallRecordCmdDebugMarkerInsertEXT",
+    "PreCallValidateCmdBindTransformFeedbackBuffersEXT",
+    "PreCallRecordCmdBindTransformFeedbackBuffersEXT",
+    "PostCallRecordCmdBindTransformFeedbackBuffersEXT",
+    "PreCallValidateCmdBeginTransformFeedbackEXT",
+    "PreCallRecordCmdBeginTransformFeedbackEXT",
+    "PostCallRecordCmdBeginTransformFeedbackEXT",
+    "PreCallValidateCmdEndTransformFeedbackEXT",
+    "PreCallRecordCmdEndTransformFeedbackEXT",
+    "PostCallRecordCmdEndTransformFeedbackEXT",
+    "PreCallValidateCmdBeginQueryIndexedEXT",
+    "PreCallRecordCmdBeginQueryIndexedEXT",
+    "PostCallRecordCmdBeginQueryIndexedEXT",
+    "PreCallValidateCmdEndQueryIndexedEXT",
+    "PreCallRecordCmdEndQueryIndexedEXT",
+    "PostCallRecordCmdEndQueryIndexedEXT",
+    "PreCallValidateCmdDrawIndirectByteCountEXT",
+    "PreCallRecordCmdDrawIndirectByteCountEXT",
+    "PostCallRecordCmdDrawIndirectByteCountEXT",
+    "PreCallValidateGetImageViewHandleNVX",
+    "PreCallRecordGetImageViewHandleNVX",
+    "PostCallRecordGetImageViewHandleNVX",
+    "PreCallValidateGetImageViewAddressNVX",
+    "PreCallRecordGetImageViewAddressNVX",
+    "PostCallRecordGetImageViewAddressNVX",
+    "PreCallValidateCmdDrawIndirectCountAMD",
+    "PreCallRecordCmdDrawIndirectCountAMD",
+    "PostCallRecordCmdDrawIndirectCountAMD",
+    "PreCallValidateCmdDrawIndexedIndirectCountAMD",
+    "PreCallRecordCmdDrawIndexedIndirectCountAMD",
+    "PostCallRecordCmdDrawIndexedIndirectCountAMD",
+    "PreCallValidateGetShaderInfoAMD",
+    "PreCallRecordGetShaderInfoAMD",
+    "PostCallRecordGetShaderInfoAMD",
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "PreCallValidateGetMemoryWin32HandleNV",
+    "PreCallRecordGetMemoryWin32HandleNV",
+    "PostCallRecordGetMemoryWin32HandleNV",
+#endif
+    "PreCallValidateCmdBeginConditionalRenderingEXT",
+    "PreCallRecordCmdBeginConditionalRenderingEXT",
+    "PostCallRecordCmdBeginConditionalRenderingEXT",
+    "PreCallValidateCmdEndConditionalRenderingEXT",
+    "PreCallRecordCmdEndConditionalRenderingEXT",
+    "PostCallRecordCmdEndConditionalRenderingEXT",
+    "PreCallValidateCmdSetViewportWScalingNV",
+    "PreCallRecordCmdSetViewportWScalingNV",
+    "PostCallRecordCmdSetViewportWScalingNV",
+    "PreCallValidateDisplayPowerControlEXT",
+    "PreCallRecordDisplayPowerControlEXT",
+    "PostCallRecordDisplayPowerControlEXT",
+    "PreCallValidateRegisterDeviceEventEXT",
+    "PreCallRecordRegisterDeviceEventEXT",
+    "PostCallRecordRegisterDeviceEventEXT",
+    "PreCallValidateRegisterDisplayEventEXT",
+    "PreCallRecordRegisterDisplayEventEXT",
+    "PostCallRecordRegisterDisplayEventEXT",
+    "PreCallValidateGetSwapchainCounterEXT",
+    "PreCallRecordGetSwapchainCounterEXT",
+    "PostCallRecordGetSwapchainCounterEXT",
+    "PreCallValidateGetRefreshCycleDurationGOOGLE",
+    "PreCallRecordGetRefreshCycleDurationGOOGLE",
+    "PostCallRecordGetRefreshCycleDurationGOOGLE",
+    "PreCallValidateGetPastPresentationTimingGOOGLE",
+    "PreCallRecordGetPastPresentationTimingGOOGLE",
+    "PostCallRecordGetPastPresentationTimingGOOGLE",
+    "PreCallValidateCmdSetDiscardRectangleEXT",
+    "PreCallRecordCmdSetDiscardRectangleEXT",
+    "PostCallRecordCmdSetDiscardRectangleEXT",
+    "PreCallValidateSetHdrMetadataEXT",
+    "PreCallRecordSetHdrMetadataEXT",
+    "PostCallRecordSetHdrMetadataEXT",
+    "PreCallValidateSetDebugUtilsObjectNameEXT",
+    "PreCallRecordSetDebugUtilsObjectNameEXT",
+    "PostCallRecordSetDebugUtilsObjectNameEXT",
+    "PreCallValidateSetDebugUtilsObjectTagEXT",
+    "PreCallRecordSetDebugUtilsObjectTagEXT",
+    "PostCallRecordSetDebugUtilsObjectTagEXT",
+    "PreCallValidateQueueBeginDebugUtilsLabelEXT",
+    "PreCallRecordQueueBeginDebugUtilsLabelEXT",
+    "PostCallRecordQueueBeginDebugUtilsLabelEXT",
+    "PreCallValidateQueueEndDebugUtilsLabelEXT",
+    "PreCallRecordQueueEndDebugUtilsLabelEXT",
+    "PostCallRecordQueueEndDebugUtilsLabelEXT",
+    "PreCallValidateQueueInsertDebugUtilsLabelEXT",
+    "PreCallRecordQueueInsertDebugUtilsLabelEXT",
+    "PostCallRecordQueueInsertDebugUtilsLabelEXT",
+    "PreCallValidateCmdBeginDebugUtilsLabelEXT",
+    "PreCallRecordCmdBeginDebugUtilsLabelEXT",
+    "PostCallRecordCmdBeginDebugUtilsLabelEXT",
+    "PreCallValidateCmdEndDebugUtilsLabelEXT",
+    "PreCallRecordCmdEndDebugUtilsLabelEXT",
+    "PostCallRecordCmdEndDebugUtilsLabelEXT",
+    "PreCallValidateCmdInsertDebugUtilsLabelEXT",
+    "PreCallRecordCmdInsertDebugUtilsLabelEXT",
+    "PostCallRecordCmdInsertDebugUtilsLabelEXT",
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    "PreCallValidateGetAndroidHardwareBufferPropertiesANDROID",
+    "PreCallRecordGetAndroidHardwareBufferPropertiesANDROID",
+    "PostCallRecordGetAndroidHardwareBufferPropertiesANDROID",
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    "PreCallValidateGetMemoryAndroidHardwareBufferANDROID",
+    "PreCallRecordGetMemoryAndroidHardwareBufferANDROID",
+    "PostCallRecordGetMemoryAndroidHardwareBufferANDROID",
+#endif
+    "PreCallValidateCmdSetSampleLocationsEXT",
+    "PreCallRecordCmdSetSampleLocationsEXT",
+    "PostCallRecordCmdSetSampleLocationsEXT",
+    "PreCallValidateGetImageDrmFormatModifierPropertiesEXT",
+    "PreCallRecordGetImageDrmFormatModifierPropertiesEXT",
+    "PostCallRecordGetImageDrmFormatModifierPropertiesEXT",
+    "PreCallValidateCmdBindShadingRateImageNV",
+    "PreCallRecordCmdBindShadingRateImageNV",
+    "PostCallRecordCmdBindShadingRateImageNV",
+    "PreCallValidateCmdSetViewportShadingRatePaletteNV",
+    "PreCallRecordCmdSetViewportShadingRatePaletteNV",
+    "PostCallRecordCmdSetViewportShadingRatePaletteNV",
+    "PreCallValidateCmdSetCoarseSampleOrderNV",
+    "PreCallRecordCmdSetCoarseSampleOrderNV",
+    "PostCallRecordCmdSetCoarseSampleOrderNV",
+    "PreCallValidateCreateAccelerationStructureNV",
+    "PreCallRecordCreateAccelerationStructureNV",
+    "PostCallRecordCreateAccelerationStructureNV",
+    "PreCallValidateDestroyAccelerationStructureKHR",
+    "PreCallRecordDestroyAccelerationStructureKHR",
+    "PostCallRecordDestroyAccelerationStructureKHR",
+    "PreCallValidateDestroyAccelerationStructureNV",
+    "PreCallRecordDestroyAccelerationStructureNV",
+    "PostCallRecordDestroyAccelerationStructureNV",
+    "PreCallValidateGetAccelerationStructureMemoryRequirementsNV",
+    "PreCallRecordGetAccelerationStructureMemoryRequirementsNV",
+    "PostCallRecordGetAccelerationStructureMemoryRequirementsNV",
+    "PreCallValidateBindAccelerationStructureMemoryKHR",
+    "PreCallRecordBindAccelerationStructureMemoryKHR",
+    "PostCallRecordBindAccelerationStructureMemoryKHR",
+    "PreCallValidateBindAccelerationStructureMemoryNV",
+    "PreCallRecordBindAccelerationStructureMemoryNV",
+    "PostCallRecordBindAccelerationStructureMemoryNV",
+    "PreCallValidateCmdBuildAccelerationStructureNV",
+    "PreCallRecordCmdBuildAccelerationStructureNV",
+    "PostCallRecordCmdBuildAccelerationStructureNV",
+    "PreCallValidateCmdCopyAccelerationStructureNV",
+    "PreCallRecordCmdCopyAccelerationStructureNV",
+    "PostCallRecordCmdCopyAccelerationStructureNV",
+    "PreCallValidateCmdTraceRaysNV",
+    "PreCallRecordCmdTraceRaysNV",
+    "PostCallRecordCmdTraceRaysNV",
+    "PreCallValidateCreateRayTracingPipelinesNV",
+    "PreCallRecordCreateRayTracingPipelinesNV",
+    "PostCallRecordCreateRayTracingPipelinesNV",
+    "PreCallValidateGetRayTracingShaderGroupHandlesKHR",
+    "PreCallRecordGetRayTracingShaderGroupHandlesKHR",
+    "PostCallRecordGetRayTracingShaderGroupHandlesKHR",
+    "PreCallValidateGetRayTracingShaderGroupHandlesNV",
+    "PreCallRecordGetRayTracingShaderGroupHandlesNV",
+    "PostCallRecordGetRayTracingShaderGroupHandlesNV",
+    "PreCallValidateGetAccelerationStructureHandleNV",
+    "PreCallRecordGetAccelerationStructureHandleNV",
+    "PostCallRecordGetAccelerationStructureHandleNV",
+    "PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR",
+    "PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR",
+    "PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR",
+    "PreCallValidateCmdWriteAccelerationStructuresPropertiesNV",
+    "PreCallRecordCmdWriteAccelerationStructuresPropertiesNV",
+    "PostCallRecordCmdWriteAccelerationStructuresPropertiesNV",
+    "PreCallValidateCompileDeferredNV",
+    "PreCallRecordCompileDeferredNV",
+    "PostCallRecordCompileDeferredNV",
+    "PreCallValidateGetMemoryHostPointerPropertiesEXT",
+    "PreCallRecordGetMemoryHostPointerPropertiesEXT",
+    "PostCallRecordGetMemoryHostPointerPropertiesEXT",
+    "PreCallValidateCmdWriteBufferMarkerAMD",
+    "PreCallRecordCmdWriteBufferMarkerAMD",
+    "PostCallRecordCmdWriteBufferMarkerAMD",
+    "PreCallValidateGetCalibratedTimestampsEXT",
+    "PreCallRecordGetCalibratedTimestampsEXT",
+    "PostCallRecordGetCalibratedTimestampsEXT",
+    "PreCallValidateCmdDrawMeshTasksNV",
+    "PreCallRecordCmdDrawMeshTasksNV",
+    "PostCallRecordCmdDrawMeshTasksNV",
+    "PreCallValidateCmdDrawMeshTasksIndirectNV",
+    "PreCallRecordCmdDrawMeshTasksIndirectNV",
+    "PostCallRecordCmdDrawMeshTasksIndirectNV",
+    "PreCallValidateCmdDrawMeshTasksIndirectCountNV",
+    "PreCallRecordCmdDrawMeshTasksIndirectCountNV",
+    "PostCallRecordCmdDrawMeshTasksIndirectCountNV",
+    "PreCallValidateCmdSetExclusiveScissorNV",
+    "PreCallRecordCmdSetExclusiveScissorNV",
+    "PostCallRecordCmdSetExclusiveScissorNV",
+    "PreCallValidateCmdSetCheckpointNV",
+    "PreCallRecordCmdSetCheckpointNV",
+    "PostCallRecordCmdSetCheckpointNV",
+    "PreCallValidateGetQueueCheckpointDataNV",
+    "PreCallRecordGetQueueCheckpointDataNV",
+    "PostCallRecordGetQueueCheckpointDataNV",
+    "PreCallValidateInitializePerformanceApiINTEL",
+    "PreCallRecordInitializePerformanceApiINTEL",
+    "PostCallRecordInitializePerformanceApiINTEL",
+    "PreCallValidateUninitializePerformanceApiINTEL",
+    "PreCallRecordUninitializePerformanceApiINTEL",
+    "PostCallRecordUninitializePerformanceApiINTEL",
+    "PreCallValidateCmdSetPerformanceMarkerINTEL",
+    "PreCallRecordCmdSetPerformanceMarkerINTEL",
+    "PostCallRecordCmdSetPerformanceMarkerINTEL",
+    "PreCallValidateCmdSetPerformanceStreamMarkerINTEL",
+    "PreCallRecordCmdSetPerformanceStreamMarkerINTEL",
+    "PostCallRecordCmdSetPerformanceStreamMarkerINTEL",
+    "PreCallValidateCmdSetPerformanceOverrideINTEL",
+    "PreCallRecordCmdSetPerformanceOverrideINTEL",
+    "PostCallRecordCmdSetPerformanceOverrideINTEL",
+    "PreCallValidateAcquirePerformanceConfigurationINTEL",
+    "PreCallRecordAcquirePerformanceConfigurationINTEL",
+    "PostCallRecordAcquirePerformanceConfigurationINTEL",
+    "PreCallValidateReleasePerformanceConfigurationINTEL",
+    "PreCallRecordReleasePerformanceConfigurationINTEL",
+    "PostCallRecordReleasePerformanceConfigurationINTEL",
+    "PreCallValidateQueueSetPerformanceConfigurationINTEL",
+    "PreCallRecordQueueSetPerformanceConfigurationINTEL",
+    "PostCallRecordQueueSetPerformanceConfigurationINTEL",
+    "PreCallValidateGetPerformanceParameterINTEL",
+    "PreCallRecordGetPerformanceParameterINTEL",
+    "PostCallRecordGetPerformanceParameterINTEL",
+    "PreCallValidateSetLocalDimmingAMD",
+    "PreCallRecordSetLocalDimmingAMD",
+    "PostCallRecordSetLocalDimmingAMD",
+    "PreCallValidateGetBufferDeviceAddressEXT",
+    "PreCallRecordGetBufferDeviceAddressEXT",
+    "PostCallRecordGetBufferDeviceAddressEXT",
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "PreCallValidateAcquireFullScreenExclusiveModeEXT",
+    "PreCallRecordAcquireFullScreenExclusiveModeEXT",
+    "PostCallRecordAcquireFullScreenExclusiveModeEXT",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "PreCallValidateReleaseFullScreenExclusiveModeEXT",
+    "PreCallRecordReleaseFullScreenExclusiveModeEXT",
+    "PostCallRecordReleaseFullScreenExclusiveModeEXT",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "PreCallValidateGetDeviceGroupSurfacePresentModes2EXT",
+    "PreCallRecordGetDeviceGroupSurfacePresentModes2EXT",
+    "PostCallRecordGetDeviceGroupSurfacePresentModes2EXT",
+#endif
+    "PreCallValidateCmdSetLineStippleEXT",
+    "PreCallRecordCmdSetLineStippleEXT",
+    "PostCallRecordCmdSetLineStippleEXT",
+    "PreCallValidateResetQueryPoolEXT",
+    "PreCallRecordResetQueryPoolEXT",
+    "PostCallRecordResetQueryPoolEXT",
+    "PreCallValidateCmdSetCullModeEXT",
+    "PreCallRecordCmdSetCullModeEXT",
+    "PostCallRecordCmdSetCullModeEXT",
+    "PreCallValidateCmdSetFrontFaceEXT",
+    "PreCallRecordCmdSetFrontFaceEXT",
+    "PostCallRecordCmdSetFrontFaceEXT",
+    "PreCallValidateCmdSetPrimitiveTopologyEXT",
+    "PreCallRecordCmdSetPrimitiveTopologyEXT",
+    "PostCallRecordCmdSetPrimitiveTopologyEXT",
+    "PreCallValidateCmdSetViewportWithCountEXT",
+    "PreCallRecordCmdSetViewportWithCountEXT",
+    "PostCallRecordCmdSetViewportWithCountEXT",
+    "PreCallValidateCmdSetScissorWithCountEXT",
+    "PreCallRecordCmdSetScissorWithCountEXT",
+    "PostCallRecordCmdSetScissorWithCountEXT",
+    "PreCallValidateCmdBindVertexBuffers2EXT",
+    "PreCallRecordCmdBindVertexBuffers2EXT",
+    "PostCallRecordCmdBindVertexBuffers2EXT",
+    "PreCallValidateCmdSetDepthTestEnableEXT",
+    "PreCallRecordCmdSetDepthTestEnableEXT",
+    "PostCallRecordCmdSetDepthTestEnableEXT",
+    "PreCallValidateCmdSetDepthWriteEnableEXT",
+    "PreCallRecordCmdSetDepthWriteEnableEXT",
+    "PostCallRecordCmdSetDepthWriteEnableEXT",
+    "PreCallValidateCmdSetDepthCompareOpEXT",
+    "PreCallRecordCmdSetDepthCompareOpEXT",
+    "PostCallRecordCmdSetDepthCompareOpEXT",
+    "PreCallValidateCmdSetDepthBoundsTestEnableEXT",
+    "PreCallRecordCmdSetDepthBoundsTestEnableEXT",
+    "PostCallRecordCmdSetDepthBoundsTestEnableEXT",
+    "PreCallValidateCmdSetStencilTestEnableEXT",
+    "PreCallRecordCmdSetStencilTestEnableEXT",
+    "PostCallRecordCmdSetStencilTestEnableEXT",
+    "PreCallValidateCmdSetStencilOpEXT",
+    "PreCallRecordCmdSetStencilOpEXT",
+    "PostCallRecordCmdSetStencilOpEXT",
+    "PreCallValidateGetGeneratedCommandsMemoryRequirementsNV",
+    "PreCallRecordGetGeneratedCommandsMemoryRequirementsNV",
+    "PostCallRecordGetGeneratedCommandsMemoryRequirementsNV",
+    "PreCallValidateCmdPreprocessGeneratedCommandsNV",
+    "PreCallRecordCmdPreprocessGeneratedCommandsNV",
+    "PostCallRecordCmdPreprocessGeneratedCommandsNV",
+    "PreCallValidateCmdExecuteGeneratedCommandsNV",
+    "PreCallRecordCmdExecuteGeneratedCommandsNV",
+    "PostCallRecordCmdExecuteGeneratedCommandsNV",
+    "PreCallValidateCmdBindPipelineShaderGroupNV",
+    "PreCallRecordCmdBindPipelineShaderGroupNV",
+    "PostCallRecordCmdBindPipelineShaderGroupNV",
+    "PreCallValidateCreateIndirectCommandsLayoutNV",
+    "PreCallRecordCreateIndirectCommandsLayoutNV",
+    "PostCallRecordCreateIndirectCommandsLayoutNV",
+    "PreCallValidateDestroyIndirectCommandsLayoutNV",
+    "PreCallRecordDestroyIndirectCommandsLayoutNV",
+    "PostCallRecordDestroyIndirectCommandsLayoutNV",
+    "PreCallValidateCreatePrivateDataSlotEXT",
+    "PreCallRecordCreatePrivateDataSlotEXT",
+    "PostCallRecordCreatePrivateDataSlotEXT",
+    "PreCallValidateDestroyPrivateDataSlotEXT",
+    "PreCallRecordDestroyPrivateDataSlotEXT",
+    "PostCallRecordDestroyPrivateDataSlotEXT",
+    "PreCallValidateSetPrivateDataEXT",
+    "PreCallRecordSetPrivateDataEXT",
+    "PostCallRecordSetPrivateDataEXT",
+    "PreCallValidateGetPrivateDataEXT",
+    "PreCallRecordGetPrivateDataEXT",
+    "PostCallRecordGetPrivateDataEXT",
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCreateAccelerationStructureKHR",
+    "PreCallRecordCreateAccelerationStructureKHR",
+    "PostCallRecordCreateAccelerationStructureKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateGetAccelerationStructureMemoryRequirementsKHR",
+    "PreCallRecordGetAccelerationStructureMemoryRequirementsKHR",
+    "PostCallRecordGetAccelerationStructureMemoryRequirementsKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCmdBuildAccelerationStructureKHR",
+    "PreCallRecordCmdBuildAccelerationStructureKHR",
+    "PostCallRecordCmdBuildAccelerationStructureKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCmdBuildAccelerationStructureIndirectKHR",
+    "PreCallRecordCmdBuildAccelerationStructureIndirectKHR",
+    "PostCallRecordCmdBuildAccelerationStructureIndirectKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateBuildAccelerationStructureKHR",
+    "PreCallRecordBuildAccelerationStructureKHR",
+    "PostCallRecordBuildAccelerationStructureKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCopyAccelerationStructureKHR",
+    "PreCallRecordCopyAccelerationStructureKHR",
+    "PostCallRecordCopyAccelerationStructureKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCopyAccelerationStructureToMemoryKHR",
+    "PreCallRecordCopyAccelerationStructureToMemoryKHR",
+    "PostCallRecordCopyAccelerationStructureToMemoryKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCopyMemoryToAccelerationStructureKHR",
+    "PreCallRecordCopyMemoryToAccelerationStructureKHR",
+    "PostCallRecordCopyMemoryToAccelerationStructureKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateWriteAccelerationStructuresPropertiesKHR",
+    "PreCallRecordWriteAccelerationStructuresPropertiesKHR",
+    "PostCallRecordWriteAccelerationStructuresPropertiesKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCmdCopyAccelerationStructureKHR",
+    "PreCallRecordCmdCopyAccelerationStructureKHR",
+    "PostCallRecordCmdCopyAccelerationStructureKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCmdCopyAccelerationStructureToMemoryKHR",
+    "PreCallRecordCmdCopyAccelerationStructureToMemoryKHR",
+    "PostCallRecordCmdCopyAccelerationStructureToMemoryKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCmdCopyMemoryToAccelerationStructureKHR",
+    "PreCallRecordCmdCopyMemoryToAccelerationStructureKHR",
+    "PostCallRecordCmdCopyMemoryToAccelerationStructureKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCmdTraceRaysKHR",
+    "PreCallRecordCmdTraceRaysKHR",
+    "PostCallRecordCmdTraceRaysKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCreateRayTracingPipelinesKHR",
+    "PreCallRecordCreateRayTracingPipelinesKHR",
+    "PostCallRecordCreateRayTracingPipelinesKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateGetAccelerationStructureDeviceAddressKHR",
+    "PreCallRecordGetAccelerationStructureDeviceAddressKHR",
+    "PostCallRecordGetAccelerationStructureDeviceAddressKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+    "PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+    "PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateCmdTraceRaysIndirectKHR",
+    "PreCallRecordCmdTraceRaysIndirectKHR",
+    "PostCallRecordCmdTraceRaysIndirectKHR",
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    "PreCallValidateGetDeviceAccelerationStructureCompatibilityKHR",
+    "PreCallRecordGetDeviceAccelerationStructureCompatibilityKHR",
+    "PostCallRecordGetDeviceAccelerationStructureCompatibilityKHR",
+#endif
+};
+
+static_assert(sizeof(intercept_id_names) / sizeof(intercept_id_names[0]) == InterceptIdCount,
+              "intercept_id_names needs one entry per InterceptId");
+
+static const char *LayerObjectTypeName(LayerObjectTypeId object_type) {
+    switch (object_type) {
+        case LayerObjectTypeThreading:
+            return "Threading";
+        case LayerObjectTypeParameterValidation:
+            return "ParameterValidation";
+        case LayerObjectTypeObjectTracker:
+            return "ObjectTracker";
+        case LayerObjectTypeCoreValidation:
+            return "CoreValidation";
+        case LayerObjectTypeBestPractices:
+            return "BestPractices";
+        case LayerObjectTypeGpuAssisted:
+            return "GpuAssisted";
+        case LayerObjectTypeDebugPrintf:
+            return "DebugPrintf";
+        case LayerObjectTypeCommandCounter:
+            return "CommandCounter";
+        case LayerObjectTypeSyncValidation:
+            return "SyncValidation";
+        default:
+            return "Chassis";
+    }
+}
+
+HookProfile::Counters::Counters() : calls(0), total_ns(0) {
+    for (auto &bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+}
+
+HookProfile::HookProfile(const std::string &report_path, uint32_t present_interval)
+    : report_path(report_path), present_interval(present_interval), rows(new std::atomic<Counters *>[InterceptIdCount]) {
+    for (uint32_t id = 0; id < InterceptIdCount; ++id) rows[id].store(nullptr, std::memory_order_relaxed);
+}
+
+HookProfile::~HookProfile() {
+    for (uint32_t id = 0; id < InterceptIdCount; ++id) delete[] rows[id].load();
+}
+
+HookProfile *HookProfile::Create() {
+    const char *enable = getLayerOption("khronos_validation.chassis_profile");
+    if (!*enable || strcmp(enable, "true")) return nullptr;
+    std::string report_path = getLayerOption("khronos_validation.chassis_profile_path");
+    if (report_path.empty()) report_path = "stdout";
+    const char *interval = getLayerOption("khronos_validation.chassis_profile_present_interval");
+    uint32_t present_interval = *interval ? static_cast<uint32_t>(strtoul(interval, nullptr, 10)) : 0;
+    return new HookProfile(report_path, present_interval);
+}
+
+void HookProfile::Record(InterceptId id, LayerObjectTypeId object_type, uint64_t ns) {
+    Counters *row = rows[id].load(std::memory_order_acquire);
+    if (!row) {
+        Counters *new_row = new Counters[LayerObjectTypeMaxEnum];
+        if (rows[id].compare_exchange_strong(row, new_row, std::memory_order_acq_rel)) {
+            row = new_row;
+        } else {
+            // Another thread installed the row first and row now points to it
+            delete[] new_row;
+        }
+    }
+    Counters &counters = row[object_type];
+    counters.calls.fetch_add(1, std::memory_order_relaxed);
+    counters.total_ns.fetch_add(ns, std::memory_order_relaxed);
+    uint32_t bucket = 0;
+    while (bucket + 1 < kBucketCount && (ns >> (bucket + 1))) ++bucket;
+    counters.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void HookProfile::Report(const char *when) const {
+    struct Entry {
+        LayerObjectTypeId object_type;
+        uint32_t id;
+        uint64_t calls;
+        uint64_t total_ns;
+        uint64_t p50_ns;
+        uint64_t p99_ns;
+    };
+    // Percentiles are reported as the upper bound of the bucket holding the call at that rank
+    auto percentile = [](const Counters &counters, uint64_t calls, uint64_t permille) {
+        const uint64_t rank = (calls * permille + 999) / 1000;
+        uint64_t seen = 0;
+        for (uint32_t bucket = 0; bucket < kBucketCount; ++bucket) {
+            seen += counters.buckets[bucket].load(std::memory_order_relaxed);
+            if (seen >= rank) return uint64_t(2) << bucket;
+        }
+        return uint64_t(2) << (kBucketCount - 1);
+    };
+
+    std::vector<Entry> entries;
+    uint64_t total_calls = 0;
+    uint64_t total_ns = 0;
+    for (uint32_t id = 0; id < InterceptIdCount; ++id) {
+        const Counters *row = rows[id].load(std::memory_order_acquire);
+        if (!row) continue;
+        for (uint32_t object_type = 0; object_type < LayerObjectTypeMaxEnum; ++object_type) {
+            const Counters &counters = row[object_type];
+            const uint64_t calls = counters.calls.load(std::memory_order_relaxed);
+            if (!calls) continue;
+            const uint64_t ns = counters.total_ns.load(std::memory_order_relaxed);
+            entries.push_back({static_cast<LayerObjectTypeId>(object_type), id, calls, ns, percentile(counters, calls, 500),
+                               percentile(counters, calls, 990)});
+            total_calls += calls;
+            total_ns += ns;
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.total_ns > b.total_ns; });
+
+    FILE *out = stdout;
+    if (report_path != "stdout") {
+        out = fopen(report_path.c_str(), "a");
+        if (!out) return;
+    }
+    fprintf(out, "Validation layer hook profile at %s: %" PRIu64 " hook calls, %.3f ms\n", when, total_calls, total_ns / 1e6);
+    fprintf(out, "%-20s %-64s %12s %12s %10s %10s %10s\n", "object", "hook", "calls", "total ms", "mean us", "p50 us",
+            "p99 us");
+    for (const auto &entry : entries) {
+        fprintf(out, "%-20s %-64s %12" PRIu64 " %12.3f %10.3f %10.3f %10.3f\n", LayerObjectTypeName(entry.object_type),
+                intercept_id_names[entry.id], entry.calls, entry.total_ns / 1e6, entry.total_ns / 1e3 / entry.calls,
+                entry.p50_ns / 1e3, entry.p99_ns / 1e3);
+    }
+    if (out == stdout) {
+        fflush(out);
+    } else {
+        fclose(out);
+    }
+}
+
+void HookProfile::CountPresent() {
+    if (!present_interval) return;
+    const uint32_t count = present_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (count % present_interval == 0) {
+        std::string when = "vkQueuePresentKHR #" + std::to_string(count);
+        Report(when.c_str());
+    }
+}
+
+
 // loader-layer interface v0, just wrappers since there is only a layer
 
 VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char *pLayerName, uint32_t *pCount,
@@ -25,6 +25,7 @@
 
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <cinttypes>
 #include <stdio.h>
@@ -55,20 +56,7 @@
 
 extern std::atomic<uint64_t> global_unique_id;
 
-// To avoid re-hashing unique ids on each use, we precompute the hash and store the
-// hash's LSBs in the high 24 bits.
-struct HashedUint64 {
-    static const int HASHED_UINT64_SHIFT = 40;
-    size_t operator()(const uint64_t &t) const { return t >> HASHED_UINT64_SHIFT; }
-
-    static uint64_t hash(uint64_t id) {
-        uint64_t h = (uint64_t)std::hash<uint64_t>()(id);
-        id |= h << HASHED_UINT64_SHIFT;
-        return id;
-    }
-};
-
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern vl_concurrent_handle_table unique_id_mapping;
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -2763,6 +2751,1079 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceAccelerationStructureCompatibilityKHR(
 #endif // VK_ENABLE_BETA_EXTENSIONS
 
 
+// Identifies a device-level hook, see ValidationObject::intercept_vectors
+enum InterceptId {
+    InterceptIdPreCallValidateGetDeviceQueue,
+    InterceptIdPreCallRecordGetDeviceQueue,
+    InterceptIdPostCallRecordGetDeviceQueue,
+    InterceptIdPreCallValidateQueueSubmit,
+    InterceptIdPreCallRecordQueueSubmit,
+    InterceptIdPostCallRecordQueueSubmit,
+    InterceptIdPreCallValidateQueueWaitIdle,
+    InterceptIdPreCallRecordQueueWaitIdle,
+    InterceptIdPostCallRecordQueueWaitIdle,
+    InterceptIdPreCallValidateDeviceWaitIdle,
+    InterceptIdPreCallRecordDeviceWaitIdle,
+    InterceptIdPostCallRecordDeviceWaitIdle,
+    InterceptIdPreCallValidateAllocateMemory,
+    InterceptIdPreCallRecordAllocateMemory,
+    InterceptIdPostCallRecordAllocateMemory,
+    InterceptIdPreCallValidateFreeMemory,
+    InterceptIdPreCallRecordFreeMemory,
+    InterceptIdPostCallRecordFreeMemory,
+    InterceptIdPreCallValidateMapMemory,
+    InterceptIdPreCallRecordMapMemory,
+    InterceptIdPostCallRecordMapMemory,
+    InterceptIdPreCallValidateUnmapMemory,
+    InterceptIdPreCallRecordUnmapMemory,
+    InterceptIdPostCallRecordUnmapMemory,
+    InterceptIdPreCallValidateFlushMappedMemoryRanges,
+    InterceptIdPreCallRecordFlushMappedMemoryRanges,
+    InterceptIdPostCallRecordFlushMappedMemoryRanges,
+    InterceptIdPreCallValidateInvalidateMappedMemoryRanges,
+    InterceptIdPreCallRecordInvalidateMappedMemoryRanges,
+    InterceptIdPostCallRecordInvalidateMappedMemoryRanges,
+    InterceptIdPreCallValidateGetDeviceMemoryCommitment,
+    InterceptIdPreCallRecordGetDeviceMemoryCommitment,
+    InterceptIdPostCallRecordGetDeviceMemoryCommitment,
+    InterceptIdPreCallValidateBindBufferMemory,
+    InterceptIdPreCallRecordBindBufferMemory,
+    InterceptIdPostCallRecordBindBufferMemory,
+    InterceptIdPreCallValidateBindImageMemory,
+    InterceptIdPreCallRecordBindImageMemory,
+    InterceptIdPostCallRecordBindImageMemory,
+    InterceptIdPreCallValidateGetBufferMemoryRequirements,
+    InterceptIdPreCallRecordGetBufferMemoryRequirements,
+    InterceptIdPostCallRecordGetBufferMemoryRequirements,
+    InterceptIdPreCallValidateGetImageMemoryRequirements,
+    InterceptIdPreCallRecordGetImageMemoryRequirements,
+    InterceptIdPostCallRecordGetImageMemoryRequirements,
+    InterceptIdPreCallValidateGetImageSparseMemoryRequirements,
+    InterceptIdPreCallRecordGetImageSparseMemoryRequirements,
+    InterceptIdPostCallRecordGetImageSparseMemoryRequirements,
+    InterceptIdPreCallValidateQueueBindSparse,
+    InterceptIdPreCallRecordQueueBindSparse,
+    InterceptIdPostCallRecordQueueBindSparse,
+    InterceptIdPreCallValidateCreateFence,
+    InterceptIdPreCallRecordCreateFence,
+    InterceptIdPostCallRecordCreateFence,
+    InterceptIdPreCallValidateDestroyFence,
+    InterceptIdPreCallRecordDestroyFence,
+    InterceptIdPostCallRecordDestroyFence,
+    InterceptIdPreCallValidateResetFences,
+    InterceptIdPreCallRecordResetFences,
+    InterceptIdPostCallRecordResetFences,
+    InterceptIdPreCallValidateGetFenceStatus,
+    InterceptIdPreCallRecordGetFenceStatus,
+    InterceptIdPostCallRecordGetFenceStatus,
+    InterceptIdPreCallValidateWaitForFences,
+    InterceptIdPreCallRecordWaitForFences,
+    InterceptIdPostCallRecordWaitForFences,
+    InterceptIdPreCallValidateCreateSemaphore,
+    InterceptIdPreCallRecordCreateSemaphore,
+    InterceptIdPostCallRecordCreateSemaphore,
+    InterceptIdPreCallValidateDestroySemaphore,
+    InterceptIdPreCallRecordDestroySemaphore,
+    InterceptIdPostCallRecordDestroySemaphore,
+    InterceptIdPreCallValidateCreateEvent,
+    InterceptIdPreCallRecordCreateEvent,
+    InterceptIdPostCallRecordCreateEvent,
+    InterceptIdPreCallValidateDestroyEvent,
+    InterceptIdPreCallRecordDestroyEvent,
+    InterceptIdPostCallRecordDestroyEvent,
+    InterceptIdPreCallValidateGetEventStatus,
+    InterceptIdPreCallRecordGetEventStatus,
+    InterceptIdPostCallRecordGetEventStatus,
+    InterceptIdPreCallValidateSetEvent,
+    InterceptIdPreCallRecordSetEvent,
+    InterceptIdPostCallRecordSetEvent,
+    InterceptIdPreCallValidateResetEvent,
+    InterceptIdPreCallRecordResetEvent,
+    InterceptIdPostCallRecordResetEvent,
+    InterceptIdPreCallValidateCreateQueryPool,
+    InterceptIdPreCallRecordCreateQueryPool,
+    InterceptIdPostCallRecordCreateQueryPool,
+    InterceptIdPreCallValidateDestroyQueryPool,
+    InterceptIdPreCallRecordDestroyQueryPool,
+    InterceptIdPostCallRecordDestroyQueryPool,
+    InterceptIdPreCallValidateGetQueryPoolResults,
+    InterceptIdPreCallRecordGetQueryPoolResults,
+    InterceptIdPostCallRecordGetQueryPoolResults,
+    InterceptIdPreCallValidateCreateBuffer,
+    InterceptIdPreCallRecordCreateBuffer,
+    InterceptIdPostCallRecordCreateBuffer,
+    InterceptIdPreCallValidateDestroyBuffer,
+    InterceptIdPreCallRecordDestroyBuffer,
+    InterceptIdPostCallRecordDestroyBuffer,
+    InterceptIdPreCallValidateCreateBufferView,
+    InterceptIdPreCallRecordCreateBufferView,
+    InterceptIdPostCallRecordCreateBufferView,
+    InterceptIdPreCallValidateDestroyBufferView,
+    InterceptIdPreCallRecordDestroyBufferView,
+    InterceptIdPostCallRecordDestroyBufferView,
+    InterceptIdPreCallValidateCreateImage,
+    InterceptIdPreCallRecordCreateImage,
+    InterceptIdPostCallRecordCreateImage,
+    InterceptIdPreCallValidateDestroyImage,
+    InterceptIdPreCallRecordDestroyImage,
+    InterceptIdPostCallRecordDestroyImage,
+    InterceptIdPreCallValidateGetImageSubresourceLayout,
+    InterceptIdPreCallRecordGetImageSubresourceLayout,
+    InterceptIdPostCallRecordGetImageSubresourceLayout,
+    InterceptIdPreCallValidateCreateImageView,
+    InterceptIdPreCallRecordCreateImageView,
+    InterceptIdPostCallRecordCreateImageView,
+    InterceptIdPreCallValidateDestroyImageView,
+    InterceptIdPreCallRecordDestroyImageView,
+    InterceptIdPostCallRecordDestroyImageView,
+    InterceptIdPreCallValidateCreateShaderModule,
+    InterceptIdPreCallRecordCreateShaderModule,
+    InterceptIdPostCallRecordCreateShaderModule,
+    InterceptIdPreCallValidateDestroyShaderModule,
+    InterceptIdPreCallRecordDestroyShaderModule,
+    InterceptIdPostCallRecordDestroyShaderModule,
+    InterceptIdPreCallValidateCreatePipelineCache,
+    InterceptIdPreCallRecordCreatePipelineCache,
+    InterceptIdPostCallRecordCreatePipelineCache,
+    InterceptIdPreCallValidateDestroyPipelineCache,
+    InterceptIdPreCallRecordDestroyPipelineCache,
+    InterceptIdPostCallRecordDestroyPipelineCache,
+    InterceptIdPreCallValidateGetPipelineCacheData,
+    InterceptIdPreCallRecordGetPipelineCacheData,
+    InterceptIdPostCallRecordGetPipelineCacheData,
+    InterceptIdPreCallValidateMergePipelineCaches,
+    InterceptIdPreCallRecordMergePipelineCaches,
+    InterceptIdPostCallRecordMergePipelineCaches,
+    InterceptIdPreCallValidateCreateGraphicsPipelines,
+    InterceptIdPreCallRecordCreateGraphicsPipelines,
+    InterceptIdPostCallRecordCreateGraphicsPipelines,
+    InterceptIdPreCallValidateCreateComputePipelines,
+    InterceptIdPreCallRecordCreateComputePipelines,
+    InterceptIdPostCallRecordCreateComputePipelines,
+    InterceptIdPreCallValidateDestroyPipeline,
+    InterceptIdPreCallRecordDestroyPipeline,
+    InterceptIdPostCallRecordDestroyPipeline,
+    InterceptIdPreCallValidateCreatePipelineLayout,
+    InterceptIdPreCallRecordCreatePipelineLayout,
+    InterceptIdPostCallRecordCreatePipelineLayout,
+    InterceptIdPreCallValidateDestroyPipelineLayout,
+    InterceptIdPreCallRecordDestroyPipelineLayout,
+    InterceptIdPostCallRecordDestroyPipelineLayout,
+    InterceptIdPreCallValidateCreateSampler,
+    InterceptIdPreCallRecordCreateSampler,
+    InterceptIdPostCallRecordCreateSampler,
+    InterceptIdPreCallValidateDestroySampler,
+    InterceptIdPreCallRecordDestroySampler,
+    InterceptIdPostCallRecordDestroySampler,
+    InterceptIdPreCallValidateCreateDescriptorSetLayout,
+    InterceptIdPreCallRecordCreateDescriptorSetLayout,
+    InterceptIdPostCallRecordCreateDescriptorSetLayout,
+    InterceptIdPreCallValidateDestroyDescriptorSetLayout,
+    InterceptIdPreCallRecordDestroyDescriptorSetLayout,
+    InterceptIdPostCallRecordDestroyDescriptorSetLayout,
+    InterceptIdPreCallValidateCreateDescriptorPool,
+    InterceptIdPreCallRecordCreateDescriptorPool,
+    InterceptIdPostCallRecordCreateDescriptorPool,
+    InterceptIdPreCallValidateDestroyDescriptorPool,
+    InterceptIdPreCallRecordDestroyDescriptorPool,
+    InterceptIdPostCallRecordDestroyDescriptorPool,
+    InterceptIdPreCallValidateResetDescriptorPool,
+    InterceptIdPreCallRecordResetDescriptorPool,
+    InterceptIdPostCallRecordResetDescriptorPool,
+    InterceptIdPreCallValidateAllocateDescriptorSets,
+    InterceptIdPreCallRecordAllocateDescriptorSets,
+    InterceptIdPostCallRecordAllocateDescriptorSets,
+    InterceptIdPreCallValidateFreeDescriptorSets,
+    InterceptIdPreCallRecordFreeDescriptorSets,
+    InterceptIdPostCallRecordFreeDescriptorSets,
+    InterceptIdPreCallValidateUpdateDescriptorSets,
+    InterceptIdPreCallRecordUpdateDescriptorSets,
+    InterceptIdPostCallRecordUpdateDescriptorSets,
+    InterceptIdPreCallValidateCreateFramebuffer,
+    InterceptIdPreCallRecordCreateFramebuffer,
+    InterceptIdPostCallRecordCreateFramebuffer,
+    InterceptIdPreCallValidateDestroyFramebuffer,
+    InterceptIdPreCallRecordDestroyFramebuffer,
+    InterceptIdPostCallRecordDestroyFramebuffer,
+    InterceptIdPreCallValidateCreateRenderPass,
+    InterceptIdPreCallRecordCreateRenderPass,
+    InterceptIdPostCallRecordCreateRenderPass,
+    InterceptIdPreCallValidateDestroyRenderPass,
+    InterceptIdPreCallRecordDestroyRenderPass,
+    InterceptIdPostCallRecordDestroyRenderPass,
+    InterceptIdPreCallValidateGetRenderAreaGranularity,
+    InterceptIdPreCallRecordGetRenderAreaGranularity,
+    InterceptIdPostCallRecordGetRenderAreaGranularity,
+    InterceptIdPreCallValidateCreateCommandPool,
+    InterceptIdPreCallRecordCreateCommandPool,
+    InterceptIdPostCallRecordCreateCommandPool,
+    InterceptIdPreCallValidateDestroyCommandPool,
+    InterceptIdPreCallRecordDestroyCommandPool,
+    InterceptIdPostCallRecordDestroyCommandPool,
+    InterceptIdPreCallValidateResetCommandPool,
+    InterceptIdPreCallRecordResetCommandPool,
+    InterceptIdPostCallRecordResetCommandPool,
+    InterceptIdPreCallValidateAllocateCommandBuffers,
+    InterceptIdPreCallRecordAllocateCommandBuffers,
+    InterceptIdPostCallRecordAllocateCommandBuffers,
+    InterceptIdPreCallValidateFreeCommandBuffers,
+    InterceptIdPreCallRecordFreeCommandBuffers,
+    InterceptIdPostCallRecordFreeCommandBuffers,
+    InterceptIdPreCallValidateBeginCommandBuffer,
+    InterceptIdPreCallRecordBeginCommandBuffer,
+    InterceptIdPostCallRecordBeginCommandBuffer,
+    InterceptIdPreCallValidateEndCommandBuffer,
+    InterceptIdPreCallRecordEndCommandBuffer,
+    InterceptIdPostCallRecordEndCommandBuffer,
+    InterceptIdPreCallValidateResetCommandBuffer,
+    InterceptIdPreCallRecordResetCommandBuffer,
+    InterceptIdPostCallRecordResetCommandBuffer,
+    InterceptIdPreCallValidateCmdBindPipeline,
+    InterceptIdPreCallRecordCmdBindPipeline,
+    InterceptIdPostCallRecordCmdBindPipeline,
+    InterceptIdPreCallValidateCmdSetViewport,
+    InterceptIdPreCallRecordCmdSetViewport,
+    InterceptIdPostCallRecordCmdSetViewport,
+    InterceptIdPreCallValidateCmdSetScissor,
+    InterceptIdPreCallRecordCmdSetScissor,
+    InterceptIdPostCallRecordCmdSetScissor,
+    InterceptIdPreCallValidateCmdSetLineWidth,
+    InterceptIdPreCallRecordCmdSetLineWidth,
+    InterceptIdPostCallRecordCmdSetLineWidth,
+    InterceptIdPreCallValidateCmdSetDepthBias,
+    InterceptIdPreCallRecordCmdSetDepthBias,
+    InterceptIdPostCallRecordCmdSetDepthBias,
+    InterceptIdPreCallValidateCmdSetBlendConstants,
+    InterceptIdPreCallRecordCmdSetBlendConstants,
+    InterceptIdPostCallRecordCmdSetBlendConstants,
+    InterceptIdPreCallValidateCmdSetDepthBounds,
+    InterceptIdPreCallRecordCmdSetDepthBounds,
+    InterceptIdPostCallRecordCmdSetDepthBounds,
+    InterceptIdPreCallValidateCmdSetStencilCompareMask,
+    InterceptIdPreCallRecordCmdSetStencilCompareMask,
+    InterceptIdPostCallRecordCmdSetStencilCompareMask,
+    InterceptIdPreCallValidateCmdSetStencilWriteMask,
+    InterceptIdPreCallRecordCmdSetStencilWriteMask,
+    InterceptIdPostCallRecordCmdSetStencilWriteMask,
+    InterceptIdPreCallValidateCmdSetStencilReference,
+    InterceptIdPreCallRecordCmdSetStencilReference,
+    InterceptIdPostCallRecordCmdSetStencilReference,
+    InterceptIdPreCallValidateCmdBindDescriptorSets,
+    InterceptIdPreCallRecordCmdBindDescriptorSets,
+    InterceptIdPostCallRecordCmdBindDescriptorSets,
+    InterceptIdPreCallValidateCmdBindIndexBuffer,
+    InterceptIdPreCallRecordCmdBindIndexBuffer,
+    InterceptIdPostCallRecordCmdBindIndexBuffer,
+    InterceptIdPreCallValidateCmdBindVertexBuffers,
+    InterceptIdPreCallRecordCmdBindVertexBuffers,
+    InterceptIdPostCallRecordCmdBindVertexBuffers,
+    InterceptIdPreCallValidateCmdDraw,
+    InterceptIdPreCallRecordCmdDraw,
+    InterceptIdPostCallRecordCmdDraw,
+    InterceptIdPreCallValidateCmdDrawIndexed,
+    InterceptIdPreCallRecordCmdDrawIndexed,
+    InterceptIdPostCallRecordCmdDrawIndexed,
+    InterceptIdPreCallValidateCmdDrawIndirect,
+    InterceptIdPreCallRecordCmdDrawIndirect,
+    InterceptIdPostCallRecordCmdDrawIndirect,
+    InterceptIdPreCallValidateCmdDrawIndexedIndirect,
+    InterceptIdPreCallRecordCmdDrawIndexedIndirect,
+    InterceptIdPostCallRecordCmdDrawIndexedIndirect,
+    InterceptIdPreCallValidateCmdDispatch,
+    InterceptIdPreCallRecordCmdDispatch,
+    InterceptIdPostCallRecordCmdDispatch,
+    InterceptIdPreCallValidateCmdDispatchIndirect,
+    InterceptIdPreCallRecordCmdDispatchIndirect,
+    InterceptIdPostCallRecordCmdDispatchIndirect,
+    InterceptIdPreCallValidateCmdCopyBuffer,
+    InterceptIdPreCallRecordCmdCopyBuffer,
+    InterceptIdPostCallRecordCmdCopyBuffer,
+    InterceptIdPreCallValidateCmdCopyImage,
+    InterceptIdPreCallRecordCmdCopyImage,
+    InterceptIdPostCallRecordCmdCopyImage,
+    InterceptIdPreCallValidateCmdBlitImage,
+    InterceptIdPreCallRecordCmdBlitImage,
+    InterceptIdPostCallRecordCmdBlitImage,
+    InterceptIdPreCallValidateCmdCopyBufferToImage,
+    InterceptIdPreCallRecordCmdCopyBufferToImage,
+    InterceptIdPostCallRecordCmdCopyBufferToImage,
+    InterceptIdPreCallValidateCmdCopyImageToBuffer,
+    InterceptIdPreCallRecordCmdCopyImageToBuffer,
+    InterceptIdPostCallRecordCmdCopyImageToBuffer,
+    InterceptIdPreCallValidateCmdUpdateBuffer,
+    InterceptIdPreCallRecordCmdUpdateBuffer,
+    InterceptIdPostCallRecordCmdUpdateBuffer,
+    InterceptIdPreCallValidateCmdFillBuffer,
+    InterceptIdPreCallRecordCmdFillBuffer,
+    InterceptIdPostCallRecordCmdFillBuffer,
+    InterceptIdPreCallValidateCmdClearColorImage,
+    InterceptIdPreCallRecordCmdClearColorImage,
+    InterceptIdPostCallRecordCmdClearColorImage,
+    InterceptIdPreCallValidateCmdClearDepthStencilImage,
+    InterceptIdPreCallRecordCmdClearDepthStencilImage,
+    InterceptIdPostCallRecordCmdClearDepthStencilImage,
+    InterceptIdPreCallValidateCmdClearAttachments,
+    InterceptIdPreCallRecordCmdClearAttachments,
+    InterceptIdPostCallRecordCmdClearAttachments,
+    InterceptIdPreCallValidateCmdResolveImage,
+    InterceptIdPreCallRecordCmdResolveImage,
+    InterceptIdPostCallRecordCmdResolveImage,
+    InterceptIdPreCallValidateCmdSetEvent,
+    InterceptIdPreCallRecordCmdSetEvent,
+    InterceptIdPostCallRecordCmdSetEvent,
+    InterceptIdPreCallValidateCmdResetEvent,
+    InterceptIdPreCallRecordCmdResetEvent,
+    InterceptIdPostCallRecordCmdResetEvent,
+    InterceptIdPreCallValidateCmdWaitEvents,
+    InterceptIdPreCallRecordCmdWaitEvents,
+    InterceptIdPostCallRecordCmdWaitEvents,
+    InterceptIdPreCallValidateCmdPipelineBarrier,
+    InterceptIdPreCallRecordCmdPipelineBarrier,
+    InterceptIdPostCallRecordCmdPipelineBarrier,
+    InterceptIdPreCallValidateCmdBeginQuery,
+    InterceptIdPreCallRecordCmdBeginQuery,
+    InterceptIdPostCallRecordCmdBeginQuery,
+    InterceptIdPreCallValidateCmdEndQuery,
+    InterceptIdPreCallRecordCmdEndQuery,
+    InterceptIdPostCallRecordCmdEndQuery,
+    InterceptIdPreCallValidateCmdResetQueryPool,
+    InterceptIdPreCallRecordCmdResetQueryPool,
+    InterceptIdPostCallRecordCmdResetQueryPool,
+    InterceptIdPreCallValidateCmdWriteTimestamp,
+    InterceptIdPreCallRecordCmdWriteTimestamp,
+    InterceptIdPostCallRecordCmdWriteTimestamp,
+    InterceptIdPreCallValidateCmdCopyQueryPoolResults,
+    InterceptIdPreCallRecordCmdCopyQueryPoolResults,
+    InterceptIdPostCallRecordCmdCopyQueryPoolResults,
+    InterceptIdPreCallValidateCmdPushConstants,
+    InterceptIdPreCallRecordCmdPushConstants,
+    InterceptIdPostCallRecordCmdPushConstants,
+    InterceptIdPreCallValidateCmdBeginRenderPass,
+    InterceptIdPreCallRecordCmdBeginRenderPass,
+    InterceptIdPostCallRecordCmdBeginRenderPass,
+    InterceptIdPreCallValidateCmdNextSubpass,
+    InterceptIdPreCallRecordCmdNextSubpass,
+    InterceptIdPostCallRecordCmdNextSubpass,
+    InterceptIdPreCallValidateCmdEndRenderPass,
+    InterceptIdPreCallRecordCmdEndRenderPass,
+    InterceptIdPostCallRecordCmdEndRenderPass,
+    InterceptIdPreCallValidateCmdExecuteCommands,
+    InterceptIdPreCallRecordCmdExecuteCommands,
+    InterceptIdPostCallRecordCmdExecuteCommands,
+    InterceptIdPreCallValidateBindBufferMemory2,
+    InterceptIdPreCallRecordBindBufferMemory2,
+    InterceptIdPostCallRecordBindBufferMemory2,
+    InterceptIdPreCallValidateBindImageMemory2,
+    InterceptIdPreCallRecordBindImageMemory2,
+    InterceptIdPostCallRecordBindImageMemory2,
+    InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeatures,
+    InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeatures,
+    InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeatures,
+    InterceptIdPreCallValidateCmdSetDeviceMask,
+    InterceptIdPreCallRecordCmdSetDeviceMask,
+    InterceptIdPostCallRecordCmdSetDeviceMask,
+    InterceptIdPreCallValidateCmdDispatchBase,
+    InterceptIdPreCallRecordCmdDispatchBase,
+    InterceptIdPostCallRecordCmdDispatchBase,
+    InterceptIdPreCallValidateGetImageMemoryRequirements2,
+    InterceptIdPreCallRecordGetImageMemoryRequirements2,
+    InterceptIdPostCallRecordGetImageMemoryRequirements2,
+    InterceptIdPreCallValidateGetBufferMemoryRequirements2,
+    InterceptIdPreCallRecordGetBufferMemoryRequirements2,
+    InterceptIdPostCallRecordGetBufferMemoryRequirements2,
+    InterceptIdPreCallValidateGetImageSparseMemoryRequirements2,
+    InterceptIdPreCallRecordGetImageSparseMemoryRequirements2,
+    InterceptIdPostCallRecordGetImageSparseMemoryRequirements2,
+    InterceptIdPreCallValidateTrimCommandPool,
+    InterceptIdPreCallRecordTrimCommandPool,
+    InterceptIdPostCallRecordTrimCommandPool,
+    InterceptIdPreCallValidateGetDeviceQueue2,
+    InterceptIdPreCallRecordGetDeviceQueue2,
+    InterceptIdPostCallRecordGetDeviceQueue2,
+    InterceptIdPreCallValidateCreateSamplerYcbcrConversion,
+    InterceptIdPreCallRecordCreateSamplerYcbcrConversion,
+    InterceptIdPostCallRecordCreateSamplerYcbcrConversion,
+    InterceptIdPreCallValidateDestroySamplerYcbcrConversion,
+    InterceptIdPreCallRecordDestroySamplerYcbcrConversion,
+    InterceptIdPostCallRecordDestroySamplerYcbcrConversion,
+    InterceptIdPreCallValidateCreateDescriptorUpdateTemplate,
+    InterceptIdPreCallRecordCreateDescriptorUpdateTemplate,
+    InterceptIdPostCallRecordCreateDescriptorUpdateTemplate,
+    InterceptIdPreCallValidateDestroyDescriptorUpdateTemplate,
+    InterceptIdPreCallRecordDestroyDescriptorUpdateTemplate,
+    InterceptIdPostCallRecordDestroyDescriptorUpdateTemplate,
+    InterceptIdPreCallValidateUpdateDescriptorSetWithTemplate,
+    InterceptIdPreCallRecordUpdateDescriptorSetWithTemplate,
+    InterceptIdPostCallRecordUpdateDescriptorSetWithTemplate,
+    InterceptIdPreCallValidateGetDescriptorSetLayoutSupport,
+    InterceptIdPreCallRecordGetDescriptorSetLayoutSupport,
+    InterceptIdPostCallRecordGetDescriptorSetLayoutSupport,
+    InterceptIdPreCallValidateCmdDrawIndirectCount,
+    InterceptIdPreCallRecordCmdDrawIndirectCount,
+    InterceptIdPostCallRecordCmdDrawIndirectCount,
+    InterceptIdPreCallValidateCmdDrawIndexedIndirectCount,
+    InterceptIdPreCallRecordCmdDrawIndexedIndirectCount,
+    InterceptIdPostCallRecordCmdDrawIndexedIndirectCount,
+    InterceptIdPreCallValidateCreateRenderPass2,
+    InterceptIdPreCallRecordCreateRenderPass2,
+    InterceptIdPostCallRecordCreateRenderPass2,
+    InterceptIdPreCallValidateCmdBeginRenderPass2,
+    InterceptIdPreCallRecordCmdBeginRenderPass2,
+    InterceptIdPostCallRecordCmdBeginRenderPass2,
+    InterceptIdPreCallValidateCmdNextSubpass2,
+    InterceptIdPreCallRecordCmdNextSubpass2,
+    InterceptIdPostCallRecordCmdNextSubpass2,
+    InterceptIdPreCallValidateCmdEndRenderPass2,
+    InterceptIdPreCallRecordCmdEndRenderPass2,
+    InterceptIdPostCallRecordCmdEndRenderPass2,
+    InterceptIdPreCallValidateResetQueryPool,
+    InterceptIdPreCallRecordResetQueryPool,
+    InterceptIdPostCallRecordResetQueryPool,
+    InterceptIdPreCallValidateGetSemaphoreCounterValue,
+    InterceptIdPreCallRecordGetSemaphoreCounterValue,
+    InterceptIdPostCallRecordGetSemaphoreCounterValue,
+    InterceptIdPreCallValidateWaitSemaphores,
+    InterceptIdPreCallRecordWaitSemaphores,
+    InterceptIdPostCallRecordWaitSemaphores,
+    InterceptIdPreCallValidateSignalSemaphore,
+    InterceptIdPreCallRecordSignalSemaphore,
+    InterceptIdPostCallRecordSignalSemaphore,
+    InterceptIdPreCallValidateGetBufferDeviceAddress,
+    InterceptIdPreCallRecordGetBufferDeviceAddress,
+    InterceptIdPostCallRecordGetBufferDeviceAddress,
+    InterceptIdPreCallValidateGetBufferOpaqueCaptureAddress,
+    InterceptIdPreCallRecordGetBufferOpaqueCaptureAddress,
+    InterceptIdPostCallRecordGetBufferOpaqueCaptureAddress,
+    InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddress,
+    InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddress,
+    InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddress,
+    InterceptIdPreCallValidateCreateSwapchainKHR,
+    InterceptIdPreCallRecordCreateSwapchainKHR,
+    InterceptIdPostCallRecordCreateSwapchainKHR,
+    InterceptIdPreCallValidateDestroySwapchainKHR,
+    InterceptIdPreCallRecordDestroySwapchainKHR,
+    InterceptIdPostCallRecordDestroySwapchainKHR,
+    InterceptIdPreCallValidateGetSwapchainImagesKHR,
+    InterceptIdPreCallRecordGetSwapchainImagesKHR,
+    InterceptIdPostCallRecordGetSwapchainImagesKHR,
+    InterceptIdPreCallValidateAcquireNextImageKHR,
+    InterceptIdPreCallRecordAcquireNextImageKHR,
+    InterceptIdPostCallRecordAcquireNextImageKHR,
+    InterceptIdPreCallValidateQueuePresentKHR,
+    InterceptIdPreCallRecordQueuePresentKHR,
+    InterceptIdPostCallRecordQueuePresentKHR,
+    InterceptIdPreCallValidateGetDeviceGroupPresentCapabilitiesKHR,
+    InterceptIdPreCallRecordGetDeviceGroupPresentCapabilitiesKHR,
+    InterceptIdPostCallRecordGetDeviceGroupPresentCapabilitiesKHR,
+    InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModesKHR,
+    InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModesKHR,
+    InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModesKHR,
+    InterceptIdPreCallValidateAcquireNextImage2KHR,
+    InterceptIdPreCallRecordAcquireNextImage2KHR,
+    InterceptIdPostCallRecordAcquireNextImage2KHR,
+    InterceptIdPreCallValidateCreateSharedSwapchainsKHR,
+    InterceptIdPreCallRecordCreateSharedSwapchainsKHR,
+    InterceptIdPostCallRecordCreateSharedSwapchainsKHR,
+    InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR,
+    InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR,
+    InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR,
+    InterceptIdPreCallValidateCmdSetDeviceMaskKHR,
+    InterceptIdPreCallRecordCmdSetDeviceMaskKHR,
+    InterceptIdPostCallRecordCmdSetDeviceMaskKHR,
+    InterceptIdPreCallValidateCmdDispatchBaseKHR,
+    InterceptIdPreCallRecordCmdDispatchBaseKHR,
+    InterceptIdPostCallRecordCmdDispatchBaseKHR,
+    InterceptIdPreCallValidateTrimCommandPoolKHR,
+    InterceptIdPreCallRecordTrimCommandPoolKHR,
+    InterceptIdPostCallRecordTrimCommandPoolKHR,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetMemoryWin32HandleKHR,
+    InterceptIdPreCallRecordGetMemoryWin32HandleKHR,
+    InterceptIdPostCallRecordGetMemoryWin32HandleKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetMemoryWin32HandlePropertiesKHR,
+    InterceptIdPreCallRecordGetMemoryWin32HandlePropertiesKHR,
+    InterceptIdPostCallRecordGetMemoryWin32HandlePropertiesKHR,
+#endif
+    InterceptIdPreCallValidateGetMemoryFdKHR,
+    InterceptIdPreCallRecordGetMemoryFdKHR,
+    InterceptIdPostCallRecordGetMemoryFdKHR,
+    InterceptIdPreCallValidateGetMemoryFdPropertiesKHR,
+    InterceptIdPreCallRecordGetMemoryFdPropertiesKHR,
+    InterceptIdPostCallRecordGetMemoryFdPropertiesKHR,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateImportSemaphoreWin32HandleKHR,
+    InterceptIdPreCallRecordImportSemaphoreWin32HandleKHR,
+    InterceptIdPostCallRecordImportSemaphoreWin32HandleKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR,
+    InterceptIdPreCallRecordGetSemaphoreWin32HandleKHR,
+    InterceptIdPostCallRecordGetSemaphoreWin32HandleKHR,
+#endif
+    InterceptIdPreCallValidateImportSemaphoreFdKHR,
+    InterceptIdPreCallRecordImportSemaphoreFdKHR,
+    InterceptIdPostCallRecordImportSemaphoreFdKHR,
+    InterceptIdPreCallValidateGetSemaphoreFdKHR,
+    InterceptIdPreCallRecordGetSemaphoreFdKHR,
+    InterceptIdPostCallRecordGetSemaphoreFdKHR,
+    InterceptIdPreCallValidateCmdPushDescriptorSetKHR,
+    InterceptIdPreCallRecordCmdPushDescriptorSetKHR,
+    InterceptIdPostCallRecordCmdPushDescriptorSetKHR,
+    InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplateKHR,
+    InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallValidateCreateDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallRecordCreateDescriptorUpdateTemplateKHR,
+    InterceptIdPostCallRecordCreateDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallValidateDestroyDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallRecordDestroyDescriptorUpdateTemplateKHR,
+    InterceptIdPostCallRecordDestroyDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallValidateUpdateDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallRecordUpdateDescriptorSetWithTemplateKHR,
+    InterceptIdPostCallRecordUpdateDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallValidateCreateRenderPass2KHR,
+    InterceptIdPreCallRecordCreateRenderPass2KHR,
+    InterceptIdPostCallRecordCreateRenderPass2KHR,
+    InterceptIdPreCallValidateCmdBeginRenderPass2KHR,
+    InterceptIdPreCallRecordCmdBeginRenderPass2KHR,
+    InterceptIdPostCallRecordCmdBeginRenderPass2KHR,
+    InterceptIdPreCallValidateCmdNextSubpass2KHR,
+    InterceptIdPreCallRecordCmdNextSubpass2KHR,
+    InterceptIdPostCallRecordCmdNextSubpass2KHR,
+    InterceptIdPreCallValidateCmdEndRenderPass2KHR,
+    InterceptIdPreCallRecordCmdEndRenderPass2KHR,
+    InterceptIdPostCallRecordCmdEndRenderPass2KHR,
+    InterceptIdPreCallValidateGetSwapchainStatusKHR,
+    InterceptIdPreCallRecordGetSwapchainStatusKHR,
+    InterceptIdPostCallRecordGetSwapchainStatusKHR,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateImportFenceWin32HandleKHR,
+    InterceptIdPreCallRecordImportFenceWin32HandleKHR,
+    InterceptIdPostCallRecordImportFenceWin32HandleKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetFenceWin32HandleKHR,
+    InterceptIdPreCallRecordGetFenceWin32HandleKHR,
+    InterceptIdPostCallRecordGetFenceWin32HandleKHR,
+#endif
+    InterceptIdPreCallValidateImportFenceFdKHR,
+    InterceptIdPreCallRecordImportFenceFdKHR,
+    InterceptIdPostCallRecordImportFenceFdKHR,
+    InterceptIdPreCallValidateGetFenceFdKHR,
+    InterceptIdPreCallRecordGetFenceFdKHR,
+    InterceptIdPostCallRecordGetFenceFdKHR,
+    InterceptIdPreCallValidateAcquireProfilingLockKHR,
+    InterceptIdPreCallRecordAcquireProfilingLockKHR,
+    InterceptIdPostCallRecordAcquireProfilingLockKHR,
+    InterceptIdPreCallValidateReleaseProfilingLockKHR,
+    InterceptIdPreCallRecordReleaseProfilingLockKHR,
+    InterceptIdPostCallRecordReleaseProfilingLockKHR,
+    InterceptIdPreCallValidateGetImageMemoryRequirements2KHR,
+    InterceptIdPreCallRecordGetImageMemoryRequirements2KHR,
+    InterceptIdPostCallRecordGetImageMemoryRequirements2KHR,
+    InterceptIdPreCallValidateGetBufferMemoryRequirements2KHR,
+    InterceptIdPreCallRecordGetBufferMemoryRequirements2KHR,
+    InterceptIdPostCallRecordGetBufferMemoryRequirements2KHR,
+    InterceptIdPreCallValidateGetImageSparseMemoryRequirements2KHR,
+    InterceptIdPreCallRecordGetImageSparseMemoryRequirements2KHR,
+    InterceptIdPostCallRecordGetImageSparseMemoryRequirements2KHR,
+    InterceptIdPreCallValidateCreateSamplerYcbcrConversionKHR,
+    InterceptIdPreCallRecordCreateSamplerYcbcrConversionKHR,
+    InterceptIdPostCallRecordCreateSamplerYcbcrConversionKHR,
+    InterceptIdPreCallValidateDestroySamplerYcbcrConversionKHR,
+    InterceptIdPreCallRecordDestroySamplerYcbcrConversionKHR,
+    InterceptIdPostCallRecordDestroySamplerYcbcrConversionKHR,
+    InterceptIdPreCallValidateBindBufferMemory2KHR,
+    InterceptIdPreCallRecordBindBufferMemory2KHR,
+    InterceptIdPostCallRecordBindBufferMemory2KHR,
+    InterceptIdPreCallValidateBindImageMemory2KHR,
+    InterceptIdPreCallRecordBindImageMemory2KHR,
+    InterceptIdPostCallRecordBindImageMemory2KHR,
+    InterceptIdPreCallValidateGetDescriptorSetLayoutSupportKHR,
+    InterceptIdPreCallRecordGetDescriptorSetLayoutSupportKHR,
+    InterceptIdPostCallRecordGetDescriptorSetLayoutSupportKHR,
+    InterceptIdPreCallValidateCmdDrawIndirectCountKHR,
+    InterceptIdPreCallRecordCmdDrawIndirectCountKHR,
+    InterceptIdPostCallRecordCmdDrawIndirectCountKHR,
+    InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR,
+    InterceptIdPreCallRecordCmdDrawIndexedIndirectCountKHR,
+    InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR,
+    InterceptIdPreCallValidateGetSemaphoreCounterValueKHR,
+    InterceptIdPreCallRecordGetSemaphoreCounterValueKHR,
+    InterceptIdPostCallRecordGetSemaphoreCounterValueKHR,
+    InterceptIdPreCallValidateWaitSemaphoresKHR,
+    InterceptIdPreCallRecordWaitSemaphoresKHR,
+    InterceptIdPostCallRecordWaitSemaphoresKHR,
+    InterceptIdPreCallValidateSignalSemaphoreKHR,
+    InterceptIdPreCallRecordSignalSemaphoreKHR,
+    InterceptIdPostCallRecordSignalSemaphoreKHR,
+    InterceptIdPreCallValidateGetBufferDeviceAddressKHR,
+    InterceptIdPreCallRecordGetBufferDeviceAddressKHR,
+    InterceptIdPostCallRecordGetBufferDeviceAddressKHR,
+    InterceptIdPreCallValidateGetBufferOpaqueCaptureAddressKHR,
+    InterceptIdPreCallRecordGetBufferOpaqueCaptureAddressKHR,
+    InterceptIdPostCallRecordGetBufferOpaqueCaptureAddressKHR,
+    InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR,
+    InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR,
+    InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR,
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCreateDeferredOperationKHR,
+    InterceptIdPreCallRecordCreateDeferredOperationKHR,
+    InterceptIdPostCallRecordCreateDeferredOperationKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateDestroyDeferredOperationKHR,
+    InterceptIdPreCallRecordDestroyDeferredOperationKHR,
+    InterceptIdPostCallRecordDestroyDeferredOperationKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetDeferredOperationMaxConcurrencyKHR,
+    InterceptIdPreCallRecordGetDeferredOperationMaxConcurrencyKHR,
+    InterceptIdPostCallRecordGetDeferredOperationMaxConcurrencyKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetDeferredOperationResultKHR,
+    InterceptIdPreCallRecordGetDeferredOperationResultKHR,
+    InterceptIdPostCallRecordGetDeferredOperationResultKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateDeferredOperationJoinKHR,
+    InterceptIdPreCallRecordDeferredOperationJoinKHR,
+    InterceptIdPostCallRecordDeferredOperationJoinKHR,
+#endif
+    InterceptIdPreCallValidateGetPipelineExecutablePropertiesKHR,
+    InterceptIdPreCallRecordGetPipelineExecutablePropertiesKHR,
+    InterceptIdPostCallRecordGetPipelineExecutablePropertiesKHR,
+    InterceptIdPreCallValidateGetPipelineExecutableStatisticsKHR,
+    InterceptIdPreCallRecordGetPipelineExecutableStatisticsKHR,
+    InterceptIdPostCallRecordGetPipelineExecutableStatisticsKHR,
+    InterceptIdPreCallValidateGetPipelineExecutableInternalRepresentationsKHR,
+    InterceptIdPreCallRecordGetPipelineExecutableInternalRepresentationsKHR,
+    InterceptIdPostCallRecordGetPipelineExecutableInternalRepresentationsKHR,
+    InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT,
+    InterceptIdPreCallRecordDebugMarkerSetObjectTagEXT,
+    InterceptIdPostCallRecordDebugMarkerSetObjectTagEXT,
+    InterceptIdPreCallValidateDebugMarkerSetObjectNameEXT,
+    InterceptIdPreCallRecordDebugMarkerSetObjectNameEXT,
+    InterceptIdPostCallRecordDebugMarkerSetObjectNameEXT,
+    InterceptIdPreCallValidateCmdDebugMarkerBeginEXT,
+    InterceptIdPreCallRecordCmdDebugMarkerBeginEXT,
+    InterceptIdPostCallRecordCmdDebugMarkerBeginEXT,
+    InterceptIdPreCallValidateCmdDebugMarkerEndEXT,
+    InterceptIdPreCallRecordCmdDebugMarkerEndEXT,
+    InterceptIdPostCallRecordCmdDebugMarkerEndEXT,
+    InterceptIdPreCallValidateCmdDebugMarkerInsertEXT,
+    InterceptIdPreCallRecordCmdDebugMarkerInsertEXT,
+    InterceptIdPostCallRecordCmdDebugMarkerInsertEXT,
+    InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT,
+    InterceptIdPreCallRecordCmdBindTransformFeedbackBuffersEXT,
+    InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT,
+    InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT,
+    InterceptIdPreCallRecordCmdBeginTransformFeedbackEXT,
+    InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT,
+    InterceptIdPreCallValidateCmdEndTransformFeedbackEXT,
+    InterceptIdPreCallRecordCmdEndTransformFeedbackEXT,
+    InterceptIdPostCallRecordCmdEndTransformFeedbackEXT,
+    InterceptIdPreCallValidateCmdBeginQueryIndexedEXT,
+    InterceptIdPreCallRecordCmdBeginQueryIndexedEXT,
+    InterceptIdPostCallRecordCmdBeginQueryIndexedEXT,
+    InterceptIdPreCallValidateCmdEndQueryIndexedEXT,
+    InterceptIdPreCallRecordCmdEndQueryIndexedEXT,
+    InterceptIdPostCallRecordCmdEndQueryIndexedEXT,
+    InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT,
+    InterceptIdPreCallRecordCmdDrawIndirectByteCountEXT,
+    InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT,
+    InterceptIdPreCallValidateGetImageViewHandleNVX,
+    InterceptIdPreCallRecordGetImageViewHandleNVX,
+    InterceptIdPostCallRecordGetImageViewHandleNVX,
+    InterceptIdPreCallValidateGetImageViewAddressNVX,
+    InterceptIdPreCallRecordGetImageViewAddressNVX,
+    InterceptIdPostCallRecordGetImageViewAddressNVX,
+    InterceptIdPreCallValidateCmdDrawIndirectCountAMD,
+    InterceptIdPreCallRecordCmdDrawIndirectCountAMD,
+    InterceptIdPostCallRecordCmdDrawIndirectCountAMD,
+    InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD,
+    InterceptIdPreCallRecordCmdDrawIndexedIndirectCountAMD,
+    InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD,
+    InterceptIdPreCallValidateGetShaderInfoAMD,
+    InterceptIdPreCallRecordGetShaderInfoAMD,
+    InterceptIdPostCallRecordGetShaderInfoAMD,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetMemoryWin32HandleNV,
+    InterceptIdPreCallRecordGetMemoryWin32HandleNV,
+    InterceptIdPostCallRecordGetMemoryWin32HandleNV,
+#endif
+    InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT,
+    InterceptIdPreCallRecordCmdBeginConditionalRenderingEXT,
+    InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT,
+    InterceptIdPreCallValidateCmdEndConditionalRenderingEXT,
+    InterceptIdPreCallRecordCmdEndConditionalRenderingEXT,
+    InterceptIdPostCallRecordCmdEndConditionalRenderingEXT,
+    InterceptIdPreCallValidateCmdSetViewportWScalingNV,
+    InterceptIdPreCallRecordCmdSetViewportWScalingNV,
+    InterceptIdPostCallRecordCmdSetViewportWScalingNV,
+    InterceptIdPreCallValidateDisplayPowerControlEXT,
+    InterceptIdPreCallRecordDisplayPowerControlEXT,
+    InterceptIdPostCallRecordDisplayPowerControlEXT,
+    InterceptIdPreCallValidateRegisterDeviceEventEXT,
+    InterceptIdPreCallRecordRegisterDeviceEventEXT,
+    InterceptIdPostCallRecordRegisterDeviceEventEXT,
+    InterceptIdPreCallValidateRegisterDisplayEventEXT,
+    InterceptIdPreCallRecordRegisterDisplayEventEXT,
+    InterceptIdPostCallRecordRegisterDisplayEventEXT,
+    InterceptIdPreCallValidateGetSwapchainCounterEXT,
+    InterceptIdPreCallRecordGetSwapchainCounterEXT,
+    InterceptIdPostCallRecordGetSwapchainCounterEXT,
+    InterceptIdPreCallValidateGetRefreshCycleDurationGOOGLE,
+    InterceptIdPreCallRecordGetRefreshCycleDurationGOOGLE,
+    InterceptIdPostCallRecordGetRefreshCycleDurationGOOGLE,
+    InterceptIdPreCallValidateGetPastPresentationTimingGOOGLE,
+    InterceptIdPreCallRecordGetPastPresentationTimingGOOGLE,
+    InterceptIdPostCallRecordGetPastPresentationTimingGOOGLE,
+    InterceptIdPreCallValidateCmdSetDiscardRectangleEXT,
+    InterceptIdPreCallRecordCmdSetDiscardRectangleEXT,
+    InterceptIdPostCallRecordCmdSetDiscardRectangleEXT,
+    InterceptIdPreCallValidateSetHdrMetadataEXT,
+    InterceptIdPreCallRecordSetHdrMetadataEXT,
+    InterceptIdPostCallRecordSetHdrMetadataEXT,
+    InterceptIdPreCallValidateSetDebugUtilsObjectNameEXT,
+    InterceptIdPreCallRecordSetDebugUtilsObjectNameEXT,
+    InterceptIdPostCallRecordSetDebugUtilsObjectNameEXT,
+    InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT,
+    InterceptIdPreCallRecordSetDebugUtilsObjectTagEXT,
+    InterceptIdPostCallRecordSetDebugUtilsObjectTagEXT,
+    InterceptIdPreCallValidateQueueBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordQueueBeginDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordQueueBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateQueueEndDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordQueueEndDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordQueueEndDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateQueueInsertDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordQueueInsertDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordQueueInsertDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordCmdBeginDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordCmdEndDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordCmdInsertDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT,
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    InterceptIdPreCallValidateGetAndroidHardwareBufferPropertiesANDROID,
+    InterceptIdPreCallRecordGetAndroidHardwareBufferPropertiesANDROID,
+    InterceptIdPostCallRecordGetAndroidHardwareBufferPropertiesANDROID,
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    InterceptIdPreCallValidateGetMemoryAndroidHardwareBufferANDROID,
+    InterceptIdPreCallRecordGetMemoryAndroidHardwareBufferANDROID,
+    InterceptIdPostCallRecordGetMemoryAndroidHardwareBufferANDROID,
+#endif
+    InterceptIdPreCallValidateCmdSetSampleLocationsEXT,
+    InterceptIdPreCallRecordCmdSetSampleLocationsEXT,
+    InterceptIdPostCallRecordCmdSetSampleLocationsEXT,
+    InterceptIdPreCallValidateGetImageDrmFormatModifierPropertiesEXT,
+    InterceptIdPreCallRecordGetImageDrmFormatModifierPropertiesEXT,
+    InterceptIdPostCallRecordGetImageDrmFormatModifierPropertiesEXT,
+    InterceptIdPreCallValidateCmdBindShadingRateImageNV,
+    InterceptIdPreCallRecordCmdBindShadingRateImageNV,
+    InterceptIdPostCallRecordCmdBindShadingRateImageNV,
+    InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV,
+    InterceptIdPreCallRecordCmdSetViewportShadingRatePaletteNV,
+    InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV,
+    InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV,
+    InterceptIdPreCallRecordCmdSetCoarseSampleOrderNV,
+    InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV,
+    InterceptIdPreCallValidateCreateAccelerationStructureNV,
+    InterceptIdPreCallRecordCreateAccelerationStructureNV,
+    InterceptIdPostCallRecordCreateAccelerationStructureNV,
+    InterceptIdPreCallValidateDestroyAccelerationStructureKHR,
+    InterceptIdPreCallRecordDestroyAccelerationStructureKHR,
+    InterceptIdPostCallRecordDestroyAccelerationStructureKHR,
+    InterceptIdPreCallValidateDestroyAccelerationStructureNV,
+    InterceptIdPreCallRecordDestroyAccelerationStructureNV,
+    InterceptIdPostCallRecordDestroyAccelerationStructureNV,
+    InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsNV,
+    InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsNV,
+    InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsNV,
+    InterceptIdPreCallValidateBindAccelerationStructureMemoryKHR,
+    InterceptIdPreCallRecordBindAccelerationStructureMemoryKHR,
+    InterceptIdPostCallRecordBindAccelerationStructureMemoryKHR,
+    InterceptIdPreCallValidateBindAccelerationStructureMemoryNV,
+    InterceptIdPreCallRecordBindAccelerationStructureMemoryNV,
+    InterceptIdPostCallRecordBindAccelerationStructureMemoryNV,
+    InterceptIdPreCallValidateCmdBuildAccelerationStructureNV,
+    InterceptIdPreCallRecordCmdBuildAccelerationStructureNV,
+    InterceptIdPostCallRecordCmdBuildAccelerationStructureNV,
+    InterceptIdPreCallValidateCmdCopyAccelerationStructureNV,
+    InterceptIdPreCallRecordCmdCopyAccelerationStructureNV,
+    InterceptIdPostCallRecordCmdCopyAccelerationStructureNV,
+    InterceptIdPreCallValidateCmdTraceRaysNV,
+    InterceptIdPreCallRecordCmdTraceRaysNV,
+    InterceptIdPostCallRecordCmdTraceRaysNV,
+    InterceptIdPreCallValidateCreateRayTracingPipelinesNV,
+    InterceptIdPreCallRecordCreateRayTracingPipelinesNV,
+    InterceptIdPostCallRecordCreateRayTracingPipelinesNV,
+    InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesKHR,
+    InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesKHR,
+    InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesKHR,
+    InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesNV,
+    InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesNV,
+    InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesNV,
+    InterceptIdPreCallValidateGetAccelerationStructureHandleNV,
+    InterceptIdPreCallRecordGetAccelerationStructureHandleNV,
+    InterceptIdPostCallRecordGetAccelerationStructureHandleNV,
+    InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesKHR,
+    InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesKHR,
+    InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesKHR,
+    InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV,
+    InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesNV,
+    InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV,
+    InterceptIdPreCallValidateCompileDeferredNV,
+    InterceptIdPreCallRecordCompileDeferredNV,
+    InterceptIdPostCallRecordCompileDeferredNV,
+    InterceptIdPreCallValidateGetMemoryHostPointerPropertiesEXT,
+    InterceptIdPreCallRecordGetMemoryHostPointerPropertiesEXT,
+    InterceptIdPostCallRecordGetMemoryHostPointerPropertiesEXT,
+    InterceptIdPreCallValidateCmdWriteBufferMarkerAMD,
+    InterceptIdPreCallRecordCmdWriteBufferMarkerAMD,
+    InterceptIdPostCallRecordCmdWriteBufferMarkerAMD,
+    InterceptIdPreCallValidateGetCalibratedTimestampsEXT,
+    InterceptIdPreCallRecordGetCalibratedTimestampsEXT,
+    InterceptIdPostCallRecordGetCalibratedTimestampsEXT,
+    InterceptIdPreCallValidateCmdDrawMeshTasksNV,
+    InterceptIdPreCallRecordCmdDrawMeshTasksNV,
+    InterceptIdPostCallRecordCmdDrawMeshTasksNV,
+    InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV,
+    InterceptIdPreCallRecordCmdDrawMeshTasksIndirectNV,
+    InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV,
+    InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV,
+    InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountNV,
+    InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV,
+    InterceptIdPreCallValidateCmdSetExclusiveScissorNV,
+    InterceptIdPreCallRecordCmdSetExclusiveScissorNV,
+    InterceptIdPostCallRecordCmdSetExclusiveScissorNV,
+    InterceptIdPreCallValidateCmdSetCheckpointNV,
+    InterceptIdPreCallRecordCmdSetCheckpointNV,
+    InterceptIdPostCallRecordCmdSetCheckpointNV,
+    InterceptIdPreCallValidateGetQueueCheckpointDataNV,
+    InterceptIdPreCallRecordGetQueueCheckpointDataNV,
+    InterceptIdPostCallRecordGetQueueCheckpointDataNV,
+    InterceptIdPreCallValidateInitializePerformanceApiINTEL,
+    InterceptIdPreCallRecordInitializePerformanceApiINTEL,
+    InterceptIdPostCallRecordInitializePerformanceApiINTEL,
+    InterceptIdPreCallValidateUninitializePerformanceApiINTEL,
+    InterceptIdPreCallRecordUninitializePerformanceApiINTEL,
+    InterceptIdPostCallRecordUninitializePerformanceApiINTEL,
+    InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL,
+    InterceptIdPreCallRecordCmdSetPerformanceMarkerINTEL,
+    InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL,
+    InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL,
+    InterceptIdPreCallRecordCmdSetPerformanceStreamMarkerINTEL,
+    InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL,
+    InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL,
+    InterceptIdPreCallRecordCmdSetPerformanceOverrideINTEL,
+    InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL,
+    InterceptIdPreCallValidateAcquirePerformanceConfigurationINTEL,
+    InterceptIdPreCallRecordAcquirePerformanceConfigurationINTEL,
+    InterceptIdPostCallRecordAcquirePerformanceConfigurationINTEL,
+    InterceptIdPreCallValidateReleasePerformanceConfigurationINTEL,
+    InterceptIdPreCallRecordReleasePerformanceConfigurationINTEL,
+    InterceptIdPostCallRecordReleasePerformanceConfigurationINTEL,
+    InterceptIdPreCallValidateQueueSetPerformanceConfigurationINTEL,
+    InterceptIdPreCallRecordQueueSetPerformanceConfigurationINTEL,
+    InterceptIdPostCallRecordQueueSetPerformanceConfigurationINTEL,
+    InterceptIdPreCallValidateGetPerformanceParameterINTEL,
+    InterceptIdPreCallRecordGetPerformanceParameterINTEL,
+    InterceptIdPostCallRecordGetPerformanceParameterINTEL,
+    InterceptIdPreCallValidateSetLocalDimmingAMD,
+    InterceptIdPreCallRecordSetLocalDimmingAMD,
+    InterceptIdPostCallRecordSetLocalDimmingAMD,
+    InterceptIdPreCallValidateGetBufferDeviceAddressEXT,
+    InterceptIdPreCallRecordGetBufferDeviceAddressEXT,
+    InterceptIdPostCallRecordGetBufferDeviceAddressEXT,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateAcquireFullScreenExclusiveModeEXT,
+    InterceptIdPreCallRecordAcquireFullScreenExclusiveModeEXT,
+    InterceptIdPostCallRecordAcquireFullScreenExclusiveModeEXT,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateReleaseFullScreenExclusiveModeEXT,
+    InterceptIdPreCallRecordReleaseFullScreenExclusiveModeEXT,
+    InterceptIdPostCallRecordReleaseFullScreenExclusiveModeEXT,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModes2EXT,
+    InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModes2EXT,
+    InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModes2EXT,
+#endif
+    InterceptIdPreCallValidateCmdSetLineStippleEXT,
+    InterceptIdPreCallRecordCmdSetLineStippleEXT,
+    InterceptIdPostCallRecordCmdSetLineStippleEXT,
+    InterceptIdPreCallValidateResetQueryPoolEXT,
+    InterceptIdPreCallRecordResetQueryPoolEXT,
+    InterceptIdPostCallRecordResetQueryPoolEXT,
+    InterceptIdPreCallValidateCmdSetCullModeEXT,
+    InterceptIdPreCallRecordCmdSetCullModeEXT,
+    InterceptIdPostCallRecordCmdSetCullModeEXT,
+    InterceptIdPreCallValidateCmdSetFrontFaceEXT,
+    InterceptIdPreCallRecordCmdSetFrontFaceEXT,
+    InterceptIdPostCallRecordCmdSetFrontFaceEXT,
+    InterceptIdPreCallValidateCmdSetPrimitiveTopologyEXT,
+    InterceptIdPreCallRecordCmdSetPrimitiveTopologyEXT,
+    InterceptIdPostCallRecordCmdSetPrimitiveTopologyEXT,
+    InterceptIdPreCallValidateCmdSetViewportWithCountEXT,
+    InterceptIdPreCallRecordCmdSetViewportWithCountEXT,
+    InterceptIdPostCallRecordCmdSetViewportWithCountEXT,
+    InterceptIdPreCallValidateCmdSetScissorWithCountEXT,
+    InterceptIdPreCallRecordCmdSetScissorWithCountEXT,
+    InterceptIdPostCallRecordCmdSetScissorWithCountEXT,
+    InterceptIdPreCallValidateCmdBindVertexBuffers2EXT,
+    InterceptIdPreCallRecordCmdBindVertexBuffers2EXT,
+    InterceptIdPostCallRecordCmdBindVertexBuffers2EXT,
+    InterceptIdPreCallValidateCmdSetDepthTestEnableEXT,
+    InterceptIdPreCallRecordCmdSetDepthTestEnableEXT,
+    InterceptIdPostCallRecordCmdSetDepthTestEnableEXT,
+    InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT,
+    InterceptIdPreCallRecordCmdSetDepthWriteEnableEXT,
+    InterceptIdPostCallRecordCmdSetDepthWriteEnableEXT,
+    InterceptIdPreCallValidateCmdSetDepthCompareOpEXT,
+    InterceptIdPreCallRecordCmdSetDepthCompareOpEXT,
+    InterceptIdPostCallRecordCmdSetDepthCompareOpEXT,
+    InterceptIdPreCallValidateCmdSetDepthBoundsTestEnableEXT,
+    InterceptIdPreCallRecordCmdSetDepthBoundsTestEnableEXT,
+    InterceptIdPostCallRecordCmdSetDepthBoundsTestEnableEXT,
+    InterceptIdPreCallValidateCmdSetStencilTestEnableEXT,
+    InterceptIdPreCallRecordCmdSetStencilTestEnableEXT,
+    InterceptIdPostCallRecordCmdSetStencilTestEnableEXT,
+    InterceptIdPreCallValidateCmdSetStencilOpEXT,
+    InterceptIdPreCallRecordCmdSetStencilOpEXT,
+    InterceptIdPostCallRecordCmdSetStencilOpEXT,
+    InterceptIdPreCallValidateGetGeneratedCommandsMemoryRequirementsNV,
+    InterceptIdPreCallRecordGetGeneratedCommandsMemoryRequirementsNV,
+    InterceptIdPostCallRecordGetGeneratedCommandsMemoryRequirementsNV,
+    InterceptIdPreCallValidateCmdPreprocessGeneratedCommandsNV,
+    InterceptIdPreCallRecordCmdPreprocessGeneratedCommandsNV,
+    InterceptIdPostCallRecordCmdPreprocessGeneratedCommandsNV,
+    InterceptIdPreCallValidateCmdExecuteGeneratedCommandsNV,
+    InterceptIdPreCallRecordCmdExecuteGeneratedCommandsNV,
+    InterceptIdPostCallRecordCmdExecuteGeneratedCommandsNV,
+    InterceptIdPreCallValidateCmdBindPipelineShaderGroupNV,
+    InterceptIdPreCallRecordCmdBindPipelineShaderGroupNV,
+    InterceptIdPostCallRecordCmdBindPipelineShaderGroupNV,
+    InterceptIdPreCallValidateCreateIndirectCommandsLayoutNV,
+    InterceptIdPreCallRecordCreateIndirectCommandsLayoutNV,
+    InterceptIdPostCallRecordCreateIndirectCommandsLayoutNV,
+    InterceptIdPreCallValidateDestroyIndirectCommandsLayoutNV,
+    InterceptIdPreCallRecordDestroyIndirectCommandsLayoutNV,
+    InterceptIdPostCallRecordDestroyIndirectCommandsLayoutNV,
+    InterceptIdPreCallValidateCreatePrivateDataSlotEXT,
+    InterceptIdPreCallRecordCreatePrivateDataSlotEXT,
+    InterceptIdPostCallRecordCreatePrivateDataSlotEXT,
+    InterceptIdPreCallValidateDestroyPrivateDataSlotEXT,
+    InterceptIdPreCallRecordDestroyPrivateDataSlotEXT,
+    InterceptIdPostCallRecordDestroyPrivateDataSlotEXT,
+    InterceptIdPreCallValidateSetPrivateDataEXT,
+    InterceptIdPreCallRecordSetPrivateDataEXT,
+    InterceptIdPostCallRecordSetPrivateDataEXT,
+    InterceptIdPreCallValidateGetPrivateDataEXT,
+    InterceptIdPreCallRecordGetPrivateDataEXT,
+    InterceptIdPostCallRecordGetPrivateDataEXT,
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCreateAccelerationStructureKHR,
+    InterceptIdPreCallRecordCreateAccelerationStructureKHR,
+    InterceptIdPostCallRecordCreateAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsKHR,
+    InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsKHR,
+    InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdBuildAccelerationStructureKHR,
+    InterceptIdPreCallRecordCmdBuildAccelerationStructureKHR,
+    InterceptIdPostCallRecordCmdBuildAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdBuildAccelerationStructureIndirectKHR,
+    InterceptIdPreCallRecordCmdBuildAccelerationStructureIndirectKHR,
+    InterceptIdPostCallRecordCmdBuildAccelerationStructureIndirectKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateBuildAccelerationStructureKHR,
+    InterceptIdPreCallRecordBuildAccelerationStructureKHR,
+    InterceptIdPostCallRecordBuildAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCopyAccelerationStructureKHR,
+    InterceptIdPreCallRecordCopyAccelerationStructureKHR,
+    InterceptIdPostCallRecordCopyAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCopyAccelerationStructureToMemoryKHR,
+    InterceptIdPreCallRecordCopyAccelerationStructureToMemoryKHR,
+    InterceptIdPostCallRecordCopyAccelerationStructureToMemoryKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCopyMemoryToAccelerationStructureKHR,
+    InterceptIdPreCallRecordCopyMemoryToAccelerationStructureKHR,
+    InterceptIdPostCallRecordCopyMemoryToAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateWriteAccelerationStructuresPropertiesKHR,
+    InterceptIdPreCallRecordWriteAccelerationStructuresPropertiesKHR,
+    InterceptIdPostCallRecordWriteAccelerationStructuresPropertiesKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdCopyAccelerationStructureKHR,
+    InterceptIdPreCallRecordCmdCopyAccelerationStructureKHR,
+    InterceptIdPostCallRecordCmdCopyAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdCopyAccelerationStructureToMemoryKHR,
+    InterceptIdPreCallRecordCmdCopyAccelerationStructureToMemoryKHR,
+    InterceptIdPostCallRecordCmdCopyAccelerationStructureToMemoryKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdCopyMemoryToAccelerationStructureKHR,
+    InterceptIdPreCallRecordCmdCopyMemoryToAccelerationStructureKHR,
+    InterceptIdPostCallRecordCmdCopyMemoryToAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdTraceRaysKHR,
+    InterceptIdPreCallRecordCmdTraceRaysKHR,
+    InterceptIdPostCallRecordCmdTraceRaysKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCreateRayTracingPipelinesKHR,
+    InterceptIdPreCallRecordCreateRayTracingPipelinesKHR,
+    InterceptIdPostCallRecordCreateRayTracingPipelinesKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetAccelerationStructureDeviceAddressKHR,
+    InterceptIdPreCallRecordGetAccelerationStructureDeviceAddressKHR,
+    InterceptIdPostCallRecordGetAccelerationStructureDeviceAddressKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR,
+    InterceptIdPreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR,
+    InterceptIdPostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdTraceRaysIndirectKHR,
+    InterceptIdPreCallRecordCmdTraceRaysIndirectKHR,
+    InterceptIdPostCallRecordCmdTraceRaysIndirectKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetDeviceAccelerationStructureCompatibilityKHR,
+    InterceptIdPreCallRecordGetDeviceAccelerationStructureCompatibilityKHR,
+    InterceptIdPostCallRecordGetDeviceAccelerationStructureCompatibilityKHR,
+#endif
+    InterceptIdCount,
+};
 
 
 // Layer object type identifiers
@@ -2803,11 +3864,19 @@ typedef enum ValidationCheckDisables {
     VALIDATION_CHECK_DISABLE_PUSH_CONSTANT_RANGE,
     VALIDATION_CHECK_DISABLE_QUERY_VALIDATION,
     VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION,
+    VALIDATION_CHECK_DISABLE_SHADER_VALIDATION_CACHE,
 } ValidationCheckDisables;
 
 typedef enum ValidationCheckEnables {
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM,
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL,
+    VALIDATION_CHECK_ENABLE_CMD_BUFFER_LOCAL_LOCKING,
+    VALIDATION_CHECK_ENABLE_PARALLEL_PIPELINE_VALIDATION,
+    VALIDATION_CHECK_ENABLE_LAZY_SHADER_MODULES,
+    VALIDATION_CHECK_ENABLE_LAZY_DESCRIPTOR_BINDING,
+    VALIDATION_CHECK_ENABLE_PARALLEL_IMAGE_LAYOUT_VALIDATION,
+    VALIDATION_CHECK_ENABLE_GPU_DEFERRED_RESULTS,
+    VALIDATION_CHECK_ENABLE_SHADER_MODULE_STATS,
 } ValidationCheckEnables;
 
 typedef enum VkValidationFeatureEnable {
@@ -2831,6 +3900,7 @@ typedef enum DisableFlags {
     stateless_checks,
     handle_wrapping,
     shader_validation,
+    shader_validation_caching,
     // Insert new disables above this line
     kMaxDisableFlags,
 } DisableFlags;
@@ -2842,6 +3912,13 @@ typedef enum EnableFlags {
     vendor_specific_arm,
     debug_printf,
     sync_validation,
+    cmd_buffer_local_locking,
+    parallel_pipeline_validation,
+    lazy_shader_modules,
+    lazy_descriptor_binding,
+    parallel_image_layout_validation,
+    gpu_deferred_results,
+    shader_module_stats,
     // Insert new enables above this line
     kMaxEnableFlags,
 } EnableFlags;
@@ -2849,6 +3926,57 @@ typedef enum EnableFlags {
 typedef std::array<bool, kMaxDisableFlags> CHECK_DISABLED;
 typedef std::array<bool, kMaxEnableFlags> CHECK_ENABLED;
 
+// Call counts and timings of the device-level hooks, kept per hook and per validation object when the
+// khronos_validation.chassis_profile option is set. Buckets are powers of two of the call time in nanoseconds.
+class HookProfile {
+  public:
+    static const uint32_t kBucketCount = 40;
+    struct Counters {
+        std::atomic<uint64_t> calls;
+        std::atomic<uint64_t> total_ns;
+        std::atomic<uint64_t> buckets[kBucketCount];
+        Counters();
+    };
+
+    HookProfile(const std::string &report_path, uint32_t present_interval);
+    ~HookProfile();
+    // Returns nullptr unless profiling was requested in the layer settings
+    static HookProfile *Create();
+
+    void Record(InterceptId id, LayerObjectTypeId object_type, uint64_t ns);
+    void Report(const char *when) const;
+    // Writes an intermediate report every present_interval presents, if one was requested
+    void CountPresent();
+
+  private:
+    std::string report_path;
+    uint32_t present_interval;
+    std::atomic<uint32_t> present_count{0};
+    // One row of LayerObjectTypeMaxEnum counters per InterceptId, allocated on the first call of that hook
+    std::unique_ptr<std::atomic<Counters *>[]> rows;
+};
+
+// Times a single hook call. Does nothing but a null check when profiling is disabled.
+class HookTimer {
+  public:
+    HookTimer(HookProfile *profile, InterceptId id, LayerObjectTypeId object_type)
+        : profile_(profile), id_(id), object_type_(object_type) {
+        if (profile_) start_ = std::chrono::steady_clock::now();
+    }
+    ~HookTimer() {
+        if (profile_) {
+            auto elapsed = std::chrono::steady_clock::now() - start_;
+            profile_->Record(id_, object_type_, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+
+  private:
+    HookProfile *profile_;
+    InterceptId id_;
+    LayerObjectTypeId object_type_;
+    std::chrono::steady_clock::time_point start_;
+};
+
 // Layer chassis validation object base class definition
 class ValidationObject {
     public:
@@ -2869,6 +3997,10 @@ class ValidationObject {
         LAYER_PHYS_DEV_PROPERTIES phys_dev_properties = {};
 
         std::vector<ValidationObject*> object_dispatch;
+        // For each InterceptId, the objects in object_dispatch whose class overrides that hook. Only built for devices.
+        std::vector<std::vector<ValidationObject*>> intercept_vectors;
+        // Hook timings, only allocated for devices when khronos_validation.chassis_profile is set
+        std::unique_ptr<HookProfile> hook_profile;
         LayerObjectTypeId container_type;
 
         std::string layer_name = "CHASSIS";
@@ -2885,6 +4017,13 @@ class ValidationObject {
         virtual write_lock_guard_t write_lock() {
             return write_lock_guard_t(validation_object_mutex);
         }
+        // Locks used around the hooks of vkCmd* entry points, see cmd_buffer_lock_guard_t
+        virtual cmd_buffer_lock_guard_t cmd_buffer_read_lock(VkCommandBuffer commandBuffer) {
+            return cmd_buffer_lock_guard_t(read_lock());
+        }
+        virtual cmd_buffer_lock_guard_t cmd_buffer_write_lock(VkCommandBuffer commandBuffer) {
+            return cmd_buffer_lock_guard_t(write_lock());
+        }
 
         void RegisterValidationObject(bool vo_enabled, uint32_t instance_api_version,
             debug_report_data* instance_report_data, std::vector<ValidationObject*> &dispatch_list) {
@@ -2895,6 +4034,8 @@ class ValidationObject {
             }
         }
 
+        void InitObjectDispatchVectors();
+
         void FinalizeInstanceValidationObject(ValidationObject *framework) {
             instance_dispatch_table = framework->instance_dispatch_table;
             enabled = framework->enabled;
@@ -2912,6 +4053,8 @@ class ValidationObject {
                 api_version = dev_obj->api_version;
                 disabled = inst_obj->disabled;
                 enabled = inst_obj->enabled;
+                // Only recording command buffers on many threads at once gains from concurrent shared holds
+                if (enabled[cmd_buffer_local_locking]) validation_object_mutex.EnableSharedHolds();
                 instance_dispatch_table = inst_obj->instance_dispatch_table;
                 instance_extensions = inst_obj->instance_extensions;
                 device_extensions = dev_obj->device_extensions;
@@ -2929,12 +4072,15 @@ class ValidationObject {
 
         // Debug Logging Helpers
         bool LogError(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -2942,17 +4088,20 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kErrorBit, objects, vuid_text, str);
+            return LogMsg(report_data, kErrorBit, objects, vuid_text, vuid_hash, str);
         };
 
         template <typename HANDLE_T>
         bool LogError(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -2961,17 +4110,20 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kErrorBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kErrorBit, single_object, vuid_text, vuid_hash, str);
 
         };
 
         bool LogWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -2979,17 +4131,20 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kWarningBit, objects, vuid_text, str);
+            return LogMsg(report_data, kWarningBit, objects, vuid_text, vuid_hash, str);
         };
 
         template <typename HANDLE_T>
         bool LogWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -2998,16 +4153,19 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kWarningBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kWarningBit, single_object, vuid_text, vuid_hash, str);
         };
 
         bool LogPerformanceWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -3015,17 +4173,20 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, objects, vuid_text, str);
+            return LogMsg(report_data, kPerformanceWarningBit, objects, vuid_text, vuid_hash, str);
         };
 
         template <typename HANDLE_T>
         bool LogPerformanceWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -3034,16 +4195,19 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kPerformanceWarningBit, single_object, vuid_text, vuid_hash, str);
         };
 
         bool LogInfo(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -3051,17 +4215,20 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kInformationBit, objects, vuid_text, str);
+            return LogMsg(report_data, kInformationBit, objects, vuid_text, vuid_hash, str);
         };
 
         template <typename HANDLE_T>
         bool LogInfo(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -3070,7 +4237,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kInformationBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kInformationBit, single_object, vuid_text, vuid_hash, str);
         };
 
         // Handle Wrapping Data
@@ -3103,17 +4270,13 @@ class ValidationObject {
         // Wrap a newly created handle with a new unique ID, and return the new ID.
         template <typename HandleType>
         HandleType WrapNew(HandleType newlyCreatedHandle) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.insert_new(global_unique_id++, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             return (HandleType)unique_id;
         }
 
         // Specialized handling for VkDisplayKHR. Adds an entry to enable reverse-lookup.
         VkDisplayKHR WrapDisplay(VkDisplayKHR newlyCreatedHandle, ValidationObject *map_data) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.insert_new(global_unique_id++, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             map_data->display_id_reverse_mapping.insert_or_assign(newlyCreatedHandle, unique_id);
             return (VkDisplayKHR)unique_id;
         }
@@ -54,6 +54,14 @@ class UtilDescriptorSetManager {
     std::unordered_map<VkDescriptorPool, struct PoolTracker> desc_pool_map_;
 };
 
+// The instrumented shader cache file is khronos_validation.gpu_shader_cache_path if set, and otherwise lives in the user's
+// cache directory. Empty if there is no such directory.
+std::string UtilInstrumentedShaderCachePath() {
+    const char *path_string = getLayerOption("khronos_validation.gpu_shader_cache_path");
+    if (*path_string) return path_string;
+    return GetUserCacheFilePath("VkLayer_khronos_validation_instrumented_shaders.bin");
+}
+
 // Implementation for Descriptor Set Manager class
 UtilDescriptorSetManager::UtilDescriptorSetManager(VkDevice device, uint32_t numBindingsInSet)
     : device(device), numBindingsInSet(numBindingsInSet) {}
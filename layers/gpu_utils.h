@@ -19,6 +19,10 @@
 #pragma once
 #include "chassis.h"
 #include "shader_validation.h"
+#include "xxhash.h"
+#include <algorithm>
+#include <deque>
+#include <fstream>
 class UtilDescriptorSetManager {
   public:
     UtilDescriptorSetManager(VkDevice device, uint32_t numBindingsInSet);
@@ -43,6 +47,239 @@ struct UtilQueueBarrierCommandInfo {
     VkCommandPool barrier_command_pool = VK_NULL_HANDLE;
     VkCommandBuffer barrier_command_buffer = VK_NULL_HANDLE;
 };
+// A submission whose instrumentation output is read back once its layer-owned fence signals.
+// Holds the submitted primary command buffers followed by their linked secondaries.
+struct UtilInFlightSubmission {
+    VkQueue queue;
+    VkFence fence;
+    std::vector<VkCommandBuffer> command_buffers;
+};
+// Instrumented SPIR-V kept on disk across runs, so shaders seen before skip the optimizer.
+// Entries are keyed by a hash of the original code and of the settings that change how it is instrumented. Each also holds the
+// original code, which must match exactly for the entry to be used, so a key collision or a corrupted entry can't substitute
+// another shader. Modules are stored instrumented with kShaderIdPlaceholder as their shader ID, along with the positions of
+// the constants holding it, so a cached module can be given the ID of the shader module being created.
+// Saving merges in the entries that other processes saved in the meantime, then evicts the least recently used entries until
+// the file is within kMaxWords.
+class UtilInstrumentedShaderCache {
+  public:
+    static const uint32_t kShaderIdPlaceholder = 0x5ca1ab1e;
+
+    bool IsEnabled() const { return !filename_.empty(); }
+
+    static uint64_t MakeKey(const uint32_t *code, size_t code_size, const uint32_t *settings, size_t settings_size) {
+        return XXH64(code, code_size, XXH64(settings, settings_size, 0));
+    }
+
+    // Instrumenting with the placeholder ID is only safe if the original code doesn't already use the same constant.
+    static bool UsesPlaceholder(const uint32_t *code, size_t num_words) {
+        return !FindConstantOperands(code, num_words, kShaderIdPlaceholder).empty();
+    }
+
+    bool Get(uint64_t key, const uint32_t *code, size_t num_words, uint32_t shader_id, std::vector<unsigned int> &pgm) {
+        auto entry = entries_.find(key);
+        if (entry == entries_.end() || !entry->second.Matches(code, num_words)) return false;
+        if (entry->second.last_used != run_) {
+            entry->second.last_used = run_;
+            dirty_ = true;
+        }
+        pgm = entry->second.pgm;
+        for (auto offset : entry->second.shader_id_offsets) {
+            pgm[offset] = shader_id;
+        }
+        return true;
+    }
+
+    // Record a module instrumented with the placeholder ID, then patch in its real shader ID.
+    void Put(uint64_t key, const uint32_t *code, size_t num_words, uint32_t shader_id, std::vector<unsigned int> &pgm) {
+        Entry &entry = entries_[key];
+        entry.original.assign(code, code + num_words);
+        entry.pgm = pgm;
+        entry.shader_id_offsets = FindConstantOperands(pgm.data(), pgm.size(), kShaderIdPlaceholder);
+        entry.last_used = run_;
+        for (auto offset : entry.shader_id_offsets) {
+            pgm[offset] = shader_id;
+        }
+        dirty_ = true;
+    }
+
+    // A file written by another version of SPIRV-Tools or of the cache, or one that is truncated, is ignored.
+    void Load(const std::string &filename);
+    // Returns false if there were changes and they couldn't be written.
+    bool Save();
+
+  private:
+    static const uint32_t kMagic = 0x43495047;  // "GPIC"
+    static const uint32_t kVersion = 2;
+    static const uint32_t kHeaderWords = 6;  // magic, version, SPIRV-Tools commit hash (2 words), last run, entry count
+    static const uint32_t kEntryHeaderWords = 6;  // key (2 words), last run used, original, offsets and pgm word counts
+    static const size_t kMaxWords = 16 * 1024 * 1024;  // 64 MiB
+
+    struct Entry {
+        std::vector<uint32_t> original;
+        std::vector<unsigned int> pgm;
+        std::vector<uint32_t> shader_id_offsets;
+        uint32_t last_used = 0;
+
+        bool Matches(const uint32_t *code, size_t num_words) const {
+            return (original.size() == num_words) && std::equal(original.begin(), original.end(), code);
+        }
+        size_t Words() const { return kEntryHeaderWords + original.size() + shader_id_offsets.size() + pgm.size(); }
+    };
+    typedef std::unordered_map<uint64_t, Entry> EntryMap;
+
+    static uint64_t ToolsHash() { return XXH64(SPIRV_TOOLS_COMMIT_ID, strlen(SPIRV_TOOLS_COMMIT_ID), 0); }
+
+    // Word offsets of the values of all 32-bit OpConstants equal to value
+    static std::vector<uint32_t> FindConstantOperands(const uint32_t *code, size_t num_words, uint32_t value) {
+        std::vector<uint32_t> offsets;
+        size_t offset = 5;  // First instruction follows the SPIR-V header
+        while (offset < num_words) {
+            const uint32_t word_count = code[offset] >> 16;
+            if (word_count == 0 || offset + word_count > num_words) break;
+            if ((code[offset] & 0x0ffffu) == spv::OpConstant && word_count == 4 && code[offset + 3] == value) {
+                offsets.push_back(static_cast<uint32_t>(offset + 3));
+            }
+            offset += word_count;
+        }
+        return offsets;
+    }
+    static bool ReadWords(std::ifstream &file, uint32_t *words, size_t count, size_t &words_left) {
+        if (count > words_left) return false;
+        words_left -= count;
+        return static_cast<bool>(file.read(reinterpret_cast<char *>(words), count * sizeof(uint32_t)));
+    }
+    static void WriteWords(std::ofstream &file, const uint32_t *words, size_t count) {
+        file.write(reinterpret_cast<const char *>(words), count * sizeof(uint32_t));
+    }
+    static bool Read(const std::string &filename, EntryMap *entries, uint32_t *last_run);
+    static bool Write(const std::string &filename, const EntryMap &entries, uint32_t last_run);
+    void Evict();
+
+    std::string filename_;
+    EntryMap entries_;
+    uint32_t run_ = 0;  // Entries record the last run to use them, numbered by the saves of the file
+    bool dirty_ = false;
+};
+inline bool UtilInstrumentedShaderCache::Read(const std::string &filename, EntryMap *entries, uint32_t *last_run) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    size_t words_left = static_cast<size_t>(file.tellg()) / sizeof(uint32_t);
+    file.seekg(0);
+
+    uint32_t header[kHeaderWords];
+    if (!ReadWords(file, header, kHeaderWords, words_left) || header[0] != kMagic || header[1] != kVersion) return false;
+    const uint64_t tools_hash = ToolsHash();
+    if (header[2] != static_cast<uint32_t>(tools_hash) || header[3] != static_cast<uint32_t>(tools_hash >> 32)) return false;
+
+    EntryMap read_entries;
+    for (uint32_t i = 0; i < header[5]; i++) {
+        uint32_t entry_header[kEntryHeaderWords];
+        if (!ReadWords(file, entry_header, kEntryHeaderWords, words_left)) return false;
+        if (static_cast<uint64_t>(entry_header[3]) + entry_header[4] + entry_header[5] > words_left) return false;
+        const uint64_t key = entry_header[0] | (static_cast<uint64_t>(entry_header[1]) << 32);
+        Entry &entry = read_entries[key];
+        entry.last_used = entry_header[2];
+        entry.original.resize(entry_header[3]);
+        entry.shader_id_offsets.resize(entry_header[4]);
+        entry.pgm.resize(entry_header[5]);
+        if (!ReadWords(file, entry.original.data(), entry.original.size(), words_left) ||
+            !ReadWords(file, entry.shader_id_offsets.data(), entry.shader_id_offsets.size(), words_left) ||
+            !ReadWords(file, entry.pgm.data(), entry.pgm.size(), words_left)) {
+            return false;
+        }
+        for (auto offset : entry.shader_id_offsets) {
+            if (offset >= entry.pgm.size()) return false;
+        }
+    }
+    *entries = std::move(read_entries);
+    *last_run = header[4];
+    return true;
+}
+
+// Written to a file of this process's own, which then replaces the cache file, so other processes never read a partial file
+inline bool UtilInstrumentedShaderCache::Write(const std::string &filename, const EntryMap &entries, uint32_t last_run) {
+    const std::string temp_filename = GetProcessTempPath(filename);
+    {
+        std::ofstream file(temp_filename, std::ios::binary | std::ios::trunc);
+        const uint64_t tools_hash = ToolsHash();
+        const uint32_t header[kHeaderWords] = {kMagic,   kVersion, static_cast<uint32_t>(tools_hash),
+                                               static_cast<uint32_t>(tools_hash >> 32), last_run,
+                                               static_cast<uint32_t>(entries.size())};
+        WriteWords(file, header, kHeaderWords);
+        for (const auto &entry : entries) {
+            const uint32_t entry_header[kEntryHeaderWords] = {static_cast<uint32_t>(entry.first),
+                                                              static_cast<uint32_t>(entry.first >> 32),
+                                                              entry.second.last_used,
+                                                              static_cast<uint32_t>(entry.second.original.size()),
+                                                              static_cast<uint32_t>(entry.second.shader_id_offsets.size()),
+                                                              static_cast<uint32_t>(entry.second.pgm.size())};
+            WriteWords(file, entry_header, kEntryHeaderWords);
+            WriteWords(file, entry.second.original.data(), entry.second.original.size());
+            WriteWords(file, entry.second.shader_id_offsets.data(), entry.second.shader_id_offsets.size());
+            WriteWords(file, entry.second.pgm.data(), entry.second.pgm.size());
+        }
+        file.flush();
+        if (!file.good()) {
+            file.close();
+            std::remove(temp_filename.c_str());
+            return false;
+        }
+    }
+    if (!RenameReplacingFile(temp_filename, filename)) {
+        std::remove(temp_filename.c_str());
+        return false;
+    }
+    return true;
+}
+
+inline void UtilInstrumentedShaderCache::Load(const std::string &filename) {
+    filename_ = filename;
+    uint32_t last_run = 0;
+    if (!Read(filename_, &entries_, &last_run)) {
+        entries_.clear();
+    }
+    run_ = last_run + 1;
+}
+
+// Drops the least recently used entries beyond kMaxWords
+inline void UtilInstrumentedShaderCache::Evict() {
+    std::vector<std::pair<uint32_t, uint64_t>> by_use;  // (last run used, key)
+    by_use.reserve(entries_.size());
+    for (const auto &entry : entries_) {
+        by_use.emplace_back(entry.second.last_used, entry.first);
+    }
+    std::sort(by_use.begin(), by_use.end(), std::greater<std::pair<uint32_t, uint64_t>>());
+    size_t words = kHeaderWords;
+    for (const auto &use : by_use) {
+        auto entry = entries_.find(use.second);
+        words += entry->second.Words();
+        if (words > kMaxWords) entries_.erase(entry);
+    }
+}
+
+inline bool UtilInstrumentedShaderCache::Save() {
+    if (!dirty_) return true;
+    // Keep what other processes saved since the file was loaded
+    EntryMap saved;
+    uint32_t saved_run = 0;
+    if (Read(filename_, &saved, &saved_run)) {
+        for (auto &entry : saved) {
+            auto found = entries_.find(entry.first);
+            if (found == entries_.end()) {
+                entries_.emplace(entry.first, std::move(entry.second));
+            } else {
+                found->second.last_used = std::max(found->second.last_used, entry.second.last_used);
+            }
+        }
+    }
+    Evict();
+    const bool written = Write(filename_, entries_, std::max(run_, saved_run));
+    dirty_ = !written;
+    return written;
+}
+
+std::string UtilInstrumentedShaderCachePath();
 VkResult UtilInitializeVma(VkPhysicalDevice physical_device, VkDevice device, VmaAllocator *pAllocator);
 void UtilPreCallRecordCreateDevice(VkPhysicalDevice gpu, safe_VkDeviceCreateInfo *modified_create_info,
                                    VkPhysicalDeviceFeatures supported_features, VkPhysicalDeviceFeatures desired_features);
@@ -68,6 +305,18 @@ void UtilPostCallRecordCreateDevice(const VkDeviceCreateInfo *pCreateInfo, std::
     }
     object_ptr->desc_set_bind_index = object_ptr->adjusted_max_desc_sets - 1;
 
+    object_ptr->deferred_processing = object_ptr->enabled[gpu_deferred_results];
+    const char *shader_cache_string = getLayerOption("khronos_validation.gpu_shader_cache");
+    if (*shader_cache_string && !strcmp(shader_cache_string, "true")) {
+        const std::string shader_cache_path = UtilInstrumentedShaderCachePath();
+        if (shader_cache_path.empty()) {
+            object_ptr->ReportSetupProblem(object_ptr->device,
+                                           "No per-user cache directory is available, so the instrumented shader cache is disabled.");
+        } else {
+            object_ptr->instrumented_shader_cache.Load(shader_cache_path);
+        }
+    }
+
     VkResult result1 = UtilInitializeVma(object_ptr->physicalDevice, object_ptr->device, &object_ptr->vmaAllocator);
     assert(result1 == VK_SUCCESS);
     std::unique_ptr<UtilDescriptorSetManager> desc_set_manager(
@@ -107,6 +356,9 @@ void UtilPostCallRecordCreateDevice(const VkDeviceCreateInfo *pCreateInfo, std::
 }
 template <typename ObjectType>
 void UtilPreCallRecordDestroyDevice(ObjectType *object_ptr) {
+    if (object_ptr->instrumented_shader_cache.IsEnabled() && !object_ptr->instrumented_shader_cache.Save()) {
+        object_ptr->ReportSetupProblem(object_ptr->device, "Unable to write the instrumented shader cache.");
+    }
     for (auto &queue_barrier_command_info_kv : object_ptr->queue_barrier_command_infos) {
         UtilQueueBarrierCommandInfo &queue_barrier_command_info = queue_barrier_command_info_kv.second;
 
@@ -118,6 +370,10 @@ void UtilPreCallRecordDestroyDevice(ObjectType *object_ptr) {
         queue_barrier_command_info.barrier_command_pool = VK_NULL_HANDLE;
     }
     object_ptr->queue_barrier_command_infos.clear();
+    for (auto fence : object_ptr->free_fences) {
+        DispatchDestroyFence(object_ptr->device, fence, NULL);
+    }
+    object_ptr->free_fences.clear();
     if (object_ptr->debug_desc_layout) {
         DispatchDestroyDescriptorSetLayout(object_ptr->device, object_ptr->debug_desc_layout, NULL);
         object_ptr->debug_desc_layout = VK_NULL_HANDLE;
@@ -348,50 +604,49 @@ void UtilCopyCreatePipelineFeedbackData(const uint32_t count, CreateInfos *pCrea
 
 template <typename ObjectType>
 // For the given command buffer, map its debug data buffers and read their contents for analysis.
-void UtilProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node, ObjectType *object_ptr) {
-    if (cb_node && (cb_node->hasDrawCmd || cb_node->hasTraceRaysCmd || cb_node->hasDispatchCmd)) {
-        auto gpu_buffer_list = object_ptr->GetBufferInfo(cb_node->commandBuffer);
-        uint32_t draw_index = 0;
-        uint32_t compute_index = 0;
-        uint32_t ray_trace_index = 0;
-
-        for (auto &buffer_info : gpu_buffer_list) {
-            char *pData;
-
-            uint32_t operation_index = 0;
-            if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-                operation_index = draw_index;
-            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
-                operation_index = compute_index;
-            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
-                operation_index = ray_trace_index;
-            } else {
-                assert(false);
-            }
+void UtilProcessInstrumentationBuffer(VkQueue queue, VkCommandBuffer command_buffer, ObjectType *object_ptr) {
+    auto &gpu_buffer_list = object_ptr->GetBufferInfo(command_buffer);
+    uint32_t draw_index = 0;
+    uint32_t compute_index = 0;
+    uint32_t ray_trace_index = 0;
+
+    for (auto &buffer_info : gpu_buffer_list) {
+        char *pData;
+
+        uint32_t operation_index = 0;
+        if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+            operation_index = draw_index;
+        } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
+            operation_index = compute_index;
+        } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
+            operation_index = ray_trace_index;
+        } else {
+            assert(false);
+        }
 
-            VkResult result = vmaMapMemory(object_ptr->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&pData);
-            if (result == VK_SUCCESS) {
-                object_ptr->AnalyzeAndGenerateMessages(cb_node->commandBuffer, queue, buffer_info.pipeline_bind_point,
-                                                       operation_index, (uint32_t *)pData);
-                vmaUnmapMemory(object_ptr->vmaAllocator, buffer_info.output_mem_block.allocation);
-            }
+        VkResult result = vmaMapMemory(object_ptr->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&pData);
+        if (result == VK_SUCCESS) {
+            object_ptr->AnalyzeAndGenerateMessages(command_buffer, queue, buffer_info.pipeline_bind_point, operation_index,
+                                                   (uint32_t *)pData);
+            vmaUnmapMemory(object_ptr->vmaAllocator, buffer_info.output_mem_block.allocation);
+        }
 
-            if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-                draw_index++;
-            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
-                compute_index++;
-            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
-                ray_trace_index++;
-            } else {
-                assert(false);
-            }
+        if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+            draw_index++;
+        } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
+            compute_index++;
+        } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
+            ray_trace_index++;
+        } else {
+            assert(false);
         }
     }
 }
 template <typename ObjectType>
 // Submit a memory barrier on graphics queues.
 // Lazy-create and record the needed command buffer.
-void UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr) {
+// If a fence is given it is signaled once the barrier, and so all earlier work on the queue, completes.
+void UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr, VkFence fence = VK_NULL_HANDLE) {
     auto queue_barrier_command_info_it = object_ptr->queue_barrier_command_infos.emplace(queue, UtilQueueBarrierCommandInfo{});
     if (queue_barrier_command_info_it.second) {
         UtilQueueBarrierCommandInfo &queue_barrier_command_info = queue_barrier_command_info_it.first->second;
@@ -456,7 +711,113 @@ void UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr) {
         submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         submit_info.commandBufferCount = 1;
         submit_info.pCommandBuffers = &queue_barrier_command_info.barrier_command_buffer;
-        DispatchQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+        DispatchQueueSubmit(queue, 1, &submit_info, fence);
+    } else if (fence != VK_NULL_HANDLE) {
+        DispatchQueueSubmit(queue, 0, nullptr, fence);
+    }
+}
+template <typename ObjectType>
+// Get an unsignaled fence to track a deferred submission, reusing one from an earlier submission when possible.
+VkFence UtilGetSubmissionFence(ObjectType *object_ptr) {
+    VkFence fence = VK_NULL_HANDLE;
+    if (!object_ptr->free_fences.empty()) {
+        fence = object_ptr->free_fences.back();
+        object_ptr->free_fences.pop_back();
+        return fence;
+    }
+    VkFenceCreateInfo fence_create_info = {};
+    fence_create_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    VkResult result = DispatchCreateFence(object_ptr->device, &fence_create_info, nullptr, &fence);
+    if (result != VK_SUCCESS) {
+        object_ptr->ReportSetupProblem(object_ptr->device, "Unable to create fence for deferred result processing.");
+        return VK_NULL_HANDLE;
+    }
+    return fence;
+}
+template <typename ObjectType>
+// Read back the output of a completed submission and recycle its fence.
+void UtilRetireSubmission(ObjectType *object_ptr, const UtilInFlightSubmission &submission) {
+    for (auto command_buffer : submission.command_buffers) {
+        object_ptr->ProcessCommandBufferOutput(submission.queue, command_buffer);
+    }
+    DispatchResetFences(object_ptr->device, 1, &submission.fence);
+    object_ptr->free_fences.push_back(submission.fence);
+}
+template <typename ObjectType>
+// Analyze the output of every in-flight submission that has completed.
+// With wait set, block until all of them complete.
+void UtilProcessCompletedSubmissions(ObjectType *object_ptr, bool wait) {
+    auto &submissions = object_ptr->in_flight_submissions;
+    for (auto it = submissions.begin(); it != submissions.end();) {
+        if (wait) {
+            DispatchWaitForFences(object_ptr->device, 1, &it->fence, VK_TRUE, UINT64_MAX);
+        } else if (DispatchGetFenceStatus(object_ptr->device, it->fence) != VK_SUCCESS) {
+            ++it;
+            continue;
+        }
+        UtilRetireSubmission(object_ptr, *it);
+        it = submissions.erase(it);
+    }
+}
+template <typename ObjectType>
+// Analyze the output of any in-flight submission of the command buffer before its debug buffers are reused or destroyed.
+// Called from record hooks, which hold the object's write lock. The lock is released while waiting for the fences, s.t. other
+// threads aren't stalled by a slow submission. The submissions are taken off the in-flight list first, so that no other
+// thread retires them or recycles their fences in the meantime.
+void UtilWaitForCommandBuffer(ObjectType *object_ptr, VkCommandBuffer command_buffer) {
+    std::vector<UtilInFlightSubmission> waited;
+    std::vector<VkFence> fences;
+    auto &submissions = object_ptr->in_flight_submissions;
+    for (auto it = submissions.begin(); it != submissions.end();) {
+        if (std::find(it->command_buffers.begin(), it->command_buffers.end(), command_buffer) == it->command_buffers.end()) {
+            ++it;
+            continue;
+        }
+        fences.push_back(it->fence);
+        waited.emplace_back(std::move(*it));
+        it = submissions.erase(it);
+    }
+    if (waited.empty()) return;
+
+    object_ptr->validation_object_mutex.unlock();
+    DispatchWaitForFences(object_ptr->device, static_cast<uint32_t>(fences.size()), fences.data(), VK_TRUE, UINT64_MAX);
+    object_ptr->validation_object_mutex.lock();
+    for (const auto &submission : waited) {
+        UtilRetireSubmission(object_ptr, submission);
+    }
+}
+template <typename ObjectType>
+// Make GPU-written data available to the host and analyze it for every command buffer in the submission.
+// By default this waits for the queue to go idle. In deferred mode a layer-owned fence is attached instead and the
+// output is analyzed at the next fence wait, queue or device idle, or present that finds the fence signaled.
+void UtilProcessSubmission(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, ObjectType *object_ptr) {
+    std::vector<VkCommandBuffer> command_buffers;
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        const VkSubmitInfo *submit = &pSubmits[submit_idx];
+        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
+            auto cb_node = object_ptr->GetCBState(submit->pCommandBuffers[i]);
+            command_buffers.push_back(cb_node->commandBuffer);
+            for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
+                command_buffers.push_back(secondaryCmdBuffer->commandBuffer);
+            }
+        }
+    }
+
+    if (object_ptr->deferred_processing) {
+        VkFence fence = UtilGetSubmissionFence(object_ptr);
+        if (fence != VK_NULL_HANDLE) {
+            UtilSubmitBarrier(queue, object_ptr, fence);
+            object_ptr->in_flight_submissions.push_back({queue, fence, std::move(command_buffers)});
+            return;
+        }
+    }
+
+    UtilSubmitBarrier(queue, object_ptr);
+
+    DispatchQueueWaitIdle(queue);
+
+    for (auto command_buffer : command_buffers) {
+        object_ptr->ProcessCommandBufferOutput(queue, command_buffer);
     }
 }
 void UtilGenerateStageMessage(const uint32_t *debug_record, std::string &msg);
@@ -306,6 +306,7 @@ void GpuAssisted::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, c
 
 // Clean up device-related resources
 void GpuAssisted::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    UtilProcessCompletedSubmissions(this, true);
     DestroyAccelerationStructureBuildValidationState();
     UtilPreCallRecordDestroyDevice(this);
     ValidationStateTracker::PreCallRecordDestroyDevice(device, pAllocator);
@@ -765,7 +766,7 @@ void GpuAssisted::PreCallRecordCmdBuildAccelerationStructureNV(VkCommandBuffer c
     assert(cb_state != nullptr);
 
     std::vector<uint64_t> current_valid_handles;
-    for (const auto &as_state_kv : accelerationStructureMap) {
+    for (const auto &as_state_kv : accelerationStructureMap.snapshot()) {
         const ACCELERATION_STRUCTURE_STATE &as_state = *as_state_kv.second;
         if (as_state.built && as_state.create_infoNV.info.type == VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_NV) {
             current_valid_handles.push_back(as_state.opaque_handle);
@@ -910,14 +911,14 @@ void GpuAssisted::PreCallRecordCmdBuildAccelerationStructureNV(VkCommandBuffer c
     as_validation_state.validation_buffers[commandBuffer].push_back(std::move(as_validation_buffer_info));
 }
 
-void GpuAssisted::ProcessAccelerationStructureBuildValidationBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node) {
-    if (cb_node == nullptr || !cb_node->hasBuildAccelerationStructureCmd) {
+void GpuAssisted::ProcessAccelerationStructureBuildValidationBuffer(VkQueue queue, VkCommandBuffer command_buffer) {
+    auto &as_validation_info = acceleration_structure_validation_state;
+    auto as_validation_buffers = as_validation_info.validation_buffers.find(command_buffer);
+    if (as_validation_buffers == as_validation_info.validation_buffers.end()) {
         return;
     }
 
-    auto &as_validation_info = acceleration_structure_validation_state;
-    auto &as_validation_buffer_infos = as_validation_info.validation_buffers[cb_node->commandBuffer];
-    for (const auto &as_validation_buffer_info : as_validation_buffer_infos) {
+    for (const auto &as_validation_buffer_info : as_validation_buffers->second) {
         GpuAccelerationStructureBuildValidationBuffer *mapped_validation_buffer = nullptr;
 
         VkResult result =
@@ -990,6 +991,7 @@ void GpuAssisted::ResetCommandBuffer(VkCommandBuffer commandBuffer) {
     if (aborted) {
         return;
     }
+    UtilWaitForCommandBuffer(this, commandBuffer);
     auto gpuav_buffer_list = GetBufferInfo(commandBuffer);
     for (auto buffer_info : gpuav_buffer_list) {
         vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
@@ -1184,8 +1186,31 @@ bool GpuAssisted::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
         }
     };
 
-    // Load original shader SPIR-V
     uint32_t num_words = static_cast<uint32_t>(pCreateInfo->codeSize / 4);
+    using namespace spvtools;
+    spv_target_env target_env = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
+    const bool buffer_address_checks =
+        (device_extensions.vk_ext_buffer_device_address || device_extensions.vk_khr_buffer_device_address) && shaderInt64 &&
+        enabled_features.core12.bufferDeviceAddress;
+
+    // Reuse the module instrumented by an earlier run if the code and instrumentation settings are the same.
+    // Otherwise instrument with the cache's placeholder shader ID so the result can be cached.
+    uint32_t instrumentation_shader_id = unique_shader_module_id;
+    uint64_t cache_key = 0;
+    bool cache_result = false;
+    if (instrumented_shader_cache.IsEnabled() && !UtilInstrumentedShaderCache::UsesPlaceholder(pCreateInfo->pCode, num_words)) {
+        const uint32_t settings[] = {static_cast<uint32_t>(container_type), desc_set_bind_index,
+                                     static_cast<uint32_t>(target_env), descriptor_indexing, buffer_address_checks};
+        cache_key = UtilInstrumentedShaderCache::MakeKey(pCreateInfo->pCode, pCreateInfo->codeSize, settings, sizeof(settings));
+        if (instrumented_shader_cache.Get(cache_key, pCreateInfo->pCode, num_words, unique_shader_module_id, new_pgm)) {
+            *unique_shader_id = unique_shader_module_id++;
+            return true;
+        }
+        instrumentation_shader_id = UtilInstrumentedShaderCache::kShaderIdPlaceholder;
+        cache_result = true;
+    }
+
+    // Load original shader SPIR-V
     new_pgm.clear();
     new_pgm.reserve(num_words);
     new_pgm.insert(new_pgm.end(), &pCreateInfo->pCode[0], &pCreateInfo->pCode[num_words]);
@@ -1193,21 +1218,19 @@ bool GpuAssisted::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
     // Call the optimizer to instrument the shader.
     // Use the unique_shader_module_id as a shader ID so we can look up its handle later in the shader_map.
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
-    using namespace spvtools;
-    spv_target_env target_env = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
     spvtools::ValidatorOptions options;
     AdjustValidatorOptions(device_extensions, enabled_features, options);
     Optimizer optimizer(target_env);
     optimizer.SetMessageConsumer(GpuConsoleMessageConsumer);
     optimizer.RegisterPass(
-        CreateInstBindlessCheckPass(desc_set_bind_index, unique_shader_module_id, descriptor_indexing, descriptor_indexing));
+        CreateInstBindlessCheckPass(desc_set_bind_index, instrumentation_shader_id, descriptor_indexing, descriptor_indexing));
     optimizer.RegisterPass(CreateAggressiveDCEPass());
-    if ((device_extensions.vk_ext_buffer_device_address || device_extensions.vk_khr_buffer_device_address) && shaderInt64 &&
-        enabled_features.core12.bufferDeviceAddress)
-        optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, unique_shader_module_id));
+    if (buffer_address_checks) optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, instrumentation_shader_id));
     bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm, options, false);
     if (!pass) {
         ReportSetupProblem(device, "Failure to instrument shader.  Proceeding with non-instrumented shader.");
+    } else if (cache_result) {
+        instrumented_shader_cache.Put(cache_key, pCreateInfo->pCode, num_words, unique_shader_module_id, new_pgm);
     }
     *unique_shader_id = unique_shader_module_id++;
     return pass;
@@ -1331,8 +1354,11 @@ void GpuAssisted::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
             auto cb_node = GetCBState(submit->pCommandBuffers[i]);
+            // A simultaneous-use command buffer may still be in flight from an earlier deferred submission
+            UtilWaitForCommandBuffer(this, cb_node->commandBuffer);
             UpdateInstrumentationBuffer(cb_node);
             for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
+                UtilWaitForCommandBuffer(this, secondaryCmdBuffer->commandBuffer);
                 UpdateInstrumentationBuffer(secondaryCmdBuffer);
             }
         }
@@ -1340,7 +1366,7 @@ void GpuAssisted::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
 }
 
 // Issue a memory barrier to make GPU-written data available to host.
-// Wait for the queue to complete execution.
+// Wait for the queue to complete execution, or in deferred mode track the submission with a fence.
 // Check the debug buffers for all the command buffers that were submitted.
 void GpuAssisted::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                             VkResult result) {
@@ -1362,22 +1388,39 @@ void GpuAssisted::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
     }
     if (!buffers_present) return;
 
-    UtilSubmitBarrier(queue, this);
+    UtilProcessSubmission(queue, submitCount, pSubmits, this);
+}
 
-    DispatchQueueWaitIdle(queue);
+void GpuAssisted::ProcessCommandBufferOutput(VkQueue queue, VkCommandBuffer command_buffer) {
+    UtilProcessInstrumentationBuffer(queue, command_buffer, this);
+    ProcessAccelerationStructureBuildValidationBuffer(queue, command_buffer);
+}
 
-    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
-        const VkSubmitInfo *submit = &pSubmits[submit_idx];
-        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
-            auto cb_node = GetCBState(submit->pCommandBuffers[i]);
-            UtilProcessInstrumentationBuffer(queue, cb_node, this);
-            ProcessAccelerationStructureBuildValidationBuffer(queue, cb_node);
-            for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
-                UtilProcessInstrumentationBuffer(queue, secondaryCmdBuffer, this);
-                ProcessAccelerationStructureBuildValidationBuffer(queue, cb_node);
-            }
-        }
-    }
+// In deferred mode, check the output of submissions whose fences the application has seen signaled.
+void GpuAssisted::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    ValidationStateTracker::PostCallRecordQueueWaitIdle(queue, result);
+    UtilProcessCompletedSubmissions(this, false);
+}
+
+void GpuAssisted::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    ValidationStateTracker::PostCallRecordDeviceWaitIdle(device, result);
+    UtilProcessCompletedSubmissions(this, false);
+}
+
+void GpuAssisted::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                              uint64_t timeout, VkResult result) {
+    ValidationStateTracker::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
+    UtilProcessCompletedSubmissions(this, false);
+}
+
+void GpuAssisted::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    ValidationStateTracker::PostCallRecordGetFenceStatus(device, fence, result);
+    UtilProcessCompletedSubmissions(this, false);
+}
+
+void GpuAssisted::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo, VkResult result) {
+    ValidationStateTracker::PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
+    UtilProcessCompletedSubmissions(this, false);
 }
 
 void GpuAssisted::PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
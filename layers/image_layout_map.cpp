@@ -61,12 +61,12 @@ bool ImageSubresourceLayoutMap::SubresourceLayout::operator==(const ImageSubreso
         (current_layout == rhs.current_layout) && (initial_layout == rhs.initial_layout) && (subresource == rhs.subresource);
     return is_equal;
 }
-ImageSubresourceLayoutMap::ImageSubresourceLayoutMap(const IMAGE_STATE& image_state)
+ImageSubresourceLayoutMap::ImageSubresourceLayoutMap(const IMAGE_STATE& image_state, sparse_container::node_pool* pool)
     : image_state_(image_state),
       encoder_(image_state.subresource_encoder),
-      layouts_(encoder_.SubresourceCount()),
+      layouts_(encoder_.SubresourceCount(), pool),
       initial_layout_states_(),
-      initial_layout_state_map_(encoder_.SubresourceCount()) {}
+      initial_layout_state_map_(encoder_.SubresourceCount(), pool) {}
 
 ImageSubresourceLayoutMap::ConstIterator ImageSubresourceLayoutMap::Begin(bool always_get_initial) const {
     return Find(image_state_.full_range, /* skip_invalid */ true, always_get_initial);
@@ -165,14 +165,15 @@ class ImageSubresourceLayoutMap {
     uintptr_t CompatibilityKey() const;
     const InitialLayoutMap& GetInitialLayoutMap() const { return layouts_.initial; }
     const LayoutMap& GetCurrentLayoutMap() const { return layouts_.current; }
-    ImageSubresourceLayoutMap(const IMAGE_STATE& image_state);
+    ImageSubresourceLayoutMap(const IMAGE_STATE& image_state, sparse_container::node_pool* pool = nullptr);
     ~ImageSubresourceLayoutMap() {}
     const IMAGE_STATE* GetImageView() const { return &image_state_; };
 
     struct LayoutMaps {
         LayoutMap current;
         InitialLayoutMap initial;
-        LayoutMaps(typename LayoutMap::index_type size) : current(size), initial(size) {}
+        LayoutMaps(typename LayoutMap::index_type size, sparse_container::node_pool* pool)
+            : current(size, pool), initial(size, pool) {}
     };
 
   protected:
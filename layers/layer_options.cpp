@@ -41,6 +41,9 @@ void SetValidationDisable(CHECK_DISABLED &disable_data, const ValidationCheckDis
         case VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION:
             disable_data[image_layout_validation] = true;
             break;
+        case VALIDATION_CHECK_DISABLE_SHADER_VALIDATION_CACHE:
+            disable_data[shader_validation_caching] = true;
+            break;
         default:
             assert(true);
     }
@@ -85,6 +88,27 @@ void SetValidationEnable(CHECK_ENABLED &enable_data, const ValidationCheckEnable
         case VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL:
             enable_data[vendor_specific_arm] = true;
             break;
+        case VALIDATION_CHECK_ENABLE_CMD_BUFFER_LOCAL_LOCKING:
+            enable_data[cmd_buffer_local_locking] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_PARALLEL_PIPELINE_VALIDATION:
+            enable_data[parallel_pipeline_validation] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_LAZY_SHADER_MODULES:
+            enable_data[lazy_shader_modules] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_LAZY_DESCRIPTOR_BINDING:
+            enable_data[lazy_descriptor_binding] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_PARALLEL_IMAGE_LAYOUT_VALIDATION:
+            enable_data[parallel_image_layout_validation] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_GPU_DEFERRED_RESULTS:
+            enable_data[gpu_deferred_results] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_SHADER_MODULE_STATS:
+            enable_data[shader_module_stats] = true;
+            break;
         default:
             assert(true);
     }
@@ -308,6 +332,8 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                 CreateFilterMessageIdList(data, ",", settings_data->message_filter_list);
             } else if (name == "duplicate_message_limit") {
                 *settings_data->duplicate_message_limit = cur_setting.data.value32;
+            } else if (name == "async_message_delivery") {
+                *settings_data->async_message_delivery = (cur_setting.data.valueBool == VK_TRUE);
             } else if (name == "custom_stype_list") {
                 if (cur_setting.type == VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT) {
                     std::string data(cur_setting.data.arrayString.pCharArray);
@@ -344,11 +370,13 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     std::string stypes_key(settings_data->layer_description);
     std::string filter_msg_key(settings_data->layer_description);
     std::string message_limit(settings_data->layer_description);
+    std::string async_delivery_key(settings_data->layer_description);
     enable_key.append(".enables");
     disable_key.append(".disables");
     stypes_key.append(".custom_stype_list");
     filter_msg_key.append(".message_id_filter");
     message_limit.append(".duplicate_message_limit");
+    async_delivery_key.append(".async_message_delivery");
     std::string list_of_config_enables = getLayerOption(enable_key.c_str());
     std::string list_of_env_enables = GetLayerEnvVar("VK_LAYER_ENABLES");
     std::string list_of_config_disables = getLayerOption(disable_key.c_str());
@@ -359,6 +387,8 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     std::string list_of_env_stypes = GetLayerEnvVar("VK_LAYER_CUSTOM_STYPE_LIST");
     std::string config_message_limit = getLayerOption(message_limit.c_str());
     std::string env_message_limit = GetLayerEnvVar("VK_LAYER_DUPLICATE_MESSAGE_LIMIT");
+    std::string config_async_delivery = getLayerOption(async_delivery_key.c_str());
+    std::string env_async_delivery = GetLayerEnvVar("VK_LAYER_ASYNC_MESSAGE_DELIVERY");
 
 #if defined(_WIN32)
     std::string env_delimiter = ";";
@@ -381,4 +411,9 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     if (config_limit_setting != 0) {
         *settings_data->duplicate_message_limit = config_limit_setting;
     }
+    // Process async message delivery, ENV var takes precedence over settings file
+    const std::string &async_delivery = env_async_delivery.empty() ? config_async_delivery : env_async_delivery;
+    if (!async_delivery.empty()) {
+        *settings_data->async_message_delivery = (async_delivery == "true") || (async_delivery == "1");
+    }
 }
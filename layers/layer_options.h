@@ -31,6 +31,7 @@ typedef struct {
     CHECK_DISABLED &disables;
     std::vector<uint32_t> &message_filter_list;
     int32_t *duplicate_message_limit;
+    bool *async_message_delivery;
 } ConfigAndEnvSettings;
 
 static const std::unordered_map<std::string, VkValidationFeatureDisableEXT> VkValFeatureDisableLookup = {
@@ -63,11 +64,19 @@ static const std::unordered_map<std::string, ValidationCheckDisables> Validation
     {"VALIDATION_CHECK_DISABLE_PUSH_CONSTANT_RANGE", VALIDATION_CHECK_DISABLE_PUSH_CONSTANT_RANGE},
     {"VALIDATION_CHECK_DISABLE_QUERY_VALIDATION", VALIDATION_CHECK_DISABLE_QUERY_VALIDATION},
     {"VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION", VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION},
+    {"VALIDATION_CHECK_DISABLE_SHADER_VALIDATION_CACHE", VALIDATION_CHECK_DISABLE_SHADER_VALIDATION_CACHE},
 };
 
 static const std::unordered_map<std::string, ValidationCheckEnables> ValidationEnableLookup = {
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM},
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL},
+    {"VALIDATION_CHECK_ENABLE_CMD_BUFFER_LOCAL_LOCKING", VALIDATION_CHECK_ENABLE_CMD_BUFFER_LOCAL_LOCKING},
+    {"VALIDATION_CHECK_ENABLE_PARALLEL_PIPELINE_VALIDATION", VALIDATION_CHECK_ENABLE_PARALLEL_PIPELINE_VALIDATION},
+    {"VALIDATION_CHECK_ENABLE_LAZY_SHADER_MODULES", VALIDATION_CHECK_ENABLE_LAZY_SHADER_MODULES},
+    {"VALIDATION_CHECK_ENABLE_LAZY_DESCRIPTOR_BINDING", VALIDATION_CHECK_ENABLE_LAZY_DESCRIPTOR_BINDING},
+    {"VALIDATION_CHECK_ENABLE_PARALLEL_IMAGE_LAYOUT_VALIDATION", VALIDATION_CHECK_ENABLE_PARALLEL_IMAGE_LAYOUT_VALIDATION},
+    {"VALIDATION_CHECK_ENABLE_GPU_DEFERRED_RESULTS", VALIDATION_CHECK_ENABLE_GPU_DEFERRED_RESULTS},
+    {"VALIDATION_CHECK_ENABLE_SHADER_MODULE_STATS", VALIDATION_CHECK_ENABLE_SHADER_MODULE_STATS},
 };
 
 // This should mirror the 'DisableFlags' enumerated type
@@ -83,7 +92,8 @@ static const std::vector<std::string> DisableFlagNameHelper = {
     "VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT",     // thread_safety,
     "VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT",    // stateless_checks,
     "VK_VALIDATION_FEATURE_DISABLE_UNIQUE_HANDLES_EXT",    // handle_wrapping,
-    "VK_VALIDATION_FEATURE_DISABLE_SHADERS_EXT"            // shader_validation,
+    "VK_VALIDATION_FEATURE_DISABLE_SHADERS_EXT",           // shader_validation,
+    "VALIDATION_CHECK_DISABLE_SHADER_VALIDATION_CACHE"     // shader_validation_caching,
 };
 
 // This should mirror the 'EnableFlags' enumerated type
@@ -93,7 +103,14 @@ static const std::vector<std::string> EnableFlagNameHelper = {
     "VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT",                     // best_practices,
     "VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM",                         // vendor_specific_arm,
     "VK_VALIDATION_FEATURE_ENABLE_DEBUG_PRINTF_EXT",                       // debug_printf,
-    "VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION"              // sync_validation,
+    "VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION",             // sync_validation,
+    "VALIDATION_CHECK_ENABLE_CMD_BUFFER_LOCAL_LOCKING",                    // cmd_buffer_local_locking,
+    "VALIDATION_CHECK_ENABLE_PARALLEL_PIPELINE_VALIDATION",                // parallel_pipeline_validation,
+    "VALIDATION_CHECK_ENABLE_LAZY_SHADER_MODULES",                         // lazy_shader_modules,
+    "VALIDATION_CHECK_ENABLE_LAZY_DESCRIPTOR_BINDING",                     // lazy_descriptor_binding,
+    "VALIDATION_CHECK_ENABLE_PARALLEL_IMAGE_LAYOUT_VALIDATION",            // parallel_image_layout_validation,
+    "VALIDATION_CHECK_ENABLE_GPU_DEFERRED_RESULTS",                        // gpu_deferred_results,
+    "VALIDATION_CHECK_ENABLE_SHADER_MODULE_STATS"                          // shader_module_stats,
 };
 
 void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data);
@@ -27,7 +27,11 @@
 #include <cassert>
 #include <limits>
 #include <map>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <cstdint>
 
 #define RANGE_ASSERT(b) assert(b)
@@ -170,6 +174,152 @@ struct split_op_keep_upper {
 
 enum class value_precedence { prefer_source, prefer_dest };
 
+// Pool of small, fixed size allocations for the nodes of node based containers (e.g. the std::map underlying range_map)
+//
+// Nodes are carved from large blocks and binned by size, freed nodes are kept on a per size free list for reuse.  reset()
+// (once all nodes are returned) rewinds the pool to its first block, and destruction releases all blocks at once, rather
+// than a free per node.  Allocations too large to bin fall through to the global operator new.
+// Not thread safe, the pool is intended to be owned by an externally synchronized object (e.g. a command buffer).
+class node_pool {
+  public:
+    static constexpr size_t kGranularity = 16;  // Also the alignment guaranteed for pooled nodes
+    static constexpr size_t kMaxNodeSize = 512;
+    static constexpr size_t kBlockSize = 64 * 1024;
+
+    node_pool() : current_block_(0), block_pos_(nullptr), block_end_(nullptr), live_count_(0) {
+        for (auto &free_list : free_lists_) {
+            free_list = nullptr;
+        }
+    }
+    node_pool(const node_pool &) = delete;
+    node_pool &operator=(const node_pool &) = delete;
+
+    void *allocate(size_t size) {
+        if (size > kMaxNodeSize) return ::operator new(size);
+        const size_t bin = BinIndex(size);
+        live_count_++;
+        FreeNode *&free_list = free_lists_[bin];
+        if (free_list) {
+            FreeNode *node = free_list;
+            free_list = node->next;
+            return node;
+        }
+        const size_t node_size = (bin + 1) * kGranularity;
+        if (static_cast<size_t>(block_end_ - block_pos_) < node_size) {
+            NextBlock();
+        }
+        void *node = block_pos_;
+        block_pos_ += node_size;
+        return node;
+    }
+
+    void deallocate(void *ptr, size_t size) {
+        if (size > kMaxNodeSize) {
+            ::operator delete(ptr);
+            return;
+        }
+        assert(live_count_ > 0);
+        live_count_--;
+        FreeNode *node = static_cast<FreeNode *>(ptr);
+        FreeNode *&free_list = free_lists_[BinIndex(size)];
+        node->next = free_list;
+        free_list = node;
+    }
+
+    // Discard the free lists and all but the first block, s.t. subsequent allocations are again contiguous.
+    void reset() {
+        assert(live_count_ == 0);
+        for (auto &free_list : free_lists_) {
+            free_list = nullptr;
+        }
+        if (blocks_.size() > 1) {
+            blocks_.resize(1);
+        }
+        current_block_ = 0;
+        if (blocks_.empty()) {
+            block_pos_ = block_end_ = nullptr;
+        } else {
+            block_pos_ = blocks_[0].get();
+            block_end_ = block_pos_ + kBlockSize;
+        }
+    }
+
+    size_t live_count() const { return live_count_; }
+    size_t block_count() const { return blocks_.size(); }
+
+  private:
+    struct FreeNode {
+        FreeNode *next;
+    };
+    static constexpr size_t kBinCount = kMaxNodeSize / kGranularity;
+    static size_t BinIndex(size_t size) { return (size > 0) ? (size - 1) / kGranularity : 0; }
+
+    void NextBlock() {
+        // The tail of the current block is abandoned, which for kMaxNodeSize << kBlockSize is negligible
+        current_block_ = blocks_.empty() ? 0 : current_block_ + 1;
+        if (current_block_ == blocks_.size()) {
+            blocks_.emplace_back(new char[kBlockSize]);
+        }
+        block_pos_ = blocks_[current_block_].get();
+        block_end_ = block_pos_ + kBlockSize;
+    }
+
+    FreeNode *free_lists_[kBinCount];
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    size_t current_block_;
+    char *block_pos_;
+    char *block_end_;
+    size_t live_count_;
+};
+
+// Allocator for node based containers drawing from a node_pool, or the global heap when constructed without one.
+//
+// Copies of a container (e.g. a snapshot of an access context) are detached from the pool, s.t. the lifespan of a pooled
+// container never exceeds that of the pool's owner.  Moves and swaps carry the pool with the contents.
+template <typename T>
+class node_pool_allocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    node_pool_allocator() : pool_(nullptr) {}
+    explicit node_pool_allocator(node_pool *pool) : pool_(pool) {}
+    template <typename U>
+    node_pool_allocator(const node_pool_allocator<U> &other) : pool_(other.pool()) {}
+
+    T *allocate(size_t n) {
+        static_assert(alignof(T) <= node_pool::kGranularity, "Pooled nodes cannot be over-aligned");
+        if (pool_ && (n == 1)) {
+            return static_cast<T *>(pool_->allocate(sizeof(T)));
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T *ptr, size_t n) {
+        if (pool_ && (n == 1)) {
+            pool_->deallocate(ptr, sizeof(T));
+        } else {
+            ::operator delete(ptr);
+        }
+    }
+
+    node_pool_allocator select_on_container_copy_construction() const { return node_pool_allocator(); }
+    node_pool *pool() const { return pool_; }
+
+  private:
+    node_pool *pool_;
+};
+
+template <typename T, typename U>
+bool operator==(const node_pool_allocator<T> &lhs, const node_pool_allocator<U> &rhs) {
+    return lhs.pool() == rhs.pool();
+}
+template <typename T, typename U>
+bool operator!=(const node_pool_allocator<T> &lhs, const node_pool_allocator<U> &rhs) {
+    return lhs.pool() != rhs.pool();
+}
+
 // The range based sparse map implemented on the ImplMap
 template <typename Key, typename T, typename RangeKey = range<Key>, typename ImplMap = std::map<RangeKey, T>>
 class range_map {
@@ -185,6 +335,10 @@ class range_map {
     using value_type = typename ImplMap::value_type;
     using key_type = typename ImplMap::key_type;
     using index_type = typename key_type::index_type;
+    using allocator_type = typename ImplMap::allocator_type;
+
+    range_map() = default;
+    explicit range_map(const allocator_type &allocator) : impl_map_(allocator) {}
 
   protected:
     template <typename ThisType>
@@ -664,12 +818,18 @@ class range_map {
 
     bool empty() const { return impl_map_.empty(); }
     size_t size() const { return impl_map_.size(); }
+    allocator_type get_allocator() const { return impl_map_.get_allocator(); }
 
     // For configuration/debug use // Use with caution...
     ImplMap &get_implementation_map() { return impl_map_; }
     const ImplMap &get_implementation_map() const { return impl_map_; }
 };
 
+// range_map with its nodes allocated from a node_pool (when constructed with a pool)
+template <typename Key, typename T, typename RangeKey = range<Key>>
+using pooled_range_map =
+    range_map<Key, T, RangeKey, std::map<RangeKey, T, std::less<RangeKey>, node_pool_allocator<std::pair<const RangeKey, T>>>>;
+
 template <typename Container>
 using const_correct_iterator = decltype(std::declval<Container>().begin());
 
@@ -1752,7 +1912,9 @@ bool update_range_value(Map &map, const Range &range, MapValue &&value, value_pr
     while (range.includes(pos->index)) {
         if (!pos->valid) {
             if (precedence == value_precedence::prefer_source) {
-                // We can convert this into and overwrite...
+                // We can convert this into and overwrite... but only from the lower bound of the whole range, as pos may have
+                // skipped past leading entries that already held value.
+                pos.seek(range.begin);
                 map.overwrite_range(pos->lower_bound, std::make_pair(range, std::forward<MapValue>(value)));
                 return true;
             }
@@ -0,0 +1,264 @@
+/* Copyright (c) 2015-2020 The Khronos Group Inc.
+ * Copyright (c) 2015-2020 Valve Corporation
+ * Copyright (c) 2015-2020 LunarG, Inc.
+ * Copyright (C) 2015-2020 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author: Chris Forbes <chrisf@ijw.co.nz>
+ * Author: Dave Houlton <daveh@lunarg.com>
+ */
+
+#include "shader_validation.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include <spirv/unified1/spirv.hpp>
+
+void decoration_set::add(uint32_t decoration, uint32_t value) {
+    switch (decoration) {
+        case spv::DecorationLocation:
+            flags |= location_bit;
+            location = value;
+            break;
+        case spv::DecorationPatch:
+            flags |= patch_bit;
+            break;
+        case spv::DecorationRelaxedPrecision:
+            flags |= relaxed_precision_bit;
+            break;
+        case spv::DecorationBlock:
+            flags |= block_bit;
+            break;
+        case spv::DecorationBufferBlock:
+            flags |= buffer_block_bit;
+            break;
+        case spv::DecorationComponent:
+            flags |= component_bit;
+            component = value;
+            break;
+        case spv::DecorationInputAttachmentIndex:
+            flags |= input_attachment_index_bit;
+            input_attachment_index = value;
+            break;
+        case spv::DecorationDescriptorSet:
+            flags |= descriptor_set_bit;
+            descriptor_set = value;
+            break;
+        case spv::DecorationBinding:
+            flags |= binding_bit;
+            binding = value;
+            break;
+        case spv::DecorationNonWritable:
+            flags |= nonwritable_bit;
+            break;
+        case spv::DecorationBuiltIn:
+            flags |= builtin_bit;
+            builtin = value;
+            break;
+    }
+}
+
+// The SPIR-V universal limits keep every <id> below this, which also caps what a corrupt Bound can make us allocate
+static const uint32_t kMaxSpirvIdBound = 0x3FFFFF;
+
+decoration_set *SHADER_MODULE_STATE::mutable_decorations(uint32_t id) {
+    if (id >= decoration_index.size()) return nullptr;
+    if (!decoration_index[id]) {
+        decorations.emplace_back();
+        decoration_index[id] = static_cast<uint32_t>(decorations.size());
+    }
+    return &decorations[decoration_index[id] - 1];
+}
+
+int64_t SHADER_MODULE_STATE::EnsureParsed() const {
+    if (parsed.load(std::memory_order_acquire)) return 0;
+    std::lock_guard<std::mutex> guard(parse_lock);
+    if (parsed.load(std::memory_order_relaxed)) return 0;
+
+    // Lazy modules are only ever created non-const by the state tracker, so finishing their construction here is sound
+    auto self = const_cast<SHADER_MODULE_STATE *>(this);
+    const int64_t raw_footprint = static_cast<int64_t>(memory_footprint());
+    self->words = self->PreprocessShaderBinary(self->words.data(), words.size() * sizeof(uint32_t), spirv_env);
+    self->BuildDefIndex();
+    parsed.store(true, std::memory_order_release);
+    return static_cast<int64_t>(memory_footprint()) - raw_footprint;
+}
+
+void SHADER_MODULE_STATE::BuildDefIndex() {
+    const uint32_t bound = words.size() > 3 ? std::min(words[3], kMaxSpirvIdBound) : 0;
+    def_index.assign(bound, 0);
+    decoration_index.assign(bound, 0);
+    auto set_def = [this](uint32_t id, uint32_t offset) {
+        if (id < def_index.size()) def_index[id] = offset;
+    };
+
+    for (auto insn : *this) {
+        switch (insn.opcode()) {
+            // Types
+            case spv::OpTypeVoid:
+            case spv::OpTypeBool:
+            case spv::OpTypeInt:
+            case spv::OpTypeFloat:
+            case spv::OpTypeVector:
+            case spv::OpTypeMatrix:
+            case spv::OpTypeImage:
+            case spv::OpTypeSampler:
+            case spv::OpTypeSampledImage:
+            case spv::OpTypeArray:
+            case spv::OpTypeRuntimeArray:
+            case spv::OpTypeStruct:
+            case spv::OpTypeOpaque:
+            case spv::OpTypePointer:
+            case spv::OpTypeFunction:
+            case spv::OpTypeEvent:
+            case spv::OpTypeDeviceEvent:
+            case spv::OpTypeReserveId:
+            case spv::OpTypeQueue:
+            case spv::OpTypePipe:
+            case spv::OpTypeAccelerationStructureNV:
+            case spv::OpTypeCooperativeMatrixNV:
+                set_def(insn.word(1), insn.offset());
+                break;
+
+                // Fixed constants
+            case spv::OpConstantTrue:
+            case spv::OpConstantFalse:
+            case spv::OpConstant:
+            case spv::OpConstantComposite:
+            case spv::OpConstantSampler:
+            case spv::OpConstantNull:
+                set_def(insn.word(2), insn.offset());
+                break;
+
+                // Specialization constants
+            case spv::OpSpecConstantTrue:
+            case spv::OpSpecConstantFalse:
+            case spv::OpSpecConstant:
+            case spv::OpSpecConstantComposite:
+            case spv::OpSpecConstantOp:
+                set_def(insn.word(2), insn.offset());
+                break;
+
+                // Variables
+            case spv::OpVariable:
+                set_def(insn.word(2), insn.offset());
+                break;
+
+                // Functions
+            case spv::OpFunction:
+                set_def(insn.word(2), insn.offset());
+                break;
+
+                // Decorations
+            case spv::OpDecorate: {
+                auto target = mutable_decorations(insn.word(1));
+                if (target) target->add(insn.word(2), insn.len() > 3u ? insn.word(3) : 0u);
+            } break;
+            case spv::OpGroupDecorate: {
+                // Copy, as adding decorations for the targets can move the group's
+                auto const src = get_decorations(insn.word(1));
+                for (auto i = 2u; i < insn.len(); i++) {
+                    auto target = mutable_decorations(insn.word(i));
+                    if (target) target->merge(src);
+                }
+            } break;
+
+                // Entry points ... add to the entrypoint table
+            case spv::OpEntryPoint: {
+                // Entry points do not have an id (the id is the function id) and thus need their own table
+                auto entrypoint_name = (char const *)&insn.word(3);
+                auto execution_model = insn.word(1);
+                auto entrypoint_stage = ExecutionModelToShaderStageFlagBits(execution_model);
+                entry_points.emplace(entrypoint_name, EntryPoint{insn.offset(), entrypoint_stage});
+                break;
+            }
+
+            case spv::OpCapability:
+                declared_capabilities.push_back(insn.word(1));
+                break;
+            case spv::OpExtension:
+                declared_extensions.emplace_back(reinterpret_cast<char const *>(&insn.word(1)));
+                break;
+
+            // Group operations checked by ValidateShaderStageGroupNonUniform
+            case spv::OpGroupNonUniformAllEqual:
+            case spv::OpGroupNonUniformBroadcast:
+            case spv::OpGroupNonUniformBroadcastFirst:
+            case spv::OpGroupNonUniformShuffle:
+            case spv::OpGroupNonUniformShuffleXor:
+            case spv::OpGroupNonUniformShuffleUp:
+            case spv::OpGroupNonUniformShuffleDown:
+            case spv::OpGroupNonUniformIAdd:
+            case spv::OpGroupNonUniformFAdd:
+            case spv::OpGroupNonUniformIMul:
+            case spv::OpGroupNonUniformFMul:
+            case spv::OpGroupNonUniformSMin:
+            case spv::OpGroupNonUniformUMin:
+            case spv::OpGroupNonUniformFMin:
+            case spv::OpGroupNonUniformSMax:
+            case spv::OpGroupNonUniformUMax:
+            case spv::OpGroupNonUniformFMax:
+            case spv::OpGroupNonUniformBitwiseAnd:
+            case spv::OpGroupNonUniformBitwiseOr:
+            case spv::OpGroupNonUniformBitwiseXor:
+            case spv::OpGroupNonUniformLogicalAnd:
+            case spv::OpGroupNonUniformLogicalOr:
+            case spv::OpGroupNonUniformLogicalXor:
+            case spv::OpGroupNonUniformQuadBroadcast:
+            case spv::OpGroupNonUniformQuadSwap:
+                group_non_uniform_offsets.push_back(insn.offset());
+                break;
+
+            default:
+                // We don't care about any other defs for now.
+                break;
+        }
+    }
+}
+
+unsigned ExecutionModelToShaderStageFlagBits(unsigned mode) {
+    switch (mode) {
+        case spv::ExecutionModelVertex:
+            return VK_SHADER_STAGE_VERTEX_BIT;
+        case spv::ExecutionModelTessellationControl:
+            return VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+        case spv::ExecutionModelTessellationEvaluation:
+            return VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+        case spv::ExecutionModelGeometry:
+            return VK_SHADER_STAGE_GEOMETRY_BIT;
+        case spv::ExecutionModelFragment:
+            return VK_SHADER_STAGE_FRAGMENT_BIT;
+        case spv::ExecutionModelGLCompute:
+            return VK_SHADER_STAGE_COMPUTE_BIT;
+        case spv::ExecutionModelRayGenerationNV:
+            return VK_SHADER_STAGE_RAYGEN_BIT_NV;
+        case spv::ExecutionModelAnyHitNV:
+            return VK_SHADER_STAGE_ANY_HIT_BIT_NV;
+        case spv::ExecutionModelClosestHitNV:
+            return VK_SHADER_STAGE_CLOSEST_HIT_BIT_NV;
+        case spv::ExecutionModelMissNV:
+            return VK_SHADER_STAGE_MISS_BIT_NV;
+        case spv::ExecutionModelIntersectionNV:
+            return VK_SHADER_STAGE_INTERSECTION_BIT_NV;
+        case spv::ExecutionModelCallableNV:
+            return VK_SHADER_STAGE_CALLABLE_BIT_NV;
+        case spv::ExecutionModelTaskNV:
+            return VK_SHADER_STAGE_TASK_BIT_NV;
+        case spv::ExecutionModelMeshNV:
+            return VK_SHADER_STAGE_MESH_BIT_NV;
+        default:
+            return 0;
+    }
+}
@@ -21,6 +21,7 @@
 
 #include "shader_validation.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cinttypes>
@@ -43,58 +44,12 @@
 #include "spirv-tools/libspirv.h"
 #include "xxhash.h"
 
-void decoration_set::add(uint32_t decoration, uint32_t value) {
-    switch (decoration) {
-        case spv::DecorationLocation:
-            flags |= location_bit;
-            location = value;
-            break;
-        case spv::DecorationPatch:
-            flags |= patch_bit;
-            break;
-        case spv::DecorationRelaxedPrecision:
-            flags |= relaxed_precision_bit;
-            break;
-        case spv::DecorationBlock:
-            flags |= block_bit;
-            break;
-        case spv::DecorationBufferBlock:
-            flags |= buffer_block_bit;
-            break;
-        case spv::DecorationComponent:
-            flags |= component_bit;
-            component = value;
-            break;
-        case spv::DecorationInputAttachmentIndex:
-            flags |= input_attachment_index_bit;
-            input_attachment_index = value;
-            break;
-        case spv::DecorationDescriptorSet:
-            flags |= descriptor_set_bit;
-            descriptor_set = value;
-            break;
-        case spv::DecorationBinding:
-            flags |= binding_bit;
-            binding = value;
-            break;
-        case spv::DecorationNonWritable:
-            flags |= nonwritable_bit;
-            break;
-        case spv::DecorationBuiltIn:
-            flags |= builtin_bit;
-            builtin = value;
-            break;
-    }
-}
-
 enum FORMAT_TYPE {
     FORMAT_TYPE_FLOAT = 1,  // UNORM, SNORM, FLOAT, USCALED, SSCALED, SRGB -- anything we consider float in the shader
     FORMAT_TYPE_SINT = 2,
     FORMAT_TYPE_UINT = 4,
 };
 
-typedef std::pair<unsigned, unsigned> location_t;
-
 static shader_stage_attributes shader_stage_attribs[] = {
     {"vertex shader", false, false, VK_SHADER_STAGE_VERTEX_BIT},
     {"tessellation control shader", true, true, VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT},
@@ -103,128 +58,7 @@ static shader_stage_attributes shader_stage_attribs[] = {
     {"fragment shader", false, false, VK_SHADER_STAGE_FRAGMENT_BIT},
 };
 
-unsigned ExecutionModelToShaderStageFlagBits(unsigned mode);
-
 // SPIRV utility functions
-void SHADER_MODULE_STATE::BuildDefIndex() {
-    for (auto insn : *this) {
-        switch (insn.opcode()) {
-            // Types
-            case spv::OpTypeVoid:
-            case spv::OpTypeBool:
-            case spv::OpTypeInt:
-            case spv::OpTypeFloat:
-            case spv::OpTypeVector:
-            case spv::OpTypeMatrix:
-            case spv::OpTypeImage:
-            case spv::OpTypeSampler:
-            case spv::OpTypeSampledImage:
-            case spv::OpTypeArray:
-            case spv::OpTypeRuntimeArray:
-            case spv::OpTypeStruct:
-            case spv::OpTypeOpaque:
-            case spv::OpTypePointer:
-            case spv::OpTypeFunction:
-            case spv::OpTypeEvent:
-            case spv::OpTypeDeviceEvent:
-            case spv::OpTypeReserveId:
-            case spv::OpTypeQueue:
-            case spv::OpTypePipe:
-            case spv::OpTypeAccelerationStructureNV:
-            case spv::OpTypeCooperativeMatrixNV:
-                def_index[insn.word(1)] = insn.offset();
-                break;
-
-                // Fixed constants
-            case spv::OpConstantTrue:
-            case spv::OpConstantFalse:
-            case spv::OpConstant:
-            case spv::OpConstantComposite:
-            case spv::OpConstantSampler:
-            case spv::OpConstantNull:
-                def_index[insn.word(2)] = insn.offset();
-                break;
-
-                // Specialization constants
-            case spv::OpSpecConstantTrue:
-            case spv::OpSpecConstantFalse:
-            case spv::OpSpecConstant:
-            case spv::OpSpecConstantComposite:
-            case spv::OpSpecConstantOp:
-                def_index[insn.word(2)] = insn.offset();
-                break;
-
-                // Variables
-            case spv::OpVariable:
-                def_index[insn.word(2)] = insn.offset();
-                break;
-
-                // Functions
-            case spv::OpFunction:
-                def_index[insn.word(2)] = insn.offset();
-                break;
-
-                // Decorations
-            case spv::OpDecorate: {
-                auto targetId = insn.word(1);
-                decorations[targetId].add(insn.word(2), insn.len() > 3u ? insn.word(3) : 0u);
-            } break;
-            case spv::OpGroupDecorate: {
-                auto const &src = decorations[insn.word(1)];
-                for (auto i = 2u; i < insn.len(); i++) decorations[insn.word(i)].merge(src);
-            } break;
-
-                // Entry points ... add to the entrypoint table
-            case spv::OpEntryPoint: {
-                // Entry points do not have an id (the id is the function id) and thus need their own table
-                auto entrypoint_name = (char const *)&insn.word(3);
-                auto execution_model = insn.word(1);
-                auto entrypoint_stage = ExecutionModelToShaderStageFlagBits(execution_model);
-                entry_points.emplace(entrypoint_name, EntryPoint{insn.offset(), entrypoint_stage});
-                break;
-            }
-
-            default:
-                // We don't care about any other defs for now.
-                break;
-        }
-    }
-}
-
-unsigned ExecutionModelToShaderStageFlagBits(unsigned mode) {
-    switch (mode) {
-        case spv::ExecutionModelVertex:
-            return VK_SHADER_STAGE_VERTEX_BIT;
-        case spv::ExecutionModelTessellationControl:
-            return VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
-        case spv::ExecutionModelTessellationEvaluation:
-            return VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
-        case spv::ExecutionModelGeometry:
-            return VK_SHADER_STAGE_GEOMETRY_BIT;
-        case spv::ExecutionModelFragment:
-            return VK_SHADER_STAGE_FRAGMENT_BIT;
-        case spv::ExecutionModelGLCompute:
-            return VK_SHADER_STAGE_COMPUTE_BIT;
-        case spv::ExecutionModelRayGenerationNV:
-            return VK_SHADER_STAGE_RAYGEN_BIT_NV;
-        case spv::ExecutionModelAnyHitNV:
-            return VK_SHADER_STAGE_ANY_HIT_BIT_NV;
-        case spv::ExecutionModelClosestHitNV:
-            return VK_SHADER_STAGE_CLOSEST_HIT_BIT_NV;
-        case spv::ExecutionModelMissNV:
-            return VK_SHADER_STAGE_MISS_BIT_NV;
-        case spv::ExecutionModelIntersectionNV:
-            return VK_SHADER_STAGE_INTERSECTION_BIT_NV;
-        case spv::ExecutionModelCallableNV:
-            return VK_SHADER_STAGE_CALLABLE_BIT_NV;
-        case spv::ExecutionModelTaskNV:
-            return VK_SHADER_STAGE_TASK_BIT_NV;
-        case spv::ExecutionModelMeshNV:
-            return VK_SHADER_STAGE_MESH_BIT_NV;
-        default:
-            return 0;
-    }
-}
 
 spirv_inst_iter FindEntrypoint(SHADER_MODULE_STATE const *src, char const *name, VkShaderStageFlagBits stageBits) {
     auto range = src->entry_points.equal_range(name);
@@ -802,7 +636,7 @@ static std::vector<uint32_t> CollectBuiltinBlockMembers(SHADER_MODULE_STATE cons
 }
 
 static std::vector<std::pair<uint32_t, interface_var>> CollectInterfaceByInputAttachmentIndex(
-    SHADER_MODULE_STATE const *src, std::unordered_set<uint32_t> const &accessible_ids) {
+    SHADER_MODULE_STATE const *src, std::vector<uint32_t> const &accessible_ids) {
     std::vector<std::pair<uint32_t, interface_var>> out;
 
     for (auto insn : *src) {
@@ -811,7 +645,7 @@ static std::vector<std::pair<uint32_t, interface_var>> CollectInterfaceByInputAt
                 auto attachment_index = insn.word(3);
                 auto id = insn.word(1);
 
-                if (accessible_ids.count(id)) {
+                if (std::binary_search(accessible_ids.begin(), accessible_ids.end(), id)) {
                     auto def = src->get_def(id);
                     assert(def != src->end());
                     if (def.opcode() == spv::OpVariable && def.word(3) == spv::StorageClassUniformConstant) {
@@ -1046,7 +880,7 @@ static void IsSpecificDescriptorType(SHADER_MODULE_STATE const *module, const sp
 }
 
 std::vector<std::pair<descriptor_slot_t, interface_var>> CollectInterfaceByDescriptorSlot(
-    SHADER_MODULE_STATE const *src, std::unordered_set<uint32_t> const &accessible_ids, bool *has_writable_descriptor,
+    SHADER_MODULE_STATE const *src, std::vector<uint32_t> const &accessible_ids, bool *has_writable_descriptor,
     bool *has_atomic_descriptor) {
     std::vector<std::pair<descriptor_slot_t, interface_var>> out;
 
@@ -1079,12 +913,14 @@ std::vector<std::pair<descriptor_slot_t, interface_var>> CollectInterfaceByDescr
     return out;
 }
 
-std::unordered_set<uint32_t> CollectWritableOutputLocationinFS(const SHADER_MODULE_STATE &module,
-                                                               const VkPipelineShaderStageCreateInfo &stage_info) {
-    std::unordered_set<uint32_t> location_list;
-    if (stage_info.stage != VK_SHADER_STAGE_FRAGMENT_BIT) return location_list;
-    const auto entrypoint = FindEntrypoint(&module, stage_info.pName, stage_info.stage);
-    const auto outputs = CollectInterfaceByLocation(&module, entrypoint, spv::StorageClassOutput, false);
+static std::vector<uint32_t> CollectWritableOutputLocationinFS(
+    const SHADER_MODULE_STATE &module, std::vector<std::pair<location_t, interface_var>> const &outputs) {
+    std::vector<uint32_t> location_list;
+    auto add_location = [&location_list](uint32_t location) {
+        if (std::find(location_list.begin(), location_list.end(), location) == location_list.end()) {
+            location_list.push_back(location);
+        }
+    };
     std::unordered_set<unsigned> store_members;
     std::unordered_map<unsigned, unsigned> accesschain_members;
 
@@ -1110,7 +946,7 @@ std::unordered_set<uint32_t> CollectWritableOutputLocationinFS(const SHADER_MODU
     for (auto output : outputs) {
         auto store_it = store_members.find(output.second.id);
         if (store_it != store_members.end()) {
-            location_list.insert(output.first.first);
+            add_location(output.first.first);
             store_members.erase(store_it);
             continue;
         }
@@ -1122,7 +958,7 @@ std::unordered_set<uint32_t> CollectWritableOutputLocationinFS(const SHADER_MODU
                 continue;
             }
             if (accesschain_it->second == output.second.id) {
-                location_list.insert(output.first.first);
+                add_location(output.first.first);
                 store_members.erase(store_it);
                 accesschain_members.erase(accesschain_it);
                 break;
@@ -1158,7 +994,7 @@ bool CoreChecks::ValidateViAgainstVsInputs(VkPipelineVertexInputStateCreateInfo
                                            spirv_inst_iter entrypoint) const {
     bool skip = false;
 
-    const auto inputs = CollectInterfaceByLocation(vs, entrypoint, spv::StorageClassInput, false);
+    const auto &inputs = vs->get_reflection(entrypoint).inputs;
 
     // Build index by location
     std::map<uint32_t, const VkVertexInputAttributeDescription *> attribs;
@@ -1233,7 +1069,7 @@ bool CoreChecks::ValidateFsOutputsAgainstRenderPass(SHADER_MODULE_STATE const *f
 
     // TODO: dual source blend index (spv::DecIndex, zero if not provided)
 
-    const auto outputs = CollectInterfaceByLocation(fs, entrypoint, spv::StorageClassOutput, false);
+    const auto &outputs = fs->get_reflection(entrypoint).outputs;
     for (const auto &output_it : outputs) {
         auto const location = output_it.first.first;
         location_map[location].output = &output_it.second;
@@ -1480,6 +1316,59 @@ std::unordered_set<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, s
     return ids;
 }
 
+static std::vector<std::pair<location_t, interface_var>> FlattenInterface(std::map<location_t, interface_var> &&interface) {
+    return std::vector<std::pair<location_t, interface_var>>(interface.begin(), interface.end());
+}
+
+static std::unique_ptr<EntryPointReflection> BuildEntryPointReflection(SHADER_MODULE_STATE const *src,
+                                                                       spirv_inst_iter entrypoint) {
+    std::unique_ptr<EntryPointReflection> reflection(new EntryPointReflection);
+    const auto stage = static_cast<VkShaderStageFlagBits>(ExecutionModelToShaderStageFlagBits(entrypoint.word(1)));
+    reflection->stage = stage;
+    reflection->interface_ids = FindEntrypointInterfaces(entrypoint);
+
+    auto accessible_ids = MarkAccessibleIds(src, entrypoint);
+    reflection->accessible_ids.assign(accessible_ids.begin(), accessible_ids.end());
+    std::sort(reflection->accessible_ids.begin(), reflection->accessible_ids.end());
+    reflection->descriptor_uses = CollectInterfaceByDescriptorSlot(
+        src, reflection->accessible_ids, &reflection->has_writable_descriptor, &reflection->has_atomic_descriptor);
+
+    const bool arrayed_input = stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT ||
+                               stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT || stage == VK_SHADER_STAGE_GEOMETRY_BIT;
+    const bool arrayed_output = stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || stage == VK_SHADER_STAGE_MESH_BIT_NV;
+    reflection->inputs = FlattenInterface(CollectInterfaceByLocation(src, entrypoint, spv::StorageClassInput, arrayed_input));
+    reflection->outputs = FlattenInterface(CollectInterfaceByLocation(src, entrypoint, spv::StorageClassOutput, arrayed_output));
+    reflection->builtin_inputs = CollectBuiltinBlockMembers(src, entrypoint, spv::StorageClassInput);
+    reflection->builtin_outputs = CollectBuiltinBlockMembers(src, entrypoint, spv::StorageClassOutput);
+
+    if (stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
+        reflection->input_attachment_uses = CollectInterfaceByInputAttachmentIndex(src, reflection->accessible_ids);
+        reflection->writable_output_locations = CollectWritableOutputLocationinFS(*src, reflection->outputs);
+    }
+
+    const auto entrypoint_id = entrypoint.word(2);
+    for (auto insn : *src) {
+        if (insn.opcode() == spv::OpExecutionMode && insn.word(1) == entrypoint_id) {
+            reflection->execution_mode_offsets.push_back(insn.offset());
+        } else if (insn.opcode() == spv::OpFunction) {
+            // Execution modes are declared ahead of all functions
+            break;
+        }
+    }
+
+    return reflection;
+}
+
+const EntryPointReflection &SHADER_MODULE_STATE::get_reflection(spirv_inst_iter entrypoint) const {
+    assert(entrypoint.opcode() == spv::OpEntryPoint);
+    std::lock_guard<std::mutex> guard(entry_point_reflection_lock);
+    auto &reflection = entry_point_reflections[entrypoint.offset()];
+    if (!reflection) {
+        reflection = BuildEntryPointReflection(this, entrypoint);
+    }
+    return *reflection;
+}
+
 bool CoreChecks::ValidatePushConstantBlockAgainstPipeline(std::vector<VkPushConstantRange> const *push_constant_ranges,
                                                           SHADER_MODULE_STATE const *src, spirv_inst_iter type,
                                                           VkShaderStageFlagBits stage) const {
@@ -1521,7 +1410,7 @@ bool CoreChecks::ValidatePushConstantBlockAgainstPipeline(std::vector<VkPushCons
 }
 
 bool CoreChecks::ValidatePushConstantUsage(std::vector<VkPushConstantRange> const *push_constant_ranges,
-                                           SHADER_MODULE_STATE const *src, std::unordered_set<uint32_t> accessible_ids,
+                                           SHADER_MODULE_STATE const *src, std::vector<uint32_t> const &accessible_ids,
                                            VkShaderStageFlagBits stage) const {
     bool skip = false;
 
@@ -1863,126 +1752,123 @@ bool CoreChecks::ValidateShaderCapabilities(SHADER_MODULE_STATE const *src, VkSh
     };
     // clang-format on
 
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpCapability) {
-            size_t n = capabilities.count(insn.word(1));
-            if (1 == n) {  // key occurs exactly once
-                auto it = capabilities.find(insn.word(1));
-                if (it != capabilities.end()) {
-                    if (it->second.feature) {
-                        skip |= RequireFeature(it->second.feature.IsEnabled(enabled_features), it->second.name);
-                    }
-                    if (it->second.extension) {
-                        skip |= RequireExtension(IsExtEnabled((device_extensions.*(it->second.extension))), it->second.name);
-                    }
+    for (uint32_t capability : src->declared_capabilities) {
+        size_t n = capabilities.count(capability);
+        if (1 == n) {  // key occurs exactly once
+            auto it = capabilities.find(capability);
+            if (it != capabilities.end()) {
+                if (it->second.feature) {
+                    skip |= RequireFeature(it->second.feature.IsEnabled(enabled_features), it->second.name);
                 }
-            } else if (1 < n) {  // key occurs multiple times, at least one must be enabled
-                bool needs_feature = false, has_feature = false;
-                bool needs_ext = false, has_ext = false;
-                std::string feature_names = "(one of) [ ";
-                std::string extension_names = feature_names;
-                auto caps = capabilities.equal_range(insn.word(1));
-                for (auto it = caps.first; it != caps.second; ++it) {
-                    if (it->second.feature) {
-                        needs_feature = true;
-                        has_feature = has_feature || it->second.feature.IsEnabled(enabled_features);
-                        feature_names += it->second.name;
-                        feature_names += " ";
-                    }
-                    if (it->second.extension) {
-                        needs_ext = true;
-                        has_ext = has_ext || device_extensions.*(it->second.extension);
-                        extension_names += it->second.name;
-                        extension_names += " ";
-                    }
+                if (it->second.extension) {
+                    skip |= RequireExtension(IsExtEnabled((device_extensions.*(it->second.extension))), it->second.name);
                 }
-                if (needs_feature) {
-                    feature_names += "]";
-                    skip |= RequireFeature(has_feature, feature_names.c_str());
+            }
+        } else if (1 < n) {  // key occurs multiple times, at least one must be enabled
+            bool needs_feature = false, has_feature = false;
+            bool needs_ext = false, has_ext = false;
+            std::string feature_names = "(one of) [ ";
+            std::string extension_names = feature_names;
+            auto caps = capabilities.equal_range(capability);
+            for (auto it = caps.first; it != caps.second; ++it) {
+                if (it->second.feature) {
+                    needs_feature = true;
+                    has_feature = has_feature || it->second.feature.IsEnabled(enabled_features);
+                    feature_names += it->second.name;
+                    feature_names += " ";
                 }
-                if (needs_ext) {
-                    extension_names += "]";
-                    skip |= RequireExtension(has_ext, extension_names.c_str());
+                if (it->second.extension) {
+                    needs_ext = true;
+                    has_ext = has_ext || device_extensions.*(it->second.extension);
+                    extension_names += it->second.name;
+                    extension_names += " ";
                 }
             }
+            if (needs_feature) {
+                feature_names += "]";
+                skip |= RequireFeature(has_feature, feature_names.c_str());
+            }
+            if (needs_ext) {
+                extension_names += "]";
+                skip |= RequireExtension(has_ext, extension_names.c_str());
+            }
+        }
 
-            {  // Do group non-uniform checks
-                const VkSubgroupFeatureFlags supportedOperations = phys_dev_props_core11.subgroupSupportedOperations;
-                const VkSubgroupFeatureFlags supportedStages = phys_dev_props_core11.subgroupSupportedStages;
-
-                switch (insn.word(1)) {
-                    default:
-                        break;
-                    case spv::CapabilityGroupNonUniform:
-                    case spv::CapabilityGroupNonUniformVote:
-                    case spv::CapabilityGroupNonUniformArithmetic:
-                    case spv::CapabilityGroupNonUniformBallot:
-                    case spv::CapabilityGroupNonUniformShuffle:
-                    case spv::CapabilityGroupNonUniformShuffleRelative:
-                    case spv::CapabilityGroupNonUniformClustered:
-                    case spv::CapabilityGroupNonUniformQuad:
-                    case spv::CapabilityGroupNonUniformPartitionedNV:
-                        RequirePropertyFlag(supportedStages & stage, string_VkShaderStageFlagBits(stage),
-                                            "VkPhysicalDeviceSubgroupProperties::supportedStages");
-                        break;
-                }
+        {  // Do group non-uniform checks
+            const VkSubgroupFeatureFlags supportedOperations = phys_dev_props_core11.subgroupSupportedOperations;
+            const VkSubgroupFeatureFlags supportedStages = phys_dev_props_core11.subgroupSupportedStages;
 
-                switch (insn.word(1)) {
-                    default:
-                        break;
-                    case spv::CapabilityGroupNonUniform:
-                        RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_BASIC_BIT, "VK_SUBGROUP_FEATURE_BASIC_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformVote:
-                        RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_VOTE_BIT, "VK_SUBGROUP_FEATURE_VOTE_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformArithmetic:
-                        RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_ARITHMETIC_BIT,
-                                            "VK_SUBGROUP_FEATURE_ARITHMETIC_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformBallot:
-                        RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_BALLOT_BIT, "VK_SUBGROUP_FEATURE_BALLOT_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformShuffle:
-                        RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_BIT,
-                                            "VK_SUBGROUP_FEATURE_SHUFFLE_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformShuffleRelative:
-                        RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT,
-                                            "VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformClustered:
-                        RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_CLUSTERED_BIT,
-                                            "VK_SUBGROUP_FEATURE_CLUSTERED_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformQuad:
-                        RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_QUAD_BIT, "VK_SUBGROUP_FEATURE_QUAD_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformPartitionedNV:
-                        RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV,
-                                            "VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                }
+            switch (capability) {
+                default:
+                    break;
+                case spv::CapabilityGroupNonUniform:
+                case spv::CapabilityGroupNonUniformVote:
+                case spv::CapabilityGroupNonUniformArithmetic:
+                case spv::CapabilityGroupNonUniformBallot:
+                case spv::CapabilityGroupNonUniformShuffle:
+                case spv::CapabilityGroupNonUniformShuffleRelative:
+                case spv::CapabilityGroupNonUniformClustered:
+                case spv::CapabilityGroupNonUniformQuad:
+                case spv::CapabilityGroupNonUniformPartitionedNV:
+                    RequirePropertyFlag(supportedStages & stage, string_VkShaderStageFlagBits(stage),
+                                        "VkPhysicalDeviceSubgroupProperties::supportedStages");
+                    break;
             }
-        } else if (insn.opcode() == spv::OpExtension) {
-            std::string extension_name = (char const *)&insn.word(1);
 
-            if (extension_name == "SPV_KHR_non_semantic_info") {
-                skip |= RequireExtension(IsExtEnabled(device_extensions.vk_khr_shader_non_semantic_info),
-                                         VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME);
+            switch (capability) {
+                default:
+                    break;
+                case spv::CapabilityGroupNonUniform:
+                    RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_BASIC_BIT, "VK_SUBGROUP_FEATURE_BASIC_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformVote:
+                    RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_VOTE_BIT, "VK_SUBGROUP_FEATURE_VOTE_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformArithmetic:
+                    RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_ARITHMETIC_BIT,
+                                        "VK_SUBGROUP_FEATURE_ARITHMETIC_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformBallot:
+                    RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_BALLOT_BIT, "VK_SUBGROUP_FEATURE_BALLOT_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformShuffle:
+                    RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_BIT, "VK_SUBGROUP_FEATURE_SHUFFLE_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformShuffleRelative:
+                    RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT,
+                                        "VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformClustered:
+                    RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_CLUSTERED_BIT,
+                                        "VK_SUBGROUP_FEATURE_CLUSTERED_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformQuad:
+                    RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_QUAD_BIT, "VK_SUBGROUP_FEATURE_QUAD_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformPartitionedNV:
+                    RequirePropertyFlag(supportedOperations & VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV,
+                                        "VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
             }
         }
     }
 
+    for (const auto &extension_name : src->declared_extensions) {
+        if (extension_name == "SPV_KHR_non_semantic_info") {
+            skip |= RequireExtension(IsExtEnabled(device_extensions.vk_khr_shader_non_semantic_info),
+                                     VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME);
+        }
+    }
+
     return skip;
 }
 
@@ -2021,7 +1907,8 @@ bool CoreChecks::ValidateShaderStageGroupNonUniform(SHADER_MODULE_STATE const *m
 
     auto const subgroup_props = phys_dev_props_core11;
 
-    for (auto inst : *module) {
+    for (uint32_t offset : module->group_non_uniform_offsets) {
+        auto inst = module->at(offset);
         // Check the quad operations.
         switch (inst.opcode()) {
             default:
@@ -2101,8 +1988,8 @@ bool CoreChecks::ValidateShaderStageInputOutputLimits(SHADER_MODULE_STATE const
 
     bool skip = false;
     auto const &limits = phys_dev_props.limits;
+    const auto &reflection = src->get_reflection(entrypoint);
 
-    std::set<uint32_t> patchIDs;
     struct Variable {
         uint32_t baseTypePtrID;
         uint32_t ID;
@@ -2112,50 +1999,27 @@ bool CoreChecks::ValidateShaderStageInputOutputLimits(SHADER_MODULE_STATE const
 
     uint32_t numVertices = 0;
 
-    auto entrypointVariables = FindEntrypointInterfaces(entrypoint);
+    // Find all input and output variables in the entrypoint's interface
+    for (uint32_t id : reflection.interface_ids) {
+        auto insn = src->get_def(id);
+        assert(insn != src->end());
+        Variable var = {};
+        var.storageClass = insn.word(3);
+        if (var.storageClass == spv::StorageClassInput || var.storageClass == spv::StorageClassOutput) {
+            var.baseTypePtrID = insn.word(1);
+            var.ID = insn.word(2);
+            variables.push_back(var);
+        }
+    }
 
-    for (auto insn : *src) {
-        switch (insn.opcode()) {
-            // Find all Patch decorations
-            case spv::OpDecorate:
-                switch (insn.word(2)) {
-                    case spv::DecorationPatch: {
-                        patchIDs.insert(insn.word(1));
-                        break;
-                    }
-                    default:
-                        break;
-                }
-                break;
-            // Find all input and output variables
-            case spv::OpVariable: {
-                Variable var = {};
-                var.storageClass = insn.word(3);
-                if ((var.storageClass == spv::StorageClassInput || var.storageClass == spv::StorageClassOutput) &&
-                    // Only include variables in the entrypoint's interface
-                    find(entrypointVariables.begin(), entrypointVariables.end(), insn.word(2)) != entrypointVariables.end()) {
-                    var.baseTypePtrID = insn.word(1);
-                    var.ID = insn.word(2);
-                    variables.push_back(var);
-                }
-                break;
-            }
-            case spv::OpExecutionMode:
-                if (insn.word(1) == entrypoint.word(2)) {
-                    switch (insn.word(2)) {
-                        default:
-                            break;
-                        case spv::ExecutionModeOutputVertices:
-                            numVertices = insn.word(3);
-                            break;
-                    }
-                }
-                break;
-            default:
-                break;
+    for (uint32_t offset : reflection.execution_mode_offsets) {
+        auto insn = src->at(offset);
+        if (insn.word(2) == spv::ExecutionModeOutputVertices) {
+            numVertices = insn.word(3);
         }
     }
 
+    // The reflection strips the same array levels from the interfaces
     bool strip_output_array_level =
         (pStage->stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStage->stage == VK_SHADER_STAGE_MESH_BIT_NV);
     bool strip_input_array_level =
@@ -2165,14 +2029,14 @@ bool CoreChecks::ValidateShaderStageInputOutputLimits(SHADER_MODULE_STATE const
     uint32_t numCompIn = 0, numCompOut = 0;
     int maxCompIn = 0, maxCompOut = 0;
 
-    auto inputs = CollectInterfaceByLocation(src, entrypoint, spv::StorageClassInput, strip_input_array_level);
-    auto outputs = CollectInterfaceByLocation(src, entrypoint, spv::StorageClassOutput, strip_output_array_level);
+    const auto &inputs = reflection.inputs;
+    const auto &outputs = reflection.outputs;
 
     // Find max component location used for input variables.
     for (auto &var : inputs) {
         int location = var.first.first;
         int component = var.first.second;
-        interface_var &iv = var.second;
+        const interface_var &iv = var.second;
 
         // Only need to look at the first location, since we use the type's whole size
         if (iv.offset != 0) {
@@ -2191,7 +2055,7 @@ bool CoreChecks::ValidateShaderStageInputOutputLimits(SHADER_MODULE_STATE const
     for (auto &var : outputs) {
         int location = var.first.first;
         int component = var.first.second;
-        interface_var &iv = var.second;
+        const interface_var &iv = var.second;
 
         // Only need to look at the first location, since we use the type's whole size
         if (iv.offset != 0) {
@@ -2212,7 +2076,7 @@ bool CoreChecks::ValidateShaderStageInputOutputLimits(SHADER_MODULE_STATE const
         // Check if the variable is a patch. Patches can also be members of blocks,
         // but if they are then the top-level arrayness has already been stripped
         // by the time GetComponentsConsumedByType gets to it.
-        bool isPatch = patchIDs.find(var.ID) != patchIDs.end();
+        bool isPatch = (src->get_decorations(var.ID).flags & decoration_set::patch_bit) != 0;
 
         if (var.storageClass == spv::StorageClassInput) {
             numCompIn += GetComponentsConsumedByType(src, var.baseTypePtrID, strip_input_array_level && !isPatch);
@@ -2699,8 +2563,6 @@ bool CoreChecks::ValidateCooperativeMatrix(SHADER_MODULE_STATE const *src, VkPip
 }
 
 bool CoreChecks::ValidateExecutionModes(SHADER_MODULE_STATE const *src, spirv_inst_iter entrypoint) const {
-    auto entrypoint_id = entrypoint.word(2);
-
     // The first denorm execution mode encountered, along with its bit width.
     // Used to check if SeparateDenormSettings is respected.
     std::pair<spv::ExecutionMode, uint32_t> first_denorm_execution_mode = std::make_pair(spv::ExecutionModeMax, 0);
@@ -2714,196 +2576,195 @@ bool CoreChecks::ValidateExecutionModes(SHADER_MODULE_STATE const *src, spirv_in
     uint32_t verticesOut = 0;
     uint32_t invocations = 0;
 
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpExecutionMode && insn.word(1) == entrypoint_id) {
-            auto mode = insn.word(2);
-            switch (mode) {
-                case spv::ExecutionModeSignedZeroInfNanPreserve: {
-                    auto bit_width = insn.word(3);
-                    if ((bit_width == 16 && !phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat16) ||
-                        (bit_width == 32 && !phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat32) ||
-                        (bit_width == 64 && !phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat64)) {
-                        skip |= LogError(
-                            device, kVUID_Core_Shader_FeatureNotEnabled,
-                            "Shader requires SignedZeroInfNanPreserve for bit width %d but it is not enabled on the device",
-                            bit_width);
-                    }
-                    break;
+    for (uint32_t offset : src->get_reflection(entrypoint).execution_mode_offsets) {
+        auto insn = src->at(offset);
+        auto mode = insn.word(2);
+        switch (mode) {
+            case spv::ExecutionModeSignedZeroInfNanPreserve: {
+                auto bit_width = insn.word(3);
+                if ((bit_width == 16 && !phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat16) ||
+                    (bit_width == 32 && !phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat32) ||
+                    (bit_width == 64 && !phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat64)) {
+                    skip |= LogError(
+                        device, kVUID_Core_Shader_FeatureNotEnabled,
+                        "Shader requires SignedZeroInfNanPreserve for bit width %d but it is not enabled on the device",
+                        bit_width);
                 }
+                break;
+            }
 
-                case spv::ExecutionModeDenormPreserve: {
-                    auto bit_width = insn.word(3);
-                    if ((bit_width == 16 && !phys_dev_props_core12.shaderDenormPreserveFloat16) ||
-                        (bit_width == 32 && !phys_dev_props_core12.shaderDenormPreserveFloat32) ||
-                        (bit_width == 64 && !phys_dev_props_core12.shaderDenormPreserveFloat64)) {
-                        skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                         "Shader requires DenormPreserve for bit width %d but it is not enabled on the device",
-                                         bit_width);
-                    }
-
-                    if (first_denorm_execution_mode.first == spv::ExecutionModeMax) {
-                        // Register the first denorm execution mode found
-                        first_denorm_execution_mode = std::make_pair(static_cast<spv::ExecutionMode>(mode), bit_width);
-                    } else if (first_denorm_execution_mode.first != mode && first_denorm_execution_mode.second != bit_width) {
-                        switch (phys_dev_props_core12.denormBehaviorIndependence) {
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR:
-                                if (first_rounding_mode.second != 32 && bit_width != 32) {
-                                    skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                                     "Shader uses different denorm execution modes for 16 and 64-bit but "
-                                                     "denormBehaviorIndependence is "
-                                                     "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR on the device");
-                                }
-                                break;
-
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL_KHR:
-                                break;
+            case spv::ExecutionModeDenormPreserve: {
+                auto bit_width = insn.word(3);
+                if ((bit_width == 16 && !phys_dev_props_core12.shaderDenormPreserveFloat16) ||
+                    (bit_width == 32 && !phys_dev_props_core12.shaderDenormPreserveFloat32) ||
+                    (bit_width == 64 && !phys_dev_props_core12.shaderDenormPreserveFloat64)) {
+                    skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
+                                     "Shader requires DenormPreserve for bit width %d but it is not enabled on the device",
+                                     bit_width);
+                }
 
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR:
+                if (first_denorm_execution_mode.first == spv::ExecutionModeMax) {
+                    // Register the first denorm execution mode found
+                    first_denorm_execution_mode = std::make_pair(static_cast<spv::ExecutionMode>(mode), bit_width);
+                } else if (first_denorm_execution_mode.first != mode && first_denorm_execution_mode.second != bit_width) {
+                    switch (phys_dev_props_core12.denormBehaviorIndependence) {
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR:
+                            if (first_rounding_mode.second != 32 && bit_width != 32) {
                                 skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                                 "Shader uses different denorm execution modes for different bit widths but "
+                                                 "Shader uses different denorm execution modes for 16 and 64-bit but "
                                                  "denormBehaviorIndependence is "
-                                                 "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR on the device");
-                                break;
+                                                 "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR on the device");
+                            }
+                            break;
 
-                            default:
-                                break;
-                        }
-                    }
-                    break;
-                }
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL_KHR:
+                            break;
 
-                case spv::ExecutionModeDenormFlushToZero: {
-                    auto bit_width = insn.word(3);
-                    if ((bit_width == 16 && !phys_dev_props_core12.shaderDenormFlushToZeroFloat16) ||
-                        (bit_width == 32 && !phys_dev_props_core12.shaderDenormFlushToZeroFloat32) ||
-                        (bit_width == 64 && !phys_dev_props_core12.shaderDenormFlushToZeroFloat64)) {
-                        skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                         "Shader requires DenormFlushToZero for bit width %d but it is not enabled on the device",
-                                         bit_width);
-                    }
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR:
+                            skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
+                                             "Shader uses different denorm execution modes for different bit widths but "
+                                             "denormBehaviorIndependence is "
+                                             "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR on the device");
+                            break;
 
-                    if (first_denorm_execution_mode.first == spv::ExecutionModeMax) {
-                        // Register the first denorm execution mode found
-                        first_denorm_execution_mode = std::make_pair(static_cast<spv::ExecutionMode>(mode), bit_width);
-                    } else if (first_denorm_execution_mode.first != mode && first_denorm_execution_mode.second != bit_width) {
-                        switch (phys_dev_props_core12.denormBehaviorIndependence) {
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR:
-                                if (first_rounding_mode.second != 32 && bit_width != 32) {
-                                    skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                                     "Shader uses different denorm execution modes for 16 and 64-bit but "
-                                                     "denormBehaviorIndependence is "
-                                                     "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR on the device");
-                                }
-                                break;
+                        default:
+                            break;
+                    }
+                }
+                break;
+            }
 
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL_KHR:
-                                break;
+            case spv::ExecutionModeDenormFlushToZero: {
+                auto bit_width = insn.word(3);
+                if ((bit_width == 16 && !phys_dev_props_core12.shaderDenormFlushToZeroFloat16) ||
+                    (bit_width == 32 && !phys_dev_props_core12.shaderDenormFlushToZeroFloat32) ||
+                    (bit_width == 64 && !phys_dev_props_core12.shaderDenormFlushToZeroFloat64)) {
+                    skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
+                                     "Shader requires DenormFlushToZero for bit width %d but it is not enabled on the device",
+                                     bit_width);
+                }
 
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR:
+                if (first_denorm_execution_mode.first == spv::ExecutionModeMax) {
+                    // Register the first denorm execution mode found
+                    first_denorm_execution_mode = std::make_pair(static_cast<spv::ExecutionMode>(mode), bit_width);
+                } else if (first_denorm_execution_mode.first != mode && first_denorm_execution_mode.second != bit_width) {
+                    switch (phys_dev_props_core12.denormBehaviorIndependence) {
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR:
+                            if (first_rounding_mode.second != 32 && bit_width != 32) {
                                 skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                                 "Shader uses different denorm execution modes for different bit widths but "
+                                                 "Shader uses different denorm execution modes for 16 and 64-bit but "
                                                  "denormBehaviorIndependence is "
-                                                 "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR on the device");
-                                break;
+                                                 "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR on the device");
+                            }
+                            break;
 
-                            default:
-                                break;
-                        }
-                    }
-                    break;
-                }
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL_KHR:
+                            break;
 
-                case spv::ExecutionModeRoundingModeRTE: {
-                    auto bit_width = insn.word(3);
-                    if ((bit_width == 16 && !phys_dev_props_core12.shaderRoundingModeRTEFloat16) ||
-                        (bit_width == 32 && !phys_dev_props_core12.shaderRoundingModeRTEFloat32) ||
-                        (bit_width == 64 && !phys_dev_props_core12.shaderRoundingModeRTEFloat64)) {
-                        skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                         "Shader requires RoundingModeRTE for bit width %d but it is not enabled on the device",
-                                         bit_width);
-                    }
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR:
+                            skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
+                                             "Shader uses different denorm execution modes for different bit widths but "
+                                             "denormBehaviorIndependence is "
+                                             "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR on the device");
+                            break;
 
-                    if (first_rounding_mode.first == spv::ExecutionModeMax) {
-                        // Register the first rounding mode found
-                        first_rounding_mode = std::make_pair(static_cast<spv::ExecutionMode>(mode), bit_width);
-                    } else if (first_rounding_mode.first != mode && first_rounding_mode.second != bit_width) {
-                        switch (phys_dev_props_core12.roundingModeIndependence) {
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR:
-                                if (first_rounding_mode.second != 32 && bit_width != 32) {
-                                    skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                                     "Shader uses different rounding modes for 16 and 64-bit but "
-                                                     "roundingModeIndependence is "
-                                                     "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR on the device");
-                                }
-                                break;
+                        default:
+                            break;
+                    }
+                }
+                break;
+            }
 
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL_KHR:
-                                break;
+            case spv::ExecutionModeRoundingModeRTE: {
+                auto bit_width = insn.word(3);
+                if ((bit_width == 16 && !phys_dev_props_core12.shaderRoundingModeRTEFloat16) ||
+                    (bit_width == 32 && !phys_dev_props_core12.shaderRoundingModeRTEFloat32) ||
+                    (bit_width == 64 && !phys_dev_props_core12.shaderRoundingModeRTEFloat64)) {
+                    skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
+                                     "Shader requires RoundingModeRTE for bit width %d but it is not enabled on the device",
+                                     bit_width);
+                }
 
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR:
+                if (first_rounding_mode.first == spv::ExecutionModeMax) {
+                    // Register the first rounding mode found
+                    first_rounding_mode = std::make_pair(static_cast<spv::ExecutionMode>(mode), bit_width);
+                } else if (first_rounding_mode.first != mode && first_rounding_mode.second != bit_width) {
+                    switch (phys_dev_props_core12.roundingModeIndependence) {
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR:
+                            if (first_rounding_mode.second != 32 && bit_width != 32) {
                                 skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                                 "Shader uses different rounding modes for different bit widths but "
+                                                 "Shader uses different rounding modes for 16 and 64-bit but "
                                                  "roundingModeIndependence is "
-                                                 "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR on the device");
-                                break;
+                                                 "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR on the device");
+                            }
+                            break;
 
-                            default:
-                                break;
-                        }
-                    }
-                    break;
-                }
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL_KHR:
+                            break;
 
-                case spv::ExecutionModeRoundingModeRTZ: {
-                    auto bit_width = insn.word(3);
-                    if ((bit_width == 16 && !phys_dev_props_core12.shaderRoundingModeRTZFloat16) ||
-                        (bit_width == 32 && !phys_dev_props_core12.shaderRoundingModeRTZFloat32) ||
-                        (bit_width == 64 && !phys_dev_props_core12.shaderRoundingModeRTZFloat64)) {
-                        skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                         "Shader requires RoundingModeRTZ for bit width %d but it is not enabled on the device",
-                                         bit_width);
-                    }
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR:
+                            skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
+                                             "Shader uses different rounding modes for different bit widths but "
+                                             "roundingModeIndependence is "
+                                             "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR on the device");
+                            break;
 
-                    if (first_rounding_mode.first == spv::ExecutionModeMax) {
-                        // Register the first rounding mode found
-                        first_rounding_mode = std::make_pair(static_cast<spv::ExecutionMode>(mode), bit_width);
-                    } else if (first_rounding_mode.first != mode && first_rounding_mode.second != bit_width) {
-                        switch (phys_dev_props_core12.roundingModeIndependence) {
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR:
-                                if (first_rounding_mode.second != 32 && bit_width != 32) {
-                                    skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                                     "Shader uses different rounding modes for 16 and 64-bit but "
-                                                     "roundingModeIndependence is "
-                                                     "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR on the device");
-                                }
-                                break;
+                        default:
+                            break;
+                    }
+                }
+                break;
+            }
 
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL_KHR:
-                                break;
+            case spv::ExecutionModeRoundingModeRTZ: {
+                auto bit_width = insn.word(3);
+                if ((bit_width == 16 && !phys_dev_props_core12.shaderRoundingModeRTZFloat16) ||
+                    (bit_width == 32 && !phys_dev_props_core12.shaderRoundingModeRTZFloat32) ||
+                    (bit_width == 64 && !phys_dev_props_core12.shaderRoundingModeRTZFloat64)) {
+                    skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
+                                     "Shader requires RoundingModeRTZ for bit width %d but it is not enabled on the device",
+                                     bit_width);
+                }
 
-                            case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR:
+                if (first_rounding_mode.first == spv::ExecutionModeMax) {
+                    // Register the first rounding mode found
+                    first_rounding_mode = std::make_pair(static_cast<spv::ExecutionMode>(mode), bit_width);
+                } else if (first_rounding_mode.first != mode && first_rounding_mode.second != bit_width) {
+                    switch (phys_dev_props_core12.roundingModeIndependence) {
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR:
+                            if (first_rounding_mode.second != 32 && bit_width != 32) {
                                 skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
-                                                 "Shader uses different rounding modes for different bit widths but "
+                                                 "Shader uses different rounding modes for 16 and 64-bit but "
                                                  "roundingModeIndependence is "
-                                                 "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR on the device");
-                                break;
+                                                 "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY_KHR on the device");
+                            }
+                            break;
 
-                            default:
-                                break;
-                        }
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL_KHR:
+                            break;
+
+                        case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR:
+                            skip |= LogError(device, kVUID_Core_Shader_FeatureNotEnabled,
+                                             "Shader uses different rounding modes for different bit widths but "
+                                             "roundingModeIndependence is "
+                                             "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE_KHR on the device");
+                            break;
+
+                        default:
+                            break;
                     }
-                    break;
                 }
+                break;
+            }
 
-                case spv::ExecutionModeOutputVertices: {
-                    verticesOut = insn.word(3);
-                    break;
-                }
+            case spv::ExecutionModeOutputVertices: {
+                verticesOut = insn.word(3);
+                break;
+            }
 
-                case spv::ExecutionModeInvocations: {
-                    invocations = insn.word(3);
-                    break;
-                }
+            case spv::ExecutionModeInvocations: {
+                invocations = insn.word(3);
+                break;
             }
         }
     }
@@ -3044,32 +2905,30 @@ bool FindLocalSize(SHADER_MODULE_STATE const *src, uint32_t &local_size_x, uint3
 }
 
 void ProcessExecutionModes(SHADER_MODULE_STATE const *src, const spirv_inst_iter &entrypoint, PIPELINE_STATE *pipeline) {
-    auto entrypoint_id = entrypoint.word(2);
     bool is_point_mode = false;
 
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpExecutionMode && insn.word(1) == entrypoint_id) {
-            switch (insn.word(2)) {
-                case spv::ExecutionModePointMode:
-                    // In tessellation shaders, PointMode is separate and trumps the tessellation topology.
-                    is_point_mode = true;
-                    break;
+    for (uint32_t offset : src->get_reflection(entrypoint).execution_mode_offsets) {
+        auto insn = src->at(offset);
+        switch (insn.word(2)) {
+            case spv::ExecutionModePointMode:
+                // In tessellation shaders, PointMode is separate and trumps the tessellation topology.
+                is_point_mode = true;
+                break;
 
-                case spv::ExecutionModeOutputPoints:
-                    pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
-                    break;
+            case spv::ExecutionModeOutputPoints:
+                pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
+                break;
 
-                case spv::ExecutionModeIsolines:
-                case spv::ExecutionModeOutputLineStrip:
-                    pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_LINE_STRIP;
-                    break;
+            case spv::ExecutionModeIsolines:
+            case spv::ExecutionModeOutputLineStrip:
+                pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_LINE_STRIP;
+                break;
 
-                case spv::ExecutionModeTriangles:
-                case spv::ExecutionModeQuads:
-                case spv::ExecutionModeOutputTriangleStrip:
-                    pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP;
-                    break;
-            }
+            case spv::ExecutionModeTriangles:
+            case spv::ExecutionModeQuads:
+            case spv::ExecutionModeOutputTriangleStrip:
+                pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP;
+                break;
         }
     }
 
@@ -3129,6 +2988,151 @@ bool CoreChecks::ValidatePointListShaderState(const PIPELINE_STATE *pipeline, SH
     return skip;
 }
 
+static inline uint32_t DetermineFinalGeomStage(const PIPELINE_STATE *pipeline, const VkGraphicsPipelineCreateInfo *pCreateInfo) {
+    uint32_t stage_mask = 0;
+    if (pipeline->topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_POINT_LIST) {
+        for (uint32_t i = 0; i < pCreateInfo->stageCount; i++) {
+            stage_mask |= pCreateInfo->pStages[i].stage;
+        }
+        // Determine which shader in which PointSize should be written (the final geometry stage)
+        if (stage_mask & VK_SHADER_STAGE_MESH_BIT_NV) {
+            stage_mask = VK_SHADER_STAGE_MESH_BIT_NV;
+        } else if (stage_mask & VK_SHADER_STAGE_GEOMETRY_BIT) {
+            stage_mask = VK_SHADER_STAGE_GEOMETRY_BIT;
+        } else if (stage_mask & VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT) {
+            stage_mask = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+        } else if (stage_mask & VK_SHADER_STAGE_VERTEX_BIT) {
+            stage_mask = VK_SHADER_STAGE_VERTEX_BIT;
+        }
+    }
+    return stage_mask;
+}
+
+static bool HasSpecializationToApply(VkPipelineShaderStageCreateInfo const *pStage, const SHADER_MODULE_STATE *module) {
+    return pStage->pSpecializationInfo != nullptr && pStage->pSpecializationInfo->mapEntryCount > 0 &&
+           pStage->pSpecializationInfo->pMapEntries != nullptr && module->has_specialization_constants;
+}
+
+// Applies the specialization constants of pStage to module and revalidates the result. The optimizer's messages are kept in
+// result to be reported by ValidatePipelineShaderStage.
+void CoreChecks::SpecializeShaderStage(VkPipelineShaderStageCreateInfo const *pStage, const SHADER_MODULE_STATE *module,
+                                       SPECIALIZED_SHADER_RESULT *result) const {
+    // Gather the specialization-constant values.
+    auto const &specialization_info = pStage->pSpecializationInfo;
+    auto const &specialization_data = reinterpret_cast<uint8_t const *>(specialization_info->pData);
+    std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;
+    id_value_map.reserve(specialization_info->mapEntryCount);
+    for (auto i = 0u; i < specialization_info->mapEntryCount; ++i) {
+        auto const &map_entry = specialization_info->pMapEntries[i];
+
+        // Expect only scalar types.
+        assert(map_entry.size == 1 || map_entry.size == 2 || map_entry.size == 4 || map_entry.size == 8);
+        auto entry = id_value_map.emplace(map_entry.constantID, std::vector<uint32_t>(map_entry.size > 4 ? 2 : 1));
+        memcpy(entry.first->second.data(), specialization_data + map_entry.offset, map_entry.size);
+    }
+
+    // Apply the specialization-constant values and revalidate the shader module.
+    spv_target_env spirv_environment = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
+    spvtools::Optimizer optimizer(spirv_environment);
+    spvtools::MessageConsumer consumer = [result](spv_message_level_t level, const char *source, const spv_position_t &position,
+                                                  const char *message) { result->optimizer_messages.emplace_back(message); };
+    optimizer.SetMessageConsumer(consumer);
+    optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
+    optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
+    std::vector<uint32_t> specialized_spirv;
+    result->optimized =
+        optimizer.Run(module->words.data(), module->words.size(), &specialized_spirv, spvtools::ValidatorOptions(), true);
+
+    if (result->optimized) {
+        spv_context ctx = spvContextCreate(spirv_environment);
+        spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
+        spv_diagnostic diag = nullptr;
+        spvtools::ValidatorOptions options;
+        AdjustValidatorOptions(device_extensions, enabled_features, options);
+        result->valid = spvValidateWithOptions(ctx, options, &binary, &diag) == SPV_SUCCESS;
+
+        spvDiagnosticDestroy(diag);
+        spvContextDestroy(ctx);
+    }
+}
+
+// Runs ValidatePipelineShaderStage for every stage of a pipeline batch on the worker pool. The workers only collect each
+// stage's messages and skip into parallel_results; ValidatePipelineShaderStageOnce logs them from the calling thread in
+// pipeline and stage order, so the messages come out as they would from the sequential checks.
+void CoreChecks::ValidatePipelineStagesInParallel(const std::vector<std::shared_ptr<PIPELINE_STATE>> &pipe_states,
+                                                  ParallelStageResults *parallel_results) const {
+    struct StageWork {
+        VkPipelineShaderStageCreateInfo const *stage;
+        const PIPELINE_STATE *pipeline;
+        const PIPELINE_STATE::StageState *stage_state;
+        const SHADER_MODULE_STATE *module;
+        bool check_point_size;
+        ParallelStageResult *result;
+    };
+    std::vector<StageWork> work;
+    auto add_stage = [this, &work](VkPipelineShaderStageCreateInfo const *stage, const PIPELINE_STATE *pipeline,
+                                   const PIPELINE_STATE::StageState *stage_state, bool check_point_size) {
+        // Stages without a module are left to the sequential checks
+        const SHADER_MODULE_STATE *module = GetShaderModuleState(stage->module);
+        if (module) work.push_back({stage, pipeline, stage_state, module, check_point_size, nullptr});
+    };
+    for (const auto &pipeline : pipe_states) {
+        switch (pipeline->getPipelineType()) {
+            case VK_PIPELINE_BIND_POINT_GRAPHICS: {
+                auto create_info = pipeline->graphicsPipelineCI.ptr();
+                const uint32_t pointlist_stage_mask = DetermineFinalGeomStage(pipeline.get(), create_info);
+                for (uint32_t i = 0; i < create_info->stageCount; ++i) {
+                    add_stage(&create_info->pStages[i], pipeline.get(), &pipeline->stage_state[i],
+                              pointlist_stage_mask == create_info->pStages[i].stage);
+                }
+                break;
+            }
+            case VK_PIPELINE_BIND_POINT_COMPUTE:
+                if (!pipeline->stage_state.empty()) {
+                    add_stage(pipeline->computePipelineCI.stage.ptr(), pipeline.get(), &pipeline->stage_state[0], false);
+                }
+                break;
+            case VK_PIPELINE_BIND_POINT_RAY_TRACING_NV:
+            case VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR:
+                for (uint32_t i = 0; i < pipeline->raytracingPipelineCI.stageCount; ++i) {
+                    add_stage(&pipeline->raytracingPipelineCI.ptr()->pStages[i], pipeline.get(), &pipeline->stage_state[i],
+                              false);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    // A lone stage is validated inline like any other
+    if (work.size() < 2) return;
+
+    // The entries are made up front so that the workers never modify the map itself
+    for (auto &item : work) item.result = &(*parallel_results)[item.stage_state];
+    worker_pool->ParallelFor(work.size(), [this, &work](size_t i) {
+        const StageWork &item = work[i];
+        // While collected, the messages don't stop ValidatePipelineShaderStage early the way a callback asking for the call to
+        // be skipped does, so a stage may report more than it would sequentially with such a callback
+        DeferredMessageScope collect(report_data, &item.result->messages);
+        const spirv_inst_iter entrypoint = FindEntrypoint(item.module, item.stage->pName, item.stage->stage);
+        item.result->skip = ValidatePipelineShaderStage(item.stage, item.pipeline, *item.stage_state, item.module, entrypoint,
+                                                        item.check_point_size);
+    });
+}
+
+// Logs what ValidatePipelineStagesInParallel found for the stage if it ran there, and validates the stage here otherwise
+bool CoreChecks::ValidatePipelineShaderStageOnce(VkPipelineShaderStageCreateInfo const *pStage, const PIPELINE_STATE *pipeline,
+                                                 const PIPELINE_STATE::StageState &stage_state, const SHADER_MODULE_STATE *module,
+                                                 const spirv_inst_iter &entrypoint, bool check_point_size,
+                                                 const ParallelStageResults *parallel_results) const {
+    if (parallel_results) {
+        const auto result = parallel_results->find(&stage_state);
+        if (result != parallel_results->end()) {
+            return LogDeferredMessages(report_data, result->second.messages) || result->second.skip;
+        }
+    }
+    return ValidatePipelineShaderStage(pStage, pipeline, stage_state, module, entrypoint, check_point_size);
+}
+
 bool CoreChecks::ValidatePipelineShaderStage(VkPipelineShaderStageCreateInfo const *pStage, const PIPELINE_STATE *pipeline,
                                              const PIPELINE_STATE::StageState &stage_state, const SHADER_MODULE_STATE *module,
                                              const spirv_inst_iter &entrypoint, bool check_point_size) const {
@@ -3143,55 +3147,21 @@ bool CoreChecks::ValidatePipelineShaderStage(VkPipelineShaderStageCreateInfo con
 
     // If specialization-constant values are given and specialization-constant instructions are present in the shader, the
     // specializations should be applied and validated.
-    if (pStage->pSpecializationInfo != nullptr && pStage->pSpecializationInfo->mapEntryCount > 0 &&
-        pStage->pSpecializationInfo->pMapEntries != nullptr && module->has_specialization_constants) {
-        // Gather the specialization-constant values.
-        auto const &specialization_info = pStage->pSpecializationInfo;
-        auto const &specialization_data = reinterpret_cast<uint8_t const *>(specialization_info->pData);
-        std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;
-        id_value_map.reserve(specialization_info->mapEntryCount);
-        for (auto i = 0u; i < specialization_info->mapEntryCount; ++i) {
-            auto const &map_entry = specialization_info->pMapEntries[i];
-
-            // Expect only scalar types.
-            assert(map_entry.size == 1 || map_entry.size == 2 || map_entry.size == 4 || map_entry.size == 8);
-            auto entry = id_value_map.emplace(map_entry.constantID, std::vector<uint32_t>(map_entry.size > 4 ? 2 : 1));
-            memcpy(entry.first->second.data(), specialization_data + map_entry.offset, map_entry.size);
-        }
-
-        // Apply the specialization-constant values and revalidate the shader module.
-        spv_target_env spirv_environment = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
-        spvtools::Optimizer optimizer(spirv_environment);
-        spvtools::MessageConsumer consumer = [&skip, &module, &pStage, this](spv_message_level_t level, const char *source,
-                                                                             const spv_position_t &position, const char *message) {
-            skip |= LogError(
-                device, "VUID-VkPipelineShaderStageCreateInfo-module-parameter", "%s does not contain valid spirv for stage %s. %s",
-                report_data->FormatHandle(module->vk_shader_module).c_str(), string_VkShaderStageFlagBits(pStage->stage), message);
-        };
-        optimizer.SetMessageConsumer(consumer);
-        optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
-        optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
-        std::vector<uint32_t> specialized_spirv;
-        auto const optimized =
-            optimizer.Run(module->words.data(), module->words.size(), &specialized_spirv, spvtools::ValidatorOptions(), true);
-        assert(optimized == true);
-
-        if (optimized) {
-            spv_context ctx = spvContextCreate(spirv_environment);
-            spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
-            spv_diagnostic diag = nullptr;
-            spvtools::ValidatorOptions options;
-            AdjustValidatorOptions(device_extensions, enabled_features, options);
-            auto const spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
-            if (spv_valid != SPV_SUCCESS) {
-                skip |= LogError(device, "VUID-VkPipelineShaderStageCreateInfo-module-04145",
-                                 "After specialization was applied, %s does not contain valid spirv for stage %s.",
-                                 report_data->FormatHandle(module->vk_shader_module).c_str(),
-                                 string_VkShaderStageFlagBits(pStage->stage));
-            }
-
-            spvDiagnosticDestroy(diag);
-            spvContextDestroy(ctx);
+    if (HasSpecializationToApply(pStage, module)) {
+        SPECIALIZED_SHADER_RESULT result;
+        SpecializeShaderStage(pStage, module, &result);
+        for (const auto &message : result.optimizer_messages) {
+            skip |= LogError(device, "VUID-VkPipelineShaderStageCreateInfo-module-parameter",
+                             "%s does not contain valid spirv for stage %s. %s",
+                             report_data->FormatHandle(module->vk_shader_module).c_str(),
+                             string_VkShaderStageFlagBits(pStage->stage), message.c_str());
+        }
+        assert(result.optimized == true);
+        if (result.optimized && !result.valid) {
+            skip |= LogError(device, "VUID-VkPipelineShaderStageCreateInfo-module-04145",
+                             "After specialization was applied, %s does not contain valid spirv for stage %s.",
+                             report_data->FormatHandle(module->vk_shader_module).c_str(),
+                             string_VkShaderStageFlagBits(pStage->stage));
         }
     }
 
@@ -3265,7 +3235,7 @@ bool CoreChecks::ValidatePipelineShaderStage(VkPipelineShaderStageCreateInfo con
 
     // Validate use of input attachments against subpass structure
     if (pStage->stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
-        auto input_attachment_uses = CollectInterfaceByInputAttachmentIndex(module, accessible_ids);
+        const auto &input_attachment_uses = module->get_reflection(entrypoint).input_attachment_uses;
 
         auto rpci = pipeline->rp_state->createInfo.ptr();
         auto subpass = pipeline->graphicsPipelineCI.subpass;
@@ -3299,9 +3269,10 @@ bool CoreChecks::ValidateInterfaceBetweenStages(SHADER_MODULE_STATE const *produ
                                                 shader_stage_attributes const *consumer_stage) const {
     bool skip = false;
 
-    auto outputs =
-        CollectInterfaceByLocation(producer, producer_entrypoint, spv::StorageClassOutput, producer_stage->arrayed_output);
-    auto inputs = CollectInterfaceByLocation(consumer, consumer_entrypoint, spv::StorageClassInput, consumer_stage->arrayed_input);
+    const auto &producer_reflection = producer->get_reflection(producer_entrypoint);
+    const auto &consumer_reflection = consumer->get_reflection(consumer_entrypoint);
+    const auto &outputs = producer_reflection.outputs;
+    const auto &inputs = consumer_reflection.inputs;
 
     auto a_it = outputs.begin();
     auto b_it = inputs.begin();
@@ -3353,8 +3324,8 @@ bool CoreChecks::ValidateInterfaceBetweenStages(SHADER_MODULE_STATE const *produ
     }
 
     if (consumer_stage->stage != VK_SHADER_STAGE_FRAGMENT_BIT) {
-        auto builtins_producer = CollectBuiltinBlockMembers(producer, producer_entrypoint, spv::StorageClassOutput);
-        auto builtins_consumer = CollectBuiltinBlockMembers(consumer, consumer_entrypoint, spv::StorageClassInput);
+        const auto &builtins_producer = producer_reflection.builtin_outputs;
+        const auto &builtins_consumer = consumer_reflection.builtin_inputs;
 
         if (!builtins_producer.empty() && !builtins_consumer.empty()) {
             if (builtins_producer.size() != builtins_consumer.size()) {
@@ -3382,29 +3353,10 @@ bool CoreChecks::ValidateInterfaceBetweenStages(SHADER_MODULE_STATE const *produ
     return skip;
 }
 
-static inline uint32_t DetermineFinalGeomStage(const PIPELINE_STATE *pipeline, const VkGraphicsPipelineCreateInfo *pCreateInfo) {
-    uint32_t stage_mask = 0;
-    if (pipeline->topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_POINT_LIST) {
-        for (uint32_t i = 0; i < pCreateInfo->stageCount; i++) {
-            stage_mask |= pCreateInfo->pStages[i].stage;
-        }
-        // Determine which shader in which PointSize should be written (the final geometry stage)
-        if (stage_mask & VK_SHADER_STAGE_MESH_BIT_NV) {
-            stage_mask = VK_SHADER_STAGE_MESH_BIT_NV;
-        } else if (stage_mask & VK_SHADER_STAGE_GEOMETRY_BIT) {
-            stage_mask = VK_SHADER_STAGE_GEOMETRY_BIT;
-        } else if (stage_mask & VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT) {
-            stage_mask = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
-        } else if (stage_mask & VK_SHADER_STAGE_VERTEX_BIT) {
-            stage_mask = VK_SHADER_STAGE_VERTEX_BIT;
-        }
-    }
-    return stage_mask;
-}
-
 // Validate that the shaders used by the given pipeline and store the active_slots
 //  that are actually used by the pipeline into pPipeline->active_slots
-bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipeline) const {
+bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipeline,
+                                                     const ParallelStageResults *parallel_results) const {
     auto pCreateInfo = pipeline->graphicsPipelineCI.ptr();
     int vertex_stage = GetShaderStageId(VK_SHADER_STAGE_VERTEX_BIT);
     int fragment_stage = GetShaderStageId(VK_SHADER_STAGE_FRAGMENT_BIT);
@@ -3422,8 +3374,8 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipel
         auto stage_id = GetShaderStageId(pStage->stage);
         shaders[stage_id] = GetShaderModuleState(pStage->module);
         entrypoints[stage_id] = FindEntrypoint(shaders[stage_id], pStage->pName, pStage->stage);
-        skip |= ValidatePipelineShaderStage(pStage, pipeline, pipeline->stage_state[i], shaders[stage_id], entrypoints[stage_id],
-                                            (pointlist_stage_mask == pStage->stage));
+        skip |= ValidatePipelineShaderStageOnce(pStage, pipeline, pipeline->stage_state[i], shaders[stage_id],
+                                                entrypoints[stage_id], (pointlist_stage_mask == pStage->stage), parallel_results);
     }
 
     // if the shader stages are no good individually, cross-stage validation is pointless.
@@ -3467,16 +3419,17 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipel
     return skip;
 }
 
-bool CoreChecks::ValidateComputePipelineShaderState(PIPELINE_STATE *pipeline) const {
+bool CoreChecks::ValidateComputePipelineShaderState(PIPELINE_STATE *pipeline, const ParallelStageResults *parallel_results) const {
     const auto &stage = *pipeline->computePipelineCI.stage.ptr();
 
     const SHADER_MODULE_STATE *module = GetShaderModuleState(stage.module);
     const spirv_inst_iter entrypoint = FindEntrypoint(module, stage.pName, stage.stage);
 
-    return ValidatePipelineShaderStage(&stage, pipeline, pipeline->stage_state[0], module, entrypoint, false);
+    return ValidatePipelineShaderStageOnce(&stage, pipeline, pipeline->stage_state[0], module, entrypoint, false, parallel_results);
 }
 
-bool CoreChecks::ValidateRayTracingPipeline(PIPELINE_STATE *pipeline, bool isKHR) const {
+bool CoreChecks::ValidateRayTracingPipeline(PIPELINE_STATE *pipeline, bool isKHR,
+                                            const ParallelStageResults *parallel_results) const {
     bool skip = false;
 
     if (isKHR) {
@@ -3526,7 +3479,8 @@ bool CoreChecks::ValidateRayTracingPipeline(PIPELINE_STATE *pipeline, bool isKHR
         const SHADER_MODULE_STATE *module = GetShaderModuleState(stage.module);
         const spirv_inst_iter entrypoint = FindEntrypoint(module, stage.pName, stage.stage);
 
-        skip |= ValidatePipelineShaderStage(&stage, pipeline, pipeline->stage_state[stage_index], module, entrypoint, false);
+        skip |= ValidatePipelineShaderStageOnce(&stage, pipeline, pipeline->stage_state[stage_index], module, entrypoint, false,
+                                                parallel_results);
 
         if (stage.stage == VK_SHADER_STAGE_RAYGEN_BIT_NV) {
             raygen_stages_found++;
@@ -3598,7 +3552,11 @@ bool CoreChecks::ValidateRayTracingPipeline(PIPELINE_STATE *pipeline, bool isKHR
     return skip;
 }
 
-uint32_t ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci) { return XXH32(smci->pCode, smci->codeSize, 0); }
+ValidationCache::ShaderKey ValidationCache::MakeShaderKey(VkShaderModuleCreateInfo const *smci, spv_target_env target_env,
+                                                          uint32_t validator_options) {
+    const uint64_t seed = (static_cast<uint64_t>(target_env) << 32) | validator_options;
+    return {XXH64(smci->pCode, smci->codeSize, seed), static_cast<uint64_t>(smci->codeSize)};
+}
 
 static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *pCreateInfo) {
     const auto validation_cache_ci = lvl_find_in_chain<VkShaderModuleValidationCacheCreateInfoEXT>(pCreateInfo->pNext);
@@ -3624,21 +3582,28 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
                          "SPIR-V module not valid: Codesize must be a multiple of 4 but is " PRINTF_SIZE_T_SPECIFIER ".",
                          pCreateInfo->codeSize);
     } else {
+        spv_target_env spirv_environment = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
+        spvtools::ValidatorOptions options;
+        uint32_t options_set = AdjustValidatorOptions(device_extensions, enabled_features, options);
+
+        // Without an application cache, fall back to the one the layer keeps across runs
         auto cache = GetValidationCacheInfo(pCreateInfo);
-        uint32_t hash = 0;
+        ValidationCache::ShaderKey key = {};
+        if (cache || core_validation_cache) {
+            key = ValidationCache::MakeShaderKey(pCreateInfo, spirv_environment, options_set);
+        }
         if (cache) {
-            hash = ValidationCache::MakeShaderHash(pCreateInfo);
-            if (cache->Contains(hash)) return false;
+            if (cache->Contains(key)) return false;
+        } else if (core_validation_cache) {
+            std::lock_guard<std::mutex> lock(core_validation_cache_mutex);
+            if (core_validation_cache->Contains(key)) return false;
         }
 
         // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
         // the default values will be used during validation.
-        spv_target_env spirv_environment = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
         spv_context ctx = spvContextCreate(spirv_environment);
         spv_const_binary_t binary{pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)};
         spv_diagnostic diag = nullptr;
-        spvtools::ValidatorOptions options;
-        AdjustValidatorOptions(device_extensions, enabled_features, options);
         spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
         if (spv_valid != SPV_SUCCESS) {
             if (!have_glsl_shader || (pCreateInfo->pCode[0] == spv::MagicNumber)) {
@@ -3652,7 +3617,11 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
             }
         } else {
             if (cache) {
-                cache->Insert(hash);
+                cache->Insert(key);
+            } else if (core_validation_cache) {
+                std::lock_guard<std::mutex> lock(core_validation_cache_mutex);
+                core_validation_cache->Insert(key);
+                core_validation_cache_dirty = true;
             }
         }
 
@@ -3725,15 +3694,20 @@ spv_target_env PickSpirvEnv(uint32_t api_version, bool spirv_1_4) {
     return SPV_ENV_VULKAN_1_0;
 }
 
-void AdjustValidatorOptions(const DeviceExtensions device_extensions, const DeviceFeatures enabled_features,
-                            spvtools::ValidatorOptions &options) {
+uint32_t AdjustValidatorOptions(const DeviceExtensions device_extensions, const DeviceFeatures enabled_features,
+                                spvtools::ValidatorOptions &options) {
+    uint32_t options_set = 0;
     if (device_extensions.vk_khr_relaxed_block_layout) {
         options.SetRelaxBlockLayout(true);
+        options_set |= 1 << 0;
     }
     if (device_extensions.vk_khr_uniform_buffer_standard_layout && enabled_features.core12.uniformBufferStandardLayout == VK_TRUE) {
         options.SetUniformBufferStandardLayout(true);
+        options_set |= 1 << 1;
     }
     if (device_extensions.vk_ext_scalar_block_layout && enabled_features.core12.scalarBlockLayout == VK_TRUE) {
         options.SetScalarBlockLayout(true);
+        options_set |= 1 << 2;
     }
+    return options_set;
 }
@@ -20,9 +20,13 @@
 #ifndef VULKAN_SHADER_VALIDATION_H
 #define VULKAN_SHADER_VALIDATION_H
 
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -120,13 +124,43 @@ struct decoration_set {
     void add(uint32_t decoration, uint32_t value);
 };
 
+typedef std::pair<unsigned, unsigned> location_t;
+
+// What pipeline validation needs to know about one entry point of a module. None of it depends on the pipeline, so it is built
+// once, by the first pipeline that uses the entry point, and shared by every later one.
+struct EntryPointReflection {
+    VkShaderStageFlagBits stage;
+    // Ids of the interface variables listed by the OpEntryPoint
+    std::vector<uint32_t> interface_ids;
+    // Sorted ids referenced by the static call tree of the entry point
+    std::vector<uint32_t> accessible_ids;
+    std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
+    bool has_writable_descriptor = false;
+    bool has_atomic_descriptor = false;
+    // User-defined interface variables in location order. The outer array level of arrayed interfaces is stripped.
+    std::vector<std::pair<location_t, interface_var>> inputs;
+    std::vector<std::pair<location_t, interface_var>> outputs;
+    // BuiltIn decoration of each member of the built-in interface blocks
+    std::vector<uint32_t> builtin_inputs;
+    std::vector<uint32_t> builtin_outputs;
+    // Fragment shaders only
+    std::vector<std::pair<uint32_t, interface_var>> input_attachment_uses;
+    std::vector<uint32_t> writable_output_locations;
+    // Offsets of the OpExecutionMode instructions that apply to the entry point
+    std::vector<uint32_t> execution_mode_offsets;
+};
+
 struct SHADER_MODULE_STATE : public BASE_NODE {
     // The spirv image itself
     std::vector<uint32_t> words;
     // A mapping of <id> to the first word of its def. this is useful because walking type
     // trees, constant expressions, etc requires jumping all over the instruction stream.
-    std::unordered_map<unsigned, unsigned> def_index;
-    std::unordered_map<unsigned, decoration_set> decorations;
+    // Ids are dense and below the Bound in the module header, so this is indexed by id directly. Zero means the id has no
+    // def we track; offset zero is the magic number and never starts an instruction.
+    std::vector<uint32_t> def_index;
+    // Indexed by id like def_index, holding one more than the position of the id's decorations in decorations, or zero.
+    std::vector<uint32_t> decoration_index;
+    std::vector<decoration_set> decorations;
     struct EntryPoint {
         uint32_t offset;
         VkShaderStageFlags stage;
@@ -136,6 +170,19 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     bool has_specialization_constants{false};
     VkShaderModule vk_shader_module;
     uint32_t gpu_validation_shader_id;
+    // Module-wide facts gathered by BuildDefIndex
+    std::vector<uint32_t> declared_capabilities;
+    std::vector<std::string> declared_extensions;
+    std::vector<uint32_t> group_non_uniform_offsets;  // OpGroupNonUniform* instructions with a typed result
+
+    // Keyed by the offset of the OpEntryPoint instruction
+    mutable std::unordered_map<uint32_t, std::unique_ptr<const EntryPointReflection>> entry_point_reflections;
+    mutable std::mutex entry_point_reflection_lock;
+
+    // A lazily created module only holds a copy of the code until EnsureParsed preprocesses and indexes it
+    spv_target_env spirv_env{SPV_ENV_UNIVERSAL_1_0};
+    mutable std::atomic<bool> parsed{true};
+    mutable std::mutex parse_lock;
 
     std::vector<uint32_t> PreprocessShaderBinary(uint32_t *src_binary, size_t binary_size, spv_target_env env) {
         std::vector<uint32_t> src(src_binary, src_binary + binary_size / sizeof(uint32_t));
@@ -189,18 +236,27 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     }
 
     SHADER_MODULE_STATE(VkShaderModuleCreateInfo const *pCreateInfo, VkShaderModule shaderModule, spv_target_env env,
-                        uint32_t unique_shader_id)
-        : words(), def_index(), has_valid_spirv(true), vk_shader_module(shaderModule), gpu_validation_shader_id(unique_shader_id) {
-        words = PreprocessShaderBinary((uint32_t *)pCreateInfo->pCode, pCreateInfo->codeSize, env);
-        BuildDefIndex();
+                        uint32_t unique_shader_id, bool lazy = false)
+        : words(),
+          def_index(),
+          has_valid_spirv(true),
+          vk_shader_module(shaderModule),
+          gpu_validation_shader_id(unique_shader_id),
+          spirv_env(env),
+          parsed(!lazy) {
+        if (lazy) {
+            words.assign(pCreateInfo->pCode, pCreateInfo->pCode + pCreateInfo->codeSize / sizeof(uint32_t));
+        } else {
+            words = PreprocessShaderBinary((uint32_t *)pCreateInfo->pCode, pCreateInfo->codeSize, env);
+            BuildDefIndex();
+        }
     }
 
     SHADER_MODULE_STATE() : has_valid_spirv(false), vk_shader_module(VK_NULL_HANDLE), gpu_validation_shader_id(UINT32_MAX) {}
 
     decoration_set get_decorations(unsigned id) const {
         // return the actual decorations for this id, or a default set.
-        auto it = decorations.find(id);
-        if (it != decorations.end()) return it->second;
+        if (id < decoration_index.size() && decoration_index[id]) return decorations[decoration_index[id] - 1];
         return decoration_set();
     }
 
@@ -212,22 +268,53 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
 
     // Gets an iterator to the definition of an id
     spirv_inst_iter get_def(unsigned id) const {
-        auto it = def_index.find(id);
-        if (it == def_index.end()) {
+        if (id >= def_index.size() || def_index[id] == 0) {
             return end();
         }
-        return at(it->second);
+        return at(def_index[id]);
     }
 
+    // Gets the reflection of the entry point whose OpEntryPoint instruction is given, building it on first use
+    const EntryPointReflection &get_reflection(spirv_inst_iter entrypoint) const;
+
     void BuildDefIndex();
+    // Finishes the construction of a lazily created module. Returns how many bytes that added to memory_footprint(), which
+    // is zero if the module was already parsed. Safe to call from concurrent validation of pipelines sharing the module.
+    int64_t EnsureParsed() const;
+    // Approximate bytes held by the code and the indices built from it
+    size_t memory_footprint() const {
+        return (words.capacity() + def_index.capacity() + decoration_index.capacity()) * sizeof(uint32_t) +
+               decorations.capacity() * sizeof(decoration_set);
+    }
+    // Returns the decorations of id to be filled in, or nullptr if the id is out of the module's bound
+    decoration_set *mutable_decorations(uint32_t id);
 };
 
 class ValidationCache {
+  public:
+    // A shader is identified by a 64-bit hash of its code, seeded with the validator settings, and by its size.
+    struct ShaderKey {
+        uint64_t hash;
+        uint64_t code_size;
+        bool operator==(const ShaderKey &other) const { return hash == other.hash && code_size == other.code_size; }
+    };
+
+  private:
+    struct ShaderKeyHash {
+        size_t operator()(const ShaderKey &key) const { return static_cast<size_t>(key.hash); }
+    };
+
+    // The VkValidationCacheEXT header is followed by the format of the entries, so data written by older layers with the
+    // same SPIRV-Tools version is rejected as well.
+    static const uint32_t kEntryFormat = 2;
+    static const size_t kHeaderSize = 3 * sizeof(uint32_t) + VK_UUID_SIZE;
+    static const size_t kEntrySize = 2 * sizeof(uint64_t);
+
     // hashes of shaders that have passed validation before, and can be skipped.
     // we don't store negative results, as we would have to also store what was
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
-    std::unordered_set<uint32_t> good_shader_hashes;
+    std::unordered_set<ShaderKey, ShaderKeyHash> good_shader_hashes;
     ValidationCache() {}
 
   public:
@@ -237,49 +324,59 @@ class ValidationCache {
         return VkValidationCacheEXT(cache);
     }
 
+    // Data from another layer or SPIRV-Tools version, or that is truncated, is ignored and leaves the cache empty.
     void Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
-        const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
-        auto size = headerSize;
-        if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
-
-        uint32_t const *data = (uint32_t const *)pCreateInfo->pInitialData;
-        if (data[0] != size) return;
-        if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
+        if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < kHeaderSize) return;
+        if ((pCreateInfo->initialDataSize - kHeaderSize) % kEntrySize != 0) return;
+
+        auto bytes = reinterpret_cast<uint8_t const *>(pCreateInfo->pInitialData);
+        uint32_t header[3];
+        memcpy(&header[0], bytes, 2 * sizeof(uint32_t));
+        memcpy(&header[2], bytes + 2 * sizeof(uint32_t) + VK_UUID_SIZE, sizeof(uint32_t));
+        if (header[0] != kHeaderSize) return;
+        if (header[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
+        if (header[2] != kEntryFormat) return;
         uint8_t expected_uuid[VK_UUID_SIZE];
         Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected_uuid);
-        if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
-
-        data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
-
-        for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-            good_shader_hashes.insert(*data);
+        if (memcmp(bytes + 2 * sizeof(uint32_t), expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
+
+        const size_t entry_count = (pCreateInfo->initialDataSize - kHeaderSize) / kEntrySize;
+        good_shader_hashes.reserve(entry_count);
+        for (size_t offset = kHeaderSize; offset < pCreateInfo->initialDataSize; offset += kEntrySize) {
+            ShaderKey key;
+            memcpy(&key.hash, bytes + offset, sizeof(uint64_t));
+            memcpy(&key.code_size, bytes + offset + sizeof(uint64_t), sizeof(uint64_t));
+            good_shader_hashes.insert(key);
         }
     }
 
     void Write(size_t *pDataSize, void *pData) {
-        const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
         if (!pData) {
-            *pDataSize = headerSize + good_shader_hashes.size() * sizeof(uint32_t);
+            *pDataSize = kHeaderSize + good_shader_hashes.size() * kEntrySize;
             return;
         }
 
-        if (*pDataSize < headerSize) {
+        if (*pDataSize < kHeaderSize) {
             *pDataSize = 0;
             return;  // Too small for even the header!
         }
 
-        uint32_t *out = (uint32_t *)pData;
-        size_t actualSize = headerSize;
-
-        // Write the header
-        *out++ = headerSize;
-        *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, reinterpret_cast<uint8_t *>(out));
-        out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
-
-        for (auto it = good_shader_hashes.begin(); it != good_shader_hashes.end() && actualSize < *pDataSize;
-             it++, out++, actualSize += sizeof(uint32_t)) {
-            *out = *it;
+        // Write the header: 4 bytes for header size, 4 bytes for version number, UUID, 4 bytes for entry format
+        auto out = reinterpret_cast<uint8_t *>(pData);
+        const uint32_t header_size = kHeaderSize;
+        const uint32_t header_version = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
+        const uint32_t entry_format = kEntryFormat;
+        memcpy(out, &header_size, sizeof(uint32_t));
+        memcpy(out + sizeof(uint32_t), &header_version, sizeof(uint32_t));
+        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, out + 2 * sizeof(uint32_t));
+        memcpy(out + 2 * sizeof(uint32_t) + VK_UUID_SIZE, &entry_format, sizeof(uint32_t));
+
+        // Only whole entries are written
+        size_t actualSize = kHeaderSize;
+        for (auto it = good_shader_hashes.begin(); it != good_shader_hashes.end() && actualSize + kEntrySize <= *pDataSize;
+             it++, actualSize += kEntrySize) {
+            memcpy(out + actualSize, &it->hash, sizeof(uint64_t));
+            memcpy(out + actualSize + sizeof(uint64_t), &it->code_size, sizeof(uint64_t));
         }
 
         *pDataSize = actualSize;
@@ -287,14 +384,15 @@ class ValidationCache {
 
     void Merge(ValidationCache const *other) {
         good_shader_hashes.reserve(good_shader_hashes.size() + other->good_shader_hashes.size());
-        for (auto h : other->good_shader_hashes) good_shader_hashes.insert(h);
+        for (const auto &key : other->good_shader_hashes) good_shader_hashes.insert(key);
     }
 
-    static uint32_t MakeShaderHash(VkShaderModuleCreateInfo const *smci);
+    // Results depend on the validator settings, so those are folded into the hash.
+    static ShaderKey MakeShaderKey(VkShaderModuleCreateInfo const *smci, spv_target_env target_env, uint32_t validator_options);
 
-    bool Contains(uint32_t hash) { return good_shader_hashes.count(hash) != 0; }
+    bool Contains(const ShaderKey &key) { return good_shader_hashes.count(key) != 0; }
 
-    void Insert(uint32_t hash) { good_shader_hashes.insert(hash); }
+    void Insert(const ShaderKey &key) { good_shader_hashes.insert(key); }
 
   private:
     void Sha1ToVkUuid(const char *sha1_str, uint8_t *uuid) {
@@ -317,6 +415,8 @@ class ValidationCache {
     }
 };
 
+unsigned ExecutionModelToShaderStageFlagBits(unsigned mode);
+
 spirv_inst_iter FindEntrypoint(SHADER_MODULE_STATE const *src, char const *name, VkShaderStageFlagBits stageBits);
 
 // For some analyses, we need to know about all ids referenced by the static call tree of a particular entrypoint. This is
@@ -336,18 +436,17 @@ bool FindLocalSize(SHADER_MODULE_STATE const *src, uint32_t &local_size_x, uint3
 
 void ProcessExecutionModes(SHADER_MODULE_STATE const *src, const spirv_inst_iter &entrypoint, PIPELINE_STATE *pipeline);
 
+// Ids in accessible_ids must be sorted, so that the result comes out in the same order every time.
 std::vector<std::pair<descriptor_slot_t, interface_var>> CollectInterfaceByDescriptorSlot(
-    SHADER_MODULE_STATE const *src, std::unordered_set<uint32_t> const &accessible_ids, bool *has_writable_descriptor,
+    SHADER_MODULE_STATE const *src, std::vector<uint32_t> const &accessible_ids, bool *has_writable_descriptor,
     bool *has_atomic_descriptor);
 
-std::unordered_set<uint32_t> CollectWritableOutputLocationinFS(const SHADER_MODULE_STATE &module,
-                                                               const VkPipelineShaderStageCreateInfo &stage_info);
-
 uint32_t DescriptorTypeToReqs(SHADER_MODULE_STATE const *module, uint32_t type_id);
 
 spv_target_env PickSpirvEnv(uint32_t api_version, bool spirv_1_4);
 
-void AdjustValidatorOptions(const DeviceExtensions device_extensions, const DeviceFeatures enabled_features,
-                            spvtools::ValidatorOptions &options);
+// Returns a bit for each option that was set, for keying cached validation results.
+uint32_t AdjustValidatorOptions(const DeviceExtensions device_extensions, const DeviceFeatures enabled_features,
+                                spvtools::ValidatorOptions &options);
 
 #endif  // VULKAN_SHADER_VALIDATION_H
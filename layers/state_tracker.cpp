@@ -20,6 +20,7 @@
  * Shannon McPherson <shannon@lunarg.com>
  */
 
+#include <cinttypes>
 #include <cmath>
 #include <set>
 #include <sstream>
@@ -335,7 +336,7 @@ void ValidationStateTracker::PostCallRecordCreateImage(VkDevice device, const Vk
 
     is_node->unprotected = ((pCreateInfo->flags & VK_IMAGE_CREATE_PROTECTED_BIT) == 0);
 
-    imageMap.insert(std::make_pair(*pImage, std::move(is_node)));
+    imageMap.insert_or_assign(*pImage, std::move(is_node));
 }
 
 void ValidationStateTracker::PreCallRecordDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) {
@@ -433,7 +434,7 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
 
     buffer_state->unprotected = ((pCreateInfo->flags & VK_BUFFER_CREATE_PROTECTED_BIT) == 0);
 
-    bufferMap.insert(std::make_pair(*pBuffer, std::move(buffer_state)));
+    bufferMap.insert_or_assign(*pBuffer, std::move(buffer_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
@@ -447,7 +448,7 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
     DispatchGetPhysicalDeviceFormatProperties(physical_device, pCreateInfo->format, &format_properties);
     buffer_view_state->format_features = format_properties.bufferFeatures;
 
-    bufferViewMap.insert(std::make_pair(*pView, std::move(buffer_view_state)));
+    bufferViewMap.insert_or_assign(*pView, std::move(buffer_view_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
@@ -490,7 +491,7 @@ void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, cons
                                                                                      : format_properties.optimalTilingFeatures;
     }
 
-    imageViewMap.insert(std::make_pair(*pView, std::move(image_view_state)));
+    imageViewMap.insert_or_assign(*pView, std::move(image_view_state));
 }
 
 void ValidationStateTracker::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
@@ -598,29 +599,34 @@ const IMAGE_VIEW_STATE *ValidationStateTracker::GetAttachmentImageViewState(cons
     return GetImageViewState(image_view);
 }
 
-void ValidationStateTracker::AddAliasingImage(IMAGE_STATE *image_state) {
-    std::unordered_set<VkImage> *bound_images = nullptr;
+void ValidationStateTracker::AddAliasingImage(IMAGE_STATE *image_state, VkImage other_image) {
+    if (other_image != image_state->image) {
+        auto is = GetImageState(other_image);
+        if (is && is->IsCompatibleAliasing(image_state)) {
+            auto inserted = is->aliasing_images.emplace(image_state->image);
+            if (inserted.second) {
+                image_state->aliasing_images.emplace(other_image);
+            }
+        }
+    }
+}
 
+void ValidationStateTracker::AddAliasingImage(IMAGE_STATE *image_state) {
     if (image_state->bind_swapchain) {
         auto swapchain_state = GetSwapchainState(image_state->bind_swapchain);
         if (swapchain_state) {
-            bound_images = &swapchain_state->images[image_state->bind_swapchain_imageIndex].bound_images;
-        }
-    } else {
-        if (image_state->binding.mem_state) {
-            bound_images = &image_state->binding.mem_state->bound_images;
+            for (const auto &handle : swapchain_state->images[image_state->bind_swapchain_imageIndex].bound_images) {
+                AddAliasingImage(image_state, handle);
+            }
         }
-    }
-
-    if (bound_images) {
-        for (const auto &handle : *bound_images) {
-            if (handle != image_state->image) {
-                auto is = GetImageState(handle);
-                if (is && is->IsCompatibleAliasing(image_state)) {
-                    auto inserted = is->aliasing_images.emplace(image_state->image);
-                    if (inserted.second) {
-                        image_state->aliasing_images.emplace(handle);
-                    }
+    } else if (image_state->binding.mem_state) {
+        // Images only alias when they're bound at the same offset, so only the objects bound over that offset can alias
+        const auto &bound_ranges = image_state->binding.mem_state->bound_ranges;
+        const auto bound_objects = bound_ranges.find(image_state->binding.offset);
+        if (bound_objects != bound_ranges.end()) {
+            for (const auto &handle : bound_objects->second) {
+                if (handle.type == kVulkanObjectTypeImage) {
+                    AddAliasingImage(image_state, handle.Cast<VkImage>());
                 }
             }
         }
@@ -729,8 +735,9 @@ void ValidationStateTracker::AddMemObjInfo(void *object, const VkDeviceMemory me
     assert(object != NULL);
 
     auto fake_address = fake_memory.Alloc(pAllocateInfo->allocationSize);
-    memObjMap[mem] = std::make_shared<DEVICE_MEMORY_STATE>(object, mem, pAllocateInfo, fake_address);
-    auto mem_info = memObjMap[mem].get();
+    auto mem_state = std::make_shared<DEVICE_MEMORY_STATE>(object, mem, pAllocateInfo, fake_address);
+    auto mem_info = mem_state.get();
+    memObjMap.insert_or_assign(mem, std::move(mem_state));
 
     auto dedicated = lvl_find_in_chain<VkMemoryDedicatedAllocateInfoKHR>(pAllocateInfo->pNext);
     if (dedicated) {
@@ -980,7 +987,8 @@ void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, CMD_TYP
 
             // TODO: If recreating the reduced_map here shows up in profilinging, need to find a way of sharing with the
             // Validate pass.  Though in the case of "many" descriptors, typically the descriptor count >> binding count
-            cvdescriptorset::PrefilterBindRequestMap reduced_map(*descriptor_set, set_binding_pair.second);
+            cvdescriptorset::PrefilterBindRequestMap reduced_map(*descriptor_set, set_binding_pair.second,
+                                                                 GetManyDescriptorsThreshold());
             const auto &binding_req_map = reduced_map.FilteredMap(*cb_state, *pPipe);
 
             if (reduced_map.IsManyDescriptors()) {
@@ -1005,16 +1013,32 @@ void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, CMD_TYP
 
             if (need_update) {
                 // Bind this set and its active descriptor resources to the command buffer
+                BindingReqMap delta_reqs;
+                const BindingReqMap *update_reqs = &binding_req_map;
                 if (!descriptor_set_changed && reduced_map.IsManyDescriptors()) {
                     // Only record the bindings that haven't already been recorded
-                    BindingReqMap delta_reqs;
                     std::set_difference(binding_req_map.begin(), binding_req_map.end(),
                                         state.per_set[setIndex].validated_set_binding_req_map.begin(),
                                         state.per_set[setIndex].validated_set_binding_req_map.end(),
                                         std::inserter(delta_reqs, delta_reqs.begin()));
-                    descriptor_set->UpdateDrawState(this, cb_state, cmd_type, pPipe, delta_reqs, function);
-                } else {
-                    descriptor_set->UpdateDrawState(this, cb_state, cmd_type, pPipe, binding_req_map, function);
+                    update_reqs = &delta_reqs;
+                }
+                // With lazy descriptor binding, the resources of "many" sets are bound at submit instead of on each draw
+                const bool defer_resources = enabled[lazy_descriptor_binding] && reduced_map.IsManyDescriptors() &&
+                                             !disabled[command_buffer_state] && !descriptor_set->IsPushDescriptor();
+                descriptor_set->UpdateDrawState(this, cb_state, cmd_type, pPipe, *update_reqs, function, defer_resources);
+                if (defer_resources && !update_reqs->empty()) {
+                    auto &deferred_bindings = cb_state->deferred_descriptor_bindings;
+                    auto deferred = std::find_if(deferred_bindings.begin(), deferred_bindings.end(),
+                                                 [descriptor_set](const CMD_BUFFER_STATE::DeferredDescriptorBinding &entry) {
+                                                     return entry.descriptor_set.get() == descriptor_set;
+                                                 });
+                    if (deferred != deferred_bindings.end()) {
+                        deferred->binding_req_map.insert(update_reqs->begin(), update_reqs->end());
+                    } else {
+                        auto set_state = GetShared<cvdescriptorset::DescriptorSet>(descriptor_set->GetSet());
+                        if (set_state) deferred_bindings.push_back({std::move(set_state), *update_reqs});
+                    }
                 }
 
                 state.per_set[setIndex].validated_set = descriptor_set;
@@ -1050,13 +1074,13 @@ void ValidationStateTracker::FreeDescriptorSet(cvdescriptorset::DescriptorSet *d
 // Free all DS Pools including their Sets & related sub-structs
 // NOTE : Calls to this function should be wrapped in mutex
 void ValidationStateTracker::DeleteDescriptorSetPools() {
-    for (auto ii = descriptorPoolMap.begin(); ii != descriptorPoolMap.end();) {
+    for (const auto &pool : descriptorPoolMap.snapshot()) {
         // Remove this pools' sets from setMap and delete them
-        for (auto ds : ii->second->sets) {
+        for (auto ds : pool.second->sets) {
             FreeDescriptorSet(ds);
         }
-        ii->second->sets.clear();
-        ii = descriptorPoolMap.erase(ii);
+        pool.second->sets.clear();
+        descriptorPoolMap.erase(pool.first);
     }
 }
 
@@ -1179,6 +1203,10 @@ bool ValidationStateTracker::AddCommandBufferBinding(small_unordered_map<CMD_BUF
     if (disabled[command_buffer_state]) {
         return false;
     }
+    std::unique_lock<std::mutex> bindings_lock;
+    if (enabled[cmd_buffer_local_locking]) {
+        bindings_lock = std::unique_lock<std::mutex>(GetCbBindingsLock(&cb_bindings));
+    }
     // Insert the cb_binding with a default 'index' of -1. Then push the obj into the object_bindings
     // vector, and update cb_bindings[cb_node] with the index of that element of the vector.
     auto inserted = cb_bindings.insert({cb_node, -1});
@@ -1190,6 +1218,24 @@ bool ValidationStateTracker::AddCommandBufferBinding(small_unordered_map<CMD_BUF
     return false;
 }
 
+// With cmd_buffer_local_locking, the hooks of vkCmd* entry points share the object lock and serialize only on the command
+// buffer being recorded. Entry points that create, destroy, begin, end, reset or submit command buffers, and
+// vkCmdExecuteCommands (which reads the state of other command buffers), still take the object lock exclusively.
+cmd_buffer_lock_guard_t ValidationStateTracker::LockCmdBuffer(VkCommandBuffer commandBuffer, bool record) {
+    if (enabled[cmd_buffer_local_locking]) {
+        read_lock_guard_t object_lock(validation_object_mutex);
+        CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
+        if (cb_state) {
+            return cmd_buffer_lock_guard_t(std::move(object_lock), std::unique_lock<std::mutex>(cb_state->cmd_buffer_lock));
+        }
+        // Unknown command buffer, fall back to the object lock
+    }
+    if (record) {
+        return cmd_buffer_lock_guard_t(write_lock());
+    }
+    return cmd_buffer_lock_guard_t(read_lock());
+}
+
 // For a given object, if cb_node is in that objects cb_bindings, remove cb_node
 void ValidationStateTracker::RemoveCommandBufferBinding(VulkanTypedHandle const &object, CMD_BUFFER_STATE *cb_node) {
     BASE_NODE *base_obj = GetStateStructPtrFromObject(object);
@@ -1236,7 +1282,7 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
         pCB->writeEventsBeforeWait.clear();
         pCB->activeQueries.clear();
         pCB->startedQueries.clear();
-        pCB->image_layout_map.clear();
+        pCB->image_layout_map.Reset();
         pCB->current_vertex_buffer_binding_info.vertex_buffer_bindings.clear();
         pCB->vertex_buffer_used = false;
         pCB->primaryCommandBuffer = VK_NULL_HANDLE;
@@ -1275,6 +1321,7 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
         ResetCmdDebugUtilsLabel(report_data, pCB->commandBuffer);
         pCB->debug_label.Reset();
         pCB->validate_descriptorsets_in_queuesubmit.clear();
+        pCB->deferred_descriptor_bindings.clear();
 
         // Best practices info
         pCB->small_indexed_draw_call_count = 0;
@@ -1319,6 +1366,13 @@ void ValidationStateTracker::PostCallRecordCreateDevice(VkPhysicalDevice gpu, co
     // Save local link to this device's physical device state
     state_tracker->physical_device_state = pd_state;
 
+    if (state_tracker->enabled[lazy_descriptor_binding] && !state_tracker->disabled[command_buffer_state]) {
+        const char *threshold_string = getLayerOption("khronos_validation.lazy_descriptor_binding_threshold");
+        state_tracker->many_descriptors_threshold =
+            *threshold_string ? static_cast<uint32_t>(atoi(threshold_string))
+                              : cvdescriptorset::PrefilterBindRequestMap::kLazyBindingManyDescriptors_;
+    }
+
     const auto *vulkan_12_features = lvl_find_in_chain<VkPhysicalDeviceVulkan12Features>(pCreateInfo->pNext);
     if (vulkan_12_features) {
         state_tracker->enabled_features.core12 = *vulkan_12_features;
@@ -1815,8 +1869,10 @@ void ValidationStateTracker::PostCallRecordCreateDevice(VkPhysicalDevice gpu, co
 void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     if (!device) return;
 
+    if (enabled[shader_module_stats]) ReportShaderModuleStats();
+
     // Reset all command buffers before destroying them, to unlink object_bindings.
-    for (auto &commandBuffer : commandBufferMap) {
+    for (const auto &commandBuffer : commandBufferMap.snapshot()) {
         ResetCommandBufferState(commandBuffer.first);
     }
     pipelineMap.clear();
@@ -1846,6 +1902,18 @@ void ValidationStateTracker::IncrementBoundObjects(CMD_BUFFER_STATE const *cb_no
     }
 }
 
+// Bind the resources of the sets recorded with lazy descriptor binding to cb_node, before they are marked in flight
+void ValidationStateTracker::ResolveDeferredDescriptorBindings(CMD_BUFFER_STATE *cb_node) {
+    for (const auto &deferred : cb_node->deferred_descriptor_bindings) {
+        const auto &descriptor_set = deferred.descriptor_set;
+        // Freeing the set invalidated cb_node. Updates that didn't, those of UPDATE_AFTER_BIND and UPDATE_UNUSED_WHILE_PENDING
+        // bindings, are what cb_node executes with, so the set's resources are bound as they are now.
+        if (descriptor_set->destroyed) continue;
+        descriptor_set->BindCommandBufferResources(this, cb_node, deferred.binding_req_map);
+    }
+    cb_node->deferred_descriptor_bindings.clear();
+}
+
 // Track which resources are in-flight by atomically incrementing their "in_use" count
 void ValidationStateTracker::IncrementResources(CMD_BUFFER_STATE *cb_node) {
     cb_node->submitCount++;
@@ -2053,8 +2121,10 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
                 cbs.push_back(submit->pCommandBuffers[i]);
                 for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
                     cbs.push_back(secondaryCmdBuffer->commandBuffer);
+                    ResolveDeferredDescriptorBindings(secondaryCmdBuffer);
                     IncrementResources(secondaryCmdBuffer);
                 }
+                ResolveDeferredDescriptorBindings(cb_node);
                 IncrementResources(cb_node);
 
                 VkQueryPool first_pool = VK_NULL_HANDLE;
@@ -2105,9 +2175,13 @@ void ValidationStateTracker::PreCallRecordFreeMemory(VkDevice device, VkDeviceMe
     for (const auto &obj : mem_info->obj_bindings) {
         BINDABLE *bindable_state = nullptr;
         switch (obj.type) {
-            case kVulkanObjectTypeImage:
-                bindable_state = GetImageState(obj.Cast<VkImage>());
+            case kVulkanObjectTypeImage: {
+                auto image_state = GetImageState(obj.Cast<VkImage>());
+                // Images can only alias images bound to the same memory, so a one way clear is enough, see RemoveAliasingImages
+                if (image_state) image_state->aliasing_images.clear();
+                bindable_state = image_state;
                 break;
+            }
             case kVulkanObjectTypeBuffer:
                 bindable_state = GetBufferState(obj.Cast<VkBuffer>());
                 break;
@@ -2138,7 +2212,6 @@ void ValidationStateTracker::PreCallRecordFreeMemory(VkDevice device, VkDeviceMe
     }
     // Any bound cmd buffers are now invalid
     InvalidateCommandBuffers(mem_info->cb_bindings, obj_struct);
-    RemoveAliasingImages(mem_info->bound_images);
     mem_info->destroyed = true;
     fake_memory.Free(mem_info->fake_base_address);
     memObjMap.erase(mem);
@@ -2261,7 +2334,7 @@ void ValidationStateTracker::PostCallRecordCreateSemaphore(VkDevice device, cons
         semaphore_state->type = semaphore_type_create_info->semaphoreType;
         semaphore_state->payload = semaphore_type_create_info->initialValue;
     }
-    semaphoreMap[*pSemaphore] = std::move(semaphore_state);
+    semaphoreMap.insert_or_assign(*pSemaphore, std::move(semaphore_state));
 }
 
 void ValidationStateTracker::RecordImportSemaphoreState(VkSemaphore semaphore, VkExternalSemaphoreHandleTypeFlagBitsKHR handle_type,
@@ -2433,22 +2506,70 @@ void ValidationStateTracker::PreCallRecordDestroyQueryPool(VkDevice device, VkQu
     queryPoolMap.erase(queryPool);
 }
 
+// Add handle to the objects bound over range, splitting the entries that straddle its ends and filling any gaps in it
+static void AddBoundObject(BoundObjectRangeMap *bound_ranges, const MemoryBindingRange &range, const VulkanTypedHandle &handle) {
+    auto pos = bound_ranges->lower_bound(range);
+    if (pos != bound_ranges->end() && pos->first.begin < range.begin) {
+        pos = bound_ranges->split(pos, range.begin, sparse_container::split_op_keep_both());
+        ++pos;
+    }
+    VkDeviceSize current = range.begin;
+    while (current < range.end) {
+        if (pos == bound_ranges->end() || current < pos->first.begin) {
+            const VkDeviceSize limit = (pos == bound_ranges->end()) ? range.end : std::min(range.end, pos->first.begin);
+            BoundObjectRangeMap::mapped_type handles;
+            handles.emplace_back(handle);
+            pos = bound_ranges->insert(pos, std::make_pair(MemoryBindingRange(current, limit), std::move(handles)));
+        } else {
+            if (pos->first.end > range.end) {
+                pos = bound_ranges->split(pos, range.end, sparse_container::split_op_keep_both());
+            }
+            pos->second.emplace_back(handle);
+        }
+        current = pos->first.end;
+        ++pos;
+    }
+}
+
+// Remove handle from the objects bound over range, dropping the entries no other object is bound over
+static void RemoveBoundObject(BoundObjectRangeMap *bound_ranges, const MemoryBindingRange &range, const VulkanTypedHandle &handle) {
+    auto pos = bound_ranges->lower_bound(range);
+    while (pos != bound_ranges->end() && pos->first.begin < range.end) {
+        auto &handles = pos->second;
+        for (uint32_t i = 0; i < handles.size(); ++i) {
+            if (handles[i] == handle) {
+                handles[i] = handles[handles.size() - 1];
+                handles.pop_back();
+                break;
+            }
+        }
+        if (handles.empty()) {
+            pos = bound_ranges->erase(pos);
+        } else {
+            ++pos;
+        }
+    }
+}
+
 // Object with given handle is being bound to memory w/ given mem_info struct.
-//  Track the newly bound memory range with given memoryOffset
-//  Also scan any previous ranges, track aliased ranges with new range, and flag an error if a linear
-//  and non-linear range incorrectly overlap.
+//  Track the newly bound memory range with given memoryOffset, indexed by offset so that objects bound over the same
+//  memory are found without visiting every object bound to it.
 void ValidationStateTracker::InsertMemoryRange(const VulkanTypedHandle &typed_handle, DEVICE_MEMORY_STATE *mem_info,
                                                VkDeviceSize memoryOffset) {
-    if (typed_handle.type == kVulkanObjectTypeImage) {
-        mem_info->bound_images.insert(typed_handle.Cast<VkImage>());
-    } else if (typed_handle.type == kVulkanObjectTypeBuffer) {
-        mem_info->bound_buffers.insert(typed_handle.Cast<VkBuffer>());
-    } else if (typed_handle.type == kVulkanObjectTypeAccelerationStructureNV) {
-        mem_info->bound_acceleration_structures.insert(typed_handle.Cast<VkAccelerationStructureNV>());
+    VkDeviceSize size = 0;
+    if (typed_handle.type == kVulkanObjectTypeAccelerationStructureNV) {
+        auto as_state = GetAccelerationStructureState(typed_handle.Cast<VkAccelerationStructureNV>());
+        if (as_state) size = as_state->memory_requirements.memoryRequirements.size;
     } else {
-        // Unsupported object type
-        assert(false);
+        auto bindable = GetObjectMemBinding(typed_handle);
+        if (bindable) size = bindable->requirements.size;
     }
+    // A binding of unknown size still covers its offset, which is where aliasing images have to be bound
+    const MemoryBindingRange range(memoryOffset, memoryOffset + std::max<VkDeviceSize>(size, 1));
+    if (range.invalid()) return;
+
+    mem_info->object_ranges[typed_handle].emplace_back(range);
+    AddBoundObject(&mem_info->bound_ranges, range, typed_handle);
 }
 
 void ValidationStateTracker::InsertImageMemoryRange(VkImage image, DEVICE_MEMORY_STATE *mem_info, VkDeviceSize mem_offset) {
@@ -2464,18 +2585,14 @@ void ValidationStateTracker::InsertAccelerationStructureMemoryRange(VkAccelerati
     InsertMemoryRange(VulkanTypedHandle(as, kVulkanObjectTypeAccelerationStructureNV), mem_info, mem_offset);
 }
 
-// This function will remove the handle-to-index mapping from the appropriate map.
+// This function will remove the object's bound ranges from the memory's offset index.
 static void RemoveMemoryRange(const VulkanTypedHandle &typed_handle, DEVICE_MEMORY_STATE *mem_info) {
-    if (typed_handle.type == kVulkanObjectTypeImage) {
-        mem_info->bound_images.erase(typed_handle.Cast<VkImage>());
-    } else if (typed_handle.type == kVulkanObjectTypeBuffer) {
-        mem_info->bound_buffers.erase(typed_handle.Cast<VkBuffer>());
-    } else if (typed_handle.type == kVulkanObjectTypeAccelerationStructureNV) {
-        mem_info->bound_acceleration_structures.erase(typed_handle.Cast<VkAccelerationStructureNV>());
-    } else {
-        // Unsupported object type
-        assert(false);
+    auto object_ranges = mem_info->object_ranges.find(typed_handle);
+    if (object_ranges == mem_info->object_ranges.end()) return;
+    for (const auto &range : object_ranges->second) {
+        RemoveBoundObject(&mem_info->bound_ranges, range, typed_handle);
     }
+    mem_info->object_ranges.erase(object_ranges);
 }
 
 void ValidationStateTracker::RemoveBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE *mem_info) {
@@ -2633,6 +2750,7 @@ void ValidationStateTracker::PreCallRecordDestroyShaderModule(VkDevice device, V
     if (!shaderModule) return;
     auto shader_module_state = GetShaderModuleState(shaderModule);
     shader_module_state->destroyed = true;
+    TrackShaderModuleBytes(-static_cast<int64_t>(shader_module_state->memory_footprint()));
     shaderModuleMap.erase(shaderModule);
 }
 
@@ -2677,10 +2795,9 @@ void ValidationStateTracker::PreCallRecordDestroySampler(VkDevice device, VkSamp
 void ValidationStateTracker::PreCallRecordDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout,
                                                                      const VkAllocationCallbacks *pAllocator) {
     if (!descriptorSetLayout) return;
-    auto layout_it = descriptorSetLayoutMap.find(descriptorSetLayout);
+    auto layout_it = descriptorSetLayoutMap.pop(descriptorSetLayout);
     if (layout_it != descriptorSetLayoutMap.end()) {
         layout_it->second.get()->destroyed = true;
-        descriptorSetLayoutMap.erase(layout_it);
     }
 }
 
@@ -2743,7 +2860,7 @@ void ValidationStateTracker::PostCallRecordCreateCommandPool(VkDevice device, co
     cmd_pool_state->createFlags = pCreateInfo->flags;
     cmd_pool_state->queueFamilyIndex = pCreateInfo->queueFamilyIndex;
     cmd_pool_state->unprotected = ((pCreateInfo->flags & VK_COMMAND_POOL_CREATE_PROTECTED_BIT) == 0);
-    commandPoolMap[command_pool] = std::move(cmd_pool_state);
+    commandPoolMap.insert_or_assign(command_pool, std::move(cmd_pool_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo *pCreateInfo,
@@ -2775,7 +2892,7 @@ void ValidationStateTracker::PostCallRecordCreateQueryPool(VkDevice device, cons
                                                                       &query_pool_state->n_performance_passes);
     }
 
-    queryPoolMap[*pQueryPool] = std::move(query_pool_state);
+    queryPoolMap.insert_or_assign(*pQueryPool, std::move(query_pool_state));
 
     QueryObject query_obj{*pQueryPool, 0u};
     for (uint32_t i = 0; i < pCreateInfo->queryCount; ++i) {
@@ -2897,7 +3014,7 @@ void ValidationStateTracker::PostCallRecordCreateFence(VkDevice device, const Vk
     fence_state->fence = *pFence;
     fence_state->createInfo = *pCreateInfo;
     fence_state->state = (pCreateInfo->flags & VK_FENCE_CREATE_SIGNALED_BIT) ? FENCE_RETIRED : FENCE_UNSIGNALED;
-    fenceMap[*pFence] = std::move(fence_state);
+    fenceMap.insert_or_assign(*pFence, std::move(fence_state));
 }
 
 bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -2909,6 +3026,9 @@ bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice dev
     cgpl_state->pCreateInfos = pCreateInfos;  // GPU validation can alter this, so we have to set a default value for the Chassis
     cgpl_state->pipe_state.reserve(count);
     for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t stage = 0; stage < pCreateInfos[i].stageCount; stage++) {
+            ParseShaderModule(pCreateInfos[i].pStages[stage].module);
+        }
         cgpl_state->pipe_state.push_back(std::make_shared<PIPELINE_STATE>());
         (cgpl_state->pipe_state)[i]->initGraphicsPipeline(this, &pCreateInfos[i], GetRenderPassShared(pCreateInfos[i].renderPass));
         (cgpl_state->pipe_state)[i]->pipeline_layout = GetPipelineLayoutShared(pCreateInfos[i].layout);
@@ -2925,7 +3045,7 @@ void ValidationStateTracker::PostCallRecordCreateGraphicsPipelines(VkDevice devi
     for (uint32_t i = 0; i < count; i++) {
         if (pPipelines[i] != VK_NULL_HANDLE) {
             (cgpl_state->pipe_state)[i]->pipeline = pPipelines[i];
-            pipelineMap[pPipelines[i]] = std::move((cgpl_state->pipe_state)[i]);
+            pipelineMap.insert_or_assign(pPipelines[i], std::move((cgpl_state->pipe_state)[i]));
         }
     }
     cgpl_state->pipe_state.clear();
@@ -2939,6 +3059,7 @@ bool ValidationStateTracker::PreCallValidateCreateComputePipelines(VkDevice devi
     ccpl_state->pCreateInfos = pCreateInfos;  // GPU validation can alter this, so we have to set a default value for the Chassis
     ccpl_state->pipe_state.reserve(count);
     for (uint32_t i = 0; i < count; i++) {
+        ParseShaderModule(pCreateInfos[i].stage.module);
         // Create and initialize internal tracking data structure
         ccpl_state->pipe_state.push_back(std::make_shared<PIPELINE_STATE>());
         ccpl_state->pipe_state.back()->initComputePipeline(this, &pCreateInfos[i]);
@@ -2957,7 +3078,7 @@ void ValidationStateTracker::PostCallRecordCreateComputePipelines(VkDevice devic
     for (uint32_t i = 0; i < count; i++) {
         if (pPipelines[i] != VK_NULL_HANDLE) {
             (ccpl_state->pipe_state)[i]->pipeline = pPipelines[i];
-            pipelineMap[pPipelines[i]] = std::move((ccpl_state->pipe_state)[i]);
+            pipelineMap.insert_or_assign(pPipelines[i], std::move((ccpl_state->pipe_state)[i]));
         }
     }
     ccpl_state->pipe_state.clear();
@@ -2971,6 +3092,9 @@ bool ValidationStateTracker::PreCallValidateCreateRayTracingPipelinesNV(VkDevice
     auto *crtpl_state = reinterpret_cast<create_ray_tracing_pipeline_api_state *>(crtpl_state_data);
     crtpl_state->pipe_state.reserve(count);
     for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t stage = 0; stage < pCreateInfos[i].stageCount; stage++) {
+            ParseShaderModule(pCreateInfos[i].pStages[stage].module);
+        }
         // Create and initialize internal tracking data structure
         crtpl_state->pipe_state.push_back(std::make_shared<PIPELINE_STATE>());
         crtpl_state->pipe_state.back()->initRayTracingPipeline(this, &pCreateInfos[i]);
@@ -2987,7 +3111,7 @@ void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesNV(
     for (uint32_t i = 0; i < count; i++) {
         if (pPipelines[i] != VK_NULL_HANDLE) {
             (crtpl_state->pipe_state)[i]->pipeline = pPipelines[i];
-            pipelineMap[pPipelines[i]] = std::move((crtpl_state->pipe_state)[i]);
+            pipelineMap.insert_or_assign(pPipelines[i], std::move((crtpl_state->pipe_state)[i]));
         }
     }
     crtpl_state->pipe_state.clear();
@@ -3001,6 +3125,9 @@ bool ValidationStateTracker::PreCallValidateCreateRayTracingPipelinesKHR(VkDevic
     auto *crtpl_state = reinterpret_cast<create_ray_tracing_pipeline_khr_api_state *>(crtpl_state_data);
     crtpl_state->pipe_state.reserve(count);
     for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t stage = 0; stage < pCreateInfos[i].stageCount; stage++) {
+            ParseShaderModule(pCreateInfos[i].pStages[stage].module);
+        }
         // Create and initialize internal tracking data structure
         crtpl_state->pipe_state.push_back(std::make_shared<PIPELINE_STATE>());
         crtpl_state->pipe_state.back()->initRayTracingPipeline(this, &pCreateInfos[i]);
@@ -3017,7 +3144,7 @@ void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesKHR(
     for (uint32_t i = 0; i < count; i++) {
         if (pPipelines[i] != VK_NULL_HANDLE) {
             (crtpl_state->pipe_state)[i]->pipeline = pPipelines[i];
-            pipelineMap[pPipelines[i]] = std::move((crtpl_state->pipe_state)[i]);
+            pipelineMap.insert_or_assign(pPipelines[i], std::move((crtpl_state->pipe_state)[i]));
         }
     }
     crtpl_state->pipe_state.clear();
@@ -3026,7 +3153,7 @@ void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesKHR(
 void ValidationStateTracker::PostCallRecordCreateSampler(VkDevice device, const VkSamplerCreateInfo *pCreateInfo,
                                                          const VkAllocationCallbacks *pAllocator, VkSampler *pSampler,
                                                          VkResult result) {
-    samplerMap[*pSampler] = std::make_shared<SAMPLER_STATE>(pSampler, pCreateInfo);
+    samplerMap.insert_or_assign(*pSampler, std::make_shared<SAMPLER_STATE>(pSampler, pCreateInfo));
     if (pCreateInfo->borderColor == VK_BORDER_COLOR_INT_CUSTOM_EXT || pCreateInfo->borderColor == VK_BORDER_COLOR_FLOAT_CUSTOM_EXT)
         custom_border_color_sampler_count++;
 }
@@ -3036,7 +3163,8 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorSetLayout(VkDevice de
                                                                      const VkAllocationCallbacks *pAllocator,
                                                                      VkDescriptorSetLayout *pSetLayout, VkResult result) {
     if (VK_SUCCESS != result) return;
-    descriptorSetLayoutMap[*pSetLayout] = std::make_shared<cvdescriptorset::DescriptorSetLayout>(pCreateInfo, *pSetLayout);
+    descriptorSetLayoutMap.insert_or_assign(*pSetLayout,
+                                            std::make_shared<cvdescriptorset::DescriptorSetLayout>(pCreateInfo, *pSetLayout));
 }
 
 // For repeatable sorting, not very useful for "memory in range" search
@@ -3111,14 +3239,14 @@ void ValidationStateTracker::PostCallRecordCreatePipelineLayout(VkDevice device,
         pipeline_layout_state->compat_for_set.emplace_back(
             GetCanonicalId(i, pipeline_layout_state->push_constant_ranges, set_layouts_id));
     }
-    pipelineLayoutMap[*pPipelineLayout] = std::move(pipeline_layout_state);
+    pipelineLayoutMap.insert_or_assign(*pPipelineLayout, std::move(pipeline_layout_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateInfo,
                                                                 const VkAllocationCallbacks *pAllocator,
                                                                 VkDescriptorPool *pDescriptorPool, VkResult result) {
     if (VK_SUCCESS != result) return;
-    descriptorPoolMap[*pDescriptorPool] = std::make_shared<DESCRIPTOR_POOL_STATE>(*pDescriptorPool, pCreateInfo);
+    descriptorPoolMap.insert_or_assign(*pDescriptorPool, std::make_shared<DESCRIPTOR_POOL_STATE>(*pDescriptorPool, pCreateInfo));
 }
 
 void ValidationStateTracker::PostCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
@@ -3126,11 +3254,38 @@ void ValidationStateTracker::PostCallRecordResetDescriptorPool(VkDevice device,
     if (VK_SUCCESS != result) return;
     DESCRIPTOR_POOL_STATE *pPool = GetDescriptorPoolState(descriptorPool);
     // TODO: validate flags
-    // For every set off of this pool, clear it, remove from setMap, and free cvdescriptorset::DescriptorSet
+    bool sets_bound = false;
     for (auto ds : pPool->sets) {
-        FreeDescriptorSet(ds);
+        if (!ds->cb_bindings.empty()) {
+            sets_bound = true;
+            break;
+        }
+    }
+    if (sets_bound) {
+        // For every set off of this pool, clear it, remove from setMap, and free cvdescriptorset::DescriptorSet
+        for (auto ds : pPool->sets) {
+            FreeDescriptorSet(ds);
+        }
+    } else {
+        // No command buffer has any of the sets bound, so there is nothing to invalidate and they leave setMap together
+        std::vector<VkDescriptorSet> set_handles;
+        set_handles.reserve(pPool->sets.size());
+        for (auto ds : pPool->sets) {
+            ds->destroyed = true;
+            set_handles.push_back(ds->GetSet());
+        }
+        setMap.erase_all(set_handles);
     }
     pPool->sets.clear();
+    // Release the sets' memory all at once. If no set state outlived the reset the arena keeps its memory for the next sets,
+    // otherwise it goes away with the last of them.
+    if (pPool->set_arena) {
+        if (pPool->set_arena.use_count() == 1) {
+            pPool->set_arena->Rewind();
+        } else {
+            pPool->set_arena = std::make_shared<DescriptorSetArena>();
+        }
+    }
     // Reset available count for each type and available sets for this pool
     for (auto it = pPool->availableDescriptorTypeCount.begin(); it != pPool->availableDescriptorTypeCount.end(); ++it) {
         pPool->availableDescriptorTypeCount[it->first] = pPool->maxDescriptorTypeCount[it->first];
@@ -3169,7 +3324,7 @@ void ValidationStateTracker::PreCallRecordFreeDescriptorSets(VkDevice device, Vk
     // For each freed descriptor add its resources back into the pool as available and remove from pool and setMap
     for (uint32_t i = 0; i < count; ++i) {
         if (pDescriptorSets[i] != VK_NULL_HANDLE) {
-            auto descriptor_set = setMap[pDescriptorSets[i]].get();
+            auto descriptor_set = GetSetNode(pDescriptorSets[i]);
             uint32_t type_index = 0, descriptor_count = 0;
             for (uint32_t j = 0; j < descriptor_set->GetBindingCount(); ++j) {
                 type_index = static_cast<uint32_t>(descriptor_set->GetTypeFromIndex(j));
@@ -3203,7 +3358,7 @@ void ValidationStateTracker::PostCallRecordAllocateCommandBuffers(VkDevice devic
             pCB->command_pool = pPool;
             pCB->unprotected = pPool->unprotected;
             // Add command buffer to map
-            commandBufferMap[pCommandBuffer[i]] = std::move(pCB);
+            commandBufferMap.insert_or_assign(pCommandBuffer[i], std::move(pCB));
             ResetCommandBufferState(pCommandBuffer[i]);
         }
     }
@@ -3499,7 +3654,7 @@ void ValidationStateTracker::PostCallRecordCreateAccelerationStructureNV(VkDevic
     DispatchGetAccelerationStructureMemoryRequirementsNV(device, &update_memory_req_info,
                                                          &as_state->update_scratch_memory_requirements);
     as_state->allocator = pAllocator;
-    accelerationStructureMap[*pAccelerationStructure] = std::move(as_state);
+    accelerationStructureMap.insert_or_assign(*pAccelerationStructure, std::move(as_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateAccelerationStructureKHR(VkDevice device,
@@ -3534,7 +3689,7 @@ void ValidationStateTracker::PostCallRecordCreateAccelerationStructureKHR(VkDevi
     DispatchGetAccelerationStructureMemoryRequirementsKHR(device, &update_memory_req_info,
                                                           &as_state->update_scratch_memory_requirements);
     as_state->allocator = pAllocator;
-    accelerationStructureMap[*pAccelerationStructure] = std::move(as_state);
+    accelerationStructureMap.insert_or_assign(*pAccelerationStructure, std::move(as_state));
 }
 
 void ValidationStateTracker::PostCallRecordGetAccelerationStructureMemoryRequirementsNV(
@@ -4123,7 +4278,7 @@ void ValidationStateTracker::PostCallRecordCreateFramebuffer(VkDevice device, co
             }
         }
     }
-    frameBufferMap[*pFramebuffer] = std::move(fb_state);
+    frameBufferMap.insert_or_assign(*pFramebuffer, std::move(fb_state));
 }
 
 void ValidationStateTracker::RecordRenderPassDAG(RenderPassCreateVersion rp_version, const VkRenderPassCreateInfo2KHR *pCreateInfo,
@@ -4342,7 +4497,7 @@ void ValidationStateTracker::RecordCreateRenderPassState(RenderPassCreateVersion
     }
 
     // Even though render_pass is an rvalue-ref parameter, still must move s.t. move assignment is invoked.
-    renderPassMap[*pRenderPass] = std::move(render_pass);
+    renderPassMap.insert_or_assign(*pRenderPass, std::move(render_pass));
 }
 
 // Style note:
@@ -4520,7 +4675,7 @@ void ValidationStateTracker::PreCallRecordCmdExecuteCommands(VkCommandBuffer com
             if (!image_state) continue;  // Can't set layouts of a dead image
 
             auto *cb_subres_map = GetImageSubresourceLayoutMap(cb_state, *image_state);
-            const auto *sub_cb_subres_map = sub_layout_map_entry.second.get();
+            const auto *sub_cb_subres_map = sub_layout_map_entry.second;
             assert(cb_subres_map && sub_cb_subres_map);  // Non const get and map traversal should never be null
             cb_subres_map->UpdateFrom(*sub_cb_subres_map);
         }
@@ -4725,7 +4880,7 @@ void ValidationStateTracker::RecordCreateSwapchainState(VkResult result, const V
             swapchain_state->shared_presentable = true;
         }
         surface_state->swapchain = swapchain_state.get();
-        swapchainMap[*pSwapchain] = std::move(swapchain_state);
+        swapchainMap.insert_or_assign(*pSwapchain, std::move(swapchain_state));
     } else {
         surface_state->swapchain = nullptr;
     }
@@ -4926,7 +5081,7 @@ void ValidationStateTracker::PreCallRecordDestroySurfaceKHR(VkInstance instance,
 }
 
 void ValidationStateTracker::RecordVulkanSurface(VkSurfaceKHR *pSurface) {
-    surface_map[*pSurface] = std::make_shared<SURFACE_STATE>(*pSurface);
+    surface_map.insert_or_assign(*pSurface, std::make_shared<SURFACE_STATE>(*pSurface));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDisplayPlaneSurfaceKHR(VkInstance instance,
@@ -5241,7 +5396,7 @@ void ValidationStateTracker::PostCallRecordAcquireProfilingLockKHR(VkDevice devi
 
 void ValidationStateTracker::PostCallRecordReleaseProfilingLockKHR(VkDevice device) {
     performance_lock_acquired = false;
-    for (auto &cmd_buffer : commandBufferMap) {
+    for (const auto &cmd_buffer : commandBufferMap.snapshot()) {
         cmd_buffer.second->performance_lock_released = true;
     }
 }
@@ -5268,7 +5423,7 @@ void ValidationStateTracker::RecordCreateDescriptorUpdateTemplateState(const VkD
                                                                        VkDescriptorUpdateTemplateKHR *pDescriptorUpdateTemplate) {
     safe_VkDescriptorUpdateTemplateCreateInfo local_create_info(pCreateInfo);
     auto template_state = std::make_shared<TEMPLATE_STATE>(*pDescriptorUpdateTemplate, &local_create_info);
-    desc_template_map[*pDescriptorUpdateTemplate] = std::move(template_state);
+    desc_template_map.insert_or_assign(*pDescriptorUpdateTemplate, std::move(template_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplate(
@@ -5398,7 +5553,7 @@ void ValidationStateTracker::RecordCreateSamplerYcbcrConversionState(const VkSam
 
     ycbcr_state->chromaFilter = create_info->chromaFilter;
     ycbcr_state->format = conversion_format;
-    samplerYcbcrConversionMap[ycbcr_conversion] = std::move(ycbcr_state);
+    samplerYcbcrConversionMap.insert_or_assign(ycbcr_conversion, std::move(ycbcr_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateSamplerYcbcrConversion(VkDevice device,
@@ -5506,7 +5661,7 @@ void ValidationStateTracker::UpdateAllocateDescriptorSetsData(const VkDescriptor
 void ValidationStateTracker::PerformAllocateDescriptorSets(const VkDescriptorSetAllocateInfo *p_alloc_info,
                                                            const VkDescriptorSet *descriptor_sets,
                                                            const cvdescriptorset::AllocateDescriptorSetsData *ds_data) {
-    auto pool_state = descriptorPoolMap[p_alloc_info->descriptorPool].get();
+    auto pool_state = GetDescriptorPoolState(p_alloc_info->descriptorPool);
     // Account for sets and individual descriptors allocated from pool
     pool_state->availableSets -= p_alloc_info->descriptorSetCount;
     for (auto it = ds_data->required_descriptors_by_type.begin(); it != ds_data->required_descriptors_by_type.end(); ++it) {
@@ -5520,11 +5675,12 @@ void ValidationStateTracker::PerformAllocateDescriptorSets(const VkDescriptorSet
     for (uint32_t i = 0; i < p_alloc_info->descriptorSetCount; i++) {
         uint32_t variable_count = variable_count_valid ? variable_count_info->pDescriptorCounts[i] : 0;
 
-        auto new_ds = std::make_shared<cvdescriptorset::DescriptorSet>(descriptor_sets[i], pool_state, ds_data->layout_nodes[i],
-                                                                       variable_count, this);
+        auto new_ds = std::allocate_shared<cvdescriptorset::DescriptorSet>(
+            DescriptorSetArenaAllocator<cvdescriptorset::DescriptorSet>(pool_state->set_arena), descriptor_sets[i], pool_state,
+            ds_data->layout_nodes[i], variable_count, this);
         pool_state->sets.insert(new_ds.get());
         new_ds->in_use.store(0);
-        setMap[descriptor_sets[i]] = std::move(new_ds);
+        setMap.insert_or_assign(descriptor_sets[i], std::move(new_ds));
     }
 }
 
@@ -5681,9 +5837,45 @@ void ValidationStateTracker::PostCallRecordCreateShaderModule(VkDevice device, c
     spv_target_env spirv_environment = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
     bool is_spirv = (pCreateInfo->pCode[0] == spv::MagicNumber);
     auto new_shader_module = is_spirv ? std::make_shared<SHADER_MODULE_STATE>(pCreateInfo, *pShaderModule, spirv_environment,
-                                                                              csm_state->unique_shader_id)
+                                                                              csm_state->unique_shader_id,
+                                                                              enabled[lazy_shader_modules])
                                       : std::make_shared<SHADER_MODULE_STATE>();
-    shaderModuleMap[*pShaderModule] = std::move(new_shader_module);
+    shader_modules_created++;
+    TrackShaderModuleBytes(static_cast<int64_t>(new_shader_module->memory_footprint()));
+    shaderModuleMap.insert_or_assign(*pShaderModule, std::move(new_shader_module));
+}
+
+// With lazy shader modules, the first pipeline to use a module preprocesses and indexes it, before any validation object
+// looks at it. Modules that never make it into a pipeline only keep a copy of their code.
+void ValidationStateTracker::ParseShaderModule(VkShaderModule module) const {
+    auto module_state = GetShaderModuleState(module);
+    if (!module_state) return;
+    int64_t added_bytes = module_state->EnsureParsed();
+    if (added_bytes) {
+        shader_modules_parsed_lazily++;
+        TrackShaderModuleBytes(added_bytes);
+    }
+}
+
+void ValidationStateTracker::TrackShaderModuleBytes(int64_t bytes) const {
+    int64_t current = shader_module_bytes.fetch_add(bytes) + bytes;
+    int64_t peak = shader_module_peak_bytes.load();
+    while (current > peak && !shader_module_peak_bytes.compare_exchange_weak(peak, current)) {
+    }
+}
+
+void ValidationStateTracker::ReportShaderModuleStats() const {
+    uint64_t resident_bytes = 0, peak_resident_bytes = 0;
+    std::string rss;
+    if (GetProcessMemoryUsage(&resident_bytes, &peak_resident_bytes)) {
+        rss = " Process resident set is " + std::to_string(resident_bytes >> 10) + " KiB, peak " +
+              std::to_string(peak_resident_bytes >> 10) + " KiB.";
+    }
+    LogInfo(device, "UNASSIGNED-Shader-Module-Memory-Stats",
+            "%u shader modules created, %u parsed on first use by a pipeline. Shader module state holds %" PRId64
+            " KiB, peak %" PRId64 " KiB.%s",
+            shader_modules_created.load(), shader_modules_parsed_lazily.load(), shader_module_bytes.load() >> 10,
+            shader_module_peak_bytes.load() >> 10, rss.c_str());
 }
 
 void ValidationStateTracker::RecordPipelineShaderStage(VkPipelineShaderStageCreateInfo const *pStage, PIPELINE_STATE *pipeline,
@@ -5698,12 +5890,14 @@ void ValidationStateTracker::RecordPipelineShaderStage(VkPipelineShaderStageCrea
 
     stage_state->stage_flag = pStage->stage;
 
-    // Mark accessible ids
-    stage_state->accessible_ids = MarkAccessibleIds(module, entrypoint);
+    // Copy what the pipeline needs out of the module's cached reflection of this entrypoint
+    const auto &reflection = module->get_reflection(entrypoint);
+    stage_state->accessible_ids = reflection.accessible_ids;
     ProcessExecutionModes(module, entrypoint, pipeline);
 
-    stage_state->descriptor_uses = CollectInterfaceByDescriptorSlot(
-        module, stage_state->accessible_ids, &stage_state->has_writable_descriptor, &stage_state->has_atomic_descriptor);
+    stage_state->descriptor_uses = reflection.descriptor_uses;
+    stage_state->has_writable_descriptor = reflection.has_writable_descriptor;
+    stage_state->has_atomic_descriptor = reflection.has_atomic_descriptor;
     // Capture descriptor uses for the pipeline
     for (auto use : stage_state->descriptor_uses) {
         // While validating shaders capture which slots are used by the pipeline
@@ -5715,7 +5909,8 @@ void ValidationStateTracker::RecordPipelineShaderStage(VkPipelineShaderStageCrea
     }
 
     if (pStage->stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
-        pipeline->fragmentShader_writable_output_location_list = CollectWritableOutputLocationinFS(*module, *pStage);
+        pipeline->fragmentShader_writable_output_location_list.insert(reflection.writable_output_locations.begin(),
+                                                                       reflection.writable_output_locations.end());
     }
 }
 
@@ -5784,8 +5979,7 @@ void ValidationStateTracker::PostCallRecordGetSwapchainImagesKHR(VkDevice device
             if (swapchain_state->createInfo.flags & VK_SWAPCHAIN_CREATE_MUTABLE_FORMAT_BIT_KHR)
                 image_ci.flags |= (VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT | VK_IMAGE_CREATE_EXTENDED_USAGE_BIT_KHR);
 
-            imageMap[pSwapchainImages[i]] = std::make_shared<IMAGE_STATE>(device, pSwapchainImages[i], &image_ci);
-            auto &image_state = imageMap[pSwapchainImages[i]];
+            auto image_state = std::make_shared<IMAGE_STATE>(device, pSwapchainImages[i], &image_ci);
             image_state->valid = false;
             image_state->create_from_swapchain = swapchain;
             image_state->bind_swapchain = swapchain;
@@ -5795,6 +5989,7 @@ void ValidationStateTracker::PostCallRecordGetSwapchainImagesKHR(VkDevice device
             swapchain_state->images[i].bound_images.emplace(pSwapchainImages[i]);
 
             AddImageStateProps(*image_state, device, physical_device);
+            imageMap.insert_or_assign(pSwapchainImages[i], std::move(image_state));
         }
     }
 
@@ -31,9 +31,11 @@
 #include "vulkan/vk_layer.h"
 #include "vk_typemap_helper.h"
 #include "vk_layer_data.h"
+#include <array>
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -375,7 +377,8 @@ class ValidationStateTracker : public ValidationObject {
         using SharedType = std::shared_ptr<StateType>;
         using ConstSharedType = std::shared_ptr<const StateType>;
         using MappedType = std::shared_ptr<StateType>;
-        using MapType = unordered_map<HandleType, MappedType>;
+        // Sharded so that object creation and destruction don't serialize with lookups made from other threads
+        using MapType = vl_concurrent_unordered_map<HandleType, MappedType, 4>;
     };
 
     // Override base class, we have some extra work to do here
@@ -407,6 +410,7 @@ class ValidationStateTracker : public ValidationObject {
     VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(VkSurfaceKHR, SURFACE_STATE, surface_map)
 
     void AddAliasingImage(IMAGE_STATE* image_state);
+    void AddAliasingImage(IMAGE_STATE* image_state, VkImage other_image);
     void RemoveAliasingImage(IMAGE_STATE* image_state);
     void RemoveAliasingImages(const std::unordered_set<VkImage>& bound_images);
 
@@ -416,7 +420,7 @@ class ValidationStateTracker : public ValidationObject {
         using Traits = AccessorTraits<State>;
         auto map_member = Traits::Map();
         const typename Traits::MapType& map =
-            (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
+            (Traits::kInstanceScope && (this->*map_member).empty()) ? instance_state->*map_member : this->*map_member;
 
         const auto found_it = map.find(handle);
         if (found_it == map.end()) {
@@ -430,10 +434,10 @@ class ValidationStateTracker : public ValidationObject {
         using Traits = AccessorTraits<State>;
         auto map_member = Traits::Map();
         const typename Traits::MapType& map =
-            (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
+            (Traits::kInstanceScope && (this->*map_member).empty()) ? instance_state->*map_member : this->*map_member;
 
         const auto found_it = map.find(handle);
-        if (found_it == map.cend()) {
+        if (found_it == map.end()) {
             return nullptr;
         }
         return found_it->second.get();
@@ -444,7 +448,7 @@ class ValidationStateTracker : public ValidationObject {
         using Traits = AccessorTraits<State>;
         auto map_member = Traits::Map();
         const typename Traits::MapType& map =
-            (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
+            (Traits::kInstanceScope && (this->*map_member).empty()) ? instance_state->*map_member : this->*map_member;
 
         const auto found_it = map.find(handle);
         if (found_it == map.end()) {
@@ -458,10 +462,10 @@ class ValidationStateTracker : public ValidationObject {
         using Traits = AccessorTraits<State>;
         auto map_member = Traits::Map();
         const typename Traits::MapType& map =
-            (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
+            (Traits::kInstanceScope && (this->*map_member).empty()) ? instance_state->*map_member : this->*map_member;
 
         const auto found_it = map.find(handle);
-        if (found_it == map.cend()) {
+        if (found_it == map.end()) {
             return nullptr;
         }
         return found_it->second;
@@ -474,10 +478,10 @@ class ValidationStateTracker : public ValidationObject {
         using Traits = AccessorTraits<State>;
         auto map_member = Traits::Map();
         const typename Traits::MapType& map =
-            (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
+            (Traits::kInstanceScope && (this->*map_member).empty()) ? instance_state->*map_member : this->*map_member;
 
         const auto found_it = map.find(handle);
-        if (found_it == map.cend()) {
+        if (found_it == map.end()) {
             return nullptr;
         }
         return found_it->second;
@@ -1172,6 +1176,8 @@ class ValidationStateTracker : public ValidationObject {
                              CMD_BUFFER_STATE* cb_node);
     bool AddCommandBufferBinding(small_unordered_map<CMD_BUFFER_STATE*, int, 8>& cb_bindings, const VulkanTypedHandle& obj,
                                  CMD_BUFFER_STATE* cb_node);
+    // Object lock for the hooks of vkCmd* entry points, honoring cmd_buffer_local_locking
+    cmd_buffer_lock_guard_t LockCmdBuffer(VkCommandBuffer commandBuffer, bool record);
     void AddCommandBufferBindingAccelerationStructure(CMD_BUFFER_STATE*, ACCELERATION_STRUCTURE_STATE*);
     void AddCommandBufferBindingBuffer(CMD_BUFFER_STATE*, BUFFER_STATE*);
     void AddCommandBufferBindingBufferView(CMD_BUFFER_STATE*, BUFFER_VIEW_STATE*);
@@ -1194,6 +1200,7 @@ class ValidationStateTracker : public ValidationObject {
     VkFormatFeatureFlags GetPotentialFormatFeatures(VkFormat format) const;
     void IncrementBoundObjects(CMD_BUFFER_STATE const* cb_node);
     void IncrementResources(CMD_BUFFER_STATE* cb_node);
+    void ResolveDeferredDescriptorBindings(CMD_BUFFER_STATE* cb_node);
     void InsertAccelerationStructureMemoryRange(VkAccelerationStructureNV as, DEVICE_MEMORY_STATE* mem_info,
                                                 VkDeviceSize mem_offset);
     void InsertBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE* mem_info, VkDeviceSize mem_offset);
@@ -1252,6 +1259,9 @@ class ValidationStateTracker : public ValidationObject {
     void RecordMappedMemory(VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize size, void** ppData);
     void RecordPipelineShaderStage(const VkPipelineShaderStageCreateInfo* pStage, PIPELINE_STATE* pipeline,
                                    PIPELINE_STATE::StageState* stage_state) const;
+    void ParseShaderModule(VkShaderModule module) const;
+    void TrackShaderModuleBytes(int64_t bytes) const;
+    void ReportShaderModuleStats() const;
     void RecordRenderPassDAG(RenderPassCreateVersion rp_version, const VkRenderPassCreateInfo2KHR* pCreateInfo,
                              RENDER_PASS_STATE* render_pass);
     void RecordVulkanSurface(VkSurfaceKHR* pSurface);
@@ -1286,6 +1296,7 @@ class ValidationStateTracker : public ValidationObject {
     void UpdateStateCmdDrawType(CMD_BUFFER_STATE* cb_state, CMD_TYPE cmd_type, VkPipelineBindPoint bind_point,
                                 const char* function);
     void UpdateDrawState(CMD_BUFFER_STATE* cb_state, CMD_TYPE cmd_type, const VkPipelineBindPoint bind_point, const char* function);
+    uint32_t GetManyDescriptorsThreshold() const { return many_descriptors_threshold; }
     void UpdateAllocateDescriptorSetsData(const VkDescriptorSetAllocateInfo*, cvdescriptorset::AllocateDescriptorSetsData*) const;
     void PostCallRecordCmdBuildAccelerationStructureKHR(VkCommandBuffer commandBuffer, uint32_t infoCount,
                                                         const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
@@ -1319,7 +1330,17 @@ class ValidationStateTracker : public ValidationObject {
     VkPhysicalDeviceVulkan12Properties phys_dev_props_core12 = {};
     VkDeviceGroupDeviceCreateInfo device_group_create_info = {};
     uint32_t physical_device_count;
-    uint32_t custom_border_color_sampler_count = 0;
+    std::atomic<uint32_t> custom_border_color_sampler_count{0};
+
+    // Threshold above which a set is treated as having "many" descriptors (see PrefilterBindRequestMap), set at device creation
+    // with lazy_descriptor_binding
+    uint32_t many_descriptors_threshold = cvdescriptorset::PrefilterBindRequestMap::kManyDescriptors_;
+
+    // Memory held by shader module state, reported at vkDestroyDevice with shader_module_stats
+    std::atomic<uint32_t> shader_modules_created{0};
+    mutable std::atomic<uint32_t> shader_modules_parsed_lazily{0};
+    mutable std::atomic<int64_t> shader_module_bytes{0};
+    mutable std::atomic<int64_t> shader_module_peak_bytes{0};
 
     // Device extension properties -- storing properties gathered from VkPhysicalDeviceProperties2KHR::pNext chain
     struct DeviceExtensionProperties {
@@ -1374,4 +1395,12 @@ class ValidationStateTracker : public ValidationObject {
         VkDeviceSize free_ = 0;
     };
     FakeAllocator fake_memory;
+
+    // With cmd_buffer_local_locking the cb_bindings of objects shared between command buffers are updated concurrently.
+    // Striped on the address of the bindings, so unrelated objects rarely contend.
+    static const size_t kCbBindingsLockCount = 16;
+    std::array<std::mutex, kCbBindingsLockCount> cb_bindings_locks_;
+    std::mutex& GetCbBindingsLock(const void* cb_bindings) {
+        return cb_bindings_locks_[(reinterpret_cast<uintptr_t>(cb_bindings) >> 4) % kCbBindingsLockCount];
+    }
 };
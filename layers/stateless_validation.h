@@ -503,8 +503,9 @@ class StatelessValidation : public ValidationObject {
         bool skip_call = false;
 
         if (next != NULL) {
-            std::unordered_set<const void *> cycle_check;
-            std::unordered_set<VkStructureType, std::hash<int>> unique_stype_check;
+            // Chains are almost always short, so these stay in inline storage and are searched linearly
+            small_vector<const void *, 16> cycle_check;
+            small_vector<VkStructureType, 16> unique_stype_check;
 
             const char *disclaimer =
                 "This error is based on the Valid Usage documentation for version %d of the Vulkan header.  It is possible that "
@@ -521,35 +522,38 @@ class StatelessValidation : public ValidationObject {
                 const VkStructureType *end = allowed_types + allowed_type_count;
                 const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
 
-                cycle_check.insert(next);
+                cycle_check.emplace_back(next);
 
                 while (current != NULL) {
-                    if (((strncmp(api_name, "vkCreateInstance", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
-                        ((strncmp(api_name, "vkCreateDevice", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                        if (cycle_check.find(current->pNext) != cycle_check.end()) {
+                    // Test the sType first, so the api name is only compared for the loader's own structures
+                    const bool loader_struct =
+                        ((current->sType == VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO) &&
+                         (strncmp(api_name, "vkCreateInstance", strlen(api_name)) == 0)) ||
+                        ((current->sType == VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO) &&
+                         (strncmp(api_name, "vkCreateDevice", strlen(api_name)) == 0));
+                    if (!loader_struct) {
+                        if (std::find(cycle_check.begin(), cycle_check.end(), current->pNext) != cycle_check.end()) {
                             std::string message = "%s: %s chain contains a cycle -- pNext pointer %" PRIx64 " is repeated.";
                             skip_call |= LogError(device, kVUID_PVError_InvalidStructPNext, message.c_str(), api_name,
                                                   parameter_name.get_name().c_str(), reinterpret_cast<uint64_t>(next));
                             break;
                         } else {
-                            cycle_check.insert(current->pNext);
+                            cycle_check.emplace_back(current->pNext);
                         }
 
-                        std::string type_name = string_VkStructureType(current->sType);
-                        if (unique_stype_check.find(current->sType) != unique_stype_check.end()) {
+                        if (std::find(unique_stype_check.begin(), unique_stype_check.end(), current->sType) !=
+                            unique_stype_check.end()) {
                             // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
                             std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
                             skip_call |= LogError(device, stype_vuid, message.c_str(), api_name, parameter_name.get_name().c_str(),
-                                                  type_name.c_str());
+                                                  string_VkStructureType(current->sType));
                         } else {
-                            unique_stype_check.insert(current->sType);
+                            unique_stype_check.emplace_back(current->sType);
                         }
 
                         // Search custom stype list -- if sType found, skip this entirely
                         bool custom = false;
-                        for (auto item : custom_stype_info) {
+                        for (const auto &item : custom_stype_info) {
                             if (item.first == current->sType) {
                                 custom = true;
                                 break;
@@ -557,7 +561,8 @@ class StatelessValidation : public ValidationObject {
                         }
                         if (!custom) {
                             if (std::find(start, end, current->sType) == end) {
-                                if (type_name.compare(UnsupportedStructureTypeString) == 0) {
+                                const char *type_name = string_VkStructureType(current->sType);
+                                if (UnsupportedStructureTypeString.compare(type_name) == 0) {
                                     std::string message =
                                         "%s: %s chain includes a structure with unknown VkStructureType (%d); Allowed structures "
                                         "are [%s]. ";
@@ -571,8 +576,8 @@ class StatelessValidation : public ValidationObject {
                                         "are [%s]. ";
                                     message += disclaimer;
                                     skip_call |= LogError(device, pnext_vuid, message.c_str(), api_name,
-                                                          parameter_name.get_name().c_str(), type_name.c_str(),
-                                                          allowed_struct_names, header_version, parameter_name.get_name().c_str());
+                                                          parameter_name.get_name().c_str(), type_name, allowed_struct_names,
+                                                          header_version, parameter_name.get_name().c_str());
                                 }
                             }
                             skip_call |= ValidatePnextStructContents(api_name, parameter_name, current, pnext_vuid);
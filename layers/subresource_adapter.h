@@ -534,7 +534,7 @@ class ConstMapView {
 enum BothRangeMapMode { kTristate, kSmall, kBig };
 template <typename T, size_t N>
 class BothRangeMap {
-    using BigMap = sparse_container::range_map<IndexType, T>;
+    using BigMap = sparse_container::pooled_range_map<IndexType, T>;
     using RangeType = sparse_container::range<IndexType>;
     using SmallMap = sparse_container::small_range_map<IndexType, T, RangeType, N>;
     using SmallMapIterator = typename SmallMap::iterator;
@@ -782,8 +782,9 @@ class BothRangeMap {
         return big_map_;
     }
     BothRangeMap() : const_big_map_(big_map_), const_small_map_(small_map_), mode_(BothRangeMapMode::kBig) {}
-    BothRangeMap(index_type limit)
-        : big_map_(),
+    // When given, the big map nodes are allocated from pool, which must outlive the map
+    BothRangeMap(index_type limit, sparse_container::node_pool* pool = nullptr)
+        : big_map_(typename BigMap::allocator_type(pool)),
           small_map_(limit <= N ? limit : 0),
           const_big_map_(big_map_),
           const_small_map_(small_map_),
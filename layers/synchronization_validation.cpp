@@ -17,6 +17,7 @@
  * Author: John Zulauf <jzulauf@lunarg.com>
  */
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 #include <memory>
@@ -454,6 +455,9 @@ AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
                              const std::vector<SubpassDependencyGraphNode> &dependencies,
                              const std::vector<AccessContext> &contexts, const AccessContext *external_context) {
     Reset();
+    if (external_context) {
+        SetNodePool(external_context->GetNodePool());
+    }
     const auto &subpass_dep = dependencies[subpass];
     prev_.reserve(subpass_dep.prev.size());
     prev_by_subpass_.resize(subpass, nullptr);  // Can't be more prevs than the subpass we're on
@@ -470,6 +474,9 @@ AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
     }
     if (subpass_dep.barrier_from_external) {
         src_external_ = TrackBack(external_context, queue_flags, *subpass_dep.barrier_from_external);
+        // Only subpasses with an external dependency can validate their first accesses against prior submissions, as the
+        // dependency is logged as a barrier when the subpass begins.
+        first_access_log_ = external_context ? external_context->GetFirstAccessLog() : nullptr;
     } else {
         src_external_ = TrackBack();
     }
@@ -696,6 +703,7 @@ static AccessContext *CreateStoreResolveProxyContext(const AccessContext &contex
                                                      uint32_t subpass, const VkRect2D &render_area,
                                                      std::vector<const IMAGE_VIEW_STATE *> attachment_views) {
     auto *proxy = new AccessContext(context);
+    proxy->SetFirstAccessLog(nullptr);  // Proxy updates are for validation only, and must not be logged
     proxy->UpdateAttachmentResolveAccess(rp_state, render_area, attachment_views, subpass, kCurrentCommandTag);
     proxy->UpdateAttachmentStoreAccess(rp_state, render_area, attachment_views, subpass, kCurrentCommandTag);
     return proxy;
@@ -1154,17 +1162,22 @@ struct UpdateMemoryAccessStateFunctor {
 
     Iterator operator()(ResourceAccessRangeMap *accesses, Iterator pos) const {
         auto &access_state = pos->second;
+        auto *first_access_log = context.GetFirstAccessLog();
+        if (first_access_log) {
+            first_access_log->LogAccess(type, pos->first, usage, tag, access_state, transition_barrier);
+        }
         access_state.Update(usage, tag);
         return pos;
     }
 
     UpdateMemoryAccessStateFunctor(AccessContext::AddressType type_, const AccessContext &context_, SyncStageAccessIndex usage_,
-                                   const ResourceUsageTag &tag_)
-        : type(type_), context(context_), usage(usage_), tag(tag_) {}
+                                   const ResourceUsageTag &tag_, const SyncBarrier *transition_barrier_ = nullptr)
+        : type(type_), context(context_), usage(usage_), tag(tag_), transition_barrier(transition_barrier_) {}
     const AccessContext::AddressType type;
     const AccessContext &context;
     const SyncStageAccessIndex usage;
     const ResourceUsageTag &tag;
+    const SyncBarrier *transition_barrier;
 };
 
 struct ApplyMemoryAccessBarrierFunctor {
@@ -1222,6 +1235,45 @@ struct ApplyGlobalBarrierFunctor {
     std::vector<ApplyMemoryAccessBarrierFunctor> barrier_functor;
 };
 
+// Applies a barrier from a FirstAccessLog, with only the parts of the dependency the log entry specifies
+struct ApplyLoggedBarrierFunctor {
+    using Iterator = ResourceAccessRangeMap::iterator;
+    inline Iterator Infill(ResourceAccessRangeMap *accesses, Iterator pos, ResourceAccessRange range) const { return pos; }
+
+    Iterator operator()(ResourceAccessRangeMap *accesses, Iterator pos) const {
+        auto &access_state = pos->second;
+        const auto &barrier = logged.barrier;
+        if (logged.execution) {
+            access_state.ApplyExecutionBarrier(barrier.src_exec_scope, barrier.dst_exec_scope);
+        }
+        if (logged.memory_access) {
+            access_state.ApplyMemoryAccessBarrier(barrier.src_exec_scope, barrier.src_access_scope, barrier.dst_exec_scope,
+                                                  barrier.dst_access_scope);
+        }
+        return pos;
+    }
+
+    ApplyLoggedBarrierFunctor(const FirstAccessLog::Barrier &logged_) : logged(logged_) {}
+    const FirstAccessLog::Barrier &logged;
+};
+
+// Resolves the (rebased) accesses of a submitted command buffer into the access state of the queue
+struct ResolveSubmittedAccessFunctor {
+    using Iterator = ResourceAccessRangeMap::iterator;
+    Iterator Infill(ResourceAccessRangeMap *accesses, Iterator pos, ResourceAccessRange range) const {
+        // Nothing prior on the queue, the (empty) infill takes on the submitted state in operator()
+        return accesses->insert(pos, std::make_pair(range, ResourceAccessState()));
+    }
+
+    Iterator operator()(ResourceAccessRangeMap *accesses, Iterator pos) const {
+        pos->second.ResolveLaterAccesses(submitted);
+        return pos;
+    }
+
+    ResolveSubmittedAccessFunctor(const ResourceAccessState &submitted_) : submitted(submitted_) {}
+    const ResourceAccessState &submitted;
+};
+
 void AccessContext::UpdateAccessState(AddressType type, SyncStageAccessIndex current_usage, const ResourceAccessRange &range,
                                       const ResourceUsageTag &tag) {
     UpdateMemoryAccessStateFunctor action(type, *this, current_usage, tag);
@@ -1361,6 +1413,65 @@ void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &conte
     }
 }
 
+// Merge the final state of a submitted command buffer into this (queue) context.  The cost is proportional to the number of
+// ranges the command buffer accessed, not the number of ranges tracked by the queue.
+void AccessContext::ResolveSubmittedAccesses(const AccessContext &submitted, uint64_t tag_base) {
+    for (const auto address_type : kAddressTypes) {
+        auto &accesses = GetAccessStateMap(address_type);
+        for (const auto &submitted_access : submitted.GetAccessStateMap(address_type)) {
+            ResourceAccessState rebased(submitted_access.second);
+            rebased.RebaseTags(tag_base);
+            const ResolveSubmittedAccessFunctor action(rebased);
+            UpdateMemoryAccessState(&accesses, submitted_access.first, action);
+        }
+    }
+}
+
+// Import the accesses signaled to a semaphore, with the semaphore wait as the barrier. With ranges, only the accesses within
+// them are imported, at a cost proportional to the ranges rather than to the signaled state.
+void AccessContext::ResolveSignaledAccesses(const AccessContext &signaled, const SyncBarrier &barrier,
+                                            const AddressRanges *ranges) {
+    for (const auto address_type : kAddressTypes) {
+        auto *resolve_map = &GetAccessStateMap(address_type);
+        if (!ranges) {
+            signaled.ResolveAccessRange(address_type, full_range, &barrier, resolve_map, nullptr, false);
+            continue;
+        }
+        for (const auto &range : (*ranges)[address_type]) {
+            signaled.ResolveAccessRange(address_type, range, &barrier, resolve_map, nullptr, false);
+        }
+    }
+}
+
+size_t AccessContext::GetMemoryUsage() const {
+    // Red-black tree nodes carry three links and a color in addition to the value
+    constexpr size_t kNodeSize = sizeof(ResourceAccessRangeMap::value_type) + 4 * sizeof(void *);
+    size_t usage = 0;
+    for (const auto address_type : kAddressTypes) {
+        const auto &access_state_map = GetAccessStateMap(address_type);
+        usage += access_state_map.size() * kNodeSize;
+        for (const auto &access : access_state_map) {
+            usage += access.second.GetHeapSize();
+        }
+    }
+    return usage;
+}
+
+// Drop the accesses known to be complete, i.e. those before the tag limit of a waited fence
+void AccessContext::RetireAccesses(const ResourceUsageTag &limit) {
+    for (const auto address_type : kAddressTypes) {
+        auto &accesses = GetAccessStateMap(address_type);
+        auto pos = accesses.begin();
+        while (pos != accesses.end()) {
+            if (pos->second.RetireAccesses(limit)) {
+                pos = accesses.erase(pos);
+            } else {
+                ++pos;
+            }
+        }
+    }
+}
+
 void AccessContext::ApplyImageBarrier(const IMAGE_STATE &image, VkPipelineStageFlags src_exec_scope,
                                       SyncStageAccessFlags src_access_scope, VkPipelineStageFlags dst_exec_scope,
                                       SyncStageAccessFlags dst_access_scope, const VkImageSubresourceRange &subresource_range) {
@@ -1374,8 +1485,11 @@ void AccessContext::ApplyImageBarrier(const IMAGE_STATE &image, VkPipelineStageF
                                       SyncStageAccessFlags dst_access_scope, const VkImageSubresourceRange &subresource_range,
                                       bool layout_transition, const ResourceUsageTag &tag) {
     if (layout_transition) {
-        UpdateAccessState(image, SYNC_IMAGE_LAYOUT_TRANSITION, subresource_range, VkOffset3D{0, 0, 0}, image.createInfo.extent,
-                          tag);
+        // The transition barrier is needed to validate the transition against prior submissions, if it is a first access
+        const SyncBarrier transition_barrier(src_exec_scope, src_access_scope, dst_exec_scope, dst_access_scope);
+        const UpdateMemoryAccessStateFunctor action(ImageAddressType(image), *this, SYNC_IMAGE_LAYOUT_TRANSITION, tag,
+                                                    &transition_barrier);
+        UpdateMemoryAccess(image, subresource_range, action);
         ApplyImageBarrier(image, src_exec_scope, SYNC_IMAGE_LAYOUT_TRANSITION_BIT, dst_exec_scope, dst_access_scope,
                           subresource_range);
     } else {
@@ -1823,6 +1937,15 @@ void CommandBufferAccessContext::RecordEndRenderPass(const RENDER_PASS_STATE &re
     current_renderpass_context_ = nullptr;
 }
 
+size_t CommandBufferAccessContext::GetMemoryUsage() const {
+    size_t usage = sizeof(*this) + cb_access_context_.GetMemoryUsage() + first_access_log_.GetMemoryUsage();
+    usage += (render_pass_contexts_.capacity() - render_pass_contexts_.size()) * sizeof(RenderPassAccessContext);
+    for (const auto &render_pass_context : render_pass_contexts_) {
+        usage += render_pass_context.GetMemoryUsage();
+    }
+    return usage;
+}
+
 bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const SyncValidator &sync_state, const CMD_BUFFER_STATE &cmd,
                                                             const VkRect2D &render_area, const char *func_name) const {
     bool skip = false;
@@ -2004,6 +2127,14 @@ AccessContext *RenderPassAccessContext::CreateStoreResolveProxy(const VkRect2D &
     return CreateStoreResolveProxyContext(CurrentContext(), *rp_state_, current_subpass_, render_area, attachment_views_);
 }
 
+size_t RenderPassAccessContext::GetMemoryUsage() const {
+    size_t usage = sizeof(*this) + attachment_views_.capacity() * sizeof(const IMAGE_VIEW_STATE *);
+    for (const auto &subpass_context : subpass_contexts_) {
+        usage += sizeof(AccessContext) + subpass_context.GetMemoryUsage();
+    }
+    return usage;
+}
+
 bool RenderPassAccessContext::ValidateFinalSubpassLayoutTransitions(const SyncValidator &sync_state, const VkRect2D &render_area,
                                                                     const char *func_name) const {
     bool skip = false;
@@ -2110,6 +2241,16 @@ void RenderPassAccessContext::RecordLoadOperations(const VkRect2D &render_area,
     }
 }
 
+// Subpass dependencies from (to) external are also memory dependencies for all the work submitted before (after) the command
+// buffer, so are logged as global barriers for submit time validation.
+static void LogSrcExternalDependency(const AccessContext &subpass_context) {
+    auto *first_access_log = subpass_context.GetFirstAccessLog();
+    const auto &src_external = subpass_context.GetSrcExternalTrackBack();
+    if (first_access_log && src_external.context) {
+        first_access_log->LogBarrier(src_external.barrier);
+    }
+}
+
 void RenderPassAccessContext::RecordBeginRenderPass(const SyncValidator &state, const CMD_BUFFER_STATE &cb_state,
                                                     const AccessContext *external_context, VkQueueFlags queue_flags,
                                                     const ResourceUsageTag &tag) {
@@ -2122,6 +2263,7 @@ void RenderPassAccessContext::RecordBeginRenderPass(const SyncValidator &state,
     }
     attachment_views_ = state.GetCurrentAttachmentViews(cb_state);
 
+    LogSrcExternalDependency(CurrentContext());
     RecordLayoutTransitions(tag);
     RecordLoadOperations(cb_state.activeRenderPassBeginInfo.renderArea, tag);
 }
@@ -2133,6 +2275,7 @@ void RenderPassAccessContext::RecordNextSubpass(const VkRect2D &render_area, con
 
     current_subpass_++;
     assert(current_subpass_ < subpass_contexts_.size());
+    LogSrcExternalDependency(CurrentContext());
     RecordLayoutTransitions(tag);
     RecordLoadOperations(render_area, tag);
 }
@@ -2146,6 +2289,16 @@ void RenderPassAccessContext::RecordEndRenderPass(AccessContext *external_contex
     // Export the accesses from the renderpass...
     external_context->ResolveChildContexts(subpass_contexts_);
 
+    auto *first_access_log = external_context->GetFirstAccessLog();
+    if (first_access_log) {
+        for (const auto &subpass_context : subpass_contexts_) {
+            const auto &dst_external = subpass_context.GetDstExternalTrackBack();
+            if (dst_external.context) {
+                first_access_log->LogBarrier(dst_external.barrier);
+            }
+        }
+    }
+
     // Add the "finalLayout" transitions to external
     // Get them from where there we're hidding in the extra entry.
     const auto &final_transitions = rp_state_->subpass_transitions.back();
@@ -2195,9 +2348,8 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index)
         // Otherwise test against last_write
         //
         // Look for casus belli for WAR
-        if (last_read_count) {
-            for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-                const auto &read_access = last_reads[read_index];
+        if (last_reads.size()) {
+            for (const auto &read_access : last_reads) {
                 if (IsReadHazard(usage_stage, read_access)) {
                     hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
                     break;
@@ -2241,12 +2393,11 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
 
     } else {
         // Only check for WAW if there are no reads since last_write
-        if (last_read_count) {
+        if (last_reads.size()) {
             // Ignore ordered read stages (which represent frame-buffer local operations, except input attachment
             const auto unordered_reads = last_read_stages & ~ordering.exec_scope;
             // Look for any WAR hazards outside the ordered set of stages
-            for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-                const auto &read_access = last_reads[read_index];
+            for (const auto &read_access : last_reads) {
                 if ((read_access.stage & unordered_reads) && IsReadHazard(usage_stage, read_access)) {
                     hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
                     break;
@@ -2278,7 +2429,7 @@ HazardResult ResourceAccessState::DetectAsyncHazard(SyncStageAccessIndex usage_i
     } else {
         if (last_write != 0) {
             hazard.Set(this, usage_index, WRITE_RACING_WRITE, last_write, write_tag);
-        } else if (last_read_count > 0) {
+        } else if (last_reads.size()) {
             hazard.Set(this, usage_index, WRITE_RACING_READ, last_reads[0].access, last_reads[0].tag);
         } else if (input_attachment_barriers != kNoAttachmentRead) {
             hazard.Set(this, usage_index, WRITE_RACING_READ, SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ, input_attachment_tag);
@@ -2294,10 +2445,9 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
     HazardResult hazard;
     // only test for WAW if there no intervening read operations.
     // See DetectHazard(SyncStagetAccessIndex) above for more details.
-    if (last_read_count) {
+    if (last_reads.size()) {
         // Look at the reads if any
-        for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-            const auto &read_access = last_reads[read_index];
+        for (const auto &read_access : last_reads) {
             // If the read stage is not in the src sync sync
             // *AND* not execution chained with an existing sync barrier (that's the or)
             // then the barrier access is unsafe (R/W after R)
@@ -2351,13 +2501,11 @@ void ResourceAccessState::Resolve(const ResourceAccessState &other) {
         }
         // The else clause is that only this has an attachment read and no merge is needed
 
-        for (uint32_t other_read_index = 0; other_read_index < other.last_read_count; other_read_index++) {
-            auto &other_read = other.last_reads[other_read_index];
+        for (auto &other_read : other.last_reads) {
             if (last_read_stages & other_read.stage) {
                 // Merge in the barriers for read stages that exist in *both* this and other
                 // TODO: This is N^2 with stages... perhaps the ReadStates should be by stage index.
-                for (uint32_t my_read_index = 0; my_read_index < last_read_count; my_read_index++) {
-                    auto &my_read = last_reads[my_read_index];
+                for (auto &my_read : last_reads) {
                     if (other_read.stage == my_read.stage) {
                         if (my_read.tag.IsBefore(other_read.tag)) {
                             my_read.tag = other_read.tag;
@@ -2369,8 +2517,7 @@ void ResourceAccessState::Resolve(const ResourceAccessState &other) {
                 }
             } else {
                 // The other read stage doesn't exist in this, so add it.
-                last_reads[last_read_count] = other_read;
-                last_read_count++;
+                last_reads.push_back(other_read);
                 last_read_stages |= other_read.stage;
             }
         }
@@ -2391,8 +2538,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, const Resourc
         // However, for purposes of barrier tracking, only one read per pipeline stage matters
         const auto usage_stage = PipelineStageBit(usage_index);
         if (usage_stage & last_read_stages) {
-            for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-                ReadState &access = last_reads[read_index];
+            for (auto &access : last_reads) {
                 if (access.stage == usage_stage) {
                     access.access = usage_bit;
                     access.barriers = 0;
@@ -2402,12 +2548,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, const Resourc
             }
         } else {
             // We don't have this stage in the list yet...
-            assert(last_read_count < last_reads.size());
-            ReadState &access = last_reads[last_read_count++];
-            access.stage = usage_stage;
-            access.access = usage_bit;
-            access.barriers = 0;
-            access.tag = tag;
+            last_reads.emplace_back(usage_stage, usage_bit, 0, tag);
             last_read_stages |= usage_stage;
         }
     } else {
@@ -2416,7 +2557,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, const Resourc
         // Clobber last read and all barriers... because all we have is DANGER, DANGER, WILL ROBINSON!!!
         // if the last_reads/last_write were unsafe, we've reported them,
         // in either case the prior access is irrelevant, we can overwrite them as *this* write is now after them
-        last_read_count = 0;
+        last_reads.clear();
         last_read_stages = 0;
         read_execution_barriers = 0;
 
@@ -2432,8 +2573,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, const Resourc
 
 void ResourceAccessState::ApplyExecutionBarrier(VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask) {
     // Execution Barriers only protect read operations
-    for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-        ReadState &access = last_reads[read_index];
+    for (auto &access : last_reads) {
         // The | implements the "dependency chain" logic for this access, as the barriers field stores the second sync scope
         if (srcStageMask & (access.stage | access.barriers)) {
             access.barriers |= dstStageMask;
@@ -2466,8 +2606,7 @@ VkPipelineStageFlags ResourceAccessState::GetReadBarriers(SyncStageAccessFlags u
     if (usage_bit & SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT) {
         barriers = input_attachment_barriers;
     } else {
-        for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-            const auto &read_access = last_reads[read_index];
+        for (const auto &read_access : last_reads) {
             if (read_access.access & usage_bit) {
                 barriers = read_access.barriers;
                 break;
@@ -2477,6 +2616,266 @@ VkPipelineStageFlags ResourceAccessState::GetReadBarriers(SyncStageAccessFlags u
     return barriers;
 }
 
+// Whether an access at this state could hazard with work submitted before the command buffer, i.e. the access isn't ordered
+// after a write to the same range, or after an earlier read from the same stage, within the command buffer
+bool ResourceAccessState::IsFirstAccess(SyncStageAccessIndex usage_index) const {
+    if (HasWriteOp()) return false;
+    const auto usage_bit = FlagBit(usage_index);
+    if (usage_bit == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT) {
+        return input_attachment_barriers == kNoAttachmentRead;
+    } else if (IsRead(usage_bit)) {
+        return 0 == (PipelineStageBit(usage_index) & last_read_stages);
+    }
+    return true;
+}
+
+// Asynchronous hazards between the accesses of a recently submitted command buffer and those of this state (from another
+// queue) at or after start_tag.
+HazardResult ResourceAccessState::DetectAsyncHazard(const ResourceAccessState &recent, const ResourceUsageTag &start_tag) const {
+    HazardResult hazard;
+    const bool async_write = (last_write != 0) && !write_tag.IsBefore(start_tag);
+    if (recent.last_write) {
+        const auto *usage_info = SyncStageAccessInfoFromMask(recent.last_write);
+        if (!usage_info) return hazard;
+        const auto usage_index = usage_info->stage_access_index;
+        if (async_write) {
+            hazard.Set(this, usage_index, WRITE_RACING_WRITE, last_write, write_tag);
+        } else {
+            for (const auto &read_access : last_reads) {
+                if (!read_access.tag.IsBefore(start_tag)) {
+                    hazard.Set(this, usage_index, WRITE_RACING_READ, read_access.access, read_access.tag);
+                    break;
+                }
+            }
+            if (!hazard.hazard && (input_attachment_barriers != kNoAttachmentRead) && !input_attachment_tag.IsBefore(start_tag)) {
+                hazard.Set(this, usage_index, WRITE_RACING_READ, SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT,
+                           input_attachment_tag);
+            }
+        }
+    } else if (async_write) {
+        if (recent.last_reads.size()) {
+            const auto *usage_info = SyncStageAccessInfoFromMask(recent.last_reads[0].access);
+            if (usage_info) {
+                hazard.Set(this, usage_info->stage_access_index, READ_RACING_WRITE, last_write, write_tag);
+            }
+        } else if (recent.input_attachment_barriers != kNoAttachmentRead) {
+            hazard.Set(this, SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ, READ_RACING_WRITE, last_write, write_tag);
+        }
+    }
+    return hazard;
+}
+
+// Unlike Resolve, which merges states of unordered contexts by tag, the accesses of later are known to be more recent than
+// any here (e.g. from a subsequently submitted command buffer). A later write supersedes everything, and later reads supersede
+// the reads from the same stage.
+void ResourceAccessState::ResolveLaterAccesses(const ResourceAccessState &later) {
+    if (later.HasWriteOp()) {
+        *this = later;
+        return;
+    }
+
+    if (later.input_attachment_barriers != kNoAttachmentRead) {
+        input_attachment_barriers = later.input_attachment_barriers;
+        input_attachment_tag = later.input_attachment_tag;
+    }
+    for (const auto &later_read : later.last_reads) {
+        if (last_read_stages & later_read.stage) {
+            for (auto &my_read : last_reads) {
+                if (my_read.stage == later_read.stage) {
+                    my_read = later_read;
+                    break;
+                }
+            }
+        } else {
+            last_reads.push_back(later_read);
+            last_read_stages |= later_read.stage;
+        }
+    }
+    read_execution_barriers |= later.read_execution_barriers;
+}
+
+// Command buffer tags encode the reset count in the upper 32 bits, replace it with the submit tag base of the queue
+void ResourceAccessState::RebaseTags(uint64_t tag_base) {
+    const auto rebase = [tag_base](ResourceUsageTag *tag) { tag->index = tag_base | (tag->index & 0xFFFFFFFF); };
+    if (last_write) {
+        rebase(&write_tag);
+    }
+    if (input_attachment_barriers != kNoAttachmentRead) {
+        rebase(&input_attachment_tag);
+    }
+    for (auto &read_access : last_reads) {
+        rebase(&read_access.tag);
+    }
+}
+
+// Drop the accesses before limit, returning true if no accesses remain
+bool ResourceAccessState::RetireAccesses(const ResourceUsageTag &limit) {
+    if (last_write && write_tag.IsBefore(limit)) {
+        last_write = 0;
+        write_barriers = ~SyncStageAccessFlags(0);
+        write_dependency_chain = 0;
+        write_tag = ResourceUsageTag();
+    }
+
+    ReadStates::size_type kept_count = 0;
+    VkPipelineStageFlags kept_stages = 0;
+    for (ReadStates::size_type read_index = 0; read_index < last_reads.size(); read_index++) {
+        const auto &read_access = last_reads[read_index];
+        if (!read_access.tag.IsBefore(limit)) {
+            kept_stages |= read_access.stage;
+            if (kept_count != read_index) {
+                last_reads[kept_count] = read_access;
+            }
+            kept_count++;
+        }
+    }
+    last_reads.resize(kept_count);
+    last_read_stages = kept_stages;
+
+    if ((input_attachment_barriers != kNoAttachmentRead) && input_attachment_tag.IsBefore(limit)) {
+        input_attachment_barriers = kNoAttachmentRead;
+    }
+
+    const bool retired = !last_write && last_reads.empty() && (input_attachment_barriers == kNoAttachmentRead);
+    if (retired) {
+        read_execution_barriers = 0;
+    }
+    return retired;
+}
+
+void FirstAccessLog::LogAccess(AccessContext::AddressType type, const ResourceAccessRange &range, SyncStageAccessIndex usage_index,
+                               const ResourceUsageTag &tag, const ResourceAccessState &current_state,
+                               const SyncBarrier *transition_barrier) {
+    if (!current_state.IsFirstAccess(usage_index)) return;
+
+    const auto barrier_count = barriers_.size();
+    if (!accesses_.empty()) {
+        // Coalesce the adjacent ranges of a single access, as updates are applied per range map entry
+        auto &last = accesses_.back();
+        if ((last.type == type) && (last.usage_index == usage_index) && (last.tag == tag) &&
+            (last.barrier_count == barrier_count) && (last.range.end == range.begin)) {
+            last.range.end = range.end;
+            return;
+        }
+    }
+    accesses_.emplace_back(
+        Access{type, range, usage_index, tag, barrier_count, transition_barrier ? *transition_barrier : SyncBarrier()});
+}
+
+void FirstAccessLog::LogBarrier(const SyncBarrier &barrier) {
+    barriers_.emplace_back(Barrier{AccessContext::kLinearAddress, full_range, barrier, true, true, true});
+}
+
+// Mirrors ApplyGlobalBarrierFunctor, the execution dependency followed by the memory dependencies of each barrier
+void FirstAccessLog::LogGlobalBarriers(VkPipelineStageFlags src_exec_scope, VkPipelineStageFlags dst_exec_scope,
+                                       SyncStageAccessFlags src_stage_accesses, SyncStageAccessFlags dst_stage_accesses,
+                                       uint32_t memory_barrier_count, const VkMemoryBarrier *memory_barriers) {
+    const SyncBarrier execution_barrier(src_exec_scope, 0, dst_exec_scope, 0);
+    barriers_.emplace_back(Barrier{AccessContext::kLinearAddress, full_range, execution_barrier, true, true, false});
+    for (uint32_t barrier_index = 0; barrier_index < memory_barrier_count; barrier_index++) {
+        const auto &barrier = memory_barriers[barrier_index];
+        const SyncBarrier memory_barrier(src_exec_scope, SyncStageAccess::AccessScope(src_stage_accesses, barrier.srcAccessMask),
+                                         dst_exec_scope, SyncStageAccess::AccessScope(dst_stage_accesses, barrier.dstAccessMask));
+        barriers_.emplace_back(Barrier{AccessContext::kLinearAddress, full_range, memory_barrier, true, false, true});
+    }
+}
+
+void FirstAccessLog::LogMemoryBarrier(AccessContext::AddressType type, const ResourceAccessRange &range,
+                                      const SyncBarrier &barrier) {
+    barriers_.emplace_back(Barrier{type, range, barrier, false, false, true});
+}
+
+void FirstAccessLog::LogImageBarrier(const IMAGE_STATE &image, const VkImageSubresourceRange &subresource_range,
+                                     const SyncBarrier &barrier) {
+    if (!SimpleBinding(image)) return;
+    const auto address_type = AccessContext::ImageAddressType(image);
+    subresource_adapter::ImageRangeGenerator range_gen(*image.fragment_encoder.get(), subresource_range, {0, 0, 0},
+                                                       image.createInfo.extent);
+    const auto base_address = AccessContext::ResourceBaseAddress(image);
+    for (; range_gen->non_empty(); ++range_gen) {
+        LogMemoryBarrier(address_type, (*range_gen + base_address), barrier);
+    }
+}
+
+static void ApplyLoggedBarrier(const FirstAccessLog::Barrier &logged, AccessContext *context) {
+    const ApplyLoggedBarrierFunctor barrier_action(logged);
+    if (logged.global) {
+        context->ApplyGlobalBarriers(barrier_action);
+    } else {
+        UpdateMemoryAccessState(&context->GetAccessStateMap(logged.type), logged.range, barrier_action);
+    }
+}
+
+// Check a first access of a command buffer against the accesses of the queue
+static HazardResult DetectFirstAccessHazard(const AccessContext &context, const FirstAccessLog::Access &access) {
+    HazardResult hazard;
+    const auto &accesses = context.GetAccessStateMap(access.type);
+    const auto to = accesses.upper_bound(access.range);
+    for (auto pos = accesses.lower_bound(access.range); (pos != to) && !hazard.hazard; ++pos) {
+        if (access.usage_index == SYNC_IMAGE_LAYOUT_TRANSITION) {
+            const auto &barrier = access.transition_barrier;
+            hazard = pos->second.DetectBarrierHazard(access.usage_index, barrier.src_exec_scope, barrier.src_access_scope);
+        } else {
+            hazard = pos->second.DetectHazard(access.usage_index);
+        }
+    }
+    return hazard;
+}
+
+// Check the accesses of a command buffer against those of another queue not synchronized with the submitting queue
+static HazardResult DetectQueueRaceHazard(const AccessContext &submitted, const QueueSyncState &other_queue,
+                                          const ResourceUsageTag &start_tag) {
+    HazardResult hazard;
+    const auto &other_context = other_queue.GetState()->access_context;
+    for (const auto address_type : {AccessContext::kLinearAddress, AccessContext::kIdealizedAddress}) {
+        const auto &other_accesses = other_context.GetAccessStateMap(address_type);
+        if (other_accesses.empty()) continue;
+        for (const auto &submitted_access : submitted.GetAccessStateMap(address_type)) {
+            const auto to = other_accesses.upper_bound(submitted_access.first);
+            for (auto pos = other_accesses.lower_bound(submitted_access.first); pos != to; ++pos) {
+                hazard = pos->second.DetectAsyncHazard(submitted_access.second, start_tag);
+                // Accesses the other queue imported through semaphore waits are not its own, and may be ordered with ours
+                if (hazard.hazard && other_queue.IsOwnSubmit(hazard.tag.index)) return hazard;
+            }
+        }
+    }
+    return HazardResult();
+}
+
+bool QueueSyncState::IsOwnSubmit(uint64_t tag_index) const {
+    const auto &submit_indices = state_->submit_indices;
+    return std::binary_search(submit_indices.cbegin(), submit_indices.cend(), tag_index >> 32);
+}
+
+QueueSyncState::State *QueueSyncState::GetWritableState() {
+    if (state_.use_count() > 1) {
+        // Shared with a signaled semaphore, so copy on write
+        state_ = std::make_shared<State>(*state_);
+    }
+    return state_.get();
+}
+
+void QueueSyncState::Retire(uint64_t tag_limit) {
+    auto *state = GetWritableState();
+    state->access_context.RetireAccesses(ResourceUsageTag(tag_limit, CMD_NONE));
+    auto &submit_indices = state->submit_indices;
+    submit_indices.erase(submit_indices.begin(),
+                         std::lower_bound(submit_indices.begin(), submit_indices.end(), tag_limit >> 32));
+}
+
+size_t QueueSyncState::GetMemoryUsage() const {
+    // Hash map nodes carry a next link in addition to the value
+    constexpr size_t kTagNodeSize = sizeof(std::pair<const VkQueue, uint64_t>) + sizeof(void *);
+    return sizeof(State) + state_->access_context.GetMemoryUsage() + state_->submit_indices.capacity() * sizeof(uint64_t) +
+           state_->synchronized_tags.size() * kTagNodeSize;
+}
+
+void QueueSyncState::Reset() {
+    auto state = std::make_shared<State>();
+    state->tag_limit = state_->tag_limit;
+    state_ = std::move(state);
+}
+
 void SyncValidator::ResetCommandBufferCallback(VkCommandBuffer command_buffer) {
     auto *access_context = GetAccessContextNoInsert(command_buffer);
     if (access_context) {
@@ -2500,6 +2899,11 @@ void SyncValidator::ApplyGlobalBarriers(AccessContext *context, VkPipelineStageF
     ApplyGlobalBarrierFunctor barriers_functor(srcStageMask, dstStageMask, src_access_scope, dst_access_scope, memoryBarrierCount,
                                                pMemoryBarriers);
     context->ApplyGlobalBarriers(barriers_functor);
+    auto *first_access_log = context->GetFirstAccessLog();
+    if (first_access_log) {
+        first_access_log->LogGlobalBarriers(srcStageMask, dstStageMask, src_access_scope, dst_access_scope, memoryBarrierCount,
+                                            pMemoryBarriers);
+    }
 }
 
 void SyncValidator::ApplyBufferBarriers(AccessContext *context, VkPipelineStageFlags src_exec_scope,
@@ -2516,6 +2920,12 @@ void SyncValidator::ApplyBufferBarriers(AccessContext *context, VkPipelineStageF
         const auto dst_access_scope = AccessScope(dst_stage_accesses, barrier.dstAccessMask);
         const ApplyMemoryAccessBarrierFunctor update_action(src_exec_scope, src_access_scope, dst_exec_scope, dst_access_scope);
         context->UpdateMemoryAccess(*buffer, range, update_action);
+        auto *first_access_log = context->GetFirstAccessLog();
+        if (first_access_log && SimpleBinding(*buffer)) {
+            const SyncBarrier sync_barrier(src_exec_scope, src_access_scope, dst_exec_scope, dst_access_scope);
+            first_access_log->LogMemoryBarrier(AccessContext::kLinearAddress, range + AccessContext::ResourceBaseAddress(*buffer),
+                                               sync_barrier);
+        }
     }
 }
 
@@ -2533,6 +2943,12 @@ void SyncValidator::ApplyImageBarriers(AccessContext *context, VkPipelineStageFl
         const auto dst_access_scope = AccessScope(dst_stage_accesses, barrier.dstAccessMask);
         context->ApplyImageBarrier(*image, src_exec_scope, src_access_scope, dst_exec_scope, dst_access_scope, subresource_range,
                                    layout_transition, tag);
+        auto *first_access_log = context->GetFirstAccessLog();
+        if (first_access_log && !layout_transition) {
+            // A layout transition is a write, superseding any prior state and thus needs no logged barrier
+            const SyncBarrier sync_barrier(src_exec_scope, src_access_scope, dst_exec_scope, dst_access_scope);
+            first_access_log->LogImageBarrier(*image, subresource_range, sync_barrier);
+        }
     }
 }
 
@@ -2758,6 +3174,353 @@ void SyncValidator::PostCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDev
     sync_device_state->SetCommandBufferFreeCallback([sync_device_state](VkCommandBuffer command_buffer) -> void {
         sync_device_state->FreeCommandBufferCallback(command_buffer);
     });
+
+    const char *stats_string = getLayerOption("khronos_validation.sync_memory_stats");
+    sync_device_state->report_memory_stats = *stats_string ? !strcmp(stats_string, "true") : false;
+}
+
+void SyncValidator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    if (report_memory_stats) ReportMemoryStats();
+    StateTracker::PreCallRecordDestroyDevice(device, pAllocator);
+}
+
+void SyncValidator::ReportMemoryStats() const {
+    uint64_t cb_usage = 0;
+    for (const auto &cb_access : cb_access_state) {
+        cb_usage += cb_access.second->GetMemoryUsage();
+    }
+    uint64_t queue_usage = 0;
+    for (const auto &queue_sync : queue_sync_states) {
+        queue_usage += queue_sync.second->GetMemoryUsage();
+    }
+    LogInfo(device, "UNASSIGNED-SYNC-Memory-Stats",
+            "%" PRIu64 " command buffer access contexts hold %" PRIu64 " KiB, the largest at vkEndCommandBuffer held %" PRIu64
+            " KiB. %" PRIu64 " queue states hold %" PRIu64 " KiB, the largest after a vkQueueSubmit held %" PRIu64 " KiB.",
+            static_cast<uint64_t>(cb_access_state.size()), cb_usage >> 10, static_cast<uint64_t>(peak_cb_memory_usage >> 10),
+            static_cast<uint64_t>(queue_sync_states.size()), queue_usage >> 10,
+            static_cast<uint64_t>(peak_queue_memory_usage >> 10));
+}
+
+void SyncValidator::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, VkResult result) {
+    StateTracker::PostCallRecordEndCommandBuffer(commandBuffer, result);
+    if (!report_memory_stats || (VK_SUCCESS != result)) return;
+    const auto *cb_access_context = GetAccessContextNoInsert(commandBuffer);
+    if (cb_access_context) {
+        peak_cb_memory_usage = std::max(peak_cb_memory_usage, cb_access_context->GetMemoryUsage());
+    }
+}
+
+void SyncValidator::RecordGetDeviceQueue(uint32_t queue_family_index, VkQueue queue) {
+    if (queue_sync_states.find(queue) != queue_sync_states.end()) return;
+    const auto &queue_family_properties = GetPhysicalDeviceState()->queue_family_properties;
+    VkQueueFlags queue_flags = 0;
+    if (queue_family_index < queue_family_properties.size()) {
+        queue_flags = queue_family_properties[queue_family_index].queueFlags;
+    }
+    queue_sync_states.emplace(queue, std::unique_ptr<QueueSyncState>(new QueueSyncState(queue, queue_flags)));
+}
+
+void SyncValidator::PostCallRecordGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex,
+                                                 VkQueue *pQueue) {
+    StateTracker::PostCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+    RecordGetDeviceQueue(queueFamilyIndex, *pQueue);
+}
+
+void SyncValidator::PostCallRecordGetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2 *pQueueInfo, VkQueue *pQueue) {
+    StateTracker::PostCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
+    RecordGetDeviceQueue(pQueueInfo->queueFamilyIndex, *pQueue);
+}
+
+// Validate the command buffer against the accesses of prior submissions, and other queues, updating state with its barriers.
+bool SyncValidator::ValidateSubmittedCommandBuffer(const CommandBufferAccessContext &cb_context, const QueueSyncState &queue_sync,
+                                                   uint32_t submit_index, uint32_t cb_index, QueueSyncState::State *state) const {
+    bool skip = false;
+    const auto *cb_state = cb_context.GetCommandBufferState();
+    if (!cb_state) return skip;
+    const auto command_buffer = cb_state->commandBuffer;
+    const auto &first_access_log = cb_context.GetFirstAccessLog();
+    const auto &barriers = first_access_log.GetBarriers();
+    auto *queue_context = &state->access_context;
+
+    // The barriers are applied to the queue state as they are reached, s.t. each first access is checked against exactly the
+    // prior accesses and the barriers recorded before it.
+    size_t barrier_index = 0;
+    for (const auto &access : first_access_log.GetAccesses()) {
+        for (; barrier_index < access.barrier_count; barrier_index++) {
+            ApplyLoggedBarrier(barriers[barrier_index], queue_context);
+        }
+        const auto hazard = DetectFirstAccessHazard(*queue_context, access);
+        if (hazard.hazard) {
+            skip |= LogError(command_buffer, string_SyncHazardVUID(hazard.hazard),
+                             "vkQueueSubmit: Hazard %s for pSubmits[%" PRIu32 "].pCommandBuffers[%" PRIu32
+                             "] %s, %s with an access of a previously submitted command buffer. Access info %s.",
+                             string_SyncHazard(hazard.hazard), submit_index, cb_index,
+                             report_data->FormatHandle(command_buffer).c_str(), CommandTypeString(access.tag.command),
+                             string_UsageTag(hazard).c_str());
+        }
+    }
+    for (; barrier_index < barriers.size(); barrier_index++) {
+        ApplyLoggedBarrier(barriers[barrier_index], queue_context);
+    }
+
+    // Work on other queues is unordered with this command buffer, unless synchronized by semaphore before the submit
+    for (const auto &other_queue : queue_sync_states) {
+        if (other_queue.first == queue_sync.GetQueue()) continue;
+        const auto synchronized = state->synchronized_tags.find(other_queue.first);
+        const ResourceUsageTag start_tag((synchronized != state->synchronized_tags.end()) ? synchronized->second : 0, CMD_NONE);
+        const auto hazard = DetectQueueRaceHazard(cb_context.GetCbAccessContext(), *other_queue.second, start_tag);
+        if (hazard.hazard) {
+            skip |= LogError(command_buffer, string_SyncHazardVUID(hazard.hazard),
+                             "vkQueueSubmit: Hazard %s for pSubmits[%" PRIu32 "].pCommandBuffers[%" PRIu32
+                             "] %s with work submitted to %s. Access info %s.",
+                             string_SyncHazard(hazard.hazard), submit_index, cb_index,
+                             report_data->FormatHandle(command_buffer).c_str(),
+                             report_data->FormatHandle(other_queue.first).c_str(), string_UsageTag(hazard).c_str());
+        }
+    }
+    return skip;
+}
+
+// Copy the queue state within the ranges the submit's command buffers access into delta, and return those ranges in
+// delta_ranges. Semaphore waits and barriers are the only other updates a submit makes to the queue state, and only matter to
+// validation where a command buffer accesses the state, so waits import the signaled accesses within delta_ranges alone.
+void SyncValidator::BuildSubmitDelta(const QueueSyncState &queue_sync, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                     QueueSyncState::State *delta, AccessContext::AddressRanges *delta_ranges) const {
+    AccessContext::AddressRanges touched;
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        const auto &submit = pSubmits[submit_idx];
+        for (uint32_t cb_index = 0; cb_index < submit.commandBufferCount; cb_index++) {
+            const auto *cb_context = GetAccessContext(submit.pCommandBuffers[cb_index]);
+            if (!cb_context) continue;
+            for (const auto address_type : AccessContext::kAddressTypes) {
+                for (const auto &access : cb_context->GetCbAccessContext().GetAccessStateMap(address_type)) {
+                    touched[address_type].emplace_back(access.first);
+                }
+            }
+            for (const auto &access : cb_context->GetFirstAccessLog().GetAccesses()) {
+                touched[access.type].emplace_back(access.range);
+            }
+        }
+    }
+
+    const auto &state = *queue_sync.GetState();
+    for (const auto address_type : AccessContext::kAddressTypes) {
+        auto &ranges = touched[address_type];
+        std::sort(ranges.begin(), ranges.end());
+        const auto &accesses = state.access_context.GetAccessStateMap(address_type);
+        auto &delta_accesses = delta->access_context.GetAccessStateMap(address_type);
+        auto &coalesced = (*delta_ranges)[address_type];
+        auto range_it = ranges.cbegin();
+        while (range_it != ranges.cend()) {
+            // Coalesce overlapping and adjacent ranges, s.t. each queue state entry is copied once
+            ResourceAccessRange range = *range_it;
+            for (++range_it; (range_it != ranges.cend()) && (range_it->begin <= range.end); ++range_it) {
+                range.end = std::max(range.end, range_it->end);
+            }
+            coalesced.emplace_back(range);
+            for (auto pos = accesses.lower_bound(range); (pos != accesses.cend()) && (pos->first.begin < range.end); ++pos) {
+                delta_accesses.insert(delta_accesses.cend(), std::make_pair(pos->first & range, pos->second));
+            }
+        }
+    }
+    delta->synchronized_tags = state.synchronized_tags;
+    delta->tag_limit = state.tag_limit;
+}
+
+// ranges restricts the import of the signaled accesses, see BuildSubmitDelta
+static void ApplySemaphoreWait(const QueueSyncState::PendingSubmit::Wait &wait, QueueSyncState::State *state,
+                               const AccessContext::AddressRanges *ranges) {
+    if (wait.signaled_in_call) {
+        // Signaled by this queue, whose state already holds the signaled accesses, s.t. the wait acts as a global barrier.  This
+        // also orders any command buffers submitted between the signal and the wait, which the semaphore does not.
+        const FirstAccessLog::Barrier wait_barrier{AccessContext::kLinearAddress, full_range, wait.barrier, true, true, true};
+        ApplyLoggedBarrier(wait_barrier, &state->access_context);
+        return;
+    }
+    if (wait.signal.state) {
+        state->access_context.ResolveSignaledAccesses(wait.signal.state->access_context, wait.barrier, ranges);
+        for (const auto &synchronized : wait.signal.state->synchronized_tags) {
+            auto &tag = state->synchronized_tags[synchronized.first];
+            tag = std::max(tag, synchronized.second);
+        }
+    }
+    auto &signaler_tag = state->synchronized_tags[wait.signal.queue];
+    signaler_tag = std::max(signaler_tag, wait.signal.tag_limit);
+}
+
+bool SyncValidator::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                               VkFence fence) const {
+    bool skip = false;
+    const auto *queue_sync = GetQueueSyncState(queue);
+    if (!queue_sync) return skip;
+
+    // Validation updates a delta holding only the parts of the queue state the submit accesses, s.t. its cost follows the size
+    // of the submitted command buffers rather than that of the queue state.  The queue state is updated at record time, if the
+    // submit succeeds.
+    QueueSyncState::State delta;
+    AccessContext::AddressRanges delta_ranges;
+    BuildSubmitDelta(*queue_sync, submitCount, pSubmits, &delta, &delta_ranges);
+    std::unique_ptr<QueueSyncState::PendingSubmit> pending(new QueueSyncState::PendingSubmit());
+
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        const auto &submit = pSubmits[submit_idx];
+        for (uint32_t wait_index = 0; wait_index < submit.waitSemaphoreCount; wait_index++) {
+            const auto semaphore = submit.pWaitSemaphores[wait_index];
+            QueueSyncState::PendingSubmit::Wait wait{submit_idx, semaphore, QueueSyncState::SemaphoreSignal(), SyncBarrier(),
+                                                     false};
+            auto pending_signal = std::find_if(pending->signals.begin(), pending->signals.end(),
+                                               [semaphore](const QueueSyncState::PendingSubmit::Signal &entry) {
+                                                   return entry.semaphore == semaphore;
+                                               });
+            if (pending_signal != pending->signals.end()) {
+                wait.signal = QueueSyncState::SemaphoreSignal{queue, queue_sync->GetQueueFlags(), delta.tag_limit, nullptr};
+                wait.signaled_in_call = true;
+                pending->signals.erase(pending_signal);
+            } else {
+                const auto signaled = signaled_semaphores.find(semaphore);
+                if (signaled == signaled_semaphores.end()) continue;
+                wait.signal = signaled->second;
+            }
+            const auto src_stage_mask = ExpandPipelineStages(wait.signal.queue_flags, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+            const auto dst_stage_mask = ExpandPipelineStages(queue_sync->GetQueueFlags(), submit.pWaitDstStageMask[wait_index]);
+            wait.barrier = SyncBarrier(WithEarlierPipelineStages(src_stage_mask), AccessScopeByStage(src_stage_mask),
+                                       WithLaterPipelineStages(dst_stage_mask), AccessScopeByStage(dst_stage_mask));
+            ApplySemaphoreWait(wait, &delta, &delta_ranges);
+            pending->waits.emplace_back(std::move(wait));
+        }
+
+        for (uint32_t cb_index = 0; cb_index < submit.commandBufferCount; cb_index++) {
+            const auto *cb_context = GetAccessContext(submit.pCommandBuffers[cb_index]);
+            if (!cb_context) continue;
+            const uint64_t submit_index = next_submit_index_.fetch_add(1);
+            skip |= ValidateSubmittedCommandBuffer(*cb_context, *queue_sync, submit_idx, cb_index, &delta);
+            delta.access_context.ResolveSubmittedAccesses(cb_context->GetCbAccessContext(), submit_index << 32);
+            delta.tag_limit = (submit_index + 1) << 32;
+            pending->submit_indices.emplace_back(submit_index);
+        }
+
+        for (uint32_t signal_index = 0; signal_index < submit.signalSemaphoreCount; signal_index++) {
+            const auto semaphore = submit.pSignalSemaphores[signal_index];
+            const auto *semaphore_state = Get<SEMAPHORE_STATE>(semaphore);
+            if (!semaphore_state || (semaphore_state->type != VK_SEMAPHORE_TYPE_BINARY_KHR)) continue;
+            pending->signals.emplace_back(QueueSyncState::PendingSubmit::Signal{submit_idx, semaphore});
+        }
+    }
+
+    queue_sync->pending_submit = std::move(pending);
+    return skip;
+}
+
+void SyncValidator::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
+                                              VkResult result) {
+    StateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
+    auto *queue_sync = GetQueueSyncState(queue);
+    if (!queue_sync) return;
+    std::unique_ptr<QueueSyncState::PendingSubmit> pending(std::move(queue_sync->pending_submit));
+    if (!pending || (result != VK_SUCCESS)) return;
+
+    // Replay the submit on the queue state in place.  Signals share the state as of their submit, so it is only copied if updated
+    // again before the semaphore is waited on.
+    auto wait_it = pending->waits.cbegin();
+    auto signal_it = pending->signals.cbegin();
+    auto submit_index_it = pending->submit_indices.cbegin();
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        const auto &submit = pSubmits[submit_idx];
+        for (; (wait_it != pending->waits.cend()) && (wait_it->submit == submit_idx); ++wait_it) {
+            ApplySemaphoreWait(*wait_it, queue_sync->GetWritableState(), nullptr);
+            signaled_semaphores.erase(wait_it->semaphore);
+        }
+
+        for (uint32_t cb_index = 0; cb_index < submit.commandBufferCount; cb_index++) {
+            const auto *cb_context = GetAccessContextNoInsert(submit.pCommandBuffers[cb_index]);
+            if (!cb_context || (submit_index_it == pending->submit_indices.cend())) continue;
+            const uint64_t submit_index = *submit_index_it++;
+            auto *state = queue_sync->GetWritableState();
+            for (const auto &barrier : cb_context->GetFirstAccessLog().GetBarriers()) {
+                ApplyLoggedBarrier(barrier, &state->access_context);
+            }
+            state->access_context.ResolveSubmittedAccesses(cb_context->GetCbAccessContext(), submit_index << 32);
+            state->submit_indices.emplace_back(submit_index);
+            state->tag_limit = (submit_index + 1) << 32;
+        }
+
+        for (; (signal_it != pending->signals.cend()) && (signal_it->submit == submit_idx); ++signal_it) {
+            const auto &state = queue_sync->GetState();
+            signaled_semaphores[signal_it->semaphore] =
+                QueueSyncState::SemaphoreSignal{queue, queue_sync->GetQueueFlags(), state->tag_limit, state};
+        }
+    }
+    if (fence != VK_NULL_HANDLE) {
+        fence_tags[fence] = std::make_pair(queue, queue_sync->GetState()->tag_limit);
+    }
+    if (report_memory_stats) {
+        peak_queue_memory_usage = std::max(peak_queue_memory_usage, queue_sync->GetMemoryUsage());
+    }
+}
+
+void SyncValidator::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo, VkResult result) {
+    StateTracker::PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
+    // Presentation consumes the signals, releasing their share of the signaling queue's state
+    for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
+        signaled_semaphores.erase(pPresentInfo->pWaitSemaphores[i]);
+    }
+}
+
+void SyncValidator::RetireSubmittedAccesses(VkFence fence) {
+    const auto found = fence_tags.find(fence);
+    if (found == fence_tags.end()) return;
+    auto *queue_sync = GetQueueSyncState(found->second.first);
+    if (queue_sync) {
+        queue_sync->Retire(found->second.second);
+    }
+}
+
+void SyncValidator::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                                uint64_t timeout, VkResult result) {
+    StateTracker::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
+    if (VK_SUCCESS != result) return;
+    if ((VK_TRUE == waitAll) || (1 == fenceCount)) {
+        for (uint32_t i = 0; i < fenceCount; i++) {
+            RetireSubmittedAccesses(pFences[i]);
+        }
+    }
+}
+
+void SyncValidator::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    StateTracker::PostCallRecordGetFenceStatus(device, fence, result);
+    if (VK_SUCCESS != result) return;
+    RetireSubmittedAccesses(fence);
+}
+
+void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    StateTracker::PostCallRecordQueueWaitIdle(queue, result);
+    if (VK_SUCCESS != result) return;
+    auto *queue_sync = GetQueueSyncState(queue);
+    if (queue_sync) {
+        queue_sync->Reset();
+    }
+}
+
+void SyncValidator::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    StateTracker::PostCallRecordDeviceWaitIdle(device, result);
+    if (VK_SUCCESS != result) return;
+    for (auto &queue_sync : queue_sync_states) {
+        queue_sync.second->Reset();
+    }
+    // The signaled work is complete, but the signals still synchronize the waiting queue with the signaling one
+    for (auto &signal : signaled_semaphores) {
+        signal.second.state.reset();
+    }
+}
+
+void SyncValidator::PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) {
+    StateTracker::PreCallRecordDestroyFence(device, fence, pAllocator);
+    fence_tags.erase(fence);
+}
+
+void SyncValidator::PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) {
+    StateTracker::PreCallRecordDestroySemaphore(device, semaphore, pAllocator);
+    signaled_semaphores.erase(semaphore);
 }
 
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
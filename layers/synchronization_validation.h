@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
@@ -30,6 +31,7 @@
 
 class SyncValidator;
 class ResourceAccessState;
+class FirstAccessLog;
 
 enum SyncHazard {
     NONE = 0,
@@ -100,6 +102,12 @@ struct SyncBarrier {
     SyncBarrier() = default;
     SyncBarrier &operator=(const SyncBarrier &) = default;
     SyncBarrier(VkQueueFlags gueue_flags, const VkSubpassDependency2 &sub_pass_barrier);
+    SyncBarrier(VkPipelineStageFlags src_exec_scope_, SyncStageAccessFlags src_access_scope_, VkPipelineStageFlags dst_exec_scope_,
+                SyncStageAccessFlags dst_access_scope_)
+        : src_exec_scope(src_exec_scope_),
+          src_access_scope(src_access_scope_),
+          dst_exec_scope(dst_exec_scope_),
+          dst_access_scope(dst_access_scope_) {}
 };
 
 // To represent ordering guarantees such as rasterization and store
@@ -121,12 +129,18 @@ class ResourceAccessState : public SyncStageAccess {
         SyncStageAccessFlags access;    // TODO: Change to FlagBits when we have a None bit enum
         VkPipelineStageFlags barriers;  // all applicable barriered stages
         ResourceUsageTag tag;
+        ReadState() = default;
+        ReadState(VkPipelineStageFlagBits stage_, SyncStageAccessFlags access_, VkPipelineStageFlags barriers_,
+                  const ResourceUsageTag &tag_)
+            : stage(stage_), access(access_), barriers(barriers_), tag(tag_) {}
         bool operator==(const ReadState &rhs) const {
             bool same = (stage == rhs.stage) && (access == rhs.access) && (barriers == rhs.barriers) && (tag == rhs.tag);
             return same;
         }
         bool operator!=(const ReadState &rhs) const { return !(*this == rhs); }
     };
+    // Most ranges have at most a couple of outstanding reads, so keep those inline and spill to the heap beyond that.
+    using ReadStates = small_vector<ReadState, 2, uint32_t>;
 
   public:
     HazardResult DetectHazard(SyncStageAccessIndex usage_index) const;
@@ -135,9 +149,14 @@ class ResourceAccessState : public SyncStageAccess {
     HazardResult DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags source_exec_scope,
                                      SyncStageAccessFlags source_access_scope) const;
     HazardResult DetectAsyncHazard(SyncStageAccessIndex usage_index) const;
+    HazardResult DetectAsyncHazard(const ResourceAccessState &recent, const ResourceUsageTag &start_tag) const;
 
     void Update(SyncStageAccessIndex usage_index, const ResourceUsageTag &tag);
     void Resolve(const ResourceAccessState &other);
+    void ResolveLaterAccesses(const ResourceAccessState &later);
+    void RebaseTags(uint64_t tag_base);
+    bool RetireAccesses(const ResourceUsageTag &limit);
+    bool IsFirstAccess(SyncStageAccessIndex usage_index) const;
     void ApplyBarrier(const SyncBarrier &barrier);
     void ApplyExecutionBarrier(VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask);
     void ApplyMemoryAccessBarrier(VkPipelineStageFlags src_stage_mask, SyncStageAccessFlags src_scope,
@@ -150,25 +169,23 @@ class ResourceAccessState : public SyncStageAccess {
           last_write(0),
           input_attachment_barriers(kNoAttachmentRead),
           input_attachment_tag(),
-          last_read_count(0),
           last_read_stages(0),
           read_execution_barriers(0) {}
 
     bool HasWriteOp() const { return last_write != 0; }
     bool operator==(const ResourceAccessState &rhs) const {
         bool same = (write_barriers == rhs.write_barriers) && (write_dependency_chain == rhs.write_dependency_chain) &&
-                    (last_read_count == rhs.last_read_count) && (last_read_stages == rhs.last_read_stages) &&
+                    (last_reads == rhs.last_reads) && (last_read_stages == rhs.last_read_stages) &&
                     (write_tag == rhs.write_tag) && (input_attachment_barriers == rhs.input_attachment_barriers) &&
                     ((input_attachment_barriers == kNoAttachmentRead) || input_attachment_tag == rhs.input_attachment_tag) &&
                     (read_execution_barriers == rhs.read_execution_barriers);
-        for (uint32_t i = 0; same && i < last_read_count; i++) {
-            same |= last_reads[i] == rhs.last_reads[i];
-        }
         return same;
     }
     bool operator!=(const ResourceAccessState &rhs) const { return !(*this == rhs); }
     VkPipelineStageFlags GetReadBarriers(SyncStageAccessFlags usage) const;
     SyncStageAccessFlags GetWriteBarriers() const { return write_barriers; }
+    // The memory owned by the state outside of the object itself
+    size_t GetHeapSize() const { return last_reads.heap_size(); }
 
   private:
     static constexpr VkPipelineStageFlags kNoAttachmentRead = ~VkPipelineStageFlags(0);
@@ -205,20 +222,22 @@ class ResourceAccessState : public SyncStageAccess {
     VkPipelineStageFlags input_attachment_barriers;
     ResourceUsageTag input_attachment_tag;
 
-    uint32_t last_read_count;
     VkPipelineStageFlags last_read_stages;
     VkPipelineStageFlags read_execution_barriers;
-    static constexpr size_t kStageCount = 32;  // TODO: The manual count was 28 real stages. Add stage count to codegen
-    std::array<ReadState, kStageCount> last_reads;
+    ReadStates last_reads;
 };
 
-using ResourceAccessRangeMap = sparse_container::range_map<VkDeviceSize, ResourceAccessState>;
+using ResourceAccessRangeMap = sparse_container::pooled_range_map<VkDeviceSize, ResourceAccessState>;
 using ResourceAccessRange = typename ResourceAccessRangeMap::key_type;
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
 
 class AccessContext {
   public:
     enum AddressType : int { kLinearAddress = 0, kIdealizedAddress = 1, kMaxAddressType = 1 };
+    constexpr static int kAddressTypeCount = AddressType::kMaxAddressType + 1;
+    static const std::array<AddressType, kAddressTypeCount> kAddressTypes;
+    // Sorted, disjoint ranges for each address type
+    using AddressRanges = std::array<std::vector<ResourceAccessRange>, kAddressTypeCount>;
     enum DetectOptions : uint32_t {
         kDetectPrevious = 1U << 0,
         kDetectAsync = 1U << 1,
@@ -256,6 +275,7 @@ class AccessContext {
                                           SyncStageAccessFlags src_stage_accesses, const VkImageMemoryBarrier &barrier) const;
     HazardResult DetectSubpassTransitionHazard(const TrackBack &track_back, const IMAGE_VIEW_STATE *attach_view) const;
 
+    const TrackBack &GetSrcExternalTrackBack() const { return src_external_; }
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
         prev_.clear();
@@ -294,6 +314,11 @@ class AccessContext {
                                      const ResourceUsageTag &tag);
 
     void ResolveChildContexts(const std::vector<AccessContext> &contexts);
+    void ResolveSubmittedAccesses(const AccessContext &submitted, uint64_t tag_base);
+    void ResolveSignaledAccesses(const AccessContext &signaled, const SyncBarrier &barrier, const AddressRanges *ranges);
+    void RetireAccesses(const ResourceUsageTag &limit);
+    // Approximate memory held by the access state maps, including the per-entry map node overhead
+    size_t GetMemoryUsage() const;
 
     void ApplyImageBarrier(const IMAGE_STATE &image, VkPipelineStageFlags src_exec_scope, SyncStageAccessFlags src_access_scope,
                            VkPipelineStageFlags dst_exec_scope, SyncStageAccessFlags dst_accesse_scope,
@@ -328,6 +353,16 @@ class AccessContext {
     const ResourceAccessRangeMap &GetLinearMap() const { return GetAccessStateMap(AddressType::kLinearAddress); }
     ResourceAccessRangeMap &GetIdealizedMap() { return GetAccessStateMap(AddressType::kIdealizedAddress); }
     const ResourceAccessRangeMap &GetIdealizedMap() const { return GetAccessStateMap(AddressType::kIdealizedAddress); }
+    FirstAccessLog *GetFirstAccessLog() const { return first_access_log_; }
+    void SetFirstAccessLog(FirstAccessLog *log) { first_access_log_ = log; }
+    // The pool backing the access state map nodes, must be set while the maps are empty and outlive the context.
+    sparse_container::node_pool *GetNodePool() const { return GetLinearMap().get_allocator().pool(); }
+    void SetNodePool(sparse_container::node_pool *pool) {
+        for (auto &map : access_state_maps_) {
+            assert(map.empty());
+            map = ResourceAccessRangeMap(ResourceAccessRangeMap::allocator_type(pool));
+        }
+    }
     const TrackBack *GetTrackBackFromSubpass(uint32_t subpass) const {
         if (subpass == VK_SUBPASS_EXTERNAL) {
             return &src_external_;
@@ -370,14 +405,58 @@ class AccessContext {
     HazardResult DetectPreviousHazard(AddressType type, const Detector &detector, const ResourceAccessRange &range) const;
     void UpdateAccessState(AddressType type, SyncStageAccessIndex current_usage, const ResourceAccessRange &range,
                            const ResourceUsageTag &tag);
-    constexpr static int kAddressTypeCount = AddressType::kMaxAddressType + 1;
-    static const std::array<AddressType, kAddressTypeCount> kAddressTypes;
     std::array<ResourceAccessRangeMap, kAddressTypeCount> access_state_maps_;
     std::vector<TrackBack> prev_;
     std::vector<TrackBack *> prev_by_subpass_;
     std::vector<AccessContext *> async_;
     TrackBack src_external_;
     TrackBack dst_external_;
+    FirstAccessLog *first_access_log_ = nullptr;
+};
+
+// The accesses and barriers of a command buffer needed to validate it against previously submitted work at queue submit time.
+// Only accesses not preceded by a write to the same range within the command buffer can hazard with earlier submissions, so
+// only those are logged (along with at most the first read per stage).  Barriers are kept in record order, as the accesses
+// must be checked against the queue state with exactly the barriers recorded before them applied.
+class FirstAccessLog {
+  public:
+    struct Access {
+        AccessContext::AddressType type;
+        ResourceAccessRange range;
+        SyncStageAccessIndex usage_index;
+        ResourceUsageTag tag;
+        size_t barrier_count;            // The number of barriers logged before this access
+        SyncBarrier transition_barrier;  // The barrier of a SYNC_IMAGE_LAYOUT_TRANSITION, unused otherwise
+    };
+    struct Barrier {
+        AccessContext::AddressType type;
+        ResourceAccessRange range;
+        SyncBarrier barrier;
+        bool global;         // Applies to all address types and ranges
+        bool execution;      // Apply the execution dependency of barrier
+        bool memory_access;  // Apply the memory dependency of barrier
+    };
+
+    void LogAccess(AccessContext::AddressType type, const ResourceAccessRange &range, SyncStageAccessIndex usage_index,
+                   const ResourceUsageTag &tag, const ResourceAccessState &current_state, const SyncBarrier *transition_barrier);
+    void LogBarrier(const SyncBarrier &barrier);
+    void LogGlobalBarriers(VkPipelineStageFlags src_exec_scope, VkPipelineStageFlags dst_exec_scope,
+                           SyncStageAccessFlags src_stage_accesses, SyncStageAccessFlags dst_stage_accesses,
+                           uint32_t memory_barrier_count, const VkMemoryBarrier *memory_barriers);
+    void LogMemoryBarrier(AccessContext::AddressType type, const ResourceAccessRange &range, const SyncBarrier &barrier);
+    void LogImageBarrier(const IMAGE_STATE &image, const VkImageSubresourceRange &subresource_range, const SyncBarrier &barrier);
+    void Reset() {
+        accesses_.clear();
+        barriers_.clear();
+    }
+
+    const std::vector<Access> &GetAccesses() const { return accesses_; }
+    const std::vector<Barrier> &GetBarriers() const { return barriers_; }
+    size_t GetMemoryUsage() const { return accesses_.capacity() * sizeof(Access) + barriers_.capacity() * sizeof(Barrier); }
+
+  private:
+    std::vector<Access> accesses_;
+    std::vector<Barrier> barriers_;
 };
 
 class RenderPassAccessContext {
@@ -405,6 +484,7 @@ class RenderPassAccessContext {
     uint32_t GetCurrentSubpass() const { return current_subpass_; }
     const RENDER_PASS_STATE *GetRenderPassState() const { return rp_state_; }
     AccessContext *CreateStoreResolveProxy(const VkRect2D &render_area) const;
+    size_t GetMemoryUsage() const;
 
   private:
     const RENDER_PASS_STATE *rp_state_;
@@ -418,12 +498,16 @@ class CommandBufferAccessContext {
     CommandBufferAccessContext()
         : command_number_(0),
           reset_count_(0),
+          node_pool_(),
           render_pass_contexts_(),
           cb_access_context_(),
           current_context_(&cb_access_context_),
           current_renderpass_context_(),
           cb_state_(),
-          queue_flags_() {}
+          queue_flags_() {
+        cb_access_context_.SetFirstAccessLog(&first_access_log_);
+        cb_access_context_.SetNodePool(&node_pool_);
+    }
     CommandBufferAccessContext(SyncValidator &sync_validator, std::shared_ptr<CMD_BUFFER_STATE> &cb_state, VkQueueFlags queue_flags)
         : CommandBufferAccessContext() {
         cb_state_ = cb_state;
@@ -435,13 +519,19 @@ class CommandBufferAccessContext {
         command_number_ = 0;
         reset_count_++;
         cb_access_context_.Reset();
+        first_access_log_.Reset();
         render_pass_contexts_.clear();
+        node_pool_.reset();  // All pooled nodes were returned by the clears above
         current_context_ = &cb_access_context_;
         current_renderpass_context_ = nullptr;
     }
 
     AccessContext *GetCurrentAccessContext() { return current_context_; }
     const AccessContext *GetCurrentAccessContext() const { return current_context_; }
+    const AccessContext &GetCbAccessContext() const { return cb_access_context_; }
+    const FirstAccessLog &GetFirstAccessLog() const { return first_access_log_; }
+    // Memory accounting for the access state recorded by this command buffer
+    size_t GetMemoryUsage() const;
     void RecordBeginRenderPass(const ResourceUsageTag &tag);
     bool ValidateBeginRenderPass(const RENDER_PASS_STATE &render_pass, const VkRenderPassBeginInfo *pRenderPassBegin,
                                  const VkSubpassBeginInfoKHR *pSubpassBeginInfo, const char *func_name) const;
@@ -472,8 +562,11 @@ class CommandBufferAccessContext {
   private:
     uint32_t command_number_;
     uint32_t reset_count_;
+    // Declared ahead of the contexts whose access state maps it backs, s.t. it is destroyed after them
+    sparse_container::node_pool node_pool_;
     std::vector<RenderPassAccessContext> render_pass_contexts_;
     AccessContext cb_access_context_;
+    FirstAccessLog first_access_log_;
     AccessContext *current_context_;
     RenderPassAccessContext *current_renderpass_context_;
     std::shared_ptr<CMD_BUFFER_STATE> cb_state_;
@@ -482,13 +575,79 @@ class CommandBufferAccessContext {
     VkQueueFlags queue_flags_;
 };
 
+// The submitted, but not yet retired, accesses of a queue.  Command buffer tags are rebased to device wide submit tags, s.t.
+// (submit index << 32) | command number orders all submitted accesses.  The state is shared copy-on-write with the semaphores
+// signaled by the queue, so waits can import it without copying.  It is only copied if the queue is updated while a signal
+// is still outstanding.
+class QueueSyncState {
+  public:
+    struct State {
+        AccessContext access_context;
+        // For each other queue, the tag before which all of its work is known to happen-before the work on this queue
+        std::unordered_map<VkQueue, uint64_t> synchronized_tags;
+        // The submit indices of the command buffers submitted to this queue, not yet retired
+        std::vector<uint64_t> submit_indices;
+        uint64_t tag_limit = 0;  // All accesses submitted to the queue have tags before this
+    };
+    struct SemaphoreSignal {
+        VkQueue queue;
+        VkQueueFlags queue_flags;
+        uint64_t tag_limit;
+        std::shared_ptr<const State> state;
+    };
+    // The semaphore waits and signals resolved while validating a vkQueueSubmit, and the submit indices it was given.  The
+    // queue state is updated in place from these at record time.
+    struct PendingSubmit {
+        struct Wait {
+            uint32_t submit;
+            VkSemaphore semaphore;
+            SemaphoreSignal signal;
+            SyncBarrier barrier;
+            bool signaled_in_call;  // Signaled earlier in the same vkQueueSubmit, so by this queue
+        };
+        struct Signal {
+            uint32_t submit;
+            VkSemaphore semaphore;
+        };
+        std::vector<Wait> waits;
+        std::vector<Signal> signals;  // Only those not waited later in the same vkQueueSubmit
+        std::vector<uint64_t> submit_indices;
+    };
+
+    QueueSyncState(VkQueue queue, VkQueueFlags queue_flags)
+        : queue_(queue), queue_flags_(queue_flags), state_(std::make_shared<State>()) {}
+
+    VkQueue GetQueue() const { return queue_; }
+    VkQueueFlags GetQueueFlags() const { return queue_flags_; }
+    const std::shared_ptr<State> &GetState() const { return state_; }
+    State *GetWritableState();
+    bool IsOwnSubmit(uint64_t tag_index) const;
+    size_t GetMemoryUsage() const;
+    void Retire(uint64_t tag_limit);
+    void Reset();
+
+    mutable std::unique_ptr<PendingSubmit> pending_submit;
+
+  private:
+    VkQueue queue_;
+    VkQueueFlags queue_flags_;
+    std::shared_ptr<State> state_;
+};
+
 class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
   public:
-    SyncValidator() { container_type = LayerObjectTypeSyncValidation; }
+    SyncValidator() : next_submit_index_(1) { container_type = LayerObjectTypeSyncValidation; }
     using StateTracker = ValidationStateTracker;
 
     using StateTracker::AccessorTraitsTypes;
     std::unordered_map<VkCommandBuffer, std::unique_ptr<CommandBufferAccessContext>> cb_access_state;
+    std::unordered_map<VkQueue, std::unique_ptr<QueueSyncState>> queue_sync_states;
+    std::unordered_map<VkSemaphore, QueueSyncState::SemaphoreSignal> signaled_semaphores;
+    std::unordered_map<VkFence, std::pair<VkQueue, uint64_t>> fence_tags;
+    // Memory use of the access state, reported at vkDestroyDevice if the sync_memory_stats setting is enabled
+    bool report_memory_stats = false;
+    size_t peak_cb_memory_usage = 0;
+    size_t peak_queue_memory_usage = 0;
     CommandBufferAccessContext *GetAccessContextImpl(VkCommandBuffer command_buffer, bool do_insert) {
         auto found_it = cb_access_state.find(command_buffer);
         if (found_it == cb_access_state.end()) {
@@ -518,6 +677,15 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
         return found_it->second.get();
     }
 
+    QueueSyncState *GetQueueSyncState(VkQueue queue) {
+        const auto found_it = queue_sync_states.find(queue);
+        return (found_it == queue_sync_states.end()) ? nullptr : found_it->second.get();
+    }
+    const QueueSyncState *GetQueueSyncState(VkQueue queue) const {
+        const auto found_it = queue_sync_states.find(queue);
+        return (found_it == queue_sync_states.end()) ? nullptr : found_it->second.get();
+    }
+
     void ApplyGlobalBarriers(AccessContext *context, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
                              SyncStageAccessFlags src_stage_scope, SyncStageAccessFlags dst_stage_scope,
                              uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers);
@@ -541,6 +709,30 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     void PostCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo *pCreateInfo,
                                     const VkAllocationCallbacks *pAllocator, VkDevice *pDevice, VkResult result);
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator);
+    void ReportMemoryStats() const;
+    void PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, VkResult result);
+
+    void RecordGetDeviceQueue(uint32_t queue_family_index, VkQueue queue);
+    void PostCallRecordGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue);
+    void PostCallRecordGetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2 *pQueueInfo, VkQueue *pQueue);
+
+    bool ValidateSubmittedCommandBuffer(const CommandBufferAccessContext &cb_context, const QueueSyncState &queue_sync,
+                                        uint32_t submit_index, uint32_t cb_index, QueueSyncState::State *state) const;
+    void BuildSubmitDelta(const QueueSyncState &queue_sync, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                          QueueSyncState::State *delta, AccessContext::AddressRanges *delta_ranges) const;
+    bool PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) const;
+    void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
+                                   VkResult result);
+    void PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo, VkResult result);
+    void RetireSubmittedAccesses(VkFence fence);
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                     uint64_t timeout, VkResult result);
+    void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result);
+    void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result);
+    void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result);
+    void PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator);
+    void PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator);
 
     bool ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                  const VkSubpassBeginInfoKHR *pSubpassBeginInfo, const char *func_name) const;
@@ -756,4 +948,8 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
                                                 VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) const;
     void PreCallRecordCmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
                                               VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker);
+
+  private:
+    // Submit indices are reserved at validation time, and thus may be consumed concurrently for different queues
+    mutable std::atomic<uint64_t> next_submit_index_;
 };
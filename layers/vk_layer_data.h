@@ -21,8 +21,13 @@
 #define LAYER_DATA_H
 
 #include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 // This is a wrapper around unordered_map that optimizes for the common case
 // of only containing a small number of elements. The first N elements are stored
@@ -341,6 +346,171 @@ class small_unordered_map
 template <typename Key, int N = 1>
 class small_unordered_set : public small_container<Key, Key, std::unordered_set<Key>, value_type_helper_set<Key>, N> {};
 
+// A vector that optimizes for the common case of only containing a small number of elements. The first N elements are
+// stored inline in the object; growing past N moves all elements to a single heap allocation.  Elements are contiguous
+// in either case, so iterators are plain pointers.
+template <typename T, size_t N, typename SizeType = uint32_t>
+class small_vector {
+  public:
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using pointer = value_type *;
+    using const_pointer = const value_type *;
+    using iterator = pointer;
+    using const_iterator = const_pointer;
+    using size_type = SizeType;
+    static const size_type kSmallCapacity = N;
+
+    small_vector() : size_(0), capacity_(N) {}
+
+    small_vector(const small_vector &other) : size_(0), capacity_(N) {
+        reserve(other.size_);
+        for (const auto &value : other) {
+            emplace_back(value);
+        }
+    }
+
+    small_vector(small_vector &&other) : size_(0), capacity_(N) { MoveFrom(other); }
+
+    ~small_vector() { clear(); }
+
+    small_vector &operator=(const small_vector &other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size_);
+            for (const auto &value : other) {
+                emplace_back(value);
+            }
+        }
+        return *this;
+    }
+
+    small_vector &operator=(small_vector &&other) {
+        if (this != &other) {
+            clear();
+            large_store_.reset();
+            capacity_ = N;
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    bool operator==(const small_vector &rhs) const {
+        if (size_ != rhs.size_) return false;
+        for (size_type i = 0; i < size_; i++) {
+            if (!((*this)[i] == rhs[i])) return false;
+        }
+        return true;
+    }
+    bool operator!=(const small_vector &rhs) const { return !(*this == rhs); }
+
+    reference operator[](size_type pos) {
+        assert(pos < size_);
+        return GetWorkingStore()[pos];
+    }
+    const_reference operator[](size_type pos) const {
+        assert(pos < size_);
+        return GetWorkingStore()[pos];
+    }
+    reference front() { return (*this)[0]; }
+    const_reference front() const { return (*this)[0]; }
+    reference back() { return (*this)[size_ - 1]; }
+    const_reference back() const { return (*this)[size_ - 1]; }
+
+    iterator begin() { return GetWorkingStore(); }
+    const_iterator begin() const { return GetWorkingStore(); }
+    const_iterator cbegin() const { return GetWorkingStore(); }
+    iterator end() { return GetWorkingStore() + size_; }
+    const_iterator end() const { return GetWorkingStore() + size_; }
+    const_iterator cend() const { return GetWorkingStore() + size_; }
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+    size_type capacity() const { return capacity_; }
+
+    // The memory owned by the vector outside of the object itself
+    size_t heap_size() const { return large_store_ ? sizeof(BackingStore) * capacity_ : 0; }
+
+    void reserve(size_type new_cap) {
+        if (new_cap <= capacity_) return;
+        std::unique_ptr<BackingStore[]> new_store(new BackingStore[new_cap]);
+        auto *new_values = reinterpret_cast<pointer>(new_store.get());
+        auto *working_store = GetWorkingStore();
+        for (size_type i = 0; i < size_; i++) {
+            new (new_values + i) value_type(std::move(working_store[i]));
+            working_store[i].~value_type();
+        }
+        large_store_ = std::move(new_store);
+        capacity_ = new_cap;
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args &&... args) {
+        if (size_ == capacity_) {
+            reserve(capacity_ * 2);
+        }
+        auto *value = new (GetWorkingStore() + size_) value_type(std::forward<Args>(args)...);
+        size_++;
+        return *value;
+    }
+    void push_back(const value_type &value) { emplace_back(value); }
+    void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+    void resize(size_type count) {
+        while (size_ > count) {
+            pop_back();
+        }
+        reserve(count);
+        while (size_ < count) {
+            emplace_back();
+        }
+    }
+
+    void pop_back() {
+        assert(size_ > 0);
+        size_--;
+        GetWorkingStore()[size_].~value_type();
+    }
+
+    // Destroys the elements, but retains any heap allocation for reuse
+    void clear() {
+        auto *working_store = GetWorkingStore();
+        for (size_type i = 0; i < size_; i++) {
+            working_store[i].~value_type();
+        }
+        size_ = 0;
+    }
+
+  private:
+    using BackingStore = typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type;
+
+    void MoveFrom(small_vector &other) {
+        if (other.large_store_) {
+            large_store_ = std::move(other.large_store_);
+            capacity_ = other.capacity_;
+            size_ = other.size_;
+            other.capacity_ = N;
+            other.size_ = 0;
+        } else {
+            for (auto &value : other) {
+                emplace_back(std::move(value));
+            }
+            other.clear();
+        }
+    }
+
+    pointer GetWorkingStore() { return reinterpret_cast<pointer>(large_store_ ? large_store_.get() : small_store_); }
+    const_pointer GetWorkingStore() const {
+        return reinterpret_cast<const_pointer>(large_store_ ? large_store_.get() : small_store_);
+    }
+
+    BackingStore small_store_[N];
+    std::unique_ptr<BackingStore[]> large_store_;
+    size_type size_;
+    size_type capacity_;
+};
+
 // For the given data key, look up the layer_data instance from given layer_data_map
 template <typename DATA_T>
 DATA_T *GetLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
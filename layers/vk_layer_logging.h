@@ -32,10 +32,18 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <queue>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 #include <utility>
@@ -118,9 +126,9 @@ typedef struct VkLayerDbgFunctionState {
 
     void *pUserData;
 
-    bool IsUtils() { return ((callback_status & DEBUG_CALLBACK_UTILS) != 0); }
-    bool IsDefault() { return ((callback_status & DEBUG_CALLBACK_DEFAULT) != 0); }
-    bool IsInstance() { return ((callback_status & DEBUG_CALLBACK_INSTANCE) != 0); }
+    bool IsUtils() const { return ((callback_status & DEBUG_CALLBACK_UTILS) != 0); }
+    bool IsDefault() const { return ((callback_status & DEBUG_CALLBACK_DEFAULT) != 0); }
+    bool IsInstance() const { return ((callback_status & DEBUG_CALLBACK_INSTANCE) != 0); }
 } VkLayerDbgFunctionState;
 
 // TODO: Could be autogenerated for the specific handles for extra type safety...
@@ -187,10 +195,287 @@ struct LoggingLabelState {
     }
 };
 
+// Hands a formatted message to a single callback, if the callback is interested in it. Returns true if the callback asked for the
+// API call to be aborted.
+static inline bool DeliverToCallback(const VkLayerDbgFunctionState &callback, VkFlags msg_flags,
+                                     VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT types,
+                                     const VkDebugUtilsMessengerCallbackDataEXT &callback_data, const char *layer_prefix) {
+    if (callback.IsUtils() && (callback.debug_utils_msg_flags & severity) && (callback.debug_utils_msg_type & types)) {
+        // VK_EXT_debug_utils callback
+        return callback.debug_utils_callback_function_ptr(static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(severity), types,
+                                                          &callback_data, callback.pUserData);
+    } else if (!callback.IsUtils() && (callback.debug_report_msg_flags & msg_flags)) {
+        // VK_EXT_debug_report callback (deprecated)
+        return callback.debug_report_callback_function_ptr(
+            msg_flags, convertCoreObjectToDebugReportObject(callback_data.pObjects[0].objectType),
+            callback_data.pObjects[0].objectHandle, callback_data.messageIdNumber, 0, layer_prefix, callback_data.pMessage,
+            callback.pUserData);
+    }
+    return false;
+}
+
+// A formatted message waiting to be delivered by AsyncMessageDelivery. Owns copies of every string the callback data points to,
+// since the object names and labels can change (or be destroyed) before the message is delivered.
+struct QueuedMessage {
+    VkFlags msg_flags;
+    VkDebugUtilsMessageSeverityFlagsEXT severity;
+    VkDebugUtilsMessageTypeFlagsEXT types;
+    std::string layer_prefix;
+    std::string vuid;
+    std::string message;
+    std::deque<std::string> names;  // deque, so the object and label name pointers stay valid as names are added
+    std::vector<VkDebugUtilsObjectNameInfoEXT> objects;
+    std::vector<VkDebugUtilsLabelEXT> queue_labels;
+    std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
+    VkDebugUtilsMessengerCallbackDataEXT callback_data;
+    std::vector<VkLayerDbgFunctionState> callbacks;
+    uint64_t ticket = 0;  // Order of reservation, see AsyncMessageDelivery::Reserve
+
+    QueuedMessage(VkFlags msg_flags_, VkDebugUtilsMessageSeverityFlagsEXT severity_, VkDebugUtilsMessageTypeFlagsEXT types_,
+                  const VkDebugUtilsMessengerCallbackDataEXT &data, const char *layer_prefix_)
+        : msg_flags(msg_flags_),
+          severity(severity_),
+          types(types_),
+          layer_prefix(layer_prefix_),
+          vuid(data.pMessageIdName ? data.pMessageIdName : ""),
+          message(data.pMessage),
+          objects(data.pObjects, data.pObjects + data.objectCount),
+          queue_labels(data.pQueueLabels, data.pQueueLabels + data.queueLabelCount),
+          cmd_buf_labels(data.pCmdBufLabels, data.pCmdBufLabels + data.cmdBufLabelCount),
+          callback_data(data) {
+        for (auto &object : objects) {
+            object.pObjectName = CopyName(object.pObjectName);
+        }
+        for (auto &label : queue_labels) {
+            label.pLabelName = CopyName(label.pLabelName);
+        }
+        for (auto &label : cmd_buf_labels) {
+            label.pLabelName = CopyName(label.pLabelName);
+        }
+        callback_data.pMessageIdName = data.pMessageIdName ? vuid.c_str() : nullptr;
+        callback_data.pMessage = message.c_str();
+        callback_data.pQueueLabels = queue_labels.empty() ? nullptr : queue_labels.data();
+        callback_data.pCmdBufLabels = cmd_buf_labels.empty() ? nullptr : cmd_buf_labels.data();
+        callback_data.pObjects = objects.data();
+    }
+
+    void Deliver() const {
+        for (const auto &callback : callbacks) {
+            DeliverToCallback(callback, msg_flags, severity, types, callback_data, layer_prefix.c_str());
+        }
+    }
+
+  private:
+    const char *CopyName(const char *name) {
+        if (!name) return nullptr;
+        names.emplace_back(name);
+        return names.back().c_str();
+    }
+};
+
+// Delivers messages to the callbacks from a dedicated thread, so that slow callbacks don't stall the threads making API calls.
+// Producers and the delivery thread share a bounded, lock-free ring buffer (Vyukov's bounded queue). When the ring is full,
+// producers wait for the delivery thread to make room rather than dropping messages.
+//
+// A message is given a ticket while debug_output_mutex is held, i.e. while its list of callbacks is current, but is pushed only
+// after the mutex is released: a callback may call back into the layer, so the delivery thread must never wait on a thread that
+// holds the mutex. Flush waits on the tickets rather than on the pushes, s.t. a message reserved before a callback was removed,
+// but not yet pushed, is still waited for.
+class AsyncMessageDelivery {
+  public:
+    AsyncMessageDelivery() : ring_(new Cell[kCapacity]) {
+        for (size_t i = 0; i < kCapacity; ++i) {
+            ring_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        thread_ = std::thread(&AsyncMessageDelivery::Run, this);
+    }
+
+    ~AsyncMessageDelivery() {
+        stop_.store(true);
+        Wake();
+        thread_.join();
+    }
+
+    // Called with debug_output_mutex held
+    uint64_t Reserve() { return reserved_.fetch_add(1); }
+
+    // Must not be called with debug_output_mutex held, as a full ring waits on the callbacks
+    void Push(std::unique_ptr<QueuedMessage> &&message) {
+        QueuedMessage *payload = message.release();
+        while (!TryPush(payload)) {
+            // Back pressure: the ring is full, so let the delivery thread catch up
+            Wake();
+            std::this_thread::yield();
+        }
+        pushed_.fetch_add(1);
+        if (sleeping_.load()) Wake();
+    }
+
+    // Returns once every message reserved before the call has been delivered. Must not be called with debug_output_mutex held.
+    void Flush() {
+        if (std::this_thread::get_id() == thread_.get_id()) return;  // Called from within a callback
+        const uint64_t target = reserved_.load();
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        while (completed_.load() < target) {
+            wake_cv_.notify_one();
+            drained_cv_.wait_for(lock, std::chrono::milliseconds(kWaitMs));
+        }
+    }
+
+  private:
+    static const size_t kCapacity = 1024;  // Must be a power of two
+    static const int kWaitMs = 10;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        QueuedMessage *message;
+    };
+
+    bool TryPush(QueuedMessage *message) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell &cell = ring_[pos & (kCapacity - 1)];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.message = message;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Full
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Only called from the delivery thread, so there is no contention on dequeue_pos_
+    QueuedMessage *TryPop() {
+        Cell &cell = ring_[dequeue_pos_ & (kCapacity - 1)];
+        const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence != dequeue_pos_ + 1) return nullptr;  // Empty
+        QueuedMessage *message = cell.message;
+        cell.sequence.store(dequeue_pos_ + kCapacity, std::memory_order_release);
+        ++dequeue_pos_;
+        return message;
+    }
+
+    void Wake() {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        wake_cv_.notify_one();
+    }
+
+    // Messages are pushed in about, but not exactly, ticket order. completed_ advances past a ticket only once it and every
+    // ticket before it have been delivered.
+    void Complete(uint64_t ticket) {
+        uint64_t completed = completed_.load(std::memory_order_relaxed);
+        if (ticket != completed) {
+            out_of_order_.push(ticket);
+            return;
+        }
+        ++completed;
+        while (!out_of_order_.empty() && (out_of_order_.top() == completed)) {
+            out_of_order_.pop();
+            ++completed;
+        }
+        completed_.store(completed);
+    }
+
+    void Run() {
+        for (;;) {
+            while (QueuedMessage *message = TryPop()) {
+                message->Deliver();
+                Complete(message->ticket);
+                delete message;
+                delivered_.fetch_add(1);
+            }
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            drained_cv_.notify_all();
+            sleeping_.store(true);
+            // Recheck after publishing sleeping_, so a producer that missed it can't leave a message behind
+            if (delivered_.load() == pushed_.load()) {
+                if (stop_.load()) break;
+                wake_cv_.wait_for(lock, std::chrono::milliseconds(kWaitMs));
+            }
+            sleeping_.store(false);
+        }
+    }
+
+    std::unique_ptr<Cell[]> ring_;
+    std::atomic<size_t> enqueue_pos_{0};
+    size_t dequeue_pos_ = 0;
+    std::atomic<uint64_t> reserved_{0};
+    std::atomic<uint64_t> pushed_{0};
+    std::atomic<uint64_t> delivered_{0};
+    std::atomic<uint64_t> completed_{0};
+    // Only touched by the delivery thread
+    std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> out_of_order_;
+    std::atomic<bool> sleeping_{false};
+    std::atomic<bool> stop_{false};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    std::condition_variable drained_cv_;
+    std::thread thread_;
+};
+
+// Hash used to identify a VUID in the filter list, the duplicate message counts and the messageIdNumber of the callback data
+static inline uint32_t VuidHash(const std::string &vuid_text) {
+    return static_cast<uint32_t>(XXH32(vuid_text.c_str(), vuid_text.size(), 8));
+}
+
+// Fixed size, open addressed table of per-VUID message counts. Slots are claimed with a compare-exchange on the key and the counts
+// are updated atomically, so the duplicate message limit can be enforced without taking debug_output_mutex.
+class DuplicateMessageCounts {
+  public:
+    // Returns true if the message has already been reported limit times, otherwise counts this occurrence against the limit.
+    bool OverLimit(uint32_t vuid_hash, int32_t limit) {
+        // Zero marks an empty slot
+        const uint32_t key = vuid_hash ? vuid_hash : 1;
+        for (uint32_t probe = 0; probe < kSlotCount; ++probe) {
+            Slot &slot = slots_[(key + probe) & (kSlotCount - 1)];
+            uint32_t slot_key = slot.key.load(std::memory_order_acquire);
+            if (slot_key == 0) {
+                if (slot.key.compare_exchange_strong(slot_key, key, std::memory_order_acq_rel)) {
+                    slot_key = key;
+                }
+            }
+            if (slot_key != key) continue;
+
+            int32_t count = slot.count.load(std::memory_order_relaxed);
+            do {
+                if (count >= limit) return true;
+            } while (!slot.count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+            return false;
+        }
+        // Table is full, never drop a message we can't count
+        return false;
+    }
+
+  private:
+    static const uint32_t kSlotCount = 4096;  // Must be a power of two
+    struct Slot {
+        std::atomic<uint32_t> key{0};
+        std::atomic<int32_t> count{0};
+    };
+    Slot slots_[kSlotCount];
+};
+
+// A message logged while its thread was in a DeferredMessageScope, with the spec text already appended
+struct DeferredMessage {
+    VkFlags msg_flags;
+    LogObjectList objects;
+    std::string vuid_text;
+    uint32_t vuid_hash;
+    std::string text;
+};
+
 typedef struct _debug_report_data {
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
-    VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
-    VkDebugUtilsMessageTypeFlagsEXT active_types{0};
+    // Read without debug_output_mutex by the Log* helpers to reject messages no callback is interested in
+    std::atomic<VkDebugUtilsMessageSeverityFlagsEXT> active_severities{0};
+    std::atomic<VkDebugUtilsMessageTypeFlagsEXT> active_types{0};
     bool queueLabelHasInsert{false};
     bool cmdBufLabelHasInsert{false};
     std::unordered_map<uint64_t, std::string> debugObjectNameMap;
@@ -202,8 +487,21 @@ typedef struct _debug_report_data {
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
     mutable std::mutex debug_output_mutex;
     int32_t duplicate_message_limit = 0;
-    mutable std::unordered_map<uint32_t, int32_t> duplicate_message_count_map{};
+    mutable DuplicateMessageCounts duplicate_message_counts;
     const void *instance_pnext_chain{};
+    // Only set when the async_message_delivery setting is enabled
+    std::unique_ptr<AsyncMessageDelivery> async_delivery;
+    // Threads whose messages are being collected by a DeferredMessageScope, guarded by debug_output_mutex
+    mutable std::unordered_map<std::thread::id, std::vector<DeferredMessage> *> deferred_messages;
+
+    // Checked before a message is formatted or debug_output_mutex is taken. filter_message_ids and duplicate_message_limit are only
+    // written while the instance is being created, so no lock is needed to read them.
+    bool SkipMessage(uint32_t vuid_hash) const {
+        if (std::find(filter_message_ids.begin(), filter_message_ids.end(), vuid_hash) != filter_message_ids.end()) {
+            return true;
+        }
+        return (duplicate_message_limit > 0) && duplicate_message_counts.OverLimit(vuid_hash, duplicate_message_limit);
+    }
 
     void DebugReportSetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
         std::unique_lock<std::mutex> lock(debug_output_mutex);
@@ -297,7 +595,8 @@ static inline void DebugReportFlagsToAnnotFlags(VkDebugReportFlagsEXT dr_flags,
 
 // Forward Declarations
 static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
-                                 const char *layer_prefix, const char *message, const char *text_vuid);
+                                 const char *layer_prefix, const char *message, const char *text_vuid, uint32_t vuid_hash,
+                                 std::unique_ptr<QueuedMessage> *queued_message);
 
 static void SetDebugUtilsSeverityFlags(std::vector<VkLayerDbgFunctionState> &callbacks, debug_report_data *debug_data) {
     // For all callback in list, return their complete set of severities and modes
@@ -336,24 +635,11 @@ static inline void RemoveAllMessageCallbacks(debug_report_data *debug_data, std:
     callbacks.clear();
 }
 
-// Returns TRUE if the number of times this message has been logged is over the set limit
-static inline bool UpdateLogMsgCounts(const debug_report_data *debug_data, int32_t vuid_hash) {
-    auto vuid_count_it = debug_data->duplicate_message_count_map.find(vuid_hash);
-    if (vuid_count_it == debug_data->duplicate_message_count_map.end()) {
-        debug_data->duplicate_message_count_map.insert({vuid_hash, 1});
-        return false;
-    } else {
-        if (vuid_count_it->second >= debug_data->duplicate_message_limit) {
-            return true;
-        } else {
-            vuid_count_it->second++;
-            return false;
-        }
-    }
-}
-
+// Called with debug_output_mutex held. With async delivery enabled, the message is returned in queued_message rather than
+// delivered, for the caller to push once the mutex is released.
 static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
-                                 const char *layer_prefix, const char *message, const char *text_vuid) {
+                                 const char *layer_prefix, const char *message, const char *text_vuid, uint32_t vuid_hash,
+                                 std::unique_ptr<QueuedMessage> *queued_message) {
     bool bail = false;
     std::vector<VkDebugUtilsLabelEXT> queue_labels;
     std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
@@ -402,15 +688,8 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
         }
     }
 
-    int32_t location = 0;
-    if (text_vuid != nullptr) {
-        // Hash for vuid text
-        location = XXH32(text_vuid, strlen(text_vuid), 8);
-        if ((debug_data->duplicate_message_limit > 0) && UpdateLogMsgCounts(debug_data, location)) {
-            // Count for this particular message is over the limit, ignore it
-            return false;
-        }
-    }
+    // Filter list and duplicate limit were already checked by the caller before the message was formatted
+    int32_t location = (text_vuid != nullptr) ? static_cast<int32_t>(vuid_hash) : 0;
 
     VkDebugUtilsMessengerCallbackDataEXT callback_data;
     callback_data.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT;
@@ -465,27 +744,28 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
         use_default_callbacks &= current_callback.IsDefault();
     }
 
-    for (auto current_callback : *callback_list) {
+    callback_data.pMessage = composite.c_str();
+    std::unique_ptr<QueuedMessage> queued;
+    if (debug_data->async_delivery) {
+        queued.reset(new QueuedMessage(msg_flags, severity, types, callback_data, layer_prefix));
+    }
+
+    for (const auto &current_callback : *callback_list) {
         // Skip callback if it's a default callback and there are non-default callbacks present
         if (current_callback.IsDefault() && !use_default_callbacks) continue;
 
-        // VK_EXT_debug_utils callback
-        if (current_callback.IsUtils() && (current_callback.debug_utils_msg_flags & severity) &&
-            (current_callback.debug_utils_msg_type & types)) {
-            callback_data.pMessage = composite.c_str();
-            if (current_callback.debug_utils_callback_function_ptr(static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(severity),
-                                                                   types, &callback_data, current_callback.pUserData)) {
-                bail = true;
-            }
-        } else if (!current_callback.IsUtils() && (current_callback.debug_report_msg_flags & msg_flags)) {
-            // VK_EXT_debug_report callback (deprecated)
-            if (current_callback.debug_report_callback_function_ptr(
-                    msg_flags, convertCoreObjectToDebugReportObject(object_name_info[0].objectType),
-                    object_name_info[0].objectHandle, location, 0, layer_prefix, composite.c_str(), current_callback.pUserData)) {
-                bail = true;
-            }
+        if (queued) {
+            queued->callbacks.push_back(current_callback);
+        } else if (DeliverToCallback(current_callback, msg_flags, severity, types, callback_data, layer_prefix)) {
+            bail = true;
         }
     }
+
+    // Delivered later, so the callbacks' return values can't abort this API call
+    if (queued && !queued->callbacks.empty()) {
+        queued->ticket = debug_data->async_delivery->Reserve();
+        *queued_message = std::move(queued);
+    }
     return bail;
 }
 
@@ -523,8 +803,17 @@ static inline LogMessageTypeFlags DebugAnnotFlagsToMsgTypeFlags(VkDebugUtilsMess
     return msg_type_flags;
 }
 
+// Blocks until every message reported so far has been handed to the callbacks
+static inline void FlushMessages(const debug_report_data *debug_data) {
+    if (debug_data->async_delivery) {
+        debug_data->async_delivery->Flush();
+    }
+}
+
 static inline void layer_debug_utils_destroy_instance(debug_report_data *debug_data) {
     if (debug_data) {
+        // Deliver anything still queued before the callbacks go away
+        debug_data->async_delivery.reset();
         std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
         RemoveAllMessageCallbacks(debug_data, debug_data->debug_callback_list);
         lock.unlock();
@@ -536,6 +825,10 @@ template <typename T>
 static inline void layer_destroy_callback(debug_report_data *debug_data, T callback, const VkAllocationCallbacks *allocator) {
     std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
     RemoveDebugUtilsCallback(debug_data, debug_data->debug_callback_list, CastToUint64(callback));
+    lock.unlock();
+    // Queued messages may still reference this callback and its user data. Those are waited for without the lock, which the
+    // callbacks themselves may need.
+    FlushMessages(debug_data);
 }
 
 template <typename TCreateInfo, typename TCallback>
@@ -647,30 +940,24 @@ static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
 }
 #endif
 
-static inline bool LogMsgLocked(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
-                                const std::string &vuid_text, char *err_msg) {
+static inline bool LogMsg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
+                          const std::string &vuid_text, uint32_t vuid_hash, char *err_msg) {
     std::string str_plus_spec_text(err_msg ? err_msg : "Allocation failure");
 
-    // If message is in filter list, bail out very early
-    size_t message_id = XXH32(vuid_text.c_str(), strlen(vuid_text.c_str()), 8);
-    if (std::find(debug_data->filter_message_ids.begin(), debug_data->filter_message_ids.end(),
-                  static_cast<uint32_t>(message_id)) != debug_data->filter_message_ids.end())
-        return false;
-
     // Append the spec error text to the error message, unless it's an UNASSIGNED or UNDEFINED vuid
     if ((vuid_text.find("UNASSIGNED-") == std::string::npos) && (vuid_text.find(kVUIDUndefined) == std::string::npos) &&
         (vuid_text.rfind("SYNC-", 0) == std::string::npos)) {
-        // Linear search makes no assumptions about the layout of the string table. This is not fast, but it does not need to be at
-        // this point in the error reporting path
-        uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
+        // The generated table is sorted by VUID in strcmp order
+        const auto *vuids_begin = std::begin(vuid_spec_text);
+        const auto *vuids_end = std::end(vuid_spec_text);
+        const auto *found =
+            std::lower_bound(vuids_begin, vuids_end, vuid_text.c_str(),
+                             [](const vuid_spec_text_pair &entry, const char *vuid) { return strcmp(entry.vuid, vuid) < 0; });
         const char *spec_text = nullptr;
         std::string spec_type;
-        for (uint32_t i = 0; i < num_vuids; i++) {
-            if (0 == strcmp(vuid_text.c_str(), vuid_spec_text[i].vuid)) {
-                spec_text = vuid_spec_text[i].spec_text;
-                spec_type = vuid_spec_text[i].url_id;
-                break;
-            }
+        if ((found != vuids_end) && (0 == strcmp(vuid_text.c_str(), found->vuid))) {
+            spec_text = found->spec_text;
+            spec_type = found->url_id;
         }
 
         // Construct and append the specification text and link to the appropriate version of the spec
@@ -710,8 +997,59 @@ static inline bool LogMsgLocked(const debug_report_data *debug_data, VkFlags msg
         }
     }
 
-    bool result = debug_log_msg(debug_data, msg_flags, objects, "Validation", str_plus_spec_text.c_str(), vuid_text.c_str());
     free(err_msg);
+    std::unique_ptr<QueuedMessage> queued_message;
+    std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+    if (!debug_data->deferred_messages.empty()) {
+        const auto deferred = debug_data->deferred_messages.find(std::this_thread::get_id());
+        if (deferred != debug_data->deferred_messages.end()) {
+            deferred->second->push_back({msg_flags, objects, vuid_text, vuid_hash, std::move(str_plus_spec_text)});
+            return false;
+        }
+    }
+    bool result = debug_log_msg(debug_data, msg_flags, objects, "Validation", str_plus_spec_text.c_str(), vuid_text.c_str(),
+                                vuid_hash, &queued_message);
+    lock.unlock();
+    if (queued_message) {
+        debug_data->async_delivery->Push(std::move(queued_message));
+    }
+    return result;
+}
+
+// Collects the messages the calling thread logs through LogMsg while the scope is alive, so that work spread over threads
+// can have its messages logged later in a fixed order by LogDeferredMessages. A collected message returns false, as if no
+// callback asked for the call to be skipped; the callbacks' answers come from LogDeferredMessages.
+class DeferredMessageScope {
+  public:
+    DeferredMessageScope(const debug_report_data *debug_data, std::vector<DeferredMessage> *messages) : debug_data_(debug_data) {
+        std::unique_lock<std::mutex> lock(debug_data_->debug_output_mutex);
+        debug_data_->deferred_messages[std::this_thread::get_id()] = messages;
+    }
+    ~DeferredMessageScope() {
+        std::unique_lock<std::mutex> lock(debug_data_->debug_output_mutex);
+        debug_data_->deferred_messages.erase(std::this_thread::get_id());
+    }
+    DeferredMessageScope(const DeferredMessageScope &) = delete;
+    DeferredMessageScope &operator=(const DeferredMessageScope &) = delete;
+
+  private:
+    const debug_report_data *debug_data_;
+};
+
+// Logs messages collected by a DeferredMessageScope in the order they were collected, returning true if any callback asked
+// for the call to be skipped
+static inline bool LogDeferredMessages(const debug_report_data *debug_data, const std::vector<DeferredMessage> &messages) {
+    bool result = false;
+    for (const auto &message : messages) {
+        std::unique_ptr<QueuedMessage> queued_message;
+        std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+        result |= debug_log_msg(debug_data, message.msg_flags, message.objects, "Validation", message.text.c_str(),
+                                message.vuid_text.c_str(), message.vuid_hash, &queued_message);
+        lock.unlock();
+        if (queued_message) {
+            debug_data->async_delivery->Push(std::move(queued_message));
+        }
+    }
     return result;
 }
 
@@ -21,6 +21,7 @@
 
 #include "vk_layer_utils.h"
 
+#include <stdlib.h>
 #include <string.h>
 #include <string>
 #include <map>
@@ -29,6 +30,21 @@
 #include "vulkan/vulkan.h"
 #include "vk_layer_config.h"
 
+#if defined(__linux__) || defined(__ANDROID__)
+#include <stdio.h>
+#include <sys/resource.h>
+#endif
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <process.h>
+#else
+#include <errno.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 static const uint8_t UTF8_ONE_BYTE_CODE = 0xC0;
 static const uint8_t UTF8_ONE_BYTE_MASK = 0xE0;
 static const uint8_t UTF8_TWO_BYTE_CODE = 0xE0;
@@ -81,6 +97,96 @@ VK_LAYER_EXPORT VkStringErrorFlags vk_string_validate(const int max_length, cons
 // Utility function for determining if a string is in a set of strings
 VK_LAYER_EXPORT bool white_list(const char *item, const std::set<std::string> &list) { return (list.find(item) != list.end()); }
 
+VK_LAYER_EXPORT std::string GetTempFilePath(const char *filename) {
+    const char *temp_dir = nullptr;
+    for (const char *env_var : {"TMPDIR", "TMP", "TEMP"}) {
+        temp_dir = getenv(env_var);
+        if (temp_dir && *temp_dir) break;
+        temp_dir = nullptr;
+    }
+#if defined(__ANDROID__)
+    std::string path = temp_dir ? temp_dir : "/data/local/tmp";
+#elif defined(_WIN32)
+    std::string path = temp_dir ? temp_dir : ".";
+#else
+    std::string path = temp_dir ? temp_dir : "/tmp";
+#endif
+    return path + "/" + filename;
+}
+
+#if !defined(_WIN32)
+// Creates dir if it doesn't exist. Only a directory owned by the user, and not writable by anyone else, is accepted.
+static bool MakePrivateDirectory(const std::string &dir) {
+    if ((mkdir(dir.c_str(), 0700) != 0) && (errno != EEXIST)) return false;
+    struct stat info;
+    if (lstat(dir.c_str(), &info) != 0) return false;
+    return S_ISDIR(info.st_mode) && (info.st_uid == getuid()) && !(info.st_mode & (S_IWGRP | S_IWOTH));
+}
+#endif
+
+VK_LAYER_EXPORT std::string GetUserCacheFilePath(const char *filename) {
+#if defined(_WIN32)
+    const char *local_app_data = getenv("LOCALAPPDATA");
+    if (!local_app_data || !*local_app_data) return "";
+    const std::string dir = std::string(local_app_data) + "\\VulkanValidationLayers";
+    if (!CreateDirectoryA(dir.c_str(), nullptr) && (GetLastError() != ERROR_ALREADY_EXISTS)) return "";
+    return dir + "\\" + filename;
+#else
+    std::string dir;
+    const char *cache_home = getenv("XDG_CACHE_HOME");
+    const char *home = getenv("HOME");
+    if (cache_home && *cache_home) {
+        dir = std::string(cache_home) + "/vulkan-validation-layers";
+    } else if (home && *home) {
+        const std::string cache_dir = std::string(home) + "/.cache";
+        if ((mkdir(cache_dir.c_str(), 0700) != 0) && (errno != EEXIST)) return "";
+        dir = cache_dir + "/vulkan-validation-layers";
+    } else {
+        // No home directory (e.g. on Android), so use a directory of the user's own in the shared temp directory
+        dir = GetTempFilePath(("vulkan-validation-layers-" + std::to_string(getuid())).c_str());
+    }
+    if (!MakePrivateDirectory(dir)) return "";
+    return dir + "/" + filename;
+#endif
+}
+
+VK_LAYER_EXPORT std::string GetProcessTempPath(const std::string &path) {
+#if defined(_WIN32)
+    return path + "." + std::to_string(_getpid()) + ".tmp";
+#else
+    return path + "." + std::to_string(getpid()) + ".tmp";
+#endif
+}
+
+VK_LAYER_EXPORT bool RenameReplacingFile(const std::string &from, const std::string &to) {
+#if defined(_WIN32)
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+VK_LAYER_EXPORT bool GetProcessMemoryUsage(uint64_t *resident_bytes, uint64_t *peak_resident_bytes) {
+#if defined(__linux__) || defined(__ANDROID__)
+    FILE *statm = fopen("/proc/self/statm", "r");
+    if (!statm) return false;
+    unsigned long total_pages = 0, resident_pages = 0;
+    const int fields = fscanf(statm, "%lu %lu", &total_pages, &resident_pages);
+    fclose(statm);
+    if (fields != 2) return false;
+    *resident_bytes = static_cast<uint64_t>(resident_pages) * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+
+    // ru_maxrss is in kilobytes on Linux
+    struct rusage usage = {};
+    *peak_resident_bytes = (getrusage(RUSAGE_SELF, &usage) == 0) ? static_cast<uint64_t>(usage.ru_maxrss) * 1024 : *resident_bytes;
+    return true;
+#else
+    (void)resident_bytes;
+    (void)peak_resident_bytes;
+    return false;
+#endif
+}
+
 // Debug callbacks get created in three ways:
 //   o  Application-defined debug callbacks
 //   o  Through settings in a vk_layer_settings.txt file
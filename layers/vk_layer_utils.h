@@ -21,9 +21,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <functional>
+#include <mutex>
+#include <thread>
 #include <stdbool.h>
 #include <string>
 #include <vector>
@@ -220,6 +226,21 @@ VK_LAYER_EXPORT void layer_debug_messenger_actions(debug_report_data *report_dat
 VK_LAYER_EXPORT VkStringErrorFlags vk_string_validate(const int max_length, const char *char_array);
 VK_LAYER_EXPORT bool white_list(const char *item, const std::set<std::string> &whitelist);
 
+// Path of a file in the temp directory, for layer data that persists between runs
+VK_LAYER_EXPORT std::string GetTempFilePath(const char *filename);
+
+// Path of a file in a cache directory private to the current user, for layer data that persists between runs. The directory is
+// created if needed. Returns an empty string if there is no such directory and it couldn't be created.
+VK_LAYER_EXPORT std::string GetUserCacheFilePath(const char *filename);
+
+// A sibling of path unique to the process, to be written and then moved over path with RenameReplacingFile, s.t. readers of
+// path never see a partially written file
+VK_LAYER_EXPORT std::string GetProcessTempPath(const std::string &path);
+VK_LAYER_EXPORT bool RenameReplacingFile(const std::string &from, const std::string &to);
+
+// Current and peak resident set size of the process. Returns false where the platform doesn't expose them.
+VK_LAYER_EXPORT bool GetProcessMemoryUsage(uint64_t *resident_bytes, uint64_t *peak_resident_bytes);
+
 static inline int u_ffs(int val) {
 #ifdef WIN32
     unsigned long bit_pos = 0;
@@ -239,24 +260,78 @@ static inline int u_ffs(int val) {
 // Minimum Visual Studio 2015 Update 2, or libc++ with C++17
 #if defined(_MSC_FULL_VER) && _MSC_FULL_VER >= 190023918 && NTDDI_VERSION > NTDDI_WIN10_RS2 && \
     (!defined(_LIBCPP_VERSION) || __cplusplus >= 201703)
+#define VL_USE_STD_SHARED_MUTEX
 #include <shared_mutex>
+#elif !defined(_WIN32)
+// Where std::shared_mutex isn't available, a lock can be switched to a pthread reader/writer lock so that shared
+// (validation) and exclusive (record) holds are distinguished. Locks that aren't switched stay plain mutexes, which are
+// cheaper to take when the lock is rarely wanted by more than one thread.
+#define VL_USE_PTHREAD_RWLOCK
+#include <pthread.h>
 #endif
 
 class ReadWriteLock {
   private:
-#if defined(_MSC_FULL_VER) && _MSC_FULL_VER >= 190023918 && NTDDI_VERSION > NTDDI_WIN10_RS2 && \
-    (!defined(_LIBCPP_VERSION) || __cplusplus >= 201703)
+#if defined(VL_USE_STD_SHARED_MUTEX)
     typedef std::shared_mutex lock_t;
 #else
     typedef std::mutex lock_t;
 #endif
 
   public:
+#if defined(VL_USE_PTHREAD_RWLOCK)
+    ReadWriteLock() = default;
+    ~ReadWriteLock() {
+        if (shared_holds_) pthread_rwlock_destroy(&m_rwlock);
+    }
+    ReadWriteLock(const ReadWriteLock &) = delete;
+    ReadWriteLock &operator=(const ReadWriteLock &) = delete;
+
+    // Let shared holds run concurrently from now on. Must be called before the lock is first taken.
+    void EnableSharedHolds() {
+        if (shared_holds_) return;
+        pthread_rwlockattr_t attr;
+        pthread_rwlockattr_init(&attr);
+#if defined(__GLIBC__)
+        // Many threads holding the lock shared (e.g. command buffer recording) must not starve exclusive holders
+        pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+        pthread_rwlock_init(&m_rwlock, &attr);
+        pthread_rwlockattr_destroy(&attr);
+        shared_holds_ = true;
+    }
+
+    void lock() {
+        if (shared_holds_) {
+            pthread_rwlock_wrlock(&m_rwlock);
+        } else {
+            m_lock.lock();
+        }
+    }
+    bool try_lock() { return shared_holds_ ? pthread_rwlock_trywrlock(&m_rwlock) == 0 : m_lock.try_lock(); }
+    void unlock() {
+        if (shared_holds_) {
+            pthread_rwlock_unlock(&m_rwlock);
+        } else {
+            m_lock.unlock();
+        }
+    }
+    void lock_shared() {
+        if (shared_holds_) {
+            pthread_rwlock_rdlock(&m_rwlock);
+        } else {
+            m_lock.lock();
+        }
+    }
+    bool try_lock_shared() { return shared_holds_ ? pthread_rwlock_tryrdlock(&m_rwlock) == 0 : m_lock.try_lock(); }
+    void unlock_shared() { unlock(); }
+#else
+    // Shared holds are either always concurrent (std::shared_mutex) or never are (std::mutex)
+    void EnableSharedHolds() {}
     void lock() { m_lock.lock(); }
     bool try_lock() { return m_lock.try_lock(); }
     void unlock() { m_lock.unlock(); }
-#if defined(_MSC_FULL_VER) && _MSC_FULL_VER >= 190023918 && NTDDI_VERSION > NTDDI_WIN10_RS2 && \
-    (!defined(_LIBCPP_VERSION) || __cplusplus >= 201703)
+#if defined(VL_USE_STD_SHARED_MUTEX)
     void lock_shared() { m_lock.lock_shared(); }
     bool try_lock_shared() { return m_lock.try_lock_shared(); }
     void unlock_shared() { m_lock.unlock_shared(); }
@@ -264,20 +339,88 @@ class ReadWriteLock {
     void lock_shared() { lock(); }
     bool try_lock_shared() { return try_lock(); }
     void unlock_shared() { unlock(); }
+#endif
 #endif
   private:
     lock_t m_lock;
+#if defined(VL_USE_PTHREAD_RWLOCK)
+    pthread_rwlock_t m_rwlock;
+    bool shared_holds_ = false;
+#endif
 };
 
-#if defined(_MSC_FULL_VER) && _MSC_FULL_VER >= 190023918 && NTDDI_VERSION > NTDDI_WIN10_RS2 && \
-    (!defined(_LIBCPP_VERSION) || __cplusplus >= 201703)
+#if defined(VL_USE_STD_SHARED_MUTEX)
 typedef std::shared_lock<ReadWriteLock> read_lock_guard_t;
 typedef std::unique_lock<ReadWriteLock> write_lock_guard_t;
 #else
-typedef std::unique_lock<ReadWriteLock> read_lock_guard_t;
+// Minimal C++11 stand-in for std::shared_lock, supporting the subset of its interface used by the layers.
+template <typename Mutex>
+class SharedLockGuard {
+  public:
+    SharedLockGuard() : mutex_(nullptr), owns_(false) {}
+    explicit SharedLockGuard(Mutex &mutex) : mutex_(&mutex), owns_(true) { mutex_->lock_shared(); }
+    SharedLockGuard(Mutex &mutex, std::defer_lock_t) : mutex_(&mutex), owns_(false) {}
+    SharedLockGuard(SharedLockGuard &&other) : mutex_(other.mutex_), owns_(other.owns_) {
+        other.mutex_ = nullptr;
+        other.owns_ = false;
+    }
+    SharedLockGuard &operator=(SharedLockGuard &&other) {
+        if (this != &other) {
+            if (owns_) mutex_->unlock_shared();
+            mutex_ = other.mutex_;
+            owns_ = other.owns_;
+            other.mutex_ = nullptr;
+            other.owns_ = false;
+        }
+        return *this;
+    }
+    SharedLockGuard(const SharedLockGuard &) = delete;
+    SharedLockGuard &operator=(const SharedLockGuard &) = delete;
+    ~SharedLockGuard() {
+        if (owns_) mutex_->unlock_shared();
+    }
+
+    void lock() {
+        assert(mutex_ && !owns_);
+        mutex_->lock_shared();
+        owns_ = true;
+    }
+    void unlock() {
+        assert(owns_);
+        mutex_->unlock_shared();
+        owns_ = false;
+    }
+    bool owns_lock() const { return owns_; }
+
+  private:
+    Mutex *mutex_;
+    bool owns_;
+};
+typedef SharedLockGuard<ReadWriteLock> read_lock_guard_t;
 typedef std::unique_lock<ReadWriteLock> write_lock_guard_t;
 #endif
 
+// Lock taken by the chassis around the hooks of command buffer recording (vkCmd*) entry points.  By default this is simply
+// the validation object's read or write lock.  Validation objects that keep recording state in the command buffer state
+// itself can instead combine a shared hold on their object lock with an exclusive hold on a per command buffer lock, so
+// that threads recording different command buffers don't serialize on the object lock.
+class cmd_buffer_lock_guard_t {
+  public:
+    cmd_buffer_lock_guard_t() = default;
+    explicit cmd_buffer_lock_guard_t(read_lock_guard_t &&object_lock) : shared_lock_(std::move(object_lock)) {}
+    explicit cmd_buffer_lock_guard_t(write_lock_guard_t &&object_lock) : exclusive_lock_(std::move(object_lock)) {}
+    cmd_buffer_lock_guard_t(read_lock_guard_t &&object_lock, std::unique_lock<std::mutex> &&cb_lock)
+        : shared_lock_(std::move(object_lock)), cb_lock_(std::move(cb_lock)) {}
+    cmd_buffer_lock_guard_t(cmd_buffer_lock_guard_t &&other) = default;
+    cmd_buffer_lock_guard_t &operator=(cmd_buffer_lock_guard_t &&other) = default;
+
+  private:
+    // Members are released in reverse order, so the command buffer lock is dropped before the object lock.
+    read_lock_guard_t shared_lock_;
+    write_lock_guard_t exclusive_lock_;
+    std::unique_lock<std::mutex> cb_lock_;
+};
+
 // Limited concurrent_unordered_map that supports internally-synchronized
 // insert/erase/access. Splits locking across N buckets and uses shared_mutex
 // for read/write locking. Iterators are not supported. The following
@@ -286,6 +429,7 @@ typedef std::unique_lock<ReadWriteLock> write_lock_guard_t;
 // insert_or_assign: Insert a new element or update an existing element.
 // insert: Insert a new element and return whether it was inserted.
 // erase: Remove an element.
+// erase_all: Remove each of a range of keys, taking the lock of each bucket once.
 // contains: Returns true if the key is in the map.
 // find: Returns != end() if found, value is in ret->second.
 // pop: Erases and returns the erased value if found.
@@ -302,6 +446,10 @@ typedef std::unique_lock<ReadWriteLock> write_lock_guard_t;
 //
 // snapshot: Return an array of elements (key, value pairs) that satisfy an optional
 // predicate. This can be used as a substitute for iterators in exceptional cases.
+//
+// size/empty: Element count, summed over the buckets one at a time. Only exact
+// while no other thread is inserting or erasing.
+// clear: Remove all elements.
 template <typename Key, typename T, int BUCKETSLOG2 = 2, typename Hash = std::hash<Key>>
 class vl_concurrent_unordered_map {
   public:
@@ -311,6 +459,12 @@ class vl_concurrent_unordered_map {
         maps[h][key] = value;
     }
 
+    void insert_or_assign(const Key &key, T &&value) {
+        uint32_t h = ConcurrentMapHashObject(key);
+        write_lock_guard_t lock(locks[h].lock);
+        maps[h][key] = std::move(value);
+    }
+
     bool insert(const Key &key, const T &value) {
         uint32_t h = ConcurrentMapHashObject(key);
         write_lock_guard_t lock(locks[h].lock);
@@ -325,6 +479,20 @@ class vl_concurrent_unordered_map {
         return maps[h].erase(key);
     }
 
+    // returns the number of elements removed
+    template <typename Keys>
+    size_t erase_all(const Keys &keys) {
+        std::vector<Key> bucket_keys[BUCKETS];
+        for (const auto &key : keys) bucket_keys[ConcurrentMapHashObject(key)].push_back(key);
+        size_t count = 0;
+        for (int h = 0; h < BUCKETS; ++h) {
+            if (bucket_keys[h].empty()) continue;
+            write_lock_guard_t lock(locks[h].lock);
+            for (const auto &key : bucket_keys[h]) count += maps[h].erase(key);
+        }
+        return count;
+    }
+
     bool contains(const Key &key) const {
         uint32_t h = ConcurrentMapHashObject(key);
         read_lock_guard_t lock(locks[h].lock);
@@ -401,6 +569,32 @@ class vl_concurrent_unordered_map {
         return ret;
     }
 
+    size_t size() const {
+        size_t count = 0;
+        for (int h = 0; h < BUCKETS; ++h) {
+            read_lock_guard_t lock(locks[h].lock);
+            count += maps[h].size();
+        }
+        return count;
+    }
+
+    bool empty() const {
+        for (int h = 0; h < BUCKETS; ++h) {
+            read_lock_guard_t lock(locks[h].lock);
+            if (!maps[h].empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void clear() {
+        for (int h = 0; h < BUCKETS; ++h) {
+            write_lock_guard_t lock(locks[h].lock);
+            maps[h].clear();
+        }
+    }
+
   private:
     static const int BUCKETS = (1 << BUCKETSLOG2);
 
@@ -419,3 +613,203 @@ class vl_concurrent_unordered_map {
         return hash;
     }
 };
+
+// Table of the unique ids handed out for wrapped handles. Rather than hashing the id, the table picks the id: its low
+// 32 bits are the index of the slot that holds the wrapped handle and its high 32 bits are a caller-supplied sequence
+// number, so an id isn't handed out again while any handle created shortly before it may still be in use. Slots live in
+// slabs that are never moved or freed before the table is, and a lookup is a few loads with no locks or hashing.
+// Inserting and erasing take a mutex to manage the list of free slots.
+//
+// insert_new: Store a value in a free slot and return its new id.
+// erase/contains/find/pop/end: As for vl_concurrent_unordered_map. Ids the table didn't hand out are never found.
+// size: Number of ids in use.
+class vl_concurrent_handle_table {
+  public:
+    vl_concurrent_handle_table() {
+        for (auto &slab : slabs_) slab.store(nullptr, std::memory_order_relaxed);
+    }
+    ~vl_concurrent_handle_table() {
+        for (auto &slab : slabs_) delete[] slab.load(std::memory_order_relaxed);
+    }
+
+    uint64_t insert_new(uint64_t sequence, uint64_t value) {
+        std::lock_guard<std::mutex> guard(lock_);
+        uint32_t index;
+        if (!free_indices_.empty()) {
+            index = free_indices_.back();
+            free_indices_.pop_back();
+        } else {
+            index = next_index_++;
+            // Running out of slots would take 2^26 live handles
+            assert((index >> kSlabBits) < kMaxSlabs);
+            auto &slab = slabs_[index >> kSlabBits];
+            if (!slab.load(std::memory_order_relaxed)) slab.store(new Slot[kSlabSize], std::memory_order_release);
+        }
+        // Slot 0 is never handed out, so that an id is never VK_NULL_HANDLE
+        const uint64_t id = (sequence << 32) | index;
+        Slot &slot = GetSlot(index);
+        // A reader that sees the new value must also see that the slot's previous id is gone, see find()
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.value.store(value, std::memory_order_relaxed);
+        slot.id.store(id, std::memory_order_release);
+        ++size_;
+        return id;
+    }
+
+    size_t erase(uint64_t id) { return pop(id) != end() ? 1 : 0; }
+
+    bool contains(uint64_t id) const { return find(id) != end(); }
+
+    // type returned by find() and end().
+    class FindResult {
+      public:
+        FindResult(bool a, uint64_t b) : result(a, b) {}
+
+        // == and != only support comparing against end()
+        bool operator==(const FindResult &other) const { return !result.first && !other.result.first; }
+        bool operator!=(const FindResult &other) const { return !(*this == other); }
+
+        // Make -> act kind of like an iterator.
+        std::pair<bool, uint64_t> *operator->() { return &result; }
+        const std::pair<bool, uint64_t> *operator->() const { return &result; }
+
+      private:
+        // (found, value)
+        std::pair<bool, uint64_t> result;
+    };
+
+    FindResult end() const { return FindResult(false, 0); }
+
+    FindResult find(uint64_t id) const {
+        const Slot *slot = FindSlot(id);
+        if (!slot) return end();
+        // The slot may be erased and reused by another thread between the loads. Reusing a slot changes its id, so the
+        // value belongs to this id if the id is unchanged after reading it.
+        uint64_t slot_id = slot->id.load(std::memory_order_acquire);
+        if (slot_id != id) return end();
+        const uint64_t value = slot->value.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        slot_id = slot->id.load(std::memory_order_relaxed);
+        if (slot_id != id) return end();
+        return FindResult(true, value);
+    }
+
+    FindResult pop(uint64_t id) {
+        Slot *slot = const_cast<Slot *>(FindSlot(id));
+        if (!slot) return end();
+        std::lock_guard<std::mutex> guard(lock_);
+        if (slot->id.load(std::memory_order_relaxed) != id) return end();
+        const uint64_t value = slot->value.load(std::memory_order_relaxed);
+        slot->id.store(0, std::memory_order_relaxed);
+        free_indices_.push_back(static_cast<uint32_t>(id));
+        --size_;
+        return FindResult(true, value);
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> guard(lock_);
+        return size_;
+    }
+
+  private:
+    static const uint32_t kSlabBits = 12;
+    static const uint32_t kSlabSize = 1u << kSlabBits;
+    static const uint32_t kMaxSlabs = 1u << 14;
+
+    struct Slot {
+        std::atomic<uint64_t> id;
+        std::atomic<uint64_t> value;
+        Slot() : id(0), value(0) {}
+    };
+
+    Slot &GetSlot(uint32_t index) { return slabs_[index >> kSlabBits].load(std::memory_order_acquire)[index & (kSlabSize - 1)]; }
+
+    const Slot *FindSlot(uint64_t id) const {
+        const uint32_t index = static_cast<uint32_t>(id);
+        if (!index || (index >> kSlabBits) >= kMaxSlabs) return nullptr;
+        const Slot *slab = slabs_[index >> kSlabBits].load(std::memory_order_acquire);
+        return slab ? &slab[index & (kSlabSize - 1)] : nullptr;
+    }
+
+    std::atomic<Slot *> slabs_[kMaxSlabs];
+    mutable std::mutex lock_;
+    std::vector<uint32_t> free_indices_;
+    uint32_t next_index_ = 1;
+    size_t size_ = 0;
+};
+
+// A fixed set of worker threads for splitting up independent validation work, such as the shader stages of a batch of
+// pipelines. Several threads may hand work to the same pool at once.
+class WorkerPool {
+  public:
+    explicit WorkerPool(uint32_t worker_count) {
+        for (uint32_t i = 0; i < worker_count; ++i) {
+            workers_.emplace_back(&WorkerPool::Run, this);
+        }
+    }
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // Calls task(i) for each i in [0, count) on the workers and the calling thread, and returns once all calls finished.
+    // The order in which the calls run is unspecified.
+    void ParallelFor(size_t count, const std::function<void(size_t)> &task) {
+        if (count == 0) return;
+        Batch batch = {&task, count, 0, 0};
+        std::unique_lock<std::mutex> guard(lock_);
+        batches_.push_back(&batch);
+        work_cv_.notify_all();
+        while (RunOne(guard, batch)) {
+        }
+        done_cv_.wait(guard, [&batch] { return batch.done == batch.count; });
+    }
+
+  private:
+    struct Batch {
+        const std::function<void(size_t)> *task;
+        size_t count;
+        size_t next;  // Index of the next call to hand out
+        size_t done;  // Number of calls finished
+    };
+
+    // Run one call from batch, with lock_ released while it runs. Returns false if every call was already handed out.
+    bool RunOne(std::unique_lock<std::mutex> &guard, Batch &batch) {
+        if (batch.next == batch.count) return false;
+        const size_t index = batch.next++;
+        if (batch.next == batch.count) {
+            batches_.erase(std::find(batches_.begin(), batches_.end(), &batch));
+        }
+        guard.unlock();
+        (*batch.task)(index);
+        guard.lock();
+        if (++batch.done == batch.count) {
+            done_cv_.notify_all();
+        }
+        return true;
+    }
+
+    void Run() {
+        std::unique_lock<std::mutex> guard(lock_);
+        while (true) {
+            work_cv_.wait(guard, [this] { return stop_ || !batches_.empty(); });
+            if (stop_) return;
+            RunOne(guard, *batches_.front());
+        }
+    }
+
+    std::mutex lock_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    std::deque<Batch *> batches_;  // Batches with calls not yet handed out
+    std::vector<std::thread> workers_;
+    bool stop_ = false;
+};
@@ -204,14 +204,48 @@ class LayerChassisOutputGenerator(OutputGenerator):
         'vkDestroyDebugReportCallbackEXT' : 'layer_destroy_callback(layer_data->report_data, callback, pAllocator);',
         'vkCreateDebugUtilsMessengerEXT' : 'layer_create_messenger_callback(layer_data->report_data, false, pCreateInfo, pAllocator, pMessenger);',
         'vkDestroyDebugUtilsMessengerEXT' : 'layer_destroy_callback(layer_data->report_data, messenger, pAllocator);',
+        'vkDeviceWaitIdle' : 'FlushMessages(layer_data->report_data);',
+        'vkQueuePresentKHR' : 'if (layer_data->hook_profile) layer_data->hook_profile->CountPresent();',
         }
 
+    # Command buffer recording functions whose hooks modify state outside of the command buffer being recorded. These
+    # always take the object-wide validation object locks instead of the command buffer locks.
+    cmd_buffer_global_functions = [
+        'vkCmdExecuteCommands',
+        ]
+
+    # Object creation functions whose post-call hooks only construct new state and add it to the (internally synchronized)
+    # state tracker maps. These take the shared validation object lock so that they don't stall validation on other threads.
+    shared_lock_post_record_functions = [
+        'vkCreateBufferView',
+        'vkCreateDescriptorSetLayout',
+        'vkCreateFence',
+        'vkCreateImageView',
+        'vkCreateSampler',
+        'vkCreateSemaphore',
+        ]
+
     precallvalidate_loop = "for (auto intercept : layer_data->object_dispatch) {"
     precallrecord_loop = precallvalidate_loop
     postcallrecord_loop = "for (auto intercept : layer_data->object_dispatch) {"
+    intercept_vector_loop = "for (auto intercept : layer_data->intercept_vectors[InterceptId%s]) {"
+    hook_timer = "        HookTimer timer(layer_data->hook_profile.get(), InterceptId%s, intercept->container_type);"
+
+    # Manually written device-level functions whose hooks are also timed by the chassis profile
+    profiled_manual_functions = [
+        'vkCreateGraphicsPipelines',
+        'vkCreateComputePipelines',
+        'vkCreateRayTracingPipelinesNV',
+        'vkCreateRayTracingPipelinesKHR',
+        'vkCreatePipelineLayout',
+        'vkCreateShaderModule',
+        'vkAllocateDescriptorSets',
+        'vkCreateBuffer',
+        ]
 
     inline_custom_header_preamble = """
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <cinttypes>
 #include <stdio.h>
@@ -242,20 +276,7 @@ class LayerChassisOutputGenerator(OutputGenerator):
 
 extern std::atomic<uint64_t> global_unique_id;
 
-// To avoid re-hashing unique ids on each use, we precompute the hash and store the
-// hash's LSBs in the high 24 bits.
-struct HashedUint64 {
-    static const int HASHED_UINT64_SHIFT = 40;
-    size_t operator()(const uint64_t &t) const { return t >> HASHED_UINT64_SHIFT; }
-
-    static uint64_t hash(uint64_t id) {
-        uint64_t h = (uint64_t)std::hash<uint64_t>()(id);
-        id |= h << HASHED_UINT64_SHIFT;
-        return id;
-    }
-};
-
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern vl_concurrent_handle_table unique_id_mapping;
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -303,11 +324,19 @@ typedef enum ValidationCheckDisables {
     VALIDATION_CHECK_DISABLE_PUSH_CONSTANT_RANGE,
     VALIDATION_CHECK_DISABLE_QUERY_VALIDATION,
     VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION,
+    VALIDATION_CHECK_DISABLE_SHADER_VALIDATION_CACHE,
 } ValidationCheckDisables;
 
 typedef enum ValidationCheckEnables {
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM,
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL,
+    VALIDATION_CHECK_ENABLE_CMD_BUFFER_LOCAL_LOCKING,
+    VALIDATION_CHECK_ENABLE_PARALLEL_PIPELINE_VALIDATION,
+    VALIDATION_CHECK_ENABLE_LAZY_SHADER_MODULES,
+    VALIDATION_CHECK_ENABLE_LAZY_DESCRIPTOR_BINDING,
+    VALIDATION_CHECK_ENABLE_PARALLEL_IMAGE_LAYOUT_VALIDATION,
+    VALIDATION_CHECK_ENABLE_GPU_DEFERRED_RESULTS,
+    VALIDATION_CHECK_ENABLE_SHADER_MODULE_STATS,
 } ValidationCheckEnables;
 
 typedef enum VkValidationFeatureEnable {
@@ -331,6 +360,7 @@ typedef enum DisableFlags {
     stateless_checks,
     handle_wrapping,
     shader_validation,
+    shader_validation_caching,
     // Insert new disables above this line
     kMaxDisableFlags,
 } DisableFlags;
@@ -342,6 +372,13 @@ typedef enum EnableFlags {
     vendor_specific_arm,
     debug_printf,
     sync_validation,
+    cmd_buffer_local_locking,
+    parallel_pipeline_validation,
+    lazy_shader_modules,
+    lazy_descriptor_binding,
+    parallel_image_layout_validation,
+    gpu_deferred_results,
+    shader_module_stats,
     // Insert new enables above this line
     kMaxEnableFlags,
 } EnableFlags;
@@ -349,6 +386,57 @@ typedef enum EnableFlags {
 typedef std::array<bool, kMaxDisableFlags> CHECK_DISABLED;
 typedef std::array<bool, kMaxEnableFlags> CHECK_ENABLED;
 
+// Call counts and timings of the device-level hooks, kept per hook and per validation object when the
+// khronos_validation.chassis_profile option is set. Buckets are powers of two of the call time in nanoseconds.
+class HookProfile {
+  public:
+    static const uint32_t kBucketCount = 40;
+    struct Counters {
+        std::atomic<uint64_t> calls;
+        std::atomic<uint64_t> total_ns;
+        std::atomic<uint64_t> buckets[kBucketCount];
+        Counters();
+    };
+
+    HookProfile(const std::string &report_path, uint32_t present_interval);
+    ~HookProfile();
+    // Returns nullptr unless profiling was requested in the layer settings
+    static HookProfile *Create();
+
+    void Record(InterceptId id, LayerObjectTypeId object_type, uint64_t ns);
+    void Report(const char *when) const;
+    // Writes an intermediate report every present_interval presents, if one was requested
+    void CountPresent();
+
+  private:
+    std::string report_path;
+    uint32_t present_interval;
+    std::atomic<uint32_t> present_count{0};
+    // One row of LayerObjectTypeMaxEnum counters per InterceptId, allocated on the first call of that hook
+    std::unique_ptr<std::atomic<Counters *>[]> rows;
+};
+
+// Times a single hook call. Does nothing but a null check when profiling is disabled.
+class HookTimer {
+  public:
+    HookTimer(HookProfile *profile, InterceptId id, LayerObjectTypeId object_type)
+        : profile_(profile), id_(id), object_type_(object_type) {
+        if (profile_) start_ = std::chrono::steady_clock::now();
+    }
+    ~HookTimer() {
+        if (profile_) {
+            auto elapsed = std::chrono::steady_clock::now() - start_;
+            profile_->Record(id_, object_type_, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+
+  private:
+    HookProfile *profile_;
+    InterceptId id_;
+    LayerObjectTypeId object_type_;
+    std::chrono::steady_clock::time_point start_;
+};
+
 // Layer chassis validation object base class definition
 class ValidationObject {
     public:
@@ -369,6 +457,10 @@ class ValidationObject {
         LAYER_PHYS_DEV_PROPERTIES phys_dev_properties = {};
 
         std::vector<ValidationObject*> object_dispatch;
+        // For each InterceptId, the objects in object_dispatch whose class overrides that hook. Only built for devices.
+        std::vector<std::vector<ValidationObject*>> intercept_vectors;
+        // Hook timings, only allocated for devices when khronos_validation.chassis_profile is set
+        std::unique_ptr<HookProfile> hook_profile;
         LayerObjectTypeId container_type;
 
         std::string layer_name = "CHASSIS";
@@ -385,6 +477,13 @@ class ValidationObject {
         virtual write_lock_guard_t write_lock() {
             return write_lock_guard_t(validation_object_mutex);
         }
+        // Locks used around the hooks of vkCmd* entry points, see cmd_buffer_lock_guard_t
+        virtual cmd_buffer_lock_guard_t cmd_buffer_read_lock(VkCommandBuffer commandBuffer) {
+            return cmd_buffer_lock_guard_t(read_lock());
+        }
+        virtual cmd_buffer_lock_guard_t cmd_buffer_write_lock(VkCommandBuffer commandBuffer) {
+            return cmd_buffer_lock_guard_t(write_lock());
+        }
 
         void RegisterValidationObject(bool vo_enabled, uint32_t instance_api_version,
             debug_report_data* instance_report_data, std::vector<ValidationObject*> &dispatch_list) {
@@ -395,6 +494,8 @@ class ValidationObject {
             }
         }
 
+        void InitObjectDispatchVectors();
+
         void FinalizeInstanceValidationObject(ValidationObject *framework) {
             instance_dispatch_table = framework->instance_dispatch_table;
             enabled = framework->enabled;
@@ -412,6 +513,8 @@ class ValidationObject {
                 api_version = dev_obj->api_version;
                 disabled = inst_obj->disabled;
                 enabled = inst_obj->enabled;
+                // Only recording command buffers on many threads at once gains from concurrent shared holds
+                if (enabled[cmd_buffer_local_locking]) validation_object_mutex.EnableSharedHolds();
                 instance_dispatch_table = inst_obj->instance_dispatch_table;
                 instance_extensions = inst_obj->instance_extensions;
                 device_extensions = dev_obj->device_extensions;
@@ -429,12 +532,15 @@ class ValidationObject {
 
         // Debug Logging Helpers
         bool LogError(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -442,17 +548,20 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kErrorBit, objects, vuid_text, str);
+            return LogMsg(report_data, kErrorBit, objects, vuid_text, vuid_hash, str);
         };
 
         template <typename HANDLE_T>
         bool LogError(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -461,17 +570,20 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kErrorBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kErrorBit, single_object, vuid_text, vuid_hash, str);
 
         };
 
         bool LogWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -479,17 +591,20 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kWarningBit, objects, vuid_text, str);
+            return LogMsg(report_data, kWarningBit, objects, vuid_text, vuid_hash, str);
         };
 
         template <typename HANDLE_T>
         bool LogWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -498,16 +613,19 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kWarningBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kWarningBit, single_object, vuid_text, vuid_hash, str);
         };
 
         bool LogPerformanceWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -515,17 +633,20 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, objects, vuid_text, str);
+            return LogMsg(report_data, kPerformanceWarningBit, objects, vuid_text, vuid_hash, str);
         };
 
         template <typename HANDLE_T>
         bool LogPerformanceWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -534,16 +655,19 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kPerformanceWarningBit, single_object, vuid_text, vuid_hash, str);
         };
 
         bool LogInfo(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -551,17 +675,20 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kInformationBit, objects, vuid_text, str);
+            return LogMsg(report_data, kInformationBit, objects, vuid_text, vuid_hash, str);
         };
 
         template <typename HANDLE_T>
         bool LogInfo(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) ||
                 !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
+            const uint32_t vuid_hash = VuidHash(vuid_text);
+            if (report_data->SkipMessage(vuid_hash)) {
+                return false;
+            }
             va_list argptr;
             va_start(argptr, format);
             char *str;
@@ -570,7 +697,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kInformationBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kInformationBit, single_object, vuid_text, vuid_hash, str);
         };
 
         // Handle Wrapping Data
@@ -603,17 +730,13 @@ class ValidationObject {
         // Wrap a newly created handle with a new unique ID, and return the new ID.
         template <typename HandleType>
         HandleType WrapNew(HandleType newlyCreatedHandle) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.insert_new(global_unique_id++, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             return (HandleType)unique_id;
         }
 
         // Specialized handling for VkDisplayKHR. Adds an entry to enable reverse-lookup.
         VkDisplayKHR WrapDisplay(VkDisplayKHR newlyCreatedHandle, ValidationObject *map_data) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.insert_new(global_unique_id++, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             map_data->display_id_reverse_mapping.insert_or_assign(newlyCreatedHandle, unique_id);
             return (VkDisplayKHR)unique_id;
         }
@@ -670,9 +793,9 @@ small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 
 // Global unique object identifier.
 std::atomic<uint64_t> global_unique_id(1ULL);
-// Map uniqueID to actual object handle. Accesses to the map itself are
-// internally synchronized.
-vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+// Map uniqueID to actual object handle. Accesses to the table itself are
+// internally synchronized, and lookups don't lock.
+vl_concurrent_handle_table unique_id_mapping;
 
 bool wrap_handles = true;
 
@@ -681,6 +804,7 @@ bool wrap_handles = true;
 
 // Include layer validation object definitions
 #include "best_practices_validation.h"
+#include "command_counter.h"
 #include "core_validation.h"
 #include "gpu_validation.h"
 #include "object_lifetime_validation.h"
@@ -902,9 +1026,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     // Set up enable and disable features flags
     CHECK_ENABLED local_enables {};
     CHECK_DISABLED local_disables {};
+    bool async_message_delivery = false;
     ConfigAndEnvSettings config_and_env_settings_data {OBJECT_LAYER_DESCRIPTION, pCreateInfo->pNext, local_enables, local_disables,
-        report_data->filter_message_ids, &report_data->duplicate_message_limit};
+        report_data->filter_message_ids, &report_data->duplicate_message_limit, &async_message_delivery};
     ProcessConfigAndEnvSettings(&config_and_env_settings_data);
+    if (async_message_delivery) {
+        report_data->async_delivery.reset(new AsyncMessageDelivery());
+    }
     layer_debug_messenger_actions(report_data, pAllocator, OBJECT_LAYER_DESCRIPTION);
 
     // Create temporary dispatch vector for pre-calls until instance is created
@@ -1137,6 +1265,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         }
     }
 
+    device_interceptor->InitObjectDispatchVectors();
+    device_interceptor->hook_profile.reset(HookProfile::Create());
+
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
@@ -1168,6 +1299,8 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
 
+    if (layer_data->hook_profile) layer_data->hook_profile->Report("vkDestroyDevice");
+
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
     }
@@ -1192,11 +1325,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     for (auto intercept : layer_data->object_dispatch) {
         cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateGraphicsPipelines, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateGraphicsPipelines, intercept->container_type);
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
     }
 
@@ -1207,6 +1342,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateGraphicsPipelines, intercept->container_type);
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(cgpl_state[intercept->container_type]));
     }
     return result;
@@ -1228,11 +1364,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     for (auto intercept : layer_data->object_dispatch) {
         ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateComputePipelines, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateComputePipelines, intercept->container_type);
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
     }
 
@@ -1243,6 +1381,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateComputePipelines, intercept->container_type);
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(ccpl_state[intercept->container_type]));
     }
     return result;
@@ -1263,12 +1402,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateRayTracingPipelinesNV, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateRayTracingPipelinesNV, intercept->container_type);
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -1277,6 +1418,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateRayTracingPipelinesNV, intercept->container_type);
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -1298,12 +1440,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateRayTracingPipelinesKHR, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesKHR(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateRayTracingPipelinesKHR, intercept->container_type);
         intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -1312,6 +1456,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateRayTracingPipelinesKHR, intercept->container_type);
         intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -1332,16 +1477,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreatePipelineLayout, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreatePipelineLayout, intercept->container_type);
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreatePipelineLayout, intercept->container_type);
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
     return result;
@@ -1361,16 +1509,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateShaderModule, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateShaderModule, intercept->container_type);
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
+    // Post-call hooks only add the new module to the state tracker maps, see shared_lock_post_record_functions
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateShaderModule, intercept->container_type);
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
     return result;
@@ -1388,17 +1540,20 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
     for (auto intercept : layer_data->object_dispatch) {
         ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateAllocateDescriptorSets, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateDescriptorSets(device,
             pAllocateInfo, pDescriptorSets, &(ads_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordAllocateDescriptorSets, intercept->container_type);
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordAllocateDescriptorSets, intercept->container_type);
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets,
             result, &(ads_state[intercept->container_type]));
     }
@@ -1419,16 +1574,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallValidateCreateBuffer, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPreCallRecordCreateBuffer, intercept->container_type);
         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, &cb_state);
     }
     VkResult result = DispatchCreateBuffer(device, &cb_state.modified_create_info, pAllocator, pBuffer);
+    // Post-call hooks only add the new buffer to the state tracker maps, see shared_lock_post_record_functions
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->read_lock();
+        HookTimer timer(layer_data->hook_profile.get(), InterceptIdPostCallRecordCreateBuffer, intercept->container_type);
         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     }
     return result;
@@ -1638,6 +1797,218 @@ VKAPI_ATTR VkResult VKAPI_CALL GetValidationCacheDataEXT(
         };
 """
 
+    inline_dispatch_vector_preamble = """
+// A validation object's class (or one of its bases) overrides a hook exactly when naming the hook through the class no longer
+// resolves to the ValidationObject member, so the member pointer types differ. No RTTI is needed to tell them apart.
+#define VALIDATION_OBJECT_OVERRIDES(type, name) \\
+    (!std::is_same<decltype(&ValidationObject::name), decltype(&type::name)>::value)
+
+#define BUILD_DISPATCH_VECTOR(name) \\
+    init_object_dispatch_vector(InterceptId ## name, \\
+                                VALIDATION_OBJECT_OVERRIDES(ThreadSafety, name), \\
+                                VALIDATION_OBJECT_OVERRIDES(StatelessValidation, name), \\
+                                VALIDATION_OBJECT_OVERRIDES(ObjectLifetimes, name), \\
+                                VALIDATION_OBJECT_OVERRIDES(CoreChecks, name), \\
+                                VALIDATION_OBJECT_OVERRIDES(BestPractices, name), \\
+                                VALIDATION_OBJECT_OVERRIDES(GpuAssisted, name), \\
+                                VALIDATION_OBJECT_OVERRIDES(DebugPrintf, name), \\
+                                VALIDATION_OBJECT_OVERRIDES(CommandCounter, name), \\
+                                VALIDATION_OBJECT_OVERRIDES(SyncValidator, name))
+
+void ValidationObject::InitObjectDispatchVectors() {
+    auto init_object_dispatch_vector = [this](InterceptId id, bool thread_safety, bool stateless_validation, bool object_tracker,
+                                              bool core_checks, bool best_practices, bool gpu_assisted, bool debug_printf,
+                                              bool command_counter, bool sync_validation) {
+        auto &intercept_vector = intercept_vectors[id];
+        for (auto item : object_dispatch) {
+            bool overrides = true;
+            switch (item->container_type) {
+                case LayerObjectTypeThreading:
+                    overrides = thread_safety;
+                    break;
+                case LayerObjectTypeParameterValidation:
+                    overrides = stateless_validation;
+                    break;
+                case LayerObjectTypeObjectTracker:
+                    overrides = object_tracker;
+                    break;
+                case LayerObjectTypeCoreValidation:
+                    overrides = core_checks;
+                    break;
+                case LayerObjectTypeBestPractices:
+                    overrides = best_practices;
+                    break;
+                case LayerObjectTypeGpuAssisted:
+                    overrides = gpu_assisted;
+                    break;
+                case LayerObjectTypeDebugPrintf:
+                    overrides = debug_printf;
+                    break;
+                case LayerObjectTypeCommandCounter:
+                    overrides = command_counter;
+                    break;
+                case LayerObjectTypeSyncValidation:
+                    overrides = sync_validation;
+                    break;
+                default:
+                    // Chassis codegen needs to be updated for unknown validation object types; call every hook until it is
+                    assert(0);
+                    break;
+            }
+            if (overrides) intercept_vector.push_back(item);
+        }
+    };
+
+    intercept_vectors.clear();
+    intercept_vectors.resize(InterceptIdCount);
+"""
+
+    inline_dispatch_vector_postamble = """}
+
+#undef BUILD_DISPATCH_VECTOR
+#undef VALIDATION_OBJECT_OVERRIDES
+"""
+
+    inline_hook_profile_source = """
+static_assert(sizeof(intercept_id_names) / sizeof(intercept_id_names[0]) == InterceptIdCount,
+              "intercept_id_names needs one entry per InterceptId");
+
+static const char *LayerObjectTypeName(LayerObjectTypeId object_type) {
+    switch (object_type) {
+        case LayerObjectTypeThreading:
+            return "Threading";
+        case LayerObjectTypeParameterValidation:
+            return "ParameterValidation";
+        case LayerObjectTypeObjectTracker:
+            return "ObjectTracker";
+        case LayerObjectTypeCoreValidation:
+            return "CoreValidation";
+        case LayerObjectTypeBestPractices:
+            return "BestPractices";
+        case LayerObjectTypeGpuAssisted:
+            return "GpuAssisted";
+        case LayerObjectTypeDebugPrintf:
+            return "DebugPrintf";
+        case LayerObjectTypeCommandCounter:
+            return "CommandCounter";
+        case LayerObjectTypeSyncValidation:
+            return "SyncValidation";
+        default:
+            return "Chassis";
+    }
+}
+
+HookProfile::Counters::Counters() : calls(0), total_ns(0) {
+    for (auto &bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+}
+
+HookProfile::HookProfile(const std::string &report_path, uint32_t present_interval)
+    : report_path(report_path), present_interval(present_interval), rows(new std::atomic<Counters *>[InterceptIdCount]) {
+    for (uint32_t id = 0; id < InterceptIdCount; ++id) rows[id].store(nullptr, std::memory_order_relaxed);
+}
+
+HookProfile::~HookProfile() {
+    for (uint32_t id = 0; id < InterceptIdCount; ++id) delete[] rows[id].load();
+}
+
+HookProfile *HookProfile::Create() {
+    const char *enable = getLayerOption("khronos_validation.chassis_profile");
+    if (!*enable || strcmp(enable, "true")) return nullptr;
+    std::string report_path = getLayerOption("khronos_validation.chassis_profile_path");
+    if (report_path.empty()) report_path = "stdout";
+    const char *interval = getLayerOption("khronos_validation.chassis_profile_present_interval");
+    uint32_t present_interval = *interval ? static_cast<uint32_t>(strtoul(interval, nullptr, 10)) : 0;
+    return new HookProfile(report_path, present_interval);
+}
+
+void HookProfile::Record(InterceptId id, LayerObjectTypeId object_type, uint64_t ns) {
+    Counters *row = rows[id].load(std::memory_order_acquire);
+    if (!row) {
+        Counters *new_row = new Counters[LayerObjectTypeMaxEnum];
+        if (rows[id].compare_exchange_strong(row, new_row, std::memory_order_acq_rel)) {
+            row = new_row;
+        } else {
+            // Another thread installed the row first and row now points to it
+            delete[] new_row;
+        }
+    }
+    Counters &counters = row[object_type];
+    counters.calls.fetch_add(1, std::memory_order_relaxed);
+    counters.total_ns.fetch_add(ns, std::memory_order_relaxed);
+    uint32_t bucket = 0;
+    while (bucket + 1 < kBucketCount && (ns >> (bucket + 1))) ++bucket;
+    counters.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void HookProfile::Report(const char *when) const {
+    struct Entry {
+        LayerObjectTypeId object_type;
+        uint32_t id;
+        uint64_t calls;
+        uint64_t total_ns;
+        uint64_t p50_ns;
+        uint64_t p99_ns;
+    };
+    // Percentiles are reported as the upper bound of the bucket holding the call at that rank
+    auto percentile = [](const Counters &counters, uint64_t calls, uint64_t permille) {
+        const uint64_t rank = (calls * permille + 999) / 1000;
+        uint64_t seen = 0;
+        for (uint32_t bucket = 0; bucket < kBucketCount; ++bucket) {
+            seen += counters.buckets[bucket].load(std::memory_order_relaxed);
+            if (seen >= rank) return uint64_t(2) << bucket;
+        }
+        return uint64_t(2) << (kBucketCount - 1);
+    };
+
+    std::vector<Entry> entries;
+    uint64_t total_calls = 0;
+    uint64_t total_ns = 0;
+    for (uint32_t id = 0; id < InterceptIdCount; ++id) {
+        const Counters *row = rows[id].load(std::memory_order_acquire);
+        if (!row) continue;
+        for (uint32_t object_type = 0; object_type < LayerObjectTypeMaxEnum; ++object_type) {
+            const Counters &counters = row[object_type];
+            const uint64_t calls = counters.calls.load(std::memory_order_relaxed);
+            if (!calls) continue;
+            const uint64_t ns = counters.total_ns.load(std::memory_order_relaxed);
+            entries.push_back({static_cast<LayerObjectTypeId>(object_type), id, calls, ns, percentile(counters, calls, 500),
+                               percentile(counters, calls, 990)});
+            total_calls += calls;
+            total_ns += ns;
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.total_ns > b.total_ns; });
+
+    FILE *out = stdout;
+    if (report_path != "stdout") {
+        out = fopen(report_path.c_str(), "a");
+        if (!out) return;
+    }
+    fprintf(out, "Validation layer hook profile at %s: %" PRIu64 " hook calls, %.3f ms\n", when, total_calls, total_ns / 1e6);
+    fprintf(out, "%-20s %-64s %12s %12s %10s %10s %10s\n", "object", "hook", "calls", "total ms", "mean us", "p50 us",
+            "p99 us");
+    for (const auto &entry : entries) {
+        fprintf(out, "%-20s %-64s %12" PRIu64 " %12.3f %10.3f %10.3f %10.3f\n", LayerObjectTypeName(entry.object_type),
+                intercept_id_names[entry.id], entry.calls, entry.total_ns / 1e6, entry.total_ns / 1e3 / entry.calls,
+                entry.p50_ns / 1e3, entry.p99_ns / 1e3);
+    }
+    if (out == stdout) {
+        fflush(out);
+    } else {
+        fclose(out);
+    }
+}
+
+void HookProfile::CountPresent() {
+    if (!present_interval) return;
+    const uint32_t count = present_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (count % present_interval == 0) {
+        std::string when = "vkQueuePresentKHR #" + std::to_string(count);
+        Report(when.c_str());
+    }
+}
+"""
+
     inline_custom_source_postamble = """
 // loader-layer interface v0, just wrappers since there is only a layer
 
@@ -1702,6 +2073,9 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         # Internal state - accumulators for different inner block text
         self.sections = dict([(section, []) for section in self.ALL_SECTIONS])
         self.intercepts = []
+        self.intercept_ids = []                     # InterceptId enumerants, one per device-level hook
+        self.intercept_id_names = []                # Hook names for the profiling report, indexed by InterceptId
+        self.dispatch_vector_builds = []            # BUILD_DISPATCH_VECTOR invocations, one per device-level hook
         self.layer_factory = ''                     # String containing base layer factory class definition
 
     # Check if the parameter passed in is a pointer to an array
@@ -1749,8 +2123,23 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             write('};\n', file=self.outFile)
             self.newline()
             write('} // namespace vulkan_layer_chassis', file=self.outFile)
+            self.newline()
+            write(self.inline_dispatch_vector_preamble, file=self.outFile)
+            write('\n'.join(self.dispatch_vector_builds), file=self.outFile)
+            write(self.inline_dispatch_vector_postamble, file=self.outFile)
+            write('// Hook names for the chassis profile report, indexed by InterceptId', file=self.outFile)
+            write('static const char *const intercept_id_names[] = {', file=self.outFile)
+            write('\n'.join(self.intercept_id_names), file=self.outFile)
+            write('};', file=self.outFile)
+            write(self.inline_hook_profile_source, file=self.outFile)
         if self.header:
             self.newline()
+            # Output the identifiers of the device-level hooks
+            write('// Identifies a device-level hook, see ValidationObject::intercept_vectors', file=self.outFile)
+            write('enum InterceptId {', file=self.outFile)
+            write('\n'.join(self.intercept_ids), file=self.outFile)
+            write('    InterceptIdCount,', file=self.outFile)
+            write('};', file=self.outFile)
             # Output Layer Factory Class Definitions
             self.layer_factory += self.inline_custom_validation_class_definitions
             self.layer_factory += '};\n\n'
@@ -1851,18 +2240,6 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         if name in ignore_functions:
             return
 
-        if self.header: # In the header declare all intercepts
-            self.appendSection('command', '')
-            self.appendSection('command', self.makeCDecls(cmdinfo.elem)[0])
-            if (self.featureExtraProtect != None):
-                self.layer_factory += '#ifdef %s\n' % self.featureExtraProtect
-            # Update base class with virtual function declarations
-            if 'ValidationCache' not in name:
-                self.layer_factory += self.BaseClassCdecl(cmdinfo.elem, name)
-            if (self.featureExtraProtect != None):
-                self.layer_factory += '#endif\n'
-            return
-
         dispatchable_type = cmdinfo.elem.find('param/type').text
         special_case_instance_APIs = [
             'vkCreateInstance',
@@ -1877,6 +2254,38 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         else:
             function_type = 'kFuncTypeDev'
 
+        # Device-level hooks are called through per-hook lists of the validation objects that override them
+        use_intercept_vectors = function_type == 'kFuncTypeDev' and name not in self.manual_functions
+        # Profiled manual functions only get InterceptIds; they still call every object in object_dispatch
+        if use_intercept_vectors or name in self.profiled_manual_functions:
+            hooks = ['PreCallValidate' + name[2:], 'PreCallRecord' + name[2:], 'PostCallRecord' + name[2:]]
+            if (self.featureExtraProtect != None):
+                self.intercept_ids += [ '#ifdef %s' % self.featureExtraProtect ]
+                self.intercept_id_names += [ '#ifdef %s' % self.featureExtraProtect ]
+            self.intercept_ids += [ '    InterceptId%s,' % hook for hook in hooks ]
+            self.intercept_id_names += [ '    "%s",' % hook for hook in hooks ]
+            if (self.featureExtraProtect != None):
+                self.intercept_ids += [ '#endif' ]
+                self.intercept_id_names += [ '#endif' ]
+        if use_intercept_vectors:
+            if (self.featureExtraProtect != None):
+                self.dispatch_vector_builds += [ '#ifdef %s' % self.featureExtraProtect ]
+            self.dispatch_vector_builds += [ '    BUILD_DISPATCH_VECTOR(%s);' % hook for hook in hooks ]
+            if (self.featureExtraProtect != None):
+                self.dispatch_vector_builds += [ '#endif' ]
+
+        if self.header: # In the header declare all intercepts
+            self.appendSection('command', '')
+            self.appendSection('command', self.makeCDecls(cmdinfo.elem)[0])
+            if (self.featureExtraProtect != None):
+                self.layer_factory += '#ifdef %s\n' % self.featureExtraProtect
+            # Update base class with virtual function declarations
+            if 'ValidationCache' not in name:
+                self.layer_factory += self.BaseClassCdecl(cmdinfo.elem, name)
+            if (self.featureExtraProtect != None):
+                self.layer_factory += '#endif\n'
+            return
+
         if name in self.manual_functions:
             if (self.featureExtraProtect != None):
                 self.intercepts += [ '#ifdef %s' % self.featureExtraProtect ]
@@ -1920,17 +2329,36 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
 
         # Set up skip and locking
         self.appendSection('command', '    bool skip = false;')
+        if name.startswith('vkCmd') and dispatchable_type == 'VkCommandBuffer' and name not in self.cmd_buffer_global_functions:
+            read_lock = 'cmd_buffer_read_lock(%s)' % dispatchable_name
+            write_lock = 'cmd_buffer_write_lock(%s)' % dispatchable_name
+        else:
+            read_lock = 'read_lock()'
+            write_lock = 'write_lock()'
+
+        if use_intercept_vectors:
+            precallvalidate_loop = self.intercept_vector_loop % ('PreCallValidate' + name[2:])
+            precallrecord_loop = self.intercept_vector_loop % ('PreCallRecord' + name[2:])
+            postcallrecord_loop = self.intercept_vector_loop % ('PostCallRecord' + name[2:])
+        else:
+            precallvalidate_loop = self.precallvalidate_loop
+            precallrecord_loop = self.precallrecord_loop
+            postcallrecord_loop = self.postcallrecord_loop
 
         # Generate pre-call validation source code
-        self.appendSection('command', '    %s' % self.precallvalidate_loop)
-        self.appendSection('command', '        auto lock = intercept->read_lock();')
+        self.appendSection('command', '    %s' % precallvalidate_loop)
+        self.appendSection('command', '        auto lock = intercept->%s;' % read_lock)
+        if use_intercept_vectors:
+            self.appendSection('command', self.hook_timer % ('PreCallValidate' + name[2:]))
         self.appendSection('command', '        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
         self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
         self.appendSection('command', '    }')
 
         # Generate pre-call state recording source code
-        self.appendSection('command', '    %s' % self.precallrecord_loop)
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
+        self.appendSection('command', '    %s' % precallrecord_loop)
+        self.appendSection('command', '        auto lock = intercept->%s;' % write_lock)
+        if use_intercept_vectors:
+            self.appendSection('command', self.hook_timer % ('PreCallRecord' + name[2:]))
         self.appendSection('command', '        intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
         self.appendSection('command', '    }')
 
@@ -1946,11 +2374,14 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             self.appendSection('command', '    %s' % self.post_dispatch_debug_utils_functions[name])
 
         # Generate post-call object processing source code
-        self.appendSection('command', '    %s' % self.postcallrecord_loop)
+        self.appendSection('command', '    %s' % postcallrecord_loop)
         returnparam = ''
         if (resulttype.text == 'VkResult' or resulttype.text == 'VkDeviceAddress'):
             returnparam = ', result'
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
+        post_record_lock = read_lock if name in self.shared_lock_post_record_functions else write_lock
+        self.appendSection('command', '        auto lock = intercept->%s;' % post_record_lock)
+        if use_intercept_vectors:
+            self.appendSection('command', self.hook_timer % ('PostCallRecord' + name[2:]))
         self.appendSection('command', '        intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
         self.appendSection('command', '    }')
         # Return result variable, if any.
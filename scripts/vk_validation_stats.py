@@ -493,7 +493,7 @@ class OutputDatabase:
 // Disable auto-formatting for generated file
 // clang-format off
 
-// Mapping from VUID string to the corresponding spec text
+// Mapping from VUID string to the corresponding spec text, sorted by VUID in strcmp order so it can be binary searched
 typedef struct _vuid_spec_text_pair {
     const char * vuid;
     const char * spec_text;
@@ -676,7 +676,8 @@ static const vuid_spec_text_pair vuid_spec_text[] = {
             hfile.write(self.header_version)
             hfile.write(self.header_preamble)
             vuid_list = list(self.vj.all_vuids)
-            vuid_list.sort()
+            # Byte order matches strcmp, which LogMsg relies on to binary search the table
+            vuid_list.sort(key=lambda vuid: vuid.encode('utf-8'))
             cmd_dict = {}
             minor_version = int(self.vj.apiversion.split('.')[1])
 
@@ -0,0 +1,98 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Minimal harness for micro-benchmarks of the data structures and locking schemes used by the layers.
+//
+// A benchmark is a function registered with VL_BENCHMARK. It times one or more variants of an operation with Run::Time,
+// each reported as the median and minimum time per operation over the repetitions, e.g.
+//
+//     VL_BENCHMARK(VectorPushBack) {
+//         std::vector<int> v;
+//         run.Time("reserved", 1000, [&]() { v.clear(); v.reserve(1000); }, [&]() {
+//             for (int i = 0; i < 1000; ++i) v.push_back(i);
+//         });
+//     }
+#ifndef VL_BENCHMARK_H_
+#define VL_BENCHMARK_H_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+// Keeps the compiler from discarding a value only computed to be timed
+template <typename T>
+inline void DoNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile char *sink = reinterpret_cast<const volatile char *>(&value);
+    (void)*sink;
+#endif
+}
+
+class Run {
+  public:
+    Run(const std::string &name, uint32_t repetitions) : name_(name), repetitions_(repetitions) {}
+
+    // Times body, which performs ops operations, once per repetition after an untimed warm-up run. setup runs untimed
+    // before each run of body. Returns the median time per operation in ns.
+    template <typename Setup, typename Body>
+    double Time(const std::string &label, uint64_t ops, Setup setup, Body body) {
+        std::vector<uint64_t> samples;
+        samples.reserve(repetitions_);
+        for (uint32_t i = 0; i <= repetitions_; ++i) {
+            setup();
+            const auto start = std::chrono::steady_clock::now();
+            body();
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            if (i > 0) samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+        return Report(label, ops, &samples);
+    }
+    template <typename Body>
+    double Time(const std::string &label, uint64_t ops, Body body) {
+        return Time(label, ops, []() {}, body);
+    }
+
+    // Prints a value derived from the timings, e.g. a threshold computed from them
+    void Note(const std::string &label, const std::string &text) const;
+
+  private:
+    double Report(const std::string &label, uint64_t ops, std::vector<uint64_t> *samples) const;
+
+    std::string name_;
+    uint32_t repetitions_;
+};
+
+typedef void (*Function)(Run &run);
+
+struct Registration {
+    Registration(const char *name, Function function);
+};
+
+}  // namespace benchmark
+
+#define VL_BENCHMARK(name)                                                 \
+    static void name(benchmark::Run &run);                                 \
+    static const benchmark::Registration name##_registration(#name, name); \
+    static void name(benchmark::Run &run)
+
+#endif  // VL_BENCHMARK_H_
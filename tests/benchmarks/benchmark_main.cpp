@@ -0,0 +1,81 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Usage: vk_layer_benchmarks [--repetitions=N] [filter...]
+// Runs the benchmarks whose name contains any of the filters, or all of them.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.h"
+
+namespace benchmark {
+
+static std::vector<std::pair<std::string, Function>> &Registry() {
+    static std::vector<std::pair<std::string, Function>> registry;
+    return registry;
+}
+
+Registration::Registration(const char *name, Function function) { Registry().emplace_back(name, function); }
+
+double Run::Report(const std::string &label, uint64_t ops, std::vector<uint64_t> *samples) const {
+    std::sort(samples->begin(), samples->end());
+    const double per_op = ops ? static_cast<double>(ops) : 1.0;
+    const double median = (*samples)[samples->size() / 2] / per_op;
+    const double fastest = samples->front() / per_op;
+    printf("%-48s %12.2f ns/op median %12.2f ns/op min  (%" PRIu64 " ops x %zu)\n", (name_ + "/" + label).c_str(), median,
+           fastest, ops, samples->size());
+    return median;
+}
+
+void Run::Note(const std::string &label, const std::string &text) const {
+    printf("%-48s %s\n", (name_ + "/" + label).c_str(), text.c_str());
+}
+
+}  // namespace benchmark
+
+int main(int argc, char **argv) {
+    uint32_t repetitions = 15;
+    std::vector<std::string> filters;
+    for (int i = 1; i < argc; ++i) {
+        const char *repetitions_arg = "--repetitions=";
+        if (!strncmp(argv[i], repetitions_arg, strlen(repetitions_arg))) {
+            repetitions = std::max(1, atoi(argv[i] + strlen(repetitions_arg)));
+        } else {
+            filters.emplace_back(argv[i]);
+        }
+    }
+
+    auto &registry = benchmark::Registry();
+    std::sort(registry.begin(), registry.end());
+    for (const auto &entry : registry) {
+        const bool selected = filters.empty() || std::any_of(filters.begin(), filters.end(), [&entry](const std::string &filter) {
+                                  return entry.first.find(filter) != std::string::npos;
+                              });
+        if (!selected) continue;
+        benchmark::Run run(entry.first, repetitions);
+        entry.second(run);
+    }
+    return 0;
+}
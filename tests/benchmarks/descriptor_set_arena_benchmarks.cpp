@@ -0,0 +1,71 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "descriptor_set_arena.h"
+
+namespace {
+
+// The allocations of a cvdescriptorset::DescriptorSet: the descriptor backing store and the descriptor pointers into it
+struct Descriptor {
+    uint64_t handles[4];
+    bool updated;
+};
+struct DescriptorSet {
+    std::vector<Descriptor, DescriptorSetArenaAllocator<Descriptor>> descriptor_store;
+    std::vector<Descriptor *, DescriptorSetArenaAllocator<Descriptor *>> descriptors;
+
+    DescriptorSet(const std::shared_ptr<DescriptorSetArena> &arena, uint32_t descriptor_count)
+        : descriptor_store(DescriptorSetArenaAllocator<Descriptor>(arena)), descriptors(descriptor_store.get_allocator()) {
+        descriptor_store.resize(descriptor_count);
+        descriptors.reserve(descriptor_count);
+        for (auto &descriptor : descriptor_store) descriptors.push_back(&descriptor);
+    }
+};
+
+// A frame's worth of vkAllocateDescriptorSets into a pool followed by vkResetDescriptorPool. arena is null for the heap.
+void AllocateAndReset(const std::shared_ptr<DescriptorSetArena> &arena, std::vector<std::shared_ptr<DescriptorSet>> *sets,
+                      uint32_t set_count, uint32_t descriptor_count) {
+    for (uint32_t i = 0; i < set_count; ++i) {
+        sets->push_back(
+            std::allocate_shared<DescriptorSet>(DescriptorSetArenaAllocator<DescriptorSet>(arena), arena, descriptor_count));
+    }
+    sets->clear();
+    if (arena) arena->Rewind();
+}
+
+}  // namespace
+
+// Cost per set of allocating descriptor set state from the heap or from the pool's arena, and releasing it on pool reset
+VL_BENCHMARK(DescriptorSetAllocation) {
+    const uint32_t set_count = 20000;
+    std::vector<std::shared_ptr<DescriptorSet>> sets;
+    sets.reserve(set_count);
+    for (uint32_t descriptor_count : {1u, 8u, 64u}) {
+        const std::string suffix = "/" + std::to_string(descriptor_count) + "_descriptors";
+        run.Time("heap" + suffix, set_count, [&]() { AllocateAndReset(nullptr, &sets, set_count, descriptor_count); });
+        // The arena keeps its chunks from the warm-up frame on, as a pool does from its second frame on
+        auto arena = std::make_shared<DescriptorSetArena>();
+        run.Time("arena" + suffix, set_count, [&]() { AllocateAndReset(arena, &sets, set_count, descriptor_count); });
+    }
+}
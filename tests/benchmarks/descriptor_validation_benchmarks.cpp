@@ -0,0 +1,157 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark.h"
+
+namespace {
+
+// A model of the draw-time descriptor loop of CoreChecks::ValidateDescriptorSetBindingData, not the layer code itself, which
+// needs a device's worth of CoreChecks state. It keeps the shape of the loop: the virtual class queries, the map lookups
+// and the attachment overlap checks, before and after they were hoisted out of the per-descriptor work. Its timings show
+// what that restructuring saves, not what a draw costs in the layer.
+
+// Stand-ins for the state ValidateDescriptorSetBindingData reads for a binding of combined image samplers
+struct ImageState {
+    uint32_t samples;
+};
+struct ImageViewState {
+    uint64_t image;
+    const ImageState *image_state;
+    uint32_t base_layer;
+    uint32_t layer_count;
+    bool Overlaps(const ImageViewState &other) const {
+        return image == other.image && base_layer < other.base_layer + other.layer_count &&
+               other.base_layer < base_layer + layer_count;
+    }
+};
+
+enum class DescriptorClass { GeneralBuffer, ImageSampler, Image };
+
+class Descriptor {
+  public:
+    virtual ~Descriptor() {}
+    virtual DescriptorClass GetClass() const = 0;
+    virtual bool IsDynamic() const { return false; }
+    bool updated = true;
+};
+class ImageSamplerDescriptor : public Descriptor {
+  public:
+    DescriptorClass GetClass() const override { return DescriptorClass::ImageSampler; }
+    uint64_t image_view;
+    const ImageViewState *image_view_state;
+};
+
+struct Device {
+    std::unordered_map<uint64_t, ImageState> images;
+    std::unordered_map<uint64_t, ImageViewState> image_views;
+    std::unordered_map<uint32_t, uint32_t> binding_types;  // The layout's binding to type lookup
+};
+
+struct Binding {
+    std::vector<std::unique_ptr<Descriptor>> descriptors;
+    std::vector<uint64_t> attachment_views;
+};
+
+// One loop for all descriptor classes: the class and type are looked up for each descriptor, the image and every attachment
+// view in the device maps
+bool ValidateGeneric(const Device &device, const Binding &binding) {
+    bool skip = false;
+    for (const auto &descriptor : binding.descriptors) {
+        if (!descriptor->updated) return true;
+        if (descriptor->GetClass() == DescriptorClass::GeneralBuffer && descriptor->IsDynamic()) skip = true;
+        if (descriptor->GetClass() != DescriptorClass::ImageSampler && descriptor->GetClass() != DescriptorClass::Image) continue;
+        const auto type = device.binding_types.find(0)->second;
+        const auto *image_sampler = static_cast<const ImageSamplerDescriptor *>(descriptor.get());
+        const auto *view_state = image_sampler->image_view_state;
+        if (type == 1) {
+            const auto &image_state = device.images.find(view_state->image)->second;
+            skip |= image_state.samples != 1;
+        }
+        for (const auto attachment : binding.attachment_views) {
+            if (attachment == image_sampler->image_view) return true;
+            const auto it = device.image_views.find(attachment);
+            if (it != device.image_views.end() && view_state->Overlaps(it->second)) return true;
+        }
+    }
+    return skip;
+}
+
+// The binding's invariants and attachment view states resolved once, then a loop for the binding's descriptor class
+bool ValidateImageSamplers(const Device &device, const Binding &binding) {
+    std::vector<const ImageViewState *> attachment_view_states;
+    attachment_view_states.reserve(binding.attachment_views.size());
+    for (const auto attachment : binding.attachment_views) {
+        const auto it = device.image_views.find(attachment);
+        attachment_view_states.push_back(it != device.image_views.end() ? &it->second : nullptr);
+    }
+    bool skip = false;
+    for (const auto &descriptor : binding.descriptors) {
+        const auto *image_sampler = static_cast<const ImageSamplerDescriptor *>(descriptor.get());
+        if (!image_sampler->updated) return true;
+        const auto *view_state = image_sampler->image_view_state;
+        skip |= view_state->image_state->samples != 1;
+        for (size_t i = 0; i < attachment_view_states.size(); ++i) {
+            if (binding.attachment_views[i] == image_sampler->image_view) return true;
+            if (attachment_view_states[i] && view_state->Overlaps(*attachment_view_states[i])) return true;
+        }
+    }
+    return skip;
+}
+
+}  // namespace
+
+// The model of draw-time validation of one binding of 4096 combined image samplers, per descriptor
+VL_BENCHMARK(DescriptorValidationModel) {
+    const uint32_t descriptor_count = 4096;
+    Device device;
+    device.binding_types[0] = 1;
+    for (uint64_t i = 0; i < descriptor_count; ++i) {
+        device.images[0x1000 + i] = ImageState{1};
+    }
+    for (uint64_t i = 0; i < descriptor_count; ++i) {
+        device.image_views[0x100000 + i] = ImageViewState{0x1000 + i, &device.images[0x1000 + i], 0, 1};
+    }
+    // Attachments are views of their own images, so no descriptor overlaps them
+    for (uint64_t i = 0; i < 4; ++i) {
+        device.images[0x2000 + i] = ImageState{1};
+        device.image_views[0x200000 + i] = ImageViewState{0x2000 + i, &device.images[0x2000 + i], 0, 1};
+    }
+
+    Binding binding;
+    for (uint64_t i = 0; i < descriptor_count; ++i) {
+        std::unique_ptr<ImageSamplerDescriptor> descriptor(new ImageSamplerDescriptor);
+        descriptor->image_view = 0x100000 + i;
+        descriptor->image_view_state = &device.image_views[0x100000 + i];
+        binding.descriptors.emplace_back(std::move(descriptor));
+    }
+
+    for (uint32_t attachment_count : {0u, 4u}) {
+        binding.attachment_views.clear();
+        for (uint64_t i = 0; i < attachment_count; ++i) binding.attachment_views.push_back(0x200000 + i);
+        const std::string suffix = "/" + std::to_string(attachment_count) + "_attachments";
+        run.Time("model_generic" + suffix, descriptor_count, [&]() { benchmark::DoNotOptimize(ValidateGeneric(device, binding)); });
+        run.Time("model_per_class" + suffix, descriptor_count,
+                 [&]() { benchmark::DoNotOptimize(ValidateImageSamplers(device, binding)); });
+    }
+}
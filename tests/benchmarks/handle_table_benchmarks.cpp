@@ -0,0 +1,111 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+#include "vk_layer_utils.h"
+
+namespace {
+
+// The unique_id_mapping the chassis used before vl_concurrent_handle_table: a sharded map keyed by sequence numbers with a
+// precomputed hash in their high bits
+struct HashedUint64 {
+    static const int HASHED_UINT64_SHIFT = 40;
+    size_t operator()(const uint64_t &t) const { return t >> HASHED_UINT64_SHIFT; }
+
+    static uint64_t hash(uint64_t id) {
+        uint64_t h = (uint64_t)std::hash<uint64_t>()(id);
+        id |= h << HASHED_UINT64_SHIFT;
+        return id;
+    }
+};
+
+struct ShardedMap {
+    vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> map;
+    std::atomic<uint64_t> sequence{1};
+
+    uint64_t Wrap(uint64_t handle) {
+        const uint64_t id = HashedUint64::hash(sequence++);
+        map.insert_or_assign(id, handle);
+        return id;
+    }
+    uint64_t Unwrap(uint64_t id) const { return map.find(id)->second; }
+    void Erase(uint64_t id) { map.erase(id); }
+};
+
+struct HandleTable {
+    vl_concurrent_handle_table table;
+    std::atomic<uint64_t> sequence{1};
+
+    uint64_t Wrap(uint64_t handle) { return table.insert_new(sequence++, handle); }
+    uint64_t Unwrap(uint64_t id) const { return table.find(id)->second; }
+    void Erase(uint64_t id) { table.erase(id); }
+};
+
+// Unwraps, as every call taking a non-dispatchable handle does, spread over threads that share the id mapping
+template <typename Mapping>
+void UnwrapOnThreads(const Mapping &mapping, const std::vector<uint64_t> &ids, uint32_t thread_count, uint32_t rounds) {
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&mapping, &ids, t, rounds]() {
+            uint64_t sum = 0;
+            for (uint32_t round = 0; round < rounds; ++round) {
+                // Each thread walks the ids from a different starting point, like threads using different objects
+                for (size_t i = 0; i < ids.size(); ++i) sum += mapping.Unwrap(ids[(i + t * 997) % ids.size()]);
+            }
+            benchmark::DoNotOptimize(sum);
+        });
+    }
+    for (auto &thread : threads) thread.join();
+}
+
+template <typename Mapping>
+void TimeMapping(benchmark::Run &run, const std::string &name) {
+    const uint32_t live_count = 10000;
+    Mapping mapping;
+    std::vector<uint64_t> ids;
+    for (uint32_t i = 0; i < live_count; ++i) ids.push_back(mapping.Wrap(0x1000 + i));
+
+    const uint32_t rounds = 100;
+    for (uint32_t thread_count : {1u, 4u}) {
+        const auto ops = static_cast<uint64_t>(thread_count) * rounds * live_count;
+        run.Time(name + "/unwrap/" + std::to_string(thread_count) + "_threads", ops,
+                 [&]() { UnwrapOnThreads(mapping, ids, thread_count, rounds); });
+    }
+
+    // Destroying and re-creating objects, which in the handle table reuses the freed slots
+    run.Time(name + "/erase_and_wrap", live_count, [&]() {
+        for (auto &id : ids) {
+            mapping.Erase(id);
+            id = mapping.Wrap(0x1000);
+        }
+    });
+}
+
+}  // namespace
+
+// Cost of wrapping and unwrapping non-dispatchable handles with 10k live objects
+VL_BENCHMARK(HandleWrapping) {
+    TimeMapping<ShardedMap>(run, "sharded_map");
+    TimeMapping<HandleTable>(run, "handle_table");
+}
@@ -0,0 +1,171 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "benchmark.h"
+#include "range_vector.h"
+#include "vk_layer_utils.h"
+
+namespace {
+
+using Range = sparse_container::range<uint64_t>;
+using LayoutMap = sparse_container::range_map<uint64_t, uint32_t>;
+
+const uint64_t kSubresourceCount = 16;
+
+// An image as recorded in a command buffer: the layouts it expects at submit and the layouts it leaves behind
+struct CmdBufImage {
+    uint64_t image;
+    LayoutMap initial_layouts;
+    LayoutMap current_layouts;
+};
+typedef std::vector<CmdBufImage> CommandBuffer;
+
+struct Mismatch {
+    Range range;
+    uint32_t initial_layout;
+    uint32_t image_layout;
+};
+// What PrecheckCmdBufImageLayouts stores for a command buffer
+struct Precheck {
+    std::vector<size_t> image_ends;
+    std::vector<Mismatch> mismatches;
+};
+
+// FindImageLayoutMismatches
+void FindMismatches(const LayoutMap &initial_layouts, const LayoutMap &overlay_map, const LayoutMap &global_map,
+                    std::vector<Mismatch> *mismatches) {
+    auto pos = initial_layouts.begin();
+    const auto end = initial_layouts.end();
+    sparse_container::parallel_iterator<const LayoutMap> current_layout(overlay_map, global_map, pos->first.begin);
+    while (pos != end) {
+        const uint32_t initial_layout = pos->second;
+        uint32_t image_layout = ~0u;
+        if (current_layout->range.empty()) break;
+        if (current_layout->pos_A->valid) {
+            image_layout = current_layout->pos_A->lower_bound->second;
+        } else if (current_layout->pos_B->valid) {
+            image_layout = current_layout->pos_B->lower_bound->second;
+        }
+        const auto intersected_range = pos->first & current_layout->range;
+        if (image_layout != initial_layout) mismatches->push_back({intersected_range, initial_layout, image_layout});
+        if (pos->first.includes(intersected_range.end)) {
+            current_layout.seek(intersected_range.end);
+        } else {
+            ++pos;
+            if (pos != end) current_layout.seek(pos->first.begin);
+        }
+    }
+}
+
+class Submit {
+  public:
+    // command_buffer_count command buffers of images_per_command_buffer images each, drawn from image_count images. Every
+    // image is expected in layout 1 and left in layout 1 on half its subresources, and the global layouts match but for a
+    // few images, so that some mismatches are found.
+    Submit(uint32_t command_buffer_count, uint32_t images_per_command_buffer, uint64_t image_count)
+        : command_buffers_(command_buffer_count), pool_(std::max(std::thread::hardware_concurrency(), 2u) - 1) {
+        for (uint64_t image = 0; image < image_count; ++image) {
+            global_maps_[image].overwrite_range(std::make_pair(Range(0, kSubresourceCount), image % 997 ? 1u : 2u));
+        }
+        uint64_t next = 0;
+        for (auto &command_buffer : command_buffers_) {
+            for (uint32_t i = 0; i < images_per_command_buffer; ++i) {
+                next = (next + 7919) % image_count;
+                command_buffer.emplace_back();
+                auto &cb_image = command_buffer.back();
+                cb_image.image = next;
+                cb_image.initial_layouts.overwrite_range(std::make_pair(Range(0, kSubresourceCount), 1u));
+                cb_image.current_layouts.overwrite_range(std::make_pair(Range(0, kSubresourceCount / 2), 1u));
+            }
+        }
+    }
+
+    // ValidateCmdBufImageLayouts for each command buffer in submit order, with precheck results when they are given
+    size_t ValidateInOrder(const std::vector<Precheck> *prechecks) const {
+        std::unordered_map<uint64_t, LayoutMap> overlay_maps;
+        std::vector<Mismatch> mismatches;
+        size_t mismatch_count = 0;
+        for (size_t cb = 0; cb < command_buffers_.size(); ++cb) {
+            size_t image_index = 0;
+            for (const auto &cb_image : command_buffers_[cb]) {
+                const size_t precheck_index = image_index++;
+                auto &overlay_map = overlay_maps[cb_image.image];
+                if (prechecks && overlay_map.empty()) {
+                    const auto &image_ends = (*prechecks)[cb].image_ends;
+                    mismatch_count += image_ends[precheck_index] - (precheck_index ? image_ends[precheck_index - 1] : 0);
+                } else {
+                    mismatches.clear();
+                    FindMismatches(cb_image.initial_layouts, overlay_map, global_maps_.find(cb_image.image)->second, &mismatches);
+                    mismatch_count += mismatches.size();
+                }
+                for (const auto &entry : cb_image.current_layouts) overlay_map.overwrite_range(entry);
+            }
+        }
+        return mismatch_count;
+    }
+
+    // PrecheckCmdBufImageLayouts for every command buffer on the worker pool
+    void Precheck(std::vector<::Precheck> *prechecks) {
+        prechecks->assign(command_buffers_.size(), ::Precheck());
+        const LayoutMap empty_overlay;
+        pool_.ParallelFor(command_buffers_.size(), [this, prechecks, &empty_overlay](size_t cb) {
+            auto &precheck = (*prechecks)[cb];
+            precheck.image_ends.reserve(command_buffers_[cb].size());
+            for (const auto &cb_image : command_buffers_[cb]) {
+                FindMismatches(cb_image.initial_layouts, empty_overlay, global_maps_.find(cb_image.image)->second,
+                               &precheck.mismatches);
+                precheck.image_ends.push_back(precheck.mismatches.size());
+            }
+        });
+    }
+
+  private:
+    std::vector<CommandBuffer> command_buffers_;
+    std::unordered_map<uint64_t, LayoutMap> global_maps_;
+    WorkerPool pool_;
+};
+
+}  // namespace
+
+// Image layout validation of a vkQueueSubmit of 32 command buffers of 1000 images each, per command buffer. With many images
+// few are shared between command buffers, with fewer images most are and fall back to the overlay compare in order.
+VL_BENCHMARK(SubmitImageLayouts) {
+    const uint32_t command_buffer_count = 32;
+    for (uint64_t image_count : {200000u, 10000u}) {
+        Submit submit(command_buffer_count, 1000, image_count);
+        const std::string suffix = "/" + std::to_string(image_count) + "_images";
+        run.Time("sequential" + suffix, command_buffer_count,
+                 [&]() { benchmark::DoNotOptimize(submit.ValidateInOrder(nullptr)); });
+
+        std::vector<Precheck> prechecks;
+        run.Time("precheck" + suffix, command_buffer_count, [&]() { submit.Precheck(&prechecks); });
+        run.Time("ordered_pass" + suffix, command_buffer_count, [&]() { submit.Precheck(&prechecks); },
+                 [&]() { benchmark::DoNotOptimize(submit.ValidateInOrder(&prechecks)); });
+        if (submit.ValidateInOrder(nullptr) != submit.ValidateInOrder(&prechecks)) {
+            run.Note("check" + suffix, "the passes found different mismatches");
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+#include "vk_layer_utils.h"
+
+namespace {
+
+struct CommandBuffer {
+    std::mutex cmd_buffer_lock;
+    std::vector<uint64_t> commands;
+};
+
+// Threads each recording their own command buffer, with the vkCmd* hooks locked as by the chassis. The validate half of a
+// hook looks the command buffer up and reads its state, the record half appends to it.
+class RecordingThreads {
+  public:
+    // With local_locking the object lock allows concurrent shared holds, as the chassis sets it up for
+    // cmd_buffer_local_locking. Otherwise it is left as is.
+    RecordingThreads(uint32_t thread_count, uint32_t hooks_per_thread, bool local_locking)
+        : thread_count_(thread_count), hooks_per_thread_(hooks_per_thread) {
+        if (local_locking) object_lock_.EnableSharedHolds();
+        for (uint32_t i = 0; i < thread_count; ++i) {
+            command_buffers_.insert_or_assign(i, std::make_shared<CommandBuffer>());
+        }
+    }
+
+    void Reset() {
+        for (uint32_t i = 0; i < thread_count_; ++i) {
+            auto command_buffer = command_buffers_.find(i)->second;
+            command_buffer->commands.clear();
+            command_buffer->commands.reserve(hooks_per_thread_);
+        }
+    }
+
+    // Validation under a shared and recording under an exclusive hold of the object lock, the default locking
+    void RecordObjectLocked() {
+        Record([this](uint64_t handle, uint32_t hook) {
+            {
+                read_lock_guard_t lock(object_lock_);
+                benchmark::DoNotOptimize(command_buffers_.find(handle)->second->commands.size());
+            }
+            write_lock_guard_t lock(object_lock_);
+            command_buffers_.find(handle)->second->commands.push_back(hook);
+        });
+    }
+
+    // Both halves under a shared hold of the object lock and the command buffer's own lock, as with cmd_buffer_local_locking
+    void RecordCommandBufferLocked() {
+        Record([this](uint64_t handle, uint32_t hook) {
+            {
+                cmd_buffer_lock_guard_t lock(LockCommandBuffer(handle));
+                benchmark::DoNotOptimize(command_buffers_.find(handle)->second->commands.size());
+            }
+            cmd_buffer_lock_guard_t lock(LockCommandBuffer(handle));
+            command_buffers_.find(handle)->second->commands.push_back(hook);
+        });
+    }
+
+  private:
+    cmd_buffer_lock_guard_t LockCommandBuffer(uint64_t handle) {
+        read_lock_guard_t object_lock(object_lock_);
+        auto command_buffer = command_buffers_.find(handle)->second;
+        return cmd_buffer_lock_guard_t(std::move(object_lock), std::unique_lock<std::mutex>(command_buffer->cmd_buffer_lock));
+    }
+
+    template <typename Hook>
+    void Record(Hook hook) {
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < thread_count_; ++i) {
+            threads.emplace_back([this, i, &hook]() {
+                for (uint32_t j = 0; j < hooks_per_thread_; ++j) hook(i, j);
+            });
+        }
+        for (auto &thread : threads) thread.join();
+    }
+
+    const uint32_t thread_count_;
+    const uint32_t hooks_per_thread_;
+    ReadWriteLock object_lock_;
+    vl_concurrent_unordered_map<uint64_t, std::shared_ptr<CommandBuffer>, 4> command_buffers_;
+};
+
+}  // namespace
+
+// Throughput of vkCmd* hooks on threads recording separate command buffers
+VL_BENCHMARK(CmdBufferLocking) {
+    const uint32_t hooks_per_thread = 20000;
+    for (uint32_t thread_count : {1u, 2u, 4u, 8u}) {
+        RecordingThreads object_locked(thread_count, hooks_per_thread, false);
+        RecordingThreads cmd_buffer_locked(thread_count, hooks_per_thread, true);
+        const auto ops = static_cast<uint64_t>(thread_count) * hooks_per_thread;
+        const std::string suffix = "/" + std::to_string(thread_count) + "_threads";
+        run.Time("object_lock" + suffix, ops, [&]() { object_locked.Reset(); }, [&]() { object_locked.RecordObjectLocked(); });
+        run.Time("cmd_buffer_lock" + suffix, ops, [&]() { cmd_buffer_locked.Reset(); },
+                 [&]() { cmd_buffer_locked.RecordCommandBufferLocked(); });
+    }
+}
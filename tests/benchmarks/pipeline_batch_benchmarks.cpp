@@ -0,0 +1,172 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark.h"
+#include "spirv-tools/libspirv.hpp"
+#include "spirv-tools/optimizer.hpp"
+#include "vk_layer_utils.h"
+
+namespace {
+
+const spv_target_env kSpirvEnvironment = SPV_ENV_VULKAN_1_0;
+
+// A compute shader of op_count arithmetic instructions on a buffer member and a specialization constant. A broken shader
+// stores a signed value to the unsigned member, which the validator rejects once the shader is specialized.
+std::vector<uint32_t> AssembleShader(uint32_t op_count, bool broken) {
+    std::string text =
+        "OpCapability Shader\n"
+        "OpMemoryModel Logical GLSL450\n"
+        "OpEntryPoint GLCompute %main \"main\"\n"
+        "OpExecutionMode %main LocalSize 1 1 1\n"
+        "OpDecorate %scale SpecId 0\n"
+        "OpDecorate %block BufferBlock\n"
+        "OpMemberDecorate %block 0 Offset 0\n"
+        "OpDecorate %buffer DescriptorSet 0\n"
+        "OpDecorate %buffer Binding 0\n"
+        "%void = OpTypeVoid\n"
+        "%void_fn = OpTypeFunction %void\n"
+        "%uint = OpTypeInt 32 0\n"
+        "%int = OpTypeInt 32 1\n"
+        "%int_0 = OpConstant %int 0\n"
+        "%scale = OpSpecConstant %uint 1\n"
+        "%block = OpTypeStruct %uint\n"
+        "%block_ptr = OpTypePointer Uniform %block\n"
+        "%uint_ptr = OpTypePointer Uniform %uint\n"
+        "%buffer = OpVariable %block_ptr Uniform\n"
+        "%main = OpFunction %void None %void_fn\n"
+        "%entry = OpLabel\n"
+        "%member = OpAccessChain %uint_ptr %buffer %int_0\n"
+        "%x0 = OpLoad %uint %member\n";
+    for (uint32_t i = 1; i <= op_count; ++i) {
+        text += "%x" + std::to_string(i) + (i % 2 ? " = OpIMul %uint %x" : " = OpIAdd %uint %x") + std::to_string(i - 1) +
+                " %scale\n";
+    }
+    const std::string last = "%x" + std::to_string(op_count);
+    if (broken) {
+        text += "%signed = OpBitcast %int " + last + "\nOpStore %member %signed\n";
+    } else {
+        text += "OpStore %member " + last + "\n";
+    }
+    text += "OpReturn\nOpFunctionEnd\n";
+
+    std::vector<uint32_t> binary;
+    spvtools::SpirvTools tools(kSpirvEnvironment);
+    tools.Assemble(text, &binary);
+    return binary;
+}
+
+// The messages and skip of a stage, as ParallelStageResult keeps them
+struct StageResult {
+    std::vector<std::string> messages;
+    bool skip = false;
+};
+
+// The SPIR-V work ValidatePipelineShaderStage does for a specialized stage, through the same calls as SpecializeShaderStage:
+// applying the specialization constants with the optimizer and validating the result
+void ValidateSpecializedStage(const std::vector<uint32_t> &module, uint32_t scale, StageResult *result) {
+    std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;
+    id_value_map.emplace(0, std::vector<uint32_t>(1, scale));
+    spvtools::Optimizer optimizer(kSpirvEnvironment);
+    optimizer.SetMessageConsumer([result](spv_message_level_t, const char *, const spv_position_t &, const char *message) {
+        result->messages.emplace_back(message);
+    });
+    optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
+    optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
+    std::vector<uint32_t> specialized_spirv;
+    if (!optimizer.Run(module.data(), module.size(), &specialized_spirv, spvtools::ValidatorOptions(), true)) {
+        result->skip = true;
+        return;
+    }
+
+    spv_context ctx = spvContextCreate(kSpirvEnvironment);
+    spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
+    spv_diagnostic diag = nullptr;
+    spvtools::ValidatorOptions options;
+    if (spvValidateWithOptions(ctx, options, &binary, &diag) != SPV_SUCCESS) {
+        result->messages.emplace_back(diag && diag->error ? diag->error : "Invalid SPIR-V");
+        result->skip = true;
+    }
+    spvDiagnosticDestroy(diag);
+    spvContextDestroy(ctx);
+}
+
+// Stands in for logging a stage's messages, returning what was reported
+size_t Report(const StageResult &result) { return result.messages.size() + (result.skip ? 1 : 0); }
+
+// A vkCreateComputePipelines of pipeline_count pipelines specializing the same shader, every eighth of them a broken one
+class PipelineBatch {
+  public:
+    PipelineBatch(uint32_t pipeline_count, uint32_t op_count)
+        : pipeline_count_(pipeline_count),
+          module_(AssembleShader(op_count, false)),
+          broken_module_(AssembleShader(op_count, true)),
+          pool_(std::max(std::thread::hardware_concurrency(), 2u) - 1) {}
+
+    // Each stage validated and reported in turn, as without parallel_pipeline_validation
+    size_t ValidateSequential() const {
+        size_t reported = 0;
+        for (uint32_t i = 0; i < pipeline_count_; ++i) {
+            StageResult result;
+            ValidateSpecializedStage(Module(i), i + 1, &result);
+            reported += Report(result);
+        }
+        return reported;
+    }
+
+    // The stages validated on the worker pool, which only collects their results, then reported in pipeline order
+    size_t ValidateParallel() {
+        std::vector<StageResult> results(pipeline_count_);
+        pool_.ParallelFor(pipeline_count_, [this, &results](size_t i) {
+            ValidateSpecializedStage(Module(i), static_cast<uint32_t>(i) + 1, &results[i]);
+        });
+        size_t reported = 0;
+        for (const auto &result : results) reported += Report(result);
+        return reported;
+    }
+
+  private:
+    const std::vector<uint32_t> &Module(size_t i) const { return i % 8 == 7 ? broken_module_ : module_; }
+
+    uint32_t pipeline_count_;
+    std::vector<uint32_t> module_;
+    std::vector<uint32_t> broken_module_;
+    WorkerPool pool_;
+};
+
+}  // namespace
+
+// Shader stage validation of a batch of specialized compute pipelines of 2000 instructions each, per pipeline. The parallel
+// path only gains with more than one core; on a single core it shows the cost of the pool and the collected results.
+VL_BENCHMARK(PipelineBatchValidation) {
+    for (uint32_t pipeline_count : {8u, 64u}) {
+        PipelineBatch batch(pipeline_count, 2000);
+        const std::string suffix = "/" + std::to_string(pipeline_count) + "_pipelines";
+        run.Time("sequential" + suffix, pipeline_count, [&]() { benchmark::DoNotOptimize(batch.ValidateSequential()); });
+        run.Time("parallel" + suffix, pipeline_count, [&]() { benchmark::DoNotOptimize(batch.ValidateParallel()); });
+        if (batch.ValidateSequential() != batch.ValidateParallel()) {
+            run.Note("check" + suffix, "the paths reported different results");
+        }
+    }
+}
@@ -0,0 +1,114 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "benchmark.h"
+#include "vk_layer_data.h"
+
+namespace {
+
+// Stands in for VkBaseOutStructure, with sTypes spread like extension structure types
+struct ChainNode {
+    int sType;
+    const ChainNode *pNext;
+};
+
+std::vector<ChainNode> MakeChain(uint32_t length) {
+    std::vector<ChainNode> chain(length);
+    for (uint32_t i = 0; i < length; ++i) {
+        chain[i].sType = 1000000000 + static_cast<int>(i) * 1000;
+        chain[i].pNext = (i + 1 < length) ? &chain[i + 1] : nullptr;
+    }
+    return chain;
+}
+
+// How validate_struct_pnext used to track the pNext pointers and sTypes it has seen
+struct HashSets {
+    template <typename T>
+    using Set = std::unordered_set<T>;
+    template <typename T>
+    static bool Contains(const Set<T> &set, const T &value) {
+        return set.find(value) != set.end();
+    }
+    template <typename T>
+    static void Insert(Set<T> &set, const T &value) {
+        set.insert(value);
+    }
+};
+
+// How it tracks them now
+struct InlineVectors {
+    template <typename T>
+    using Set = small_vector<T, 16>;
+    template <typename T>
+    static bool Contains(const Set<T> &set, const T &value) {
+        return std::find(set.begin(), set.end(), value) != set.end();
+    }
+    template <typename T>
+    static void Insert(Set<T> &set, const T &value) {
+        set.emplace_back(value);
+    }
+};
+
+// The cycle and duplicate sType checks of StatelessValidation::validate_struct_pnext. Returns the number of problems found.
+template <typename Tracking>
+uint32_t CheckChain(const ChainNode *next) {
+    typename Tracking::template Set<const ChainNode *> cycle_check;
+    typename Tracking::template Set<int> unique_stype_check;
+    uint32_t problems = 0;
+    Tracking::Insert(cycle_check, next);
+    for (const ChainNode *current = next; current != nullptr; current = current->pNext) {
+        if (Tracking::Contains(cycle_check, current->pNext)) {
+            ++problems;
+            break;
+        }
+        Tracking::Insert(cycle_check, current->pNext);
+        if (Tracking::Contains(unique_stype_check, current->sType)) {
+            ++problems;
+        } else {
+            Tracking::Insert(unique_stype_check, current->sType);
+        }
+    }
+    return problems;
+}
+
+}  // namespace
+
+// Chain checking with the hash sets validate_struct_pnext used before and the inline vectors it uses now, for chains up to
+// and past the 16 entries kept inline
+VL_BENCHMARK(PNextChain) {
+    const uint32_t chains_per_run = 10000;
+    for (uint32_t length : {1u, 4u, 16u, 32u}) {
+        const auto chain = MakeChain(length);
+        const std::string suffix = "/" + std::to_string(length) + "_structs";
+        run.Time("unordered_set" + suffix, chains_per_run, [&]() {
+            for (uint32_t i = 0; i < chains_per_run; ++i) {
+                benchmark::DoNotOptimize(CheckChain<HashSets>(chain.data()));
+            }
+        });
+        run.Time("small_vector" + suffix, chains_per_run, [&]() {
+            for (uint32_t i = 0; i < chains_per_run; ++i) {
+                benchmark::DoNotOptimize(CheckChain<InlineVectors>(chain.data()));
+            }
+        });
+    }
+}
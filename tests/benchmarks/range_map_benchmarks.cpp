@@ -0,0 +1,136 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.h"
+#include "range_vector.h"
+
+namespace {
+
+using Range = sparse_container::range<uint64_t>;
+using TreeMap = sparse_container::range_map<uint64_t, uint64_t>;
+using PooledTreeMap = sparse_container::pooled_range_map<uint64_t, uint64_t>;
+
+const uint64_t kRangeSize = 16;
+
+template <typename Map>
+void Populate(Map &map, uint64_t range_count) {
+    for (uint64_t i = 0; i < range_count; ++i) {
+        map.overwrite_range(std::make_pair(Range(i * kRangeSize, (i + 1) * kRangeSize), i));
+    }
+}
+
+template <typename Map>
+uint64_t Lookup(const Map &map, uint64_t range_count, uint64_t lookup_count) {
+    uint64_t sum = 0;
+    const uint64_t limit = range_count * kRangeSize;
+    for (uint64_t i = 0; i < lookup_count; ++i) {
+        const uint64_t index = (i * 7919) % limit;
+        sum += map.lower_bound(Range(index, index + 1))->second;
+    }
+    return sum;
+}
+
+// The lifecycle of an image layout map: populated with a few ranges, queried, and discarded with its command buffer. The
+// pool of pooled maps is reset between runs, as on command buffer reset.
+template <typename Map>
+void TimeMap(benchmark::Run &run, const std::string &label, const typename Map::allocator_type &allocator,
+             sparse_container::node_pool *pool) {
+    const uint32_t map_count = 256;
+    for (uint64_t range_count : {4u, 64u}) {
+        const std::string suffix = "/" + std::to_string(range_count) + "_ranges";
+        std::vector<Map> maps;
+        maps.reserve(map_count);
+        auto reset = [&]() {
+            maps.clear();
+            if (pool) pool->reset();
+        };
+        auto populate = [&]() {
+            for (uint32_t i = 0; i < map_count; ++i) {
+                maps.emplace_back(allocator);
+                Populate(maps.back(), range_count);
+            }
+        };
+        run.Time(label + "/populate" + suffix, map_count, reset, populate);
+        run.Time(label + "/lookup" + suffix, map_count * range_count, [&]() {
+            uint64_t sum = 0;
+            for (const auto &map : maps) sum += Lookup(map, range_count, range_count);
+            benchmark::DoNotOptimize(sum);
+        });
+
+        // Walks each map against one with every boundary shifted by half a range, as when validating against a global map.
+        // That one outlives the pool resets below, so it is heap allocated.
+        Map shifted;
+        for (uint64_t i = 0; i < range_count; ++i) {
+            const uint64_t begin = i * kRangeSize + kRangeSize / 2;
+            shifted.overwrite_range(std::make_pair(Range(begin, begin + kRangeSize), i));
+        }
+        run.Time(label + "/parallel_iterator" + suffix, map_count * range_count * 2, [&]() {
+            uint64_t sum = 0;
+            for (const auto &map : maps) {
+                sparse_container::parallel_iterator<const Map> it(map, shifted, 0);
+                for (; it->range.non_empty(); ++it) {
+                    if (it->pos_A->valid) sum += it->pos_A->lower_bound->second;
+                    if (it->pos_B->valid) sum += it->pos_B->lower_bound->second;
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        });
+
+        // Splits every range in half, doubling the entries of each map
+        run.Time(label + "/split" + suffix, map_count * range_count,
+                 [&]() {
+                     reset();
+                     populate();
+                 },
+                 [&]() {
+                     for (auto &map : maps) {
+                         for (auto it = map.begin(); it != map.end(); ++it) {
+                             it = sparse_container::split(it, map, Range(it->first.begin + kRangeSize / 2, it->first.end));
+                         }
+                     }
+                 });
+
+        std::vector<Map> moved;
+        moved.reserve(map_count);
+        run.Time(label + "/move" + suffix, map_count,
+                 [&]() {
+                     moved.clear();
+                     reset();
+                     populate();
+                 },
+                 [&]() {
+                     for (auto &map : maps) moved.emplace_back(std::move(map));
+                 });
+        moved.clear();
+        reset();
+    }
+}
+
+}  // namespace
+
+// range_map backends for image layout maps, with and without a node_pool
+VL_BENCHMARK(RangeMap) {
+    sparse_container::node_pool pool;
+    TimeMap<TreeMap>(run, "std_map", TreeMap::allocator_type(), nullptr);
+    TimeMap<PooledTreeMap>(run, "pooled_std_map", PooledTreeMap::allocator_type(&pool), &pool);
+}
@@ -0,0 +1,103 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "shader_validation.h"
+#include "spirv-tools/libspirv.hpp"
+
+namespace {
+
+const spv_target_env kSpirvEnvironment = SPV_ENV_VULKAN_1_0;
+
+// A compute shader summing variable_count decorated private variables, each initialized with its own constant. About half
+// of the ids below the bound have a def that is tracked, the others are loads and results of arithmetic.
+std::vector<uint32_t> AssembleShader(uint32_t variable_count) {
+    std::string text =
+        "OpCapability Shader\n"
+        "OpMemoryModel Logical GLSL450\n"
+        "OpEntryPoint GLCompute %main \"main\"\n"
+        "OpExecutionMode %main LocalSize 1 1 1\n";
+    for (uint32_t i = 1; i <= variable_count; ++i) text += "OpDecorate %p" + std::to_string(i) + " RelaxedPrecision\n";
+    text +=
+        "%void = OpTypeVoid\n"
+        "%void_fn = OpTypeFunction %void\n"
+        "%uint = OpTypeInt 32 0\n"
+        "%uint_ptr = OpTypePointer Private %uint\n";
+    for (uint32_t i = 1; i <= variable_count; ++i) {
+        const std::string n = std::to_string(i);
+        text += "%c" + n + " = OpConstant %uint " + n + "\n%p" + n + " = OpVariable %uint_ptr Private %c" + n + "\n";
+    }
+    text +=
+        "%main = OpFunction %void None %void_fn\n"
+        "%entry = OpLabel\n"
+        "%x0 = OpLoad %uint %p1\n";
+    for (uint32_t i = 1; i <= variable_count; ++i) {
+        const std::string n = std::to_string(i);
+        text += "%l" + n + " = OpLoad %uint %p" + n + "\n%x" + n + " = OpIAdd %uint %x" + std::to_string(i - 1) + " %l" + n + "\n";
+    }
+    text += "OpStore %p1 %x" + std::to_string(variable_count) + "\nOpReturn\nOpFunctionEnd\n";
+
+    std::vector<uint32_t> binary;
+    spvtools::SpirvTools tools(kSpirvEnvironment);
+    tools.Assemble(text, &binary);
+    return binary;
+}
+
+}  // namespace
+
+// Creating the SHADER_MODULE_STATE of a shader module, which indexes its defs and decorations, and looking up defs in it, per
+// id below the bound of the module. Type walks jump between related ids, so the lookups visit the ids in a scattered order.
+VL_BENCHMARK(SpirvDefIndex) {
+    for (uint32_t variable_count : {64u, 1024u, 16384u}) {
+        const std::vector<uint32_t> code = AssembleShader(variable_count);
+        if (code.size() < 5) {
+            run.Note("assemble", "the shader failed to assemble");
+            return;
+        }
+        VkShaderModuleCreateInfo create_info = {};
+        create_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        create_info.codeSize = code.size() * sizeof(uint32_t);
+        create_info.pCode = code.data();
+        const uint32_t bound = code[3];
+        const std::string suffix = "/" + std::to_string(bound) + "_ids";
+
+        std::unique_ptr<SHADER_MODULE_STATE> module;
+        run.Time("build" + suffix, bound, [&]() { module.reset(); },
+                 [&]() { module.reset(new SHADER_MODULE_STATE(&create_info, VK_NULL_HANDLE, kSpirvEnvironment, 0)); });
+
+        std::vector<uint32_t> lookups;
+        uint32_t x = 12345;
+        for (uint32_t i = 0; i < bound; ++i) {
+            x = x * 1103515245 + 12345;
+            lookups.push_back(1 + (x >> 8) % (bound - 1));
+        }
+        run.Time("get_def" + suffix, lookups.size(), [&]() {
+            uint32_t sum = 0;
+            for (uint32_t id : lookups) {
+                auto def = module->get_def(id);
+                sum += def.offset();
+            }
+            benchmark::DoNotOptimize(sum);
+        });
+    }
+}
@@ -14117,3 +14117,382 @@ TEST_F(VkSyncValTest, SyncLayoutTransition) {
                            &full_subresource_range);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(VkSyncValTest, SyncSubmitHazards) {
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+
+    VkBufferCopy region = {0, 0, 256};
+
+    // Both command buffers write buffer_b, with nothing ordering the second copy after the first
+    VkCommandBufferObj cb_first(m_device, m_commandPool);
+    VkCommandBufferObj cb_second(m_device, m_commandPool);
+    cb_first.begin();
+    vk::CmdCopyBuffer(cb_first.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb_first.end();
+    cb_second.begin();
+    vk::CmdCopyBuffer(cb_second.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb_second.end();
+
+    VkCommandBuffer command_buffers[2] = {cb_first.handle(), cb_second.handle()};
+    auto submit_info = lvl_init_struct<VkSubmitInfo>();
+    submit_info.commandBufferCount = 2;
+    submit_info.pCommandBuffers = command_buffers;
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE_AFTER_WRITE");
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+    vk::QueueWaitIdle(m_device->m_queue);
+
+    // A barrier at the start of the second command buffer orders it after the first
+    cb_second.begin();
+    auto buffer_barrier = lvl_init_struct<VkBufferMemoryBarrier>();
+    buffer_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    buffer_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    buffer_barrier.buffer = buffer_b.handle();
+    buffer_barrier.offset = 0;
+    buffer_barrier.size = 256;
+    vk::CmdPipelineBarrier(cb_second.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1,
+                           &buffer_barrier, 0, nullptr);
+    vk::CmdCopyBuffer(cb_second.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb_second.end();
+
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    vk::QueueWaitIdle(m_device->m_queue);
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkLayerTest, LongPNextChainDuplicateAndCycle) {
+    TEST_DESCRIPTION(
+        "Chain more structures than the pNext checks keep inline, and check that a duplicate structure type and a cycle past that "
+        "point are still found.");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        printf("%s VK_KHR_get_physical_device_properties2 requires Vulkan 1.1+, skipping test\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    // Distinct structure types allowed in VkPhysicalDeviceProperties2. The calls below fail validation and are not passed
+    // down, but each node is still large enough for any of these structures.
+    const VkStructureType stypes[] = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES_EXT,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES,
+                                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES};
+    const uint32_t stype_count = sizeof(stypes) / sizeof(stypes[0]);
+    struct ChainNode {
+        VkBaseOutStructure header;
+        uint8_t payload[1024];
+    };
+    std::vector<ChainNode> chain(stype_count + 1);
+    for (uint32_t i = 0; i < stype_count; ++i) {
+        chain[i] = {};
+        chain[i].header.sType = stypes[i];
+        chain[i].header.pNext = &chain[i + 1].header;
+    }
+
+    VkPhysicalDeviceProperties2 properties2 = {};
+    properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties2.pNext = &chain[0];
+
+    // The last structure repeats the type of the first
+    chain[stype_count] = {};
+    chain[stype_count].header.sType = stypes[0];
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkPhysicalDeviceProperties2-sType-unique");
+    vk::GetPhysicalDeviceProperties2(gpu(), &properties2);
+    m_errorMonitor->VerifyFound();
+
+    // The last structure points back into the middle of the chain
+    chain[stype_count - 1].header.pNext = &chain[stype_count / 2].header;
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-GeneralParameterError-InvalidStructPNext");
+    vk::GetPhysicalDeviceProperties2(gpu(), &properties2);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkLayerTest, QueueSubmitParallelImageLayoutMismatch) {
+    TEST_DESCRIPTION("Submit command buffers expecting wrong image layouts with parallel image layout validation.");
+
+    const char *enables = "VALIDATION_CHECK_ENABLE_PARALLEL_IMAGE_LAYOUT_VALIDATION";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = enables;
+    enables_value.arrayString.count = strlen(enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &enables_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &enables_setting));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    const uint32_t cb_count = 8;
+    const VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    // Init leaves the images in VK_IMAGE_LAYOUT_GENERAL
+    VkImageObj shared_image(m_device);
+    shared_image.Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, usage, VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(shared_image.initialized());
+    std::vector<std::unique_ptr<VkImageObj>> images;
+    std::vector<std::unique_ptr<VkCommandBufferObj>> command_buffers;
+    std::vector<VkCommandBuffer> handles;
+    for (uint32_t i = 0; i < cb_count; ++i) {
+        images.emplace_back(new VkImageObj(m_device));
+        images.back()->Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, usage, VK_IMAGE_TILING_OPTIMAL, 0);
+        ASSERT_TRUE(images.back()->initialized());
+        command_buffers.emplace_back(new VkCommandBufferObj(m_device, m_commandPool));
+        handles.push_back(command_buffers.back()->handle());
+    }
+
+    auto transition = [](VkCommandBufferObj *cb, VkImage image, VkImageLayout old_layout, VkImageLayout new_layout) {
+        VkImageMemoryBarrier barrier = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER};
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.oldLayout = old_layout;
+        barrier.newLayout = new_layout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        vk::CmdPipelineBarrier(cb->handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                               nullptr, 1, &barrier);
+    };
+
+    const uint32_t stale_cb = 5;
+    for (uint32_t i = 0; i < cb_count; ++i) {
+        VkCommandBufferObj *cb = command_buffers[i].get();
+        cb->begin();
+        // Only compared with the global layouts, and wrong in every other command buffer
+        const VkImageLayout own_layout = (i % 2) ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_GENERAL;
+        transition(cb, images[i]->handle(), own_layout, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+        // The first command buffer changes the shared image's layout. The others correctly expect the new layout, which
+        // doesn't match the global layout, except for one that still expects the layout from before the change.
+        if (i == 0 || i == stale_cb) {
+            transition(cb, shared_image.handle(), VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        } else {
+            transition(cb, shared_image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        }
+        cb->end();
+    }
+
+    for (uint32_t i = 1; i < cb_count; i += 2) {
+        m_errorMonitor->SetDesiredFailureMsg(
+            kErrorBit, "to be in layout VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL--instead, current layout is VK_IMAGE_LAYOUT_GENERAL");
+    }
+    m_errorMonitor->SetDesiredFailureMsg(
+        kErrorBit, "to be in layout VK_IMAGE_LAYOUT_GENERAL--instead, current layout is VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL");
+    VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    submit_info.commandBufferCount = cb_count;
+    submit_info.pCommandBuffers = handles.data();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+}
+
+// A queue other than the device's default queue that supports buffer copies, or null if the device has none
+static vk_testing::Queue *GetOtherTransferQueue(VkDeviceObj *device) {
+    const VkQueueFlags copy_flags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+    for (uint32_t family = 0; family < device->queue_props.size(); ++family) {
+        if (!(device->queue_props[family].queueFlags & copy_flags)) continue;
+        for (const auto &queue : device->queue_family_queues(family)) {
+            if (queue->handle() != device->m_queue) return queue.get();
+        }
+    }
+    return nullptr;
+}
+
+TEST_F(VkSyncValTest, SyncSubmitSemaphoreHazards) {
+    TEST_DESCRIPTION("Check that a semaphore wait orders work on another queue only within its destination access scope.");
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    vk_testing::Queue *other_queue = GetOtherTransferQueue(m_device);
+    if (!other_queue) {
+        printf("%s Test requires a second queue, skipping.\n", kSkipPrefix);
+        return;
+    }
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkBufferObj buffer_c;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_c.init_as_src_and_dst(*m_device, 256, mem_prop);
+    VkBufferCopy region = {0, 0, 256};
+
+    // The signaling command buffer writes buffer_b and buffer_c, the waiting ones one of them each
+    VkCommandPoolObj other_pool(m_device, other_queue->get_family_index());
+    VkCommandBufferObj cb_signal(m_device, m_commandPool);
+    VkCommandBufferObj cb_wait_b(m_device, &other_pool);
+    VkCommandBufferObj cb_wait_c(m_device, &other_pool);
+    cb_signal.begin();
+    vk::CmdCopyBuffer(cb_signal.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    vk::CmdCopyBuffer(cb_signal.handle(), buffer_a.handle(), buffer_c.handle(), 1, &region);
+    cb_signal.end();
+    cb_wait_b.begin();
+    vk::CmdCopyBuffer(cb_wait_b.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb_wait_b.end();
+    cb_wait_c.begin();
+    vk::CmdCopyBuffer(cb_wait_c.handle(), buffer_a.handle(), buffer_c.handle(), 1, &region);
+    cb_wait_c.end();
+
+    vk_testing::Semaphore semaphore;
+    semaphore.init(*m_device, vk_testing::Semaphore::create_info(0));
+    const VkSemaphore semaphore_handle = semaphore.handle();
+
+    auto signal_submit = lvl_init_struct<VkSubmitInfo>();
+    signal_submit.commandBufferCount = 1;
+    signal_submit.pCommandBuffers = &cb_signal.handle();
+    signal_submit.signalSemaphoreCount = 1;
+    signal_submit.pSignalSemaphores = &semaphore_handle;
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(m_device->m_queue, 1, &signal_submit, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyNotFound();
+
+    // The top of pipe stage has no access scope, so the wait does not make the signaled write visible to the copy
+    VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    auto wait_submit = lvl_init_struct<VkSubmitInfo>();
+    wait_submit.waitSemaphoreCount = 1;
+    wait_submit.pWaitSemaphores = &semaphore_handle;
+    wait_submit.pWaitDstStageMask = &wait_stage;
+    wait_submit.commandBufferCount = 1;
+    wait_submit.pCommandBuffers = &cb_wait_b.handle();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE_AFTER_WRITE");
+    vk::QueueSubmit(other_queue->handle(), 1, &wait_submit, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+
+    // Waiting at the transfer stage orders the copy after the signaled write
+    wait_stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(other_queue->handle(), 1, &wait_submit, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyNotFound();
+
+    // The wait imported all the signaled accesses, not only those of the buffer the waiting command buffer copied to
+    auto later_submit = lvl_init_struct<VkSubmitInfo>();
+    later_submit.commandBufferCount = 1;
+    later_submit.pCommandBuffers = &cb_wait_c.handle();
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(other_queue->handle(), 1, &later_submit, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyNotFound();
+
+    vk::DeviceWaitIdle(m_device->device());
+}
+
+TEST_F(VkSyncValTest, SyncSubmitFenceHazards) {
+    TEST_DESCRIPTION("Check that waiting for a fence retires the accesses of the work it was submitted with.");
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    VkBufferCopy region = {0, 0, 256};
+
+    VkCommandBufferObj cb_first(m_device, m_commandPool);
+    VkCommandBufferObj cb_second(m_device, m_commandPool);
+    cb_first.begin();
+    vk::CmdCopyBuffer(cb_first.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb_first.end();
+    cb_second.begin();
+    vk::CmdCopyBuffer(cb_second.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb_second.end();
+
+    vk_testing::Fence fence;
+    fence.init(*m_device, vk_testing::Fence::create_info());
+    const VkFence fence_handle = fence.handle();
+
+    auto first_submit = lvl_init_struct<VkSubmitInfo>();
+    first_submit.commandBufferCount = 1;
+    first_submit.pCommandBuffers = &cb_first.handle();
+    auto second_submit = lvl_init_struct<VkSubmitInfo>();
+    second_submit.commandBufferCount = 1;
+    second_submit.pCommandBuffers = &cb_second.handle();
+
+    // Without waiting for the fence, the first copy is still pending when the second is submitted
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(m_device->m_queue, 1, &first_submit, fence_handle);
+    m_errorMonitor->VerifyNotFound();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE_AFTER_WRITE");
+    vk::QueueSubmit(m_device->m_queue, 1, &second_submit, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->ExpectSuccess();
+    vk::WaitForFences(m_device->device(), 1, &fence_handle, VK_TRUE, UINT64_MAX);
+    vk::QueueSubmit(m_device->m_queue, 1, &second_submit, VK_NULL_HANDLE);
+    vk::QueueWaitIdle(m_device->m_queue);
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkSyncValTest, SyncSubmitCrossQueueHazards) {
+    TEST_DESCRIPTION("Check that work on two queues accessing the same buffer without synchronization is reported.");
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    vk_testing::Queue *other_queue = GetOtherTransferQueue(m_device);
+    if (!other_queue) {
+        printf("%s Test requires a second queue, skipping.\n", kSkipPrefix);
+        return;
+    }
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    VkBufferCopy region = {0, 0, 256};
+
+    VkCommandPoolObj other_pool(m_device, other_queue->get_family_index());
+    VkCommandBufferObj cb_first(m_device, m_commandPool);
+    VkCommandBufferObj cb_other(m_device, &other_pool);
+    cb_first.begin();
+    vk::CmdCopyBuffer(cb_first.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb_first.end();
+    cb_other.begin();
+    vk::CmdCopyBuffer(cb_other.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb_other.end();
+
+    vk_testing::Fence fence;
+    fence.init(*m_device, vk_testing::Fence::create_info());
+    const VkFence fence_handle = fence.handle();
+
+    auto first_submit = lvl_init_struct<VkSubmitInfo>();
+    first_submit.commandBufferCount = 1;
+    first_submit.pCommandBuffers = &cb_first.handle();
+    auto other_submit = lvl_init_struct<VkSubmitInfo>();
+    other_submit.commandBufferCount = 1;
+    other_submit.pCommandBuffers = &cb_other.handle();
+
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(m_device->m_queue, 1, &first_submit, fence_handle);
+    m_errorMonitor->VerifyNotFound();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "with work submitted to");
+    vk::QueueSubmit(other_queue->handle(), 1, &other_submit, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+
+    // Once the fence is waited for, the copy on the default queue is complete and no longer races the other queue
+    m_errorMonitor->ExpectSuccess();
+    vk::WaitForFences(m_device->device(), 1, &fence_handle, VK_TRUE, UINT64_MAX);
+    vk::QueueSubmit(other_queue->handle(), 1, &other_submit, VK_NULL_HANDLE);
+    vk::DeviceWaitIdle(m_device->device());
+    m_errorMonitor->VerifyNotFound();
+}
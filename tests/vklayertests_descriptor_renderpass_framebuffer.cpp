@@ -8245,3 +8245,365 @@ TEST_F(VkLayerTest, ImageSubresourceOverlapBetweenAttachmentsAndDescriptorSets)
     m_commandBuffer->EndRenderPass();
     m_commandBuffer->end();
 }
+
+TEST_F(VkLayerTest, ResetDescriptorPoolSetsNotUpdated) {
+    TEST_DESCRIPTION("Dispatch with a set allocated after resetting its pool, without updating it.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    const char *cs_source =
+        "#version 450\n"
+        "layout(local_size_x = 1) in;\n"
+        "layout(set = 0, binding = 0) uniform ubo { vec4 x; };\n"
+        "layout(set = 0, binding = 1) buffer ssbo { vec4 y; };\n"
+        "void main() { y = x; }\n";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                          {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe.cs_.reset(new VkShaderObj(m_device, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, this));
+    pipe.InitState();
+    pipe.CreateComputePipeline();
+
+    // Without VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, so that resetting the pool reuses its set state memory
+    const uint32_t set_count = 16;
+    VkDescriptorPoolSize pool_sizes[2] = {{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, set_count},
+                                          {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, set_count}};
+    auto pool_ci = lvl_init_struct<VkDescriptorPoolCreateInfo>();
+    pool_ci.maxSets = set_count;
+    pool_ci.poolSizeCount = 2;
+    pool_ci.pPoolSizes = pool_sizes;
+    VkDescriptorPool pool;
+    ASSERT_VK_SUCCESS(vk::CreateDescriptorPool(device(), &pool_ci, nullptr, &pool));
+
+    VkBufferObj uniform_buffer;
+    uniform_buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkBufferObj storage_buffer;
+    storage_buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    VkDescriptorBufferInfo buffer_infos[2] = {{uniform_buffer.handle(), 0, VK_WHOLE_SIZE},
+                                              {storage_buffer.handle(), 0, VK_WHOLE_SIZE}};
+
+    std::vector<VkDescriptorSetLayout> layouts(set_count, pipe.descriptor_set_->layout_.handle());
+    std::vector<VkDescriptorSet> sets(set_count, VK_NULL_HANDLE);
+    auto alloc_info = lvl_init_struct<VkDescriptorSetAllocateInfo>();
+    alloc_info.descriptorPool = pool;
+    alloc_info.descriptorSetCount = set_count;
+    alloc_info.pSetLayouts = layouts.data();
+
+    // Fully updated sets validate cleanly
+    m_errorMonitor->ExpectSuccess();
+    ASSERT_VK_SUCCESS(vk::AllocateDescriptorSets(device(), &alloc_info, sets.data()));
+    std::vector<VkWriteDescriptorSet> writes;
+    for (uint32_t i = 0; i < set_count; ++i) {
+        for (uint32_t binding = 0; binding < 2; ++binding) {
+            auto write = lvl_init_struct<VkWriteDescriptorSet>();
+            write.dstSet = sets[i];
+            write.dstBinding = binding;
+            write.descriptorCount = 1;
+            write.descriptorType = binding ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            write.pBufferInfo = &buffer_infos[binding];
+            writes.push_back(write);
+        }
+    }
+    vk::UpdateDescriptorSets(device(), static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                              &sets[set_count - 1], 0, nullptr);
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyNotFound();
+
+    // The sets allocated after the reset take over the memory of the updated ones, but must still start out not updated
+    vk::ResetDescriptorPool(device(), pool, 0);
+    ASSERT_VK_SUCCESS(vk::AllocateDescriptorSets(device(), &alloc_info, sets.data()));
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                              &sets[set_count - 1], 0, nullptr);
+    // Once for each binding
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-DescriptorSetNotUpdated");
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-DescriptorSetNotUpdated");
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+
+    vk::DestroyDescriptorPool(device(), pool, nullptr);
+}
+
+TEST_F(VkLayerTest, DrawWithAttachmentInLargeSampledImageArray) {
+    TEST_DESCRIPTION("Draw with the color attachment, and a view overlapping it, deep inside combined image sampler arrays.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+    const uint32_t descriptor_count = 32;
+    if (m_device->props.limits.maxPerStageDescriptorSamplers < 2 * descriptor_count ||
+        m_device->props.limits.maxPerStageDescriptorSampledImages < 2 * descriptor_count) {
+        printf("%s Not enough sampled image descriptors per stage, skipping test\n", kSkipPrefix);
+        return;
+    }
+
+    // Layer 0 is the color attachment, layer 1 is only sampled
+    const VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    VkImageObj image(m_device);
+    auto image_ci = VkImageObj::ImageCreateInfo2D(64, 64, 1, 2, format,
+                                                  VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                                                  VK_IMAGE_TILING_OPTIMAL);
+    image.Init(image_ci);
+    ASSERT_TRUE(image.initialized());
+    image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+
+    VkImageViewCreateInfo view_ci = SafeSaneImageViewCreateInfo(image, format, VK_IMAGE_ASPECT_COLOR_BIT);
+    view_ci.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    vk_testing::ImageView attachment_view;
+    attachment_view.init(*m_device, view_ci);
+    view_ci.subresourceRange.baseArrayLayer = 1;
+    vk_testing::ImageView sampled_view;
+    sampled_view.init(*m_device, view_ci);
+    // Both layers, so this view overlaps the attachment without being the same view
+    view_ci.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 2};
+    view_ci.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    vk_testing::ImageView overlap_view;
+    overlap_view.init(*m_device, view_ci);
+    view_ci.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 1, 1};
+    vk_testing::ImageView sampled_array_view;
+    sampled_array_view.init(*m_device, view_ci);
+
+    VkAttachmentDescription attachment = {0u,
+                                          format,
+                                          VK_SAMPLE_COUNT_1_BIT,
+                                          VK_ATTACHMENT_LOAD_OP_LOAD,
+                                          VK_ATTACHMENT_STORE_OP_STORE,
+                                          VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+                                          VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                                          VK_IMAGE_LAYOUT_GENERAL,
+                                          VK_IMAGE_LAYOUT_GENERAL};
+    VkAttachmentReference color_ref = {0, VK_IMAGE_LAYOUT_GENERAL};
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &color_ref;
+    auto rp_ci = lvl_init_struct<VkRenderPassCreateInfo>();
+    rp_ci.attachmentCount = 1;
+    rp_ci.pAttachments = &attachment;
+    rp_ci.subpassCount = 1;
+    rp_ci.pSubpasses = &subpass;
+    VkRenderPass rp;
+    ASSERT_VK_SUCCESS(vk::CreateRenderPass(device(), &rp_ci, nullptr, &rp));
+
+    VkImageView fb_attachment = attachment_view.handle();
+    auto fb_ci = lvl_init_struct<VkFramebufferCreateInfo>();
+    fb_ci.renderPass = rp;
+    fb_ci.attachmentCount = 1;
+    fb_ci.pAttachments = &fb_attachment;
+    fb_ci.width = 64;
+    fb_ci.height = 64;
+    fb_ci.layers = 1;
+    VkFramebuffer fb;
+    ASSERT_VK_SUCCESS(vk::CreateFramebuffer(device(), &fb_ci, nullptr, &fb));
+
+    vk_testing::Sampler sampler;
+    sampler.init(*m_device, SafeSaneSamplerCreateInfo());
+
+    char const *fsSource =
+        "#version 450\n"
+        "layout(set=0, binding=0) uniform sampler2D s0[32];\n"
+        "layout(set=0, binding=1) uniform sampler2DArray s1[32];\n"
+        "layout(location=0) out vec4 x;\n"
+        "void main(){\n"
+        "   x = vec4(0);\n"
+        "   for (int i = 0; i < 32; ++i) x += texture(s0[i], vec2(1)) + texture(s1[i], vec3(1));\n"
+        "}\n";
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.dsl_bindings_ = {
+        {0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr},
+        {1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}};
+    pipe.gp_ci_.renderPass = rp;
+    pipe.InitState();
+    ASSERT_VK_SUCCESS(pipe.CreateGraphicsPipeline());
+
+    // Only the last element of binding 0 is the attachment itself, and only one element in the middle of binding 1 overlaps it
+    const uint32_t overlap_index = 20;
+    std::vector<VkDescriptorImageInfo> image_infos[2];
+    image_infos[0].assign(descriptor_count, {sampler.handle(), sampled_view.handle(), VK_IMAGE_LAYOUT_GENERAL});
+    image_infos[0][descriptor_count - 1].imageView = attachment_view.handle();
+    image_infos[1].assign(descriptor_count, {sampler.handle(), sampled_array_view.handle(), VK_IMAGE_LAYOUT_GENERAL});
+    image_infos[1][overlap_index].imageView = overlap_view.handle();
+    VkWriteDescriptorSet writes[2];
+    for (uint32_t binding = 0; binding < 2; ++binding) {
+        writes[binding] = lvl_init_struct<VkWriteDescriptorSet>();
+        writes[binding].dstSet = pipe.descriptor_set_->set_;
+        writes[binding].dstBinding = binding;
+        writes[binding].descriptorCount = descriptor_count;
+        writes[binding].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        writes[binding].pImageInfo = image_infos[binding].data();
+    }
+    vk::UpdateDescriptorSets(device(), 2, writes, 0, nullptr);
+
+    m_commandBuffer->begin();
+    m_renderPassBeginInfo.renderArea = {{0, 0}, {64, 64}};
+    m_renderPassBeginInfo.renderPass = rp;
+    m_renderPassBeginInfo.framebuffer = fb;
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                              &pipe.descriptor_set_->set_, 0, nullptr);
+
+    // Each binding's error names the offending element
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Descriptor in binding #0 index 31 and");
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Descriptor in binding #1 index 20 and");
+    vk::CmdDraw(m_commandBuffer->handle(), 1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+
+    vk::DestroyFramebuffer(device(), fb, nullptr);
+    vk::DestroyRenderPass(device(), rp, nullptr);
+}
+
+TEST_F(VkLayerTest, LazyDescriptorBindingUpdateAfterBindSamplerInUseDestroyed) {
+    TEST_DESCRIPTION(
+        "With lazy descriptor binding, update an update-after-bind sampler array after recording a draw with it, submit, and "
+        "destroy a sampler of the update while it is in flight.");
+
+    if (InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
+        m_instance_extension_names.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+    } else {
+        printf("%s %s Extension not supported, skipping tests\n", kSkipPrefix,
+               VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+        return;
+    }
+    const char *enables = "VALIDATION_CHECK_ENABLE_LAZY_DESCRIPTOR_BINDING";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = enables;
+    enables_value.arrayString.count = strlen(enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &enables_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &enables_setting));
+    if (DeviceExtensionSupported(gpu(), nullptr, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME) &&
+        DeviceExtensionSupported(gpu(), nullptr, VK_KHR_MAINTENANCE3_EXTENSION_NAME)) {
+        m_device_extension_names.push_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+        m_device_extension_names.push_back(VK_KHR_MAINTENANCE3_EXTENSION_NAME);
+    } else {
+        printf("%s Descriptor Indexing or Maintenance3 Extension not supported, skipping tests\n", kSkipPrefix);
+        return;
+    }
+
+    PFN_vkGetPhysicalDeviceFeatures2KHR vkGetPhysicalDeviceFeatures2KHR =
+        (PFN_vkGetPhysicalDeviceFeatures2KHR)vk::GetInstanceProcAddr(instance(), "vkGetPhysicalDeviceFeatures2KHR");
+    ASSERT_TRUE(vkGetPhysicalDeviceFeatures2KHR != nullptr);
+    PFN_vkGetPhysicalDeviceProperties2KHR vkGetPhysicalDeviceProperties2KHR =
+        (PFN_vkGetPhysicalDeviceProperties2KHR)vk::GetInstanceProcAddr(instance(), "vkGetPhysicalDeviceProperties2KHR");
+    ASSERT_TRUE(vkGetPhysicalDeviceProperties2KHR != nullptr);
+
+    auto indexing_features = lvl_init_struct<VkPhysicalDeviceDescriptorIndexingFeaturesEXT>();
+    auto features2 = lvl_init_struct<VkPhysicalDeviceFeatures2KHR>(&indexing_features);
+    vkGetPhysicalDeviceFeatures2KHR(gpu(), &features2);
+    if (VK_FALSE == indexing_features.descriptorBindingSampledImageUpdateAfterBind) {
+        printf("%s Test requires (unsupported) descriptorBindingSampledImageUpdateAfterBind, skipping\n", kSkipPrefix);
+        return;
+    }
+
+    // One more than the default lazy descriptor binding threshold, s.t. the array's resources are bound at submit
+    const uint32_t descriptor_count = 179;
+    auto indexing_props = lvl_init_struct<VkPhysicalDeviceDescriptorIndexingPropertiesEXT>();
+    auto props2 = lvl_init_struct<VkPhysicalDeviceProperties2KHR>(&indexing_props);
+    vkGetPhysicalDeviceProperties2KHR(gpu(), &props2);
+    if (indexing_props.maxPerStageDescriptorUpdateAfterBindSamplers < descriptor_count ||
+        indexing_props.maxPerStageDescriptorUpdateAfterBindSampledImages < descriptor_count ||
+        indexing_props.maxDescriptorSetUpdateAfterBindSamplers < descriptor_count ||
+        indexing_props.maxDescriptorSetUpdateAfterBindSampledImages < descriptor_count ||
+        indexing_props.maxPerStageUpdateAfterBindResources < descriptor_count) {
+        printf("%s Not enough update-after-bind sampled image descriptors per stage, skipping test\n", kSkipPrefix);
+        return;
+    }
+
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &features2));
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(image.initialized());
+    image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    VkImageView view = image.targetView(VK_FORMAT_R8G8B8A8_UNORM);
+
+    VkSamplerCreateInfo sampler_ci = SafeSaneSamplerCreateInfo();
+    VkSampler recorded_sampler;
+    ASSERT_VK_SUCCESS(vk::CreateSampler(m_device->device(), &sampler_ci, nullptr, &recorded_sampler));
+    VkSampler updated_sampler;
+    ASSERT_VK_SUCCESS(vk::CreateSampler(m_device->device(), &sampler_ci, nullptr, &updated_sampler));
+
+    const VkDescriptorBindingFlagsEXT binding_flags = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT;
+    auto flags_create_info = lvl_init_struct<VkDescriptorSetLayoutBindingFlagsCreateInfoEXT>();
+    flags_create_info.bindingCount = 1;
+    flags_create_info.pBindingFlags = &binding_flags;
+    OneOffDescriptorSet descriptor_set(
+        m_device, {{0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}},
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT, &flags_create_info,
+        VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT);
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&descriptor_set.layout_});
+
+    std::vector<VkDescriptorImageInfo> image_infos(descriptor_count,
+                                                   {recorded_sampler, view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL});
+    auto descriptor_write = lvl_init_struct<VkWriteDescriptorSet>();
+    descriptor_write.dstSet = descriptor_set.set_;
+    descriptor_write.dstBinding = 0;
+    descriptor_write.descriptorCount = descriptor_count;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    descriptor_write.pImageInfo = image_infos.data();
+    vk::UpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, nullptr);
+
+    const std::string count = std::to_string(descriptor_count);
+    const std::string fsSource = "#version 450\n"
+                                 "layout(set=0, binding=0) uniform sampler2D s[" + count + "];\n"
+                                 "layout(location=0) out vec4 x;\n"
+                                 "void main(){\n"
+                                 "   x = vec4(0);\n"
+                                 "   for (int i = 0; i < " + count + "; ++i) x += texture(s[i], vec2(1));\n"
+                                 "}\n";
+    VkShaderObj vs(m_device, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource.c_str(), VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddDefaultColorAttachment();
+    pipe.CreateVKPipeline(pipeline_layout.handle(), renderPass());
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    VkViewport viewport = {0, 0, 16, 16, 0, 1};
+    VkRect2D scissor = {{0, 0}, {16, 16}};
+    vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &viewport);
+    vk::CmdSetScissor(m_commandBuffer->handle(), 0, 1, &scissor);
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+
+    // An update-after-bind update doesn't invalidate the command buffer, which executes with the updated sampler
+    for (auto &image_info : image_infos) image_info.sampler = updated_sampler;
+    vk::UpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, nullptr);
+
+    VkSubmitInfo submit_info = lvl_init_struct<VkSubmitInfo>();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkDestroySampler-sampler-01082");
+    vk::DestroySampler(m_device->device(), updated_sampler, nullptr);
+    m_errorMonitor->VerifyFound();
+    vk::QueueWaitIdle(m_device->m_queue);
+
+    m_errorMonitor->SetUnexpectedError("If sampler is not VK_NULL_HANDLE, sampler must be a valid VkSampler handle");
+    m_errorMonitor->SetUnexpectedError("Unable to remove Sampler obj");
+    vk::DestroySampler(m_device->device(), updated_sampler, nullptr);
+    vk::DestroySampler(m_device->device(), recorded_sampler, nullptr);
+}
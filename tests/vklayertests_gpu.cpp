@@ -1947,3 +1947,107 @@ TEST_F(VkDebugPrintfTest, MeshTaskShadersPrintf) {
     ASSERT_VK_SUCCESS(err);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(VkGpuAssistedLayerTest, GpuValidationDeferredResults) {
+    TEST_DESCRIPTION(
+        "GPU validation: with deferred results, verify that an out-of-bounds descriptor index is reported once the queue is "
+        "idle, or once the command buffer is reset.");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    VkValidationFeatureEnableEXT enables[] = {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT};
+    VkValidationFeatureDisableEXT disables[] = {
+        VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+        VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT, VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT};
+    VkValidationFeaturesEXT features = {};
+    features.sType = VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT;
+    features.enabledValidationFeatureCount = 1;
+    features.disabledValidationFeatureCount = 4;
+    features.pEnabledValidationFeatures = enables;
+    features.pDisabledValidationFeatures = disables;
+
+    const char *deferred_enables = "VALIDATION_CHECK_ENABLE_GPU_DEFERRED_RESULTS";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = deferred_enables;
+    enables_value.arrayString.count = strlen(deferred_enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), &features, 1,
+                                       &enables_setting_val};
+    InitFramework(m_errorMonitor, &enables_setting);
+
+    if (IsPlatform(kMockICD) || DeviceSimulation()) {
+        printf("%s GPU-Assisted validation test requires a driver that can draw.\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        printf("%s GPU-Assisted validation test requires Vulkan 1.1+.\n", kSkipPrefix);
+        return;
+    }
+    auto c_queue = m_device->GetDefaultComputeQueue();
+    if (!c_queue || (c_queue->handle() != m_device->m_queue)) {
+        printf("%s Test requires the default queue to support compute.\n", kSkipPrefix);
+        return;
+    }
+
+    VkMemoryPropertyFlags mem_props = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    VkBufferObj index_buffer;
+    index_buffer.init(*m_device, sizeof(uint32_t), mem_props, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkBufferObj storage_buffer;
+    storage_buffer.init(*m_device, 4 * sizeof(uint32_t), mem_props, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    char const *csSource =
+        "#version 450\n"
+        "layout(set = 0, binding = 0) uniform ufoo { uint index; } u_index;\n"
+        "layout(set = 0, binding = 1) buffer StorageBuffer { uint data; } Data[6];\n"
+        "void main() {\n"
+        "   Data[u_index.index].data = 0;\n"
+        "}\n";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                          {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 6, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe.cs_.reset(new VkShaderObj(m_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this));
+    pipe.InitState();
+    pipe.CreateComputePipeline();
+    pipe.descriptor_set_->WriteDescriptorBufferInfo(0, index_buffer.handle(), sizeof(uint32_t));
+    pipe.descriptor_set_->WriteDescriptorBufferInfo(1, storage_buffer.handle(), 4 * sizeof(uint32_t),
+                                                    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 6);
+    pipe.descriptor_set_->UpdateDescriptorSets();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                              &pipe.descriptor_set_->set_, 0, nullptr);
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    uint32_t *data = (uint32_t *)index_buffer.memory().map();
+    data[0] = 25;
+    index_buffer.memory().unmap();
+
+    vk_testing::Fence fence;
+    fence.init(*m_device, vk_testing::Fence::create_info());
+    const VkFence fence_handle = fence.handle();
+    auto submit_info = lvl_init_struct<VkSubmitInfo>();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+
+    // The submit returns without waiting for the results, which the queue wait idle then reports
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyNotFound();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Index of 25 used to index descriptor array of length 6.");
+    vk::QueueWaitIdle(m_device->m_queue);
+    m_errorMonitor->VerifyFound();
+
+    // The application's fence may signal before the layer's. Either the fence wait or, at the latest, the reset of the command
+    // buffer reports the results.
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, fence_handle);
+    m_errorMonitor->VerifyNotFound();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Index of 25 used to index descriptor array of length 6.");
+    vk::WaitForFences(m_device->device(), 1, &fence_handle, VK_TRUE, UINT64_MAX);
+    m_commandBuffer->reset();
+    m_errorMonitor->VerifyFound();
+}
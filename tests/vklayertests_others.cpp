@@ -24,6 +24,9 @@
  * Author: John Zulauf <jzulauf@lunarg.com>
  */
 
+#include <chrono>
+#include <thread>
+
 #include "cast_utils.h"
 #include "layer_validation_tests.h"
 
@@ -103,6 +106,25 @@ class DuplicateMsgLimit {
     VkLayerSettingsEXT limit_setting;
 };
 
+class AsyncMsgDelivery {
+  public:
+    AsyncMsgDelivery() {
+        async_value.valueBool = VK_TRUE;
+
+        strncpy(async_setting_val.name, "async_message_delivery", sizeof(async_setting_val.name));
+        async_setting_val.type = VK_LAYER_SETTING_VALUE_TYPE_BOOL_EXT;
+        async_setting_val.data = async_value;
+        async_setting = {static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                         &async_setting_val};
+    }
+    VkLayerSettingsEXT *pnext{&async_setting};
+
+  private:
+    VkLayerSettingValueDataEXT async_value{};
+    VkLayerSettingValueEXT async_setting_val;
+    VkLayerSettingsEXT async_setting;
+};
+
 TEST_F(VkLayerTest, VersionCheckPromotedAPIs) {
     TEST_DESCRIPTION("Validate that promoted APIs are not valid in old versions.");
     SetTargetApiVersion(VK_API_VERSION_1_0);
@@ -10714,3 +10736,201 @@ TEST_F(VkLayerTest, ValidateExtendedDynamicStateEnabledNoMultiview) {
 
     commandBuffer.end();
 }
+
+TEST_F(VkLayerTest, AsyncMessageDelivery) {
+    TEST_DESCRIPTION(
+        "Deliver messages asynchronously to a messenger whose callback calls back into the layer, and destroy the messenger while "
+        "messages for it are still queued.");
+
+    if (InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) &&
+        InstanceExtensionSupported(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)) {
+        m_instance_extension_names.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+        m_instance_extension_names.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    } else {
+        printf("%s %s or %s Extension not supported, skipping tests\n", kSkipPrefix,
+               VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+        return;
+    }
+
+    auto async_setting = AsyncMsgDelivery();
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, async_setting.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    PFN_vkGetPhysicalDeviceProperties2KHR vkGetPhysicalDeviceProperties2KHR =
+        (PFN_vkGetPhysicalDeviceProperties2KHR)vk::GetInstanceProcAddr(instance(), "vkGetPhysicalDeviceProperties2KHR");
+    ASSERT_TRUE(vkGetPhysicalDeviceProperties2KHR != nullptr);
+    PFN_vkSetDebugUtilsObjectNameEXT fpvkSetDebugUtilsObjectNameEXT =
+        (PFN_vkSetDebugUtilsObjectNameEXT)vk::GetInstanceProcAddr(instance(), "vkSetDebugUtilsObjectNameEXT");
+    ASSERT_TRUE(fpvkSetDebugUtilsObjectNameEXT);
+    PFN_vkCreateDebugUtilsMessengerEXT fpvkCreateDebugUtilsMessengerEXT =
+        (PFN_vkCreateDebugUtilsMessengerEXT)vk::GetInstanceProcAddr(instance(), "vkCreateDebugUtilsMessengerEXT");
+    ASSERT_TRUE(fpvkCreateDebugUtilsMessengerEXT);
+    PFN_vkDestroyDebugUtilsMessengerEXT fpvkDestroyDebugUtilsMessengerEXT =
+        (PFN_vkDestroyDebugUtilsMessengerEXT)vk::GetInstanceProcAddr(instance(), "vkDestroyDebugUtilsMessengerEXT");
+    ASSERT_TRUE(fpvkDestroyDebugUtilsMessengerEXT);
+
+    // The callback is slow, so that messages queue up behind it, and names the device, which takes the lock the layer holds
+    // while reporting a message
+    const std::thread::id test_thread = std::this_thread::get_id();
+    bool delivered_on_test_thread = false;
+    const std::string device_name = "async_device";
+    auto name_info = lvl_init_struct<VkDebugUtilsObjectNameInfoEXT>();
+    name_info.objectType = VK_OBJECT_TYPE_DEVICE;
+    name_info.objectHandle = reinterpret_cast<uint64_t>(device());
+    name_info.pObjectName = device_name.c_str();
+
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.count = 0;
+    callback_data.callback = [&](const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData, DebugUtilsLabelCheckData *data) {
+        if (std::this_thread::get_id() == test_thread) delivered_on_test_thread = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        fpvkSetDebugUtilsObjectNameEXT(device(), &name_info);
+        data->count++;
+    };
+
+    auto callback_create_info = lvl_init_struct<VkDebugUtilsMessengerCreateInfoEXT>();
+    callback_create_info.messageSeverity =
+        VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT;
+    callback_create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    callback_create_info.pfnUserCallback = DebugUtilsCallback;
+    callback_create_info.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(fpvkCreateDebugUtilsMessengerEXT(instance(), &callback_create_info, nullptr, &messenger));
+
+    // An unknown pNext structure is reported, but harmless if the call still goes down the chain, as it does with async
+    // delivery
+    VkBaseOutStructure bogus_struct{};
+    bogus_struct.sType = static_cast<VkStructureType>(0x33333333);
+    auto properties2 = lvl_init_struct<VkPhysicalDeviceProperties2KHR>(&bogus_struct);
+
+    const size_t message_count = 64;
+    for (size_t i = 0; i < message_count; ++i) {
+        m_errorMonitor->SetDesiredFailureMsg((kErrorBit | kWarningBit), "VUID-VkPhysicalDeviceProperties2-pNext-pNext");
+    }
+    for (size_t i = 0; i < message_count; ++i) {
+        vkGetPhysicalDeviceProperties2KHR(gpu(), &properties2);
+    }
+
+    // Destroying the messenger delivers the messages still queued for it before returning, without deadlocking against the
+    // callback
+    fpvkDestroyDebugUtilsMessengerEXT(instance(), messenger, nullptr);
+    ASSERT_EQ(message_count, callback_data.count);
+    ASSERT_FALSE(delivered_on_test_thread);
+
+    // vkDeviceWaitIdle flushes the messages to the error monitor
+    vk::DeviceWaitIdle(device());
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkLayerTest, UseStaleHandleAfterSlotReuse) {
+    TEST_DESCRIPTION("Use a destroyed event's handle after a new event took over its wrapped handle slot.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkEventCreateInfo event_ci = {VK_STRUCTURE_TYPE_EVENT_CREATE_INFO, nullptr, 0};
+    VkEvent stale_event = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateEvent(device(), &event_ci, nullptr, &stale_event));
+    vk::DestroyEvent(device(), stale_event, nullptr);
+    VkEvent event = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateEvent(device(), &event_ci, nullptr, &event));
+    ASSERT_NE(stale_event, event);
+
+    // The stale handle must not resolve to the event now in its slot
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkSetEvent-event-parameter");
+    vk::SetEvent(device(), stale_event);
+    m_errorMonitor->VerifyFound();
+
+    // Nor must a handle that only shares the new event's slot index
+    const auto forged_event = CastFromUint64<VkEvent>(CastToUint64(event) ^ (1ULL << 48));
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkSetEvent-event-parameter");
+    vk::SetEvent(device(), forged_event);
+    m_errorMonitor->VerifyFound();
+
+    ASSERT_EQ(VK_EVENT_RESET, vk::GetEventStatus(device(), event));
+    vk::DestroyEvent(device(), event, nullptr);
+}
+
+#if GTEST_IS_THREADSAFE
+TEST_F(VkLayerTest, ThreadCommandBufferLocalLockingInvalidation) {
+    TEST_DESCRIPTION(
+        "Record separate command buffers from multiple threads with command buffer local locking enabled, and check that an "
+        "object bound by both threads invalidates both command buffers when it is destroyed.");
+
+    const char *enables = "VALIDATION_CHECK_ENABLE_CMD_BUFFER_LOCAL_LOCKING";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = enables;
+    enables_value.arrayString.count = strlen(enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &enables_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &enables_setting));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    // Both command buffers bind the same event, so the event's command buffer bindings are updated concurrently
+    VkEventCreateInfo event_info = {};
+    event_info.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+    VkEvent event;
+    ASSERT_VK_SUCCESS(vk::CreateEvent(device(), &event_info, NULL, &event));
+
+    // Command pools are externally synchronized, so each thread records from its own pool
+    VkCommandPoolObj pool_a(m_device, m_device->graphics_queue_node_index_);
+    VkCommandPoolObj pool_b(m_device, m_device->graphics_queue_node_index_);
+    VkCommandBufferObj command_buffer_a(m_device, &pool_a);
+    VkCommandBufferObj command_buffer_b(m_device, &pool_b);
+    command_buffer_a.begin();
+    command_buffer_b.begin();
+
+    bool bailout = false;
+    struct thread_data_struct data_a = {};
+    data_a.commandBuffer = command_buffer_a.handle();
+    data_a.event = event;
+    data_a.bailout = &bailout;
+    struct thread_data_struct data_b = data_a;
+    data_b.commandBuffer = command_buffer_b.handle();
+
+    test_platform_thread thread;
+    test_platform_thread_create(&thread, AddToCommandBuffer, (void *)&data_a);
+    AddToCommandBuffer(&data_b);
+    test_platform_thread_join(thread, NULL);
+
+    command_buffer_a.end();
+    command_buffer_b.end();
+
+    // The event's bindings were updated under the striped binding locks rather than the object lock. Both command buffers
+    // must still be invalidated by destroying it.
+    vk::DestroyEvent(device(), event, NULL);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-InvalidCommandBuffer-VkEvent");
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-InvalidCommandBuffer-VkEvent");
+    VkCommandBuffer command_buffers[2] = {command_buffer_a.handle(), command_buffer_b.handle()};
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 2;
+    submit_info.pCommandBuffers = command_buffers;
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+}
+#endif  // GTEST_IS_THREADSAFE
+
+TEST_F(VkLayerTest, ShaderModuleMemoryStats) {
+    TEST_DESCRIPTION("Report the memory held by shader module state when a device is destroyed.");
+
+    const char *enables = "VALIDATION_CHECK_ENABLE_LAZY_SHADER_MODULES,VALIDATION_CHECK_ENABLE_SHADER_MODULE_STATS";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = enables;
+    enables_value.arrayString.count = strlen(enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &enables_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &enables_setting));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    {
+        // The report comes from vkDestroyDevice, so use a device the test can destroy
+        VkDeviceObj test_device(0, gpu());
+        VkShaderObj vs(&test_device, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT, this);
+        VkShaderObj fs(&test_device, bindStateFragShaderText, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+        m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "UNASSIGNED-Shader-Module-Memory-Stats");
+    }
+    m_errorMonitor->VerifyFound();
+}
+
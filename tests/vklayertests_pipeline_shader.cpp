@@ -8799,3 +8799,102 @@ TEST_F(VkLayerTest, ValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR) {
                                                       (ray_tracing_properties.shaderGroupHandleCaptureReplaySize - 1), &buffer);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(VkLayerTest, CreateComputePipelinesParallelStageErrors) {
+    TEST_DESCRIPTION(
+        "Create a batch of specialized compute pipelines whose shaders use a descriptor missing from the pipeline layout, with "
+        "parallel pipeline validation enabled, and check that each stage's error is reported once.");
+
+    const char *enables = "VALIDATION_CHECK_ENABLE_PARALLEL_PIPELINE_VALIDATION";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = enables;
+    enables_value.arrayString.count = strlen(enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &enables_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &enables_setting));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    char const *csSource =
+        "#version 450\n"
+        "layout(local_size_x=1) in;\n"
+        "layout(constant_id=0) const uint scale = 1;\n"
+        "layout(set=0, binding=0) buffer block { uint x; };\n"
+        "void main() {\n"
+        "   x *= scale;\n"
+        "}\n";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.dsl_bindings_ = {};
+    pipe.cs_.reset(new VkShaderObj(m_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this));
+    pipe.InitState();
+    pipe.LateBindPipelineInfo();
+
+    const uint32_t pipeline_count = 8;
+    const VkSpecializationMapEntry entry = {0, 0, sizeof(uint32_t)};
+    std::vector<uint32_t> scales(pipeline_count);
+    std::vector<VkSpecializationInfo> specialization_infos(pipeline_count);
+    std::vector<VkComputePipelineCreateInfo> create_infos(pipeline_count, pipe.cp_ci_);
+    for (uint32_t i = 0; i < pipeline_count; ++i) {
+        scales[i] = i + 1;
+        specialization_infos[i] = {1, &entry, sizeof(uint32_t), &scales[i]};
+        create_infos[i].stage.pSpecializationInfo = &specialization_infos[i];
+    }
+
+    // A stage validated on the workers must not be validated again by the per-pipeline checks
+    for (uint32_t i = 0; i < pipeline_count; ++i) {
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkComputePipelineCreateInfo-layout-00703");
+    }
+    std::vector<VkPipeline> pipelines(pipeline_count, VK_NULL_HANDLE);
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, pipeline_count, create_infos.data(), nullptr, pipelines.data());
+    m_errorMonitor->VerifyFound();
+
+    for (auto pipeline : pipelines) {
+        if (pipeline != VK_NULL_HANDLE) vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+}
+
+TEST_F(VkLayerTest, CreatePipelineVsFsTypeMismatchLazyShaderModules) {
+    TEST_DESCRIPTION(
+        "Test that shader modules parsed on first use still produce an error for mismatched types across the vertex->fragment "
+        "shader interface, both for the pipeline that parses them and for a later one.");
+
+    const char *enables = "VALIDATION_CHECK_ENABLE_LAZY_SHADER_MODULES";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = enables;
+    enables_value.arrayString.count = strlen(enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &enables_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &enables_setting));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    char const *vsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out int x;\n"
+        "void main(){\n"
+        "   x = 0;\n"
+        "   gl_Position = vec4(1);\n"
+        "}\n";
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) in float x;\n" /* VS writes int */
+        "layout(location=0) out vec4 color;\n"
+        "void main(){\n"
+        "   color = vec4(x);\n"
+        "}\n";
+
+    VkShaderObj vs(m_device, vsSource, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    const auto set_info = [&](CreatePipelineHelper &helper) {
+        helper.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    };
+    // The first pipeline parses the modules, the second finds them parsed
+    CreatePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "Type mismatch on location 0");
+    CreatePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "Type mismatch on location 0");
+}
@@ -10215,3 +10215,589 @@ TEST_F(VkPositiveLayerTest, AndroidHardwareBufferExportImage) {
 }
 
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
+
+#if GTEST_IS_THREADSAFE
+TEST_F(VkPositiveLayerTest, ThreadCommandBufferLocalLocking) {
+    TEST_DESCRIPTION("Record separate command buffers from multiple threads with command buffer local locking enabled.");
+
+    const char *enables = "VALIDATION_CHECK_ENABLE_CMD_BUFFER_LOCAL_LOCKING";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = enables;
+    enables_value.arrayString.count = strlen(enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &enables_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &enables_setting));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    m_errorMonitor->ExpectSuccess();
+
+    // Both command buffers bind the same event, so the event's command buffer bindings are updated concurrently
+    VkEventCreateInfo event_info = {};
+    event_info.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+    VkEvent event;
+    ASSERT_VK_SUCCESS(vk::CreateEvent(device(), &event_info, NULL, &event));
+
+    // Command pools are externally synchronized, so each thread records from its own pool
+    VkCommandPoolObj pool_a(m_device, m_device->graphics_queue_node_index_);
+    VkCommandPoolObj pool_b(m_device, m_device->graphics_queue_node_index_);
+    VkCommandBufferObj command_buffer_a(m_device, &pool_a);
+    VkCommandBufferObj command_buffer_b(m_device, &pool_b);
+    command_buffer_a.begin();
+    command_buffer_b.begin();
+
+    bool bailout = false;
+    struct thread_data_struct data_a = {};
+    data_a.commandBuffer = command_buffer_a.handle();
+    data_a.event = event;
+    data_a.bailout = &bailout;
+    struct thread_data_struct data_b = data_a;
+    data_b.commandBuffer = command_buffer_b.handle();
+
+    test_platform_thread thread;
+    test_platform_thread_create(&thread, AddToCommandBuffer, (void *)&data_a);
+    AddToCommandBuffer(&data_b);
+    test_platform_thread_join(thread, NULL);
+
+    command_buffer_a.end();
+    command_buffer_b.end();
+    m_errorMonitor->VerifyNotFound();
+
+    vk::DestroyEvent(device(), event, NULL);
+}
+#endif  // GTEST_IS_THREADSAFE
+
+TEST_F(VkPositiveLayerTest, LazyShaderModules) {
+    TEST_DESCRIPTION("Create shader modules that are parsed on first use, and some that are never used by a pipeline.");
+
+    const char *enables = "VALIDATION_CHECK_ENABLE_LAZY_SHADER_MODULES";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = enables;
+    enables_value.arrayString.count = strlen(enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &enables_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &enables_setting));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    m_errorMonitor->ExpectSuccess();
+    VkShaderObj vs(m_device, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, bindStateFragShaderText, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    // Never used by a pipeline, so never parsed
+    VkShaderObj unused_fs(m_device, bindStateFragShaderText, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    // The first pipeline parses the modules, the second finds them parsed
+    for (int i = 0; i < 2; ++i) {
+        CreatePipelineHelper pipe(*this);
+        pipe.InitInfo();
+        pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+        pipe.InitState();
+        pipe.CreateGraphicsPipeline();
+    }
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkPositiveLayerTest, GroupDecoratedInterfacePrecision) {
+    TEST_DESCRIPTION(
+        "Match a vertex shader whose outputs get RelaxedPrecision from a decoration group against a fragment shader that "
+        "decorates its inputs one by one. The layer flattens the group into per-output decorations before indexing the "
+        "module, and an output that lost its RelaxedPrecision on the way would be reported as a precision mismatch.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    const uint32_t varying_count = 8;
+    std::string interface_ids, vs_group_targets, vs_locations, fs_decorations, vs_variables, fs_variables;
+    for (uint32_t i = 0; i < varying_count; ++i) {
+        const std::string n = std::to_string(i);
+        interface_ids += " %v" + n;
+        vs_group_targets += " %v" + n;
+        vs_locations += "OpDecorate %v" + n + " Location " + n + "\n";
+        fs_decorations += "OpDecorate %v" + n + " Location " + n + "\nOpDecorate %v" + n + " RelaxedPrecision\n";
+        vs_variables += "%v" + n + " = OpVariable %ptr_v4float Output\n";
+        fs_variables += "%v" + n + " = OpVariable %ptr_v4float Input\n";
+    }
+
+    const std::string vsSource = "OpCapability Shader\n"
+                                 "OpMemoryModel Logical GLSL450\n"
+                                 "OpEntryPoint Vertex %main \"main\"" +
+                                 interface_ids +
+                                 "\n"
+                                 "OpDecorate %relaxed RelaxedPrecision\n"
+                                 "%relaxed = OpDecorationGroup\n"
+                                 "OpGroupDecorate %relaxed" +
+                                 vs_group_targets + "\n" + vs_locations +
+                                 "%void = OpTypeVoid\n"
+                                 "%func = OpTypeFunction %void\n"
+                                 "%float = OpTypeFloat 32\n"
+                                 "%v4float = OpTypeVector %float 4\n"
+                                 "%ptr_v4float = OpTypePointer Output %v4float\n" +
+                                 vs_variables +
+                                 "%main = OpFunction %void None %func\n"
+                                 "%label = OpLabel\n"
+                                 "OpReturn\n"
+                                 "OpFunctionEnd\n";
+    const std::string fsSource = "OpCapability Shader\n"
+                                 "OpMemoryModel Logical GLSL450\n"
+                                 "OpEntryPoint Fragment %main \"main\" %color" +
+                                 interface_ids +
+                                 "\n"
+                                 "OpExecutionMode %main OriginUpperLeft\n"
+                                 "OpDecorate %color Location 0\n" +
+                                 fs_decorations +
+                                 "%void = OpTypeVoid\n"
+                                 "%func = OpTypeFunction %void\n"
+                                 "%float = OpTypeFloat 32\n"
+                                 "%v4float = OpTypeVector %float 4\n"
+                                 "%ptr_v4float = OpTypePointer Input %v4float\n"
+                                 "%ptr_color = OpTypePointer Output %v4float\n"
+                                 "%color = OpVariable %ptr_color Output\n" +
+                                 fs_variables +
+                                 "%main = OpFunction %void None %func\n"
+                                 "%label = OpLabel\n"
+                                 "%value = OpLoad %v4float %v0\n"
+                                 "OpStore %color %value\n"
+                                 "OpReturn\n"
+                                 "OpFunctionEnd\n";
+
+    m_errorMonitor->ExpectSuccess();
+    VkShaderObj vs(m_device, vsSource, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    // A lost group decoration shows up as a precision mismatch between the stages
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.InitState();
+    pipe.CreateGraphicsPipeline();
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkPositiveLayerTest, HandleWrappingReusesSlots) {
+    TEST_DESCRIPTION("Create objects after destroying others so that their wrapped handles reuse slots, and use all of them.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    m_errorMonitor->ExpectSuccess();
+    VkEventCreateInfo event_ci = {VK_STRUCTURE_TYPE_EVENT_CREATE_INFO, nullptr, 0};
+    const uint32_t event_count = 64;
+    std::vector<VkEvent> events(event_count, VK_NULL_HANDLE);
+    for (auto &event : events) {
+        vk::CreateEvent(device(), &event_ci, nullptr, &event);
+    }
+
+    // Destroy every other event and create new ones in their place
+    std::vector<VkEvent> destroyed;
+    for (uint32_t i = 0; i < event_count; i += 2) {
+        destroyed.push_back(events[i]);
+        vk::DestroyEvent(device(), events[i], nullptr);
+        vk::CreateEvent(device(), &event_ci, nullptr, &events[i]);
+    }
+    for (auto event : events) {
+        ASSERT_TRUE(std::find(destroyed.begin(), destroyed.end(), event) == destroyed.end());
+    }
+
+    for (auto event : events) {
+        vk::SetEvent(device(), event);
+        ASSERT_EQ(VK_EVENT_SET, vk::GetEventStatus(device(), event));
+        vk::DestroyEvent(device(), event, nullptr);
+    }
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkPositiveLayerTest, CreateComputePipelinesParallelSpecialization) {
+    TEST_DESCRIPTION("Create a batch of specialized compute pipelines with parallel pipeline validation enabled.");
+
+    const char *enables = "VALIDATION_CHECK_ENABLE_PARALLEL_PIPELINE_VALIDATION";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = enables;
+    enables_value.arrayString.count = strlen(enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &enables_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &enables_setting));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    char const *csSource =
+        "#version 450\n"
+        "layout(local_size_x=1) in;\n"
+        "layout(constant_id=0) const uint scale = 1;\n"
+        "layout(set=0, binding=0) buffer block { uint x; };\n"
+        "void main() {\n"
+        "   x *= scale;\n"
+        "}\n";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe.cs_.reset(new VkShaderObj(m_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this));
+    pipe.InitState();
+    pipe.LateBindPipelineInfo();
+
+    // Each pipeline gets its own specialization, so every stage is specialized and revalidated separately
+    const uint32_t pipeline_count = 32;
+    const VkSpecializationMapEntry entry = {0, 0, sizeof(uint32_t)};
+    std::vector<uint32_t> scales(pipeline_count);
+    std::vector<VkSpecializationInfo> specialization_infos(pipeline_count);
+    std::vector<VkComputePipelineCreateInfo> create_infos(pipeline_count, pipe.cp_ci_);
+    for (uint32_t i = 0; i < pipeline_count; ++i) {
+        scales[i] = i + 1;
+        specialization_infos[i] = {1, &entry, sizeof(uint32_t), &scales[i]};
+        create_infos[i].stage.pSpecializationInfo = &specialization_infos[i];
+    }
+
+    m_errorMonitor->ExpectSuccess();
+    std::vector<VkPipeline> pipelines(pipeline_count, VK_NULL_HANDLE);
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, pipeline_count, create_infos.data(), nullptr, pipelines.data());
+    m_errorMonitor->VerifyNotFound();
+
+    for (auto pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+}
+
+TEST_F(VkPositiveLayerTest, SuballocatedMemoryWithAliasingImages) {
+    TEST_DESCRIPTION("Bind aliasing images and many suballocated buffers to one memory object, then free it while still bound.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    auto image_create_info = lvl_init_struct<VkImageCreateInfo>();
+    image_create_info.flags = VK_IMAGE_CREATE_ALIAS_BIT;
+    image_create_info.imageType = VK_IMAGE_TYPE_2D;
+    image_create_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_create_info.extent = {32, 32, 1};
+    image_create_info.mipLevels = 1;
+    image_create_info.arrayLayers = 1;
+    image_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_create_info.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    image_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    auto buffer_create_info = lvl_init_struct<VkBufferCreateInfo>();
+    buffer_create_info.size = 256;
+    buffer_create_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    buffer_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    m_errorMonitor->ExpectSuccess();
+    VkImage images[2];
+    vk::CreateImage(device(), &image_create_info, nullptr, &images[0]);
+    vk::CreateImage(device(), &image_create_info, nullptr, &images[1]);
+    const uint32_t buffer_count = 64;
+    std::vector<VkBuffer> buffers(buffer_count, VK_NULL_HANDLE);
+    for (auto &buffer : buffers) {
+        vk::CreateBuffer(device(), &buffer_create_info, nullptr, &buffer);
+    }
+
+    VkMemoryRequirements image_reqs, buffer_reqs;
+    vk::GetImageMemoryRequirements(device(), images[0], &image_reqs);
+    vk::GetImageMemoryRequirements(device(), images[1], &image_reqs);
+    vk::GetBufferMemoryRequirements(device(), buffers[0], &buffer_reqs);
+    for (uint32_t i = 1; i < buffer_count; ++i) {
+        vk::GetBufferMemoryRequirements(device(), buffers[i], &buffer_reqs);
+    }
+
+    // The buffers are packed behind the images, past the buffer image granularity
+    auto align = [](VkDeviceSize value, VkDeviceSize alignment) { return ((value + alignment - 1) / alignment) * alignment; };
+    const VkDeviceSize granularity = std::max(m_device->props.limits.bufferImageGranularity, buffer_reqs.alignment);
+    const VkDeviceSize buffer_stride = align(buffer_reqs.size, buffer_reqs.alignment);
+    const VkDeviceSize buffer_base = align(image_reqs.size, granularity);
+    auto alloc_info = lvl_init_struct<VkMemoryAllocateInfo>();
+    alloc_info.allocationSize = buffer_base + buffer_stride * buffer_count;
+    if (!m_device->phy().set_memory_type(image_reqs.memoryTypeBits & buffer_reqs.memoryTypeBits, &alloc_info, 0)) {
+        printf("%s No memory type supports both images and buffers, skipping test\n", kSkipPrefix);
+        vk::DestroyImage(device(), images[0], nullptr);
+        vk::DestroyImage(device(), images[1], nullptr);
+        for (auto buffer : buffers) {
+            vk::DestroyBuffer(device(), buffer, nullptr);
+        }
+        return;
+    }
+    VkDeviceMemory memory;
+    vk::AllocateMemory(device(), &alloc_info, nullptr, &memory);
+
+    vk::BindImageMemory(device(), images[0], memory, 0);
+    for (uint32_t i = 0; i < buffer_count; ++i) {
+        vk::BindBufferMemory(device(), buffers[i], memory, buffer_base + buffer_stride * i);
+    }
+    vk::BindImageMemory(device(), images[1], memory, 0);
+
+    // Unbind half of the buffers before freeing the memory with the rest of the objects still bound to it
+    for (uint32_t i = 0; i < buffer_count; i += 2) {
+        vk::DestroyBuffer(device(), buffers[i], nullptr);
+    }
+    vk::DestroyImage(device(), images[0], nullptr);
+    vk::FreeMemory(device(), memory, nullptr);
+    vk::DestroyImage(device(), images[1], nullptr);
+    for (uint32_t i = 1; i < buffer_count; i += 2) {
+        vk::DestroyBuffer(device(), buffers[i], nullptr);
+    }
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkPositiveLayerTest, ResetDescriptorPoolReusesSetState) {
+    TEST_DESCRIPTION("Repeatedly fill a pool that can't free sets individually, update the sets, and reset the pool.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkDescriptorSetLayoutBinding dsl_bindings[2] = {
+        {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+        {1, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 4, VK_SHADER_STAGE_ALL, nullptr},
+    };
+    const VkDescriptorSetLayoutObj ds_layout(m_device, {dsl_bindings[0], dsl_bindings[1]});
+
+    const uint32_t set_count = 256;
+    VkDescriptorPoolSize pool_sizes[2] = {{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, set_count},
+                                          {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 4 * set_count}};
+    auto pool_ci = lvl_init_struct<VkDescriptorPoolCreateInfo>();
+    pool_ci.maxSets = set_count;
+    pool_ci.poolSizeCount = 2;
+    pool_ci.pPoolSizes = pool_sizes;
+    VkDescriptorPool pool;
+    vk::CreateDescriptorPool(device(), &pool_ci, nullptr, &pool);
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkDescriptorBufferInfo buffer_info = {buffer.handle(), 0, VK_WHOLE_SIZE};
+
+    m_errorMonitor->ExpectSuccess();
+    std::vector<VkDescriptorSetLayout> layouts(set_count, ds_layout.handle());
+    std::vector<VkDescriptorSet> sets(set_count, VK_NULL_HANDLE);
+    auto alloc_info = lvl_init_struct<VkDescriptorSetAllocateInfo>();
+    alloc_info.descriptorPool = pool;
+    alloc_info.descriptorSetCount = set_count;
+    alloc_info.pSetLayouts = layouts.data();
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        ASSERT_VK_SUCCESS(vk::AllocateDescriptorSets(device(), &alloc_info, sets.data()));
+        std::vector<VkWriteDescriptorSet> writes(set_count, lvl_init_struct<VkWriteDescriptorSet>());
+        for (uint32_t i = 0; i < set_count; ++i) {
+            writes[i].dstSet = sets[i];
+            writes[i].dstBinding = 0;
+            writes[i].descriptorCount = 1;
+            writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            writes[i].pBufferInfo = &buffer_info;
+        }
+        vk::UpdateDescriptorSets(device(), set_count, writes.data(), 0, nullptr);
+        vk::ResetDescriptorPool(device(), pool, 0);
+    }
+    vk::DestroyDescriptorPool(device(), pool, nullptr);
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkPositiveLayerTest, DrawWithLargeSampledImageArray) {
+    TEST_DESCRIPTION("Record many draws that use every element of a large combined image sampler array.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    const uint32_t descriptor_count = 64;
+    if (m_device->props.limits.maxPerStageDescriptorSamplers < descriptor_count ||
+        m_device->props.limits.maxPerStageDescriptorSampledImages < descriptor_count) {
+        printf("%s Not enough sampled image descriptors per stage, skipping test\n", kSkipPrefix);
+        return;
+    }
+
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(image.initialized());
+    image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    VkImageView view = image.targetView(VK_FORMAT_R8G8B8A8_UNORM);
+
+    VkSamplerCreateInfo sampler_ci = SafeSaneSamplerCreateInfo();
+    VkSampler sampler;
+    ASSERT_VK_SUCCESS(vk::CreateSampler(m_device->device(), &sampler_ci, nullptr, &sampler));
+
+    OneOffDescriptorSet descriptor_set(
+        m_device, {{0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    descriptor_set.WriteDescriptorImageInfo(0, view, sampler, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, descriptor_count);
+    descriptor_set.UpdateDescriptorSets();
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&descriptor_set.layout_});
+
+    char const *fsSource =
+        "#version 450\n"
+        "layout(set=0, binding=0) uniform sampler2D s[64];\n"
+        "layout(location=0) out vec4 x;\n"
+        "void main(){\n"
+        "   x = vec4(0);\n"
+        "   for (int i = 0; i < 64; ++i) x += texture(s[i], vec2(1));\n"
+        "}\n";
+    VkShaderObj vs(m_device, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddDefaultColorAttachment();
+    pipe.CreateVKPipeline(pipeline_layout.handle(), renderPass());
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    VkViewport viewport = {0, 0, 16, 16, 0, 1};
+    VkRect2D scissor = {{0, 0}, {16, 16}};
+    vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &viewport);
+    vk::CmdSetScissor(m_commandBuffer->handle(), 0, 1, &scissor);
+    for (uint32_t i = 0; i < 16; ++i) {
+        m_commandBuffer->Draw(1, 0, 0, 0);
+    }
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    vk::DestroySampler(m_device->device(), sampler, nullptr);
+}
+
+TEST_F(VkPositiveLayerTest, LazyDescriptorBindingLargeSampledImageArray) {
+    TEST_DESCRIPTION(
+        "Draw with a combined image sampler array above the default lazy descriptor binding threshold and submit twice.");
+
+    const char *enables = "VALIDATION_CHECK_ENABLE_LAZY_DESCRIPTOR_BINDING";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = enables;
+    enables_value.arrayString.count = strlen(enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &enables_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &enables_setting));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    // One more than the default threshold, s.t. the array's resources are bound at submit
+    const uint32_t descriptor_count = 179;
+    const auto &limits = m_device->props.limits;
+    if (limits.maxPerStageDescriptorSamplers < descriptor_count || limits.maxPerStageDescriptorSampledImages < descriptor_count ||
+        limits.maxDescriptorSetSamplers < descriptor_count || limits.maxDescriptorSetSampledImages < descriptor_count ||
+        limits.maxPerStageResources < descriptor_count) {
+        printf("%s Not enough sampled image descriptors per stage, skipping test\n", kSkipPrefix);
+        return;
+    }
+
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(image.initialized());
+    image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    VkImageView view = image.targetView(VK_FORMAT_R8G8B8A8_UNORM);
+
+    VkSamplerCreateInfo sampler_ci = SafeSaneSamplerCreateInfo();
+    VkSampler sampler;
+    ASSERT_VK_SUCCESS(vk::CreateSampler(m_device->device(), &sampler_ci, nullptr, &sampler));
+
+    OneOffDescriptorSet descriptor_set(
+        m_device, {{0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    descriptor_set.WriteDescriptorImageInfo(0, view, sampler, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, descriptor_count);
+    descriptor_set.UpdateDescriptorSets();
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&descriptor_set.layout_});
+
+    const std::string count = std::to_string(descriptor_count);
+    const std::string fsSource = "#version 450\n"
+                                 "layout(set=0, binding=0) uniform sampler2D s[" + count + "];\n"
+                                 "layout(location=0) out vec4 x;\n"
+                                 "void main(){\n"
+                                 "   x = vec4(0);\n"
+                                 "   for (int i = 0; i < " + count + "; ++i) x += texture(s[i], vec2(1));\n"
+                                 "}\n";
+    VkShaderObj vs(m_device, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource.c_str(), VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddDefaultColorAttachment();
+    pipe.CreateVKPipeline(pipeline_layout.handle(), renderPass());
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    VkViewport viewport = {0, 0, 16, 16, 0, 1};
+    VkRect2D scissor = {{0, 0}, {16, 16}};
+    vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &viewport);
+    vk::CmdSetScissor(m_commandBuffer->handle(), 0, 1, &scissor);
+    for (uint32_t i = 0; i < 16; ++i) {
+        m_commandBuffer->Draw(1, 0, 0, 0);
+    }
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+    // The first submit binds the array's resources to the command buffer, the second one finds them already bound
+    m_commandBuffer->QueueCommandBuffer();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    vk::DestroySampler(m_device->device(), sampler, nullptr);
+}
+
+TEST_F(VkPositiveLayerTest, QueueSubmitParallelImageLayoutValidation) {
+    TEST_DESCRIPTION("Submit command buffers that depend on each other's image layouts with parallel image layout validation.");
+
+    const char *enables = "VALIDATION_CHECK_ENABLE_PARALLEL_IMAGE_LAYOUT_VALIDATION";
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = enables;
+    enables_value.arrayString.count = strlen(enables);
+    VkLayerSettingValueEXT enables_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT enables_setting{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &enables_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &enables_setting));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    const uint32_t cb_count = 8;
+    const VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    // Init leaves the images in VK_IMAGE_LAYOUT_GENERAL
+    VkImageObj shared_image(m_device);
+    shared_image.Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, usage, VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(shared_image.initialized());
+    std::vector<std::unique_ptr<VkImageObj>> images;
+    std::vector<std::unique_ptr<VkCommandBufferObj>> command_buffers;
+    std::vector<VkCommandBuffer> handles;
+    for (uint32_t i = 0; i < cb_count; ++i) {
+        images.emplace_back(new VkImageObj(m_device));
+        images.back()->Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, usage, VK_IMAGE_TILING_OPTIMAL, 0);
+        ASSERT_TRUE(images.back()->initialized());
+        command_buffers.emplace_back(new VkCommandBufferObj(m_device, m_commandPool));
+        handles.push_back(command_buffers.back()->handle());
+    }
+
+    auto transition = [](VkCommandBufferObj *cb, VkImage image, VkImageLayout old_layout, VkImageLayout new_layout) {
+        VkImageMemoryBarrier barrier = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER};
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.oldLayout = old_layout;
+        barrier.newLayout = new_layout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        vk::CmdPipelineBarrier(cb->handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                               nullptr, 1, &barrier);
+    };
+
+    m_errorMonitor->ExpectSuccess();
+    for (uint32_t i = 0; i < cb_count; ++i) {
+        VkCommandBufferObj *cb = command_buffers[i].get();
+        cb->begin();
+        // Checked against the global layouts
+        transition(cb, images[i]->handle(), VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+        // The first command buffer changes the layout the others expect
+        if (i == 0) {
+            transition(cb, shared_image.handle(), VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        } else {
+            transition(cb, shared_image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        }
+        cb->end();
+    }
+
+    VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    submit_info.commandBufferCount = cb_count;
+    submit_info.pCommandBuffers = handles.data();
+    ASSERT_VK_SUCCESS(vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE));
+    ASSERT_VK_SUCCESS(vk::QueueWaitIdle(m_device->m_queue));
+    m_errorMonitor->VerifyNotFound();
+}